@@ -30,6 +30,7 @@ void arm_scmi_agent_execute(void *agent_info)
     uint32_t num_pass;
     uint32_t num_fail;
     uint32_t num_skip;
+    uint32_t num_timeout;
 
     val_print(VAL_PRINT_ERR, "\n\n        **** SCMI Compliance Suite **** ");
 
@@ -38,6 +39,9 @@ void arm_scmi_agent_execute(void *agent_info)
         return;
     }
 
+    /* The base walk finds the protocols of the agent */
+    val_discovery_initialize();
+
     val_print(VAL_PRINT_ERR, "\n\n          *** Starting BASE tests ***");
     val_base_execute_tests();
 
@@ -74,13 +78,20 @@ void arm_scmi_agent_execute(void *agent_info)
     num_pass = val_get_test_passed();
     num_fail = val_get_test_failed();
     num_skip = val_get_test_skipped();
+    num_timeout = val_get_test_timeout();
 
     val_print(VAL_PRINT_ERR, "\n****************************************************", 0);
-    val_print(VAL_PRINT_ERR, "\n  TOTAL TESTS: %d", num_pass + num_fail + num_skip);
+    val_print(VAL_PRINT_ERR, "\n  TOTAL TESTS: %d", num_pass + num_fail + num_skip + num_timeout);
     val_print(VAL_PRINT_ERR, "    PASSED: %d", num_pass);
     val_print(VAL_PRINT_ERR, "    FAILED: %d", num_fail);
     val_print(VAL_PRINT_ERR, "    SKIPPED: %d", num_skip);
+    if (num_timeout)
+        val_print(VAL_PRINT_ERR, "    TIMEOUT: %d", num_timeout);
     val_print(VAL_PRINT_ERR, "\n****************************************************", 0);
 
+    val_test_timing_report();
+    val_discovery_report();
+    val_latency_report();
+
     val_print(VAL_PRINT_ERR, "\n\n        **** SCMI tests complete **** \n ");
 }
@@ -0,0 +1,577 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include <time.h>
+#include "val_interface.h"
+#include "val_latency.h"
+#include "val_performance.h"
+
+#define BENCH_DEFAULT_ITERATIONS 10000
+#define BENCH_DEFAULT_WARMUP     100
+#define BENCH_SPIN_NS            50000 /* Spin rather than sleep this close to a send */
+#define BENCH_NS_PER_SEC         1000000000ull
+#define BENCH_NS_PER_US          1000
+#define BENCH_VISIBLE_SAMPLES    1000     /* Cap on fast-channel rate limit samples */
+#define BENCH_VISIBLE_TIMEOUT_NS 100000000 /* Give up on a fast-channel write after this */
+
+/* Exit status of a rejected command line, as for scmi_test_agent */
+#define APP_EXIT_BAD_ARGUMENTS   2
+
+typedef struct {
+    const char *name;
+    uint32_t protocol_id;
+    uint32_t msg_id;
+    uint32_t num_parameters;  /* Words in the channel for fast-channel commands */
+    bool fast_channel;
+} BENCH_COMMAND_s;
+
+typedef struct {
+    uint32_t iterations;
+    uint32_t warmup;
+    uint32_t rate;          /* Commands per second, 0 to send back to back */
+    uint32_t id;            /* Domain, clock or sensor identifier */
+    const char *commands;   /* Comma separated command names, NULL for all */
+} BENCH_CONFIG_s;
+
+static const BENCH_COMMAND_s g_bench_commands[] = {
+    {"perf_level_get",     PROTOCOL_PERFORMANCE,  PERFORMANCE_LEVEL_GET,  1, false},
+    {"perf_level_set",     PROTOCOL_PERFORMANCE,  PERFORMANCE_LEVEL_SET,  2, false},
+    {"clock_rate_get",     PROTOCOL_CLOCK,        CLOCK_RATE_GET,         1, false},
+    {"sensor_reading_get", PROTOCOL_SENSOR,       SENSOR_READING_GET,     2, false},
+    {"power_state_get",    PROTOCOL_POWER_DOMAIN, POWER_STATE_GET,        1, false},
+    {"fc_perf_level_get",  PROTOCOL_PERFORMANCE,  PERFORMANCE_LEVEL_GET,  1, true},
+    {"fc_perf_level_set",  PROTOCOL_PERFORMANCE,  PERFORMANCE_LEVEL_SET,  1, true},
+    {"fc_perf_limits_get", PROTOCOL_PERFORMANCE,  PERFORMANCE_LIMITS_GET, 2, true},
+    {"fc_perf_limits_set", PROTOCOL_PERFORMANCE,  PERFORMANCE_LIMITS_SET, 2, true},
+};
+
+/* Not a command of its own, measures when fast-channel level writes take effect */
+static const BENCH_COMMAND_s g_bench_rate_limit =
+    {"fc_rate_limit",      PROTOCOL_PERFORMANCE,  PERFORMANCE_LEVEL_SET,  1, true};
+
+/* Histogram of the command being run, reused across commands */
+static VAL_LATENCY_ENTRY_s g_bench_histogram;
+
+/* Samples of the histogram per completion mode, see pal_get_completion_mode() */
+static uint32_t g_bench_modes[PAL_COMPLETION_POLL + 1];
+
+/**
+  @brief   Waits until a point in time, sleeping for long gaps and spinning
+           for the last stretch so that sends stay on schedule
+  @param   deadline_ns  time to wait for
+  @return  none
+**/
+static void bench_wait_until(uint64_t deadline_ns)
+{
+    struct timespec delay;
+    uint64_t now;
+    uint64_t remaining;
+
+    while ((now = pal_get_time_ns()) < deadline_ns) {
+        remaining = deadline_ns - now;
+        if (remaining <= BENCH_SPIN_NS)
+            continue;
+
+        remaining -= BENCH_SPIN_NS;
+        delay.tv_sec = remaining / BENCH_NS_PER_SEC;
+        delay.tv_nsec = remaining % BENCH_NS_PER_SEC;
+        nanosleep(&delay, NULL);
+    }
+}
+
+/**
+  @brief   Checks whether a command was selected on the command line
+  @param   config   benchmark configuration
+  @param   command  command
+  @return  true if the command is to be run
+**/
+static bool bench_command_selected(const BENCH_CONFIG_s *config, const BENCH_COMMAND_s *command)
+{
+    const char *name = config->commands;
+    size_t length = strlen(command->name);
+
+    if (name == NULL)
+        return true;
+
+    while (*name != '\0') {
+        if ((strncmp(name, command->name, length) == 0) &&
+            ((name[length] == ',') || (name[length] == '\0')))
+            return true;
+
+        name = strchr(name, ',');
+        if (name == NULL)
+            break;
+        name++;
+    }
+
+    return false;
+}
+
+/**
+  @brief   Checks that every name of the --commands list is a benchmark
+  @param   commands  comma separated command names
+  @return  true if each name is in g_bench_commands or is g_bench_rate_limit
+**/
+static bool bench_commands_valid(const char *commands)
+{
+    const char *name = commands;
+    size_t length;
+    uint32_t i;
+    bool found;
+
+    while (1) {
+        length = strcspn(name, ",");
+        found = (length == strlen(g_bench_rate_limit.name)) &&
+                (strncmp(name, g_bench_rate_limit.name, length) == 0);
+        for (i = 0; !found && (i < NUM_ELEMS(g_bench_commands)); i++)
+            found = (length == strlen(g_bench_commands[i].name)) &&
+                    (strncmp(name, g_bench_commands[i].name, length) == 0);
+
+        if (!found) {
+            printf("\n **** UNKNOWN COMMAND %.*s ***\n", (int)length, name);
+            return false;
+        }
+
+        if (name[length] == '\0')
+            return true;
+        name += length + 1;
+    }
+}
+
+/**
+  @brief   Parses an option value that must be a whole number
+  @param   value   option value, decimal, or hexadecimal with a 0x prefix
+  @param   number  parsed number
+  @return  true when the value is a number and nothing follows it
+**/
+static bool bench_parse_number(const char *value, uint32_t *number)
+{
+    char *end;
+
+    if ((*value < '0') || (*value > '9'))
+        return false;
+    *number = strtoul(value, &end, 0);
+
+    return *end == '\0';
+}
+
+/**
+  @brief   Sends a performance GET command for the configured domain
+  @param   config         benchmark configuration
+  @param   message_id     PERFORMANCE_LEVEL_GET or PERFORMANCE_LIMITS_GET
+  @param   return_values  return value storage
+  @param   count          number of return values expected
+  @return  status
+**/
+static uint32_t bench_perf_get(const BENCH_CONFIG_s *config, uint32_t message_id,
+                               uint32_t *return_values, uint32_t count)
+{
+    uint32_t domain_id = config->id;
+    uint32_t rsp_msg_hdr;
+    size_t return_value_count;
+    int32_t status;
+
+    val_send_message(val_msg_hdr_create(PROTOCOL_PERFORMANCE, message_id, COMMAND_MSG),
+                     1, &domain_id, &rsp_msg_hdr, &status, &return_value_count, return_values);
+    if ((status != SCMI_SUCCESS) || (return_value_count < count))
+        return VAL_STATUS_FAIL;
+
+    return VAL_STATUS_PASS;
+}
+
+/**
+  @brief   Builds the parameters of a command. PERFORMANCE_LEVEL_SET and
+           PERFORMANCE_LIMITS_SET write back the current values so that the
+           benchmark leaves no trace.
+  @param   config      benchmark configuration
+  @param   command     command
+  @param   parameters  parameter storage
+  @return  status
+**/
+static uint32_t bench_prepare(const BENCH_CONFIG_s *config, const BENCH_COMMAND_s *command,
+                              uint32_t *parameters)
+{
+    uint32_t return_values[MAX_RETURNS_SIZE];
+
+    parameters[0] = config->id;
+    parameters[1] = 0; /* Synchronous sensor read */
+    parameters[2] = 0;
+
+    if (command->protocol_id != PROTOCOL_PERFORMANCE)
+        return VAL_STATUS_PASS;
+
+    if (command->msg_id == PERFORMANCE_LEVEL_SET) {
+        if (bench_perf_get(config, PERFORMANCE_LEVEL_GET, return_values, 1) != VAL_STATUS_PASS)
+            return VAL_STATUS_FAIL;
+        parameters[1] = return_values[PERFORMANCE_LEVEL_OFFSET];
+    } else if (command->msg_id == PERFORMANCE_LIMITS_SET) {
+        if (bench_perf_get(config, PERFORMANCE_LIMITS_GET, return_values, 2) != VAL_STATUS_PASS)
+            return VAL_STATUS_FAIL;
+        parameters[1] = return_values[RANGE_MAX_OFFSET];
+        parameters[2] = return_values[RANGE_MIN_OFFSET];
+    }
+
+    return VAL_STATUS_PASS;
+}
+
+/**
+  @brief   Issues one command, through the mailbox or its fast channel
+  @param   command       command
+  @param   fast_channel  fast channel of the command, if it has one
+  @param   parameters    parameters built by bench_prepare()
+  @return  true if the command succeeded
+**/
+static bool bench_issue(const BENCH_COMMAND_s *command, const VAL_FAST_CHANNEL_s *fast_channel,
+                        uint32_t *parameters)
+{
+    uint32_t return_values[MAX_RETURNS_SIZE];
+    uint32_t rsp_msg_hdr;
+    size_t return_value_count;
+    int32_t status;
+
+    if (command->fast_channel) {
+        /* Fast channels hold the parameters that follow the domain */
+        if ((command->msg_id == PERFORMANCE_LEVEL_SET) ||
+            (command->msg_id == PERFORMANCE_LIMITS_SET))
+            return val_fast_channel_write(fast_channel, parameters + 1,
+                                          command->num_parameters) == VAL_STATUS_PASS;
+        return val_fast_channel_read(fast_channel, return_values,
+                                     command->num_parameters) == VAL_STATUS_PASS;
+    }
+
+    val_send_message(val_msg_hdr_create(command->protocol_id, command->msg_id, COMMAND_MSG),
+                     command->num_parameters, parameters, &rsp_msg_hdr, &status,
+                     &return_value_count, return_values);
+    return status == SCMI_SUCCESS;
+}
+
+/**
+  @brief   Prints a result row out of the benchmark histogram
+  @param   name        row name
+  @param   operations  number of operations timed
+  @param   errors      number of failed operations
+  @param   elapsed     time taken by all operations in ns
+  @return  none
+**/
+static void bench_print_row(const char *name, uint32_t operations, uint32_t errors,
+                            uint64_t elapsed)
+{
+    if (elapsed == 0)
+        elapsed = 1;
+
+    printf("\n%-20s %10u %8u %12llu %10u %10u %10u %10u %10u", name, operations, errors,
+           (unsigned long long)((operations * BENCH_NS_PER_SEC) / elapsed),
+           val_latency_get_percentile(&g_bench_histogram, 500),
+           val_latency_get_percentile(&g_bench_histogram, 900),
+           val_latency_get_percentile(&g_bench_histogram, 990),
+           val_latency_get_percentile(&g_bench_histogram, 999),
+           g_bench_histogram.max);
+
+    /* Only transports with several completion modes tell them apart */
+    if (g_bench_modes[PAL_COMPLETION_INTERRUPT] || g_bench_modes[PAL_COMPLETION_POLL])
+        printf("  IRQ: %u  POLL: %u", g_bench_modes[PAL_COMPLETION_INTERRUPT],
+               g_bench_modes[PAL_COMPLETION_POLL]);
+}
+
+/**
+  @brief   Runs one command for the configured number of iterations and
+           prints its throughput and latency percentiles. With a rate, sends
+           follow an open-loop schedule and latency is measured from the
+           scheduled send time, so that a slow platform is not hidden by the
+           benchmark waiting for it.
+  @param   config   benchmark configuration
+  @param   command  command
+  @return  none
+**/
+static void bench_run_command(const BENCH_CONFIG_s *config, const BENCH_COMMAND_s *command)
+{
+    VAL_FAST_CHANNEL_s fast_channel;
+    uint32_t parameters[3];
+    uint64_t period_ns = config->rate ? (BENCH_NS_PER_SEC / config->rate) : 0;
+    uint64_t start, scheduled, elapsed;
+    uint32_t errors = 0;
+    uint32_t i;
+
+    if (bench_prepare(config, command, parameters) != VAL_STATUS_PASS) {
+        printf("\n%-20s NOT SUPPORTED", command->name);
+        return;
+    }
+
+    if (command->fast_channel &&
+        (val_fast_channel_open(config->id, command->msg_id, &fast_channel) != VAL_STATUS_PASS)) {
+        printf("\n%-20s NOT SUPPORTED", command->name);
+        return;
+    }
+
+    for (i = 0; i < config->warmup; i++)
+        bench_issue(command, &fast_channel, parameters);
+
+    memset(&g_bench_histogram, 0, sizeof(g_bench_histogram));
+    memset(g_bench_modes, 0, sizeof(g_bench_modes));
+    start = pal_get_time_ns();
+
+    for (i = 0; i < config->iterations; i++) {
+        if (period_ns) {
+            scheduled = start + (i * period_ns);
+            bench_wait_until(scheduled);
+        } else {
+            scheduled = pal_get_time_ns();
+        }
+
+        if (!bench_issue(command, &fast_channel, parameters))
+            errors++;
+        val_latency_histogram_add(&g_bench_histogram, pal_get_time_ns() - scheduled);
+        if (!command->fast_channel)
+            g_bench_modes[pal_get_completion_mode()]++;
+    }
+
+    elapsed = pal_get_time_ns() - start;
+    if (command->fast_channel)
+        val_fast_channel_close(&fast_channel);
+
+    bench_print_row(command->name, config->iterations, errors, elapsed);
+}
+
+/**
+  @brief   Finds a performance level of the configured domain other than
+           the given one
+  @param   config  benchmark configuration
+  @param   level   level to avoid
+  @param   other   storage for the other level
+  @return  status
+**/
+static uint32_t bench_find_other_level(const BENCH_CONFIG_s *config, uint32_t level,
+                                       uint32_t *other)
+{
+    uint32_t return_values[MAX_RETURNS_SIZE];
+    uint32_t parameters[2];
+    uint32_t rsp_msg_hdr;
+    size_t return_value_count;
+    int32_t status;
+    uint32_t num_levels;
+    uint32_t i;
+
+    parameters[0] = config->id;
+    parameters[1] = 0; /* First level index */
+    val_send_message(val_msg_hdr_create(PROTOCOL_PERFORMANCE, PERFORMANCE_DESCRIBE_LEVELS,
+                                        COMMAND_MSG),
+                     2, parameters, &rsp_msg_hdr, &status, &return_value_count, return_values);
+    if (status != SCMI_SUCCESS)
+        return VAL_STATUS_FAIL;
+
+    /* Each level is described by its value, power cost and latency */
+    num_levels = VAL_EXTRACT_BITS(return_values[NUM_LEVEL_OFFSET], 0, 11);
+    for (i = 0; (i < num_levels) && (PERF_LEVEL_ARRAY_OFFSET + (i * 3) < return_value_count);
+         i++) {
+        if (return_values[PERF_LEVEL_ARRAY_OFFSET + (i * 3)] != level) {
+            *other = return_values[PERF_LEVEL_ARRAY_OFFSET + (i * 3)];
+            return VAL_STATUS_PASS;
+        }
+    }
+
+    return VAL_STATUS_FAIL;
+}
+
+/**
+  @brief   Writes a level through the fast channel and polls the mailbox
+           until the platform reports it
+  @param   config        benchmark configuration
+  @param   fast_channel  PERFORMANCE_LEVEL_SET fast channel
+  @param   level         level to be written
+  @return  time taken in ns, 0 if the level never became visible
+**/
+static uint64_t bench_level_visible(const BENCH_CONFIG_s *config,
+                                    const VAL_FAST_CHANNEL_s *fast_channel, uint32_t level)
+{
+    uint32_t return_values[MAX_RETURNS_SIZE];
+    uint64_t start = pal_get_time_ns();
+    uint64_t now;
+
+    if (val_fast_channel_write(fast_channel, &level, 1) != VAL_STATUS_PASS)
+        return 0;
+
+    do {
+        now = pal_get_time_ns();
+        if ((bench_perf_get(config, PERFORMANCE_LEVEL_GET, return_values, 1) == VAL_STATUS_PASS) &&
+            (return_values[PERFORMANCE_LEVEL_OFFSET] == level))
+            return (now > start) ? (now - start) : 1;
+    } while (now - start < BENCH_VISIBLE_TIMEOUT_NS);
+
+    return 0;
+}
+
+/**
+  @brief   Measures how long a level written through the fast channel takes
+           to be reported by PERFORMANCE_LEVEL_GET, writing no faster than
+           the advertised rate limit, and prints it next to that limit. The
+           level alternates with the current one, which is restored last.
+  @param   config  benchmark configuration
+  @return  none
+**/
+static void bench_run_rate_limit(const BENCH_CONFIG_s *config)
+{
+    const BENCH_COMMAND_s *command = &g_bench_rate_limit;
+    VAL_FAST_CHANNEL_s fast_channel;
+    uint32_t return_values[MAX_RETURNS_SIZE];
+    uint32_t levels[2];
+    uint32_t samples = config->iterations;
+    uint64_t start, visible, next = 0;
+    uint32_t errors = 0;
+    uint32_t i;
+
+    if ((bench_perf_get(config, PERFORMANCE_LEVEL_GET, return_values, 1) != VAL_STATUS_PASS) ||
+        (val_fast_channel_open(config->id, command->msg_id, &fast_channel) != VAL_STATUS_PASS)) {
+        printf("\n%-20s NOT SUPPORTED", command->name);
+        return;
+    }
+
+    levels[0] = return_values[PERFORMANCE_LEVEL_OFFSET];
+    if (bench_find_other_level(config, levels[0], &levels[1]) != VAL_STATUS_PASS) {
+        val_fast_channel_close(&fast_channel);
+        printf("\n%-20s NOT SUPPORTED", command->name);
+        return;
+    }
+
+    if (samples > BENCH_VISIBLE_SAMPLES)
+        samples = BENCH_VISIBLE_SAMPLES;
+
+    memset(&g_bench_histogram, 0, sizeof(g_bench_histogram));
+    memset(g_bench_modes, 0, sizeof(g_bench_modes));
+    start = pal_get_time_ns();
+
+    for (i = 0; i < samples; i++) {
+        bench_wait_until(next);
+        next = pal_get_time_ns() + ((uint64_t)fast_channel.rate_limit * BENCH_NS_PER_US);
+
+        visible = bench_level_visible(config, &fast_channel, levels[(i + 1) % 2]);
+        if (visible == 0)
+            errors++;
+        else
+            val_latency_histogram_add(&g_bench_histogram, visible);
+    }
+
+    /* An odd number of samples leaves the other level in place */
+    if (samples % 2) {
+        bench_wait_until(next);
+        bench_level_visible(config, &fast_channel, levels[0]);
+    }
+
+    bench_print_row(command->name, samples, errors, pal_get_time_ns() - start);
+    printf("  RATE LIMIT(us): %u", fast_channel.rate_limit);
+    val_fast_channel_close(&fast_channel);
+}
+
+/**
+  @brief   Prints the command line usage
+  @param   program  executable name
+  @return  none
+**/
+static void bench_usage(const char *program)
+{
+    uint32_t i;
+
+    printf("Usage: %s [options]\n", program);
+    printf("  --iterations=N  commands sent per benchmark, above 0 (default %d)\n",
+           BENCH_DEFAULT_ITERATIONS);
+    printf("  --warmup=N      untimed commands sent first (default %d)\n",
+           BENCH_DEFAULT_WARMUP);
+    printf("  --rate=N        open-loop rate in commands/s, 0 sends back to back (default)\n");
+    printf("  --id=N          domain, clock or sensor identifier (default 0)\n");
+    printf("  --transport=NAME[:ARG] transport to the platform (default: platform choice)\n");
+    printf("  --stats-rate=N  read the statistics regions N times/s, up to %d (default off)\n",
+           VAL_STATS_MAX_RATE_HZ);
+    printf("  --commands=LIST comma separated benchmarks, out of:\n");
+    for (i = 0; i < NUM_ELEMS(g_bench_commands); i++)
+        printf("                  %s\n", g_bench_commands[i].name);
+    printf("                  %s\n", g_bench_rate_limit.name);
+}
+
+/**
+  @brief   Entry point to SCMI benchmark
+           1. Caller       -  Platform layer.
+  @param   see bench_usage()
+  @return  0 on success, 1 if the platform fails to initialize,
+           APP_EXIT_BAD_ARGUMENTS on an unknown option, a malformed value,
+           an unknown command name or an unknown transport
+**/
+int main(int argc, char *argv[])
+{
+    BENCH_CONFIG_s config = {BENCH_DEFAULT_ITERATIONS, BENCH_DEFAULT_WARMUP, 0, 0, NULL};
+    const char *transport = NULL;
+    uint32_t stats_rate = 0;
+    bool valid;
+    uint32_t i;
+
+    for (i = 1; i < argc; i++) {
+        valid = true;
+        if (strncmp(argv[i], "--iterations=", 13) == 0)
+            valid = bench_parse_number(argv[i] + 13, &config.iterations) &&
+                    (config.iterations != 0);
+        else if (strncmp(argv[i], "--warmup=", 9) == 0)
+            valid = bench_parse_number(argv[i] + 9, &config.warmup);
+        else if (strncmp(argv[i], "--rate=", 7) == 0)
+            valid = bench_parse_number(argv[i] + 7, &config.rate);
+        else if (strncmp(argv[i], "--id=", 5) == 0)
+            valid = bench_parse_number(argv[i] + 5, &config.id);
+        else if (strncmp(argv[i], "--commands=", 11) == 0) {
+            config.commands = argv[i] + 11;
+            valid = bench_commands_valid(config.commands);
+        } else if (strncmp(argv[i], "--transport=", 12) == 0)
+            transport = argv[i] + 12;
+        else if (strncmp(argv[i], "--stats-rate=", 13) == 0)
+            valid = bench_parse_number(argv[i] + 13, &stats_rate) &&
+                    (stats_rate <= VAL_STATS_MAX_RATE_HZ);
+        else
+            valid = false;
+
+        if (!valid) {
+            bench_usage(argv[0]);
+            return APP_EXIT_BAD_ARGUMENTS;
+        }
+    }
+
+    if (val_set_transport(transport)) {
+        printf("\n **** INVALID TRANSPORT ***\n");
+        return APP_EXIT_BAD_ARGUMENTS;
+    }
+
+    if (val_initialize_system((void *) NULL)) {
+        printf("\n **** INIT FAILED ***\n");
+        return 1;
+    }
+
+    printf("\n        **** SCMI Benchmark ****");
+    printf("\n  ITERATIONS: %u    RATE: %u/s    ID: %u    TRANSPORT: %s", config.iterations,
+           config.rate, config.id, val_get_transport());
+    printf("\n%-20s %10s %8s %12s %10s %10s %10s %10s %10s", "COMMAND", "OPS", "ERRORS",
+           "OPS/S", "P50(ns)", "P90(ns)", "P99(ns)", "P999(ns)", "MAX(ns)");
+
+    if (stats_rate != 0)
+        val_stats_start(stats_rate);
+
+    for (i = 0; i < NUM_ELEMS(g_bench_commands); i++) {
+        if (bench_command_selected(&config, &g_bench_commands[i]))
+            bench_run_command(&config, &g_bench_commands[i]);
+    }
+
+    if (bench_command_selected(&config, &g_bench_rate_limit))
+        bench_run_rate_limit(&config);
+
+    val_stats_stop();
+    printf("\n");
+    return 0;
+}
@@ -0,0 +1,325 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <protocol_common.h>
+#include <pal_platform.h>
+#include <mock_mailbox.h>
+#include <timer_wheel.h>
+
+#define SERVER_MAX_CLIENTS 32
+#define SERVER_MAX_RETURNS 64 /* Room for the largest response of any protocol model */
+
+static volatile sig_atomic_t g_server_stop;
+
+/* Listening socket followed by one entry per connected agent channel */
+static struct pollfd g_server_fds[SERVER_MAX_CLIENTS + 1];
+static uint32_t g_server_num_fds;
+/* Agent of each connected channel, as seen by the protocol models */
+static uint32_t g_server_agents[SERVER_MAX_CLIENTS + 1];
+static uint32_t g_server_agents_used;
+
+/**
+  @brief   Signal handler, stops the server loop
+  @param   signal_number  signal received
+  @return  none
+**/
+static void server_stop(int signal_number)
+{
+    g_server_stop = 1;
+}
+
+/**
+  @brief   Reads a word of the mailbox memory
+  @param   mailbox  mailbox memory
+  @param   offset   byte offset
+  @return  word
+**/
+static uint32_t server_read_word(const uint8_t *mailbox, uint32_t offset)
+{
+    return *(const uint32_t *)&mailbox[offset];
+}
+
+/**
+  @brief   Writes a word of the mailbox memory
+  @param   mailbox  mailbox memory
+  @param   offset   byte offset
+  @param   value    word
+  @return  none
+**/
+static void server_write_word(uint8_t *mailbox, uint32_t offset, uint32_t value)
+{
+    *(uint32_t *)&mailbox[offset] = value;
+}
+
+/**
+  @brief   Processes a command written into the mailbox memory by an agent:
+           dispatches it to the protocol models and writes the response back
+           into the mailbox memory, as the platform would
+  @param   mailbox  mailbox memory
+  @param   length   bytes of mailbox memory written by the agent
+  @param   copies   storage for the number of copies of the response to
+                    send, from the fault profile
+  @return  bytes of mailbox memory to be returned to the agent
+**/
+static size_t server_process(uint8_t *mailbox, size_t length, uint32_t *copies)
+{
+    uint32_t parameters[MB_MAX_PAYLOAD_WORDS];
+    uint32_t return_values[SERVER_MAX_RETURNS];
+    uint32_t header_payload_length;
+    uint32_t message_header_rcv;
+    size_t return_values_count = 0;
+    size_t parameter_count;
+    int32_t status = SCMI_STATUS_GENERIC_ERROR;
+    size_t i;
+
+    header_payload_length = (length >= MB_MESSAGE_PAYLOAD) ?
+                            server_read_word(mailbox, MB_HEADER_PAYLOAD_LENGTH) : 0;
+    if ((header_payload_length < sizeof(uint32_t)) ||
+        (MB_MESSAGE_HEADER + header_payload_length > length)) {
+        server_write_word(mailbox, MB_CHANNEL_STATUS,
+                          MB_CHANNEL_STATUS_FREE | MB_CHANNEL_STATUS_ERROR);
+        *copies = MOCKER_RESPONSE_DELIVERED;
+        return MB_MESSAGE_PAYLOAD;
+    }
+
+    parameter_count = (header_payload_length / sizeof(uint32_t)) - 1;
+    for (i = 0; i < parameter_count; i++)
+        parameters[i] = server_read_word(mailbox, MB_MESSAGE_PAYLOAD + (i * sizeof(uint32_t)));
+
+    *copies = mocker_send_message(server_read_word(mailbox, MB_MESSAGE_HEADER),
+                                  parameter_count, parameters, &message_header_rcv, &status,
+                                  &return_values_count, return_values);
+
+    /* The status takes the first payload word */
+    if (return_values_count > MB_MAX_PAYLOAD_WORDS - 1) {
+        status = SCMI_STATUS_GENERIC_ERROR;
+        return_values_count = 0;
+    }
+
+    server_write_word(mailbox, MB_MESSAGE_HEADER, message_header_rcv);
+    server_write_word(mailbox, MB_MESSAGE_PAYLOAD, (uint32_t)status);
+    for (i = 0; i < return_values_count; i++)
+        server_write_word(mailbox, MB_MESSAGE_PAYLOAD + ((i + 1) * sizeof(uint32_t)),
+                          return_values[i]);
+
+    server_write_word(mailbox, MB_HEADER_PAYLOAD_LENGTH,
+                      (return_values_count + 2) * sizeof(uint32_t));
+    server_write_word(mailbox, MB_CHANNEL_STATUS, MB_CHANNEL_STATUS_FREE);
+    return MB_MESSAGE_PAYLOAD + ((return_values_count + 1) * sizeof(uint32_t));
+}
+
+/**
+  @brief   Serves one mailbox write of an agent channel
+  @param   fd  agent channel
+  @return  false when the agent has gone away
+**/
+static bool server_serve(int fd, uint32_t agent)
+{
+    uint8_t mailbox[MOCK_MAILBOX_LENGTH] __attribute__((aligned(8)));
+    uint32_t copies;
+    ssize_t received;
+    size_t length;
+
+    received = recv(fd, mailbox, sizeof(mailbox), 0);
+    if (received <= 0)
+        return false;
+
+    mocker_select_agent(agent);
+    length = server_process(mailbox, received, &copies);
+    for (; copies > 0; copies--) {
+        if (send(fd, mailbox, length, MSG_NOSIGNAL) != (ssize_t)length)
+            return false;
+    }
+
+    return true;
+}
+
+/**
+  @brief   Writes the delayed responses and notifications that are due into
+           the mailbox memory of their agents. Messages for an agent that has
+           gone away are dropped.
+  @return  none
+**/
+static void server_deliver(void)
+{
+    uint8_t mailbox[MOCK_MAILBOX_LENGTH] __attribute__((aligned(8)));
+    struct timer_wheel_message message;
+    uint32_t payload_words, i;
+    size_t length;
+
+    while (timer_wheel_pop(&message)) {
+        for (i = 1; i < g_server_num_fds; i++) {
+            if (g_server_agents[i] == message.agent)
+                break;
+        }
+        if (i == g_server_num_fds)
+            continue;
+
+        /* A delayed response carries its status ahead of the values */
+        memset(mailbox, 0, MB_MESSAGE_PAYLOAD);
+        payload_words = 0;
+        if (scmi_codec_type(message.header) == MOCKER_DELAYED_RESPONSE_MSG)
+            server_write_word(mailbox, MB_MESSAGE_PAYLOAD + (payload_words++ * sizeof(uint32_t)),
+                              (uint32_t)message.status);
+        for (length = 0; length < message.count; length++)
+            server_write_word(mailbox, MB_MESSAGE_PAYLOAD + (payload_words++ * sizeof(uint32_t)),
+                              message.values[length]);
+
+        server_write_word(mailbox, MB_MESSAGE_HEADER, message.header);
+        server_write_word(mailbox, MB_HEADER_PAYLOAD_LENGTH, (payload_words + 1) * sizeof(uint32_t));
+        server_write_word(mailbox, MB_CHANNEL_STATUS, MB_CHANNEL_STATUS_FREE);
+        length = MB_MESSAGE_PAYLOAD + (payload_words * sizeof(uint32_t));
+        send(g_server_fds[i].fd, mailbox, length, MSG_NOSIGNAL);
+    }
+}
+
+/**
+  @brief   Returns the poll timeout until the next asynchronous message is due
+  @return  milliseconds, -1 when nothing is scheduled
+**/
+static int server_timeout(void)
+{
+    int64_t expiry = timer_wheel_next_expiry();
+
+    if (expiry < 0)
+        return -1;
+
+    return (int)((expiry + 999999) / 1000000);
+}
+
+/**
+  @brief   Creates the listening socket
+  @param   path  socket path
+  @return  socket, -1 on failure
+**/
+static int server_listen(const char *path)
+{
+    struct sockaddr_un address;
+    int fd;
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(address.sun_path))
+        return -1;
+    strcpy(address.sun_path, path);
+
+    fd = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+    if (fd < 0)
+        return -1;
+
+    unlink(path);
+    if ((bind(fd, (struct sockaddr *)&address, sizeof(address)) != 0) ||
+        (listen(fd, SERVER_MAX_CLIENTS) != 0)) {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+/**
+  @brief   Entry point of the mock platform server. Agents built for the
+           mocker platform talk to it when SCMI_MOCK_SERVER is set.
+  @param   --socket=PATH  socket path, default MOCK_SERVER_DEFAULT_PATH
+  @return  0 on success
+**/
+int main(int argc, char *argv[])
+{
+    const char *path = MOCK_SERVER_DEFAULT_PATH;
+    struct sigaction action;
+    uint32_t i, agent;
+    int fd;
+
+    for (i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--socket=", 9) == 0) {
+            path = argv[i] + 9;
+        } else {
+            printf("Usage: %s [--socket=PATH]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    /* No SA_RESTART, so that poll() returns on a stop request */
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = server_stop;
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+
+    g_server_fds[0].fd = server_listen(path);
+    if (g_server_fds[0].fd < 0) {
+        printf("ERROR: cannot listen on %s\n", path);
+        return 1;
+    }
+    g_server_fds[0].events = POLLIN;
+    g_server_num_fds = 1;
+
+    mocker_initialize();
+    printf("scmi_mock_server listening on %s\n", path);
+    fflush(stdout);
+
+    while (!g_server_stop) {
+        if (poll(g_server_fds, g_server_num_fds, server_timeout()) < 0)
+            continue;
+
+        server_deliver();
+
+        /* Agent channels first, a channel that went away frees its slot */
+        for (i = 1; i < g_server_num_fds; i++) {
+            if (!g_server_fds[i].revents)
+                continue;
+
+            if (!(g_server_fds[i].revents & POLLIN) ||
+                !server_serve(g_server_fds[i].fd, g_server_agents[i])) {
+                close(g_server_fds[i].fd);
+                g_server_agents_used &= ~(1u << g_server_agents[i]);
+                g_server_agents[i] = g_server_agents[g_server_num_fds - 1];
+                g_server_fds[i--] = g_server_fds[--g_server_num_fds];
+            }
+        }
+
+        if (g_server_fds[0].revents & POLLIN) {
+            fd = accept(g_server_fds[0].fd, NULL, NULL);
+            if (fd < 0)
+                continue;
+
+            if (g_server_num_fds > SERVER_MAX_CLIENTS) {
+                close(fd);
+                continue;
+            }
+
+            /* Lowest free agent, so that a lone agent is agent 0 as in process */
+            for (agent = 0; g_server_agents_used & (1u << agent); agent++)
+                ;
+            g_server_agents_used |= 1u << agent;
+            g_server_agents[g_server_num_fds] = agent;
+
+            g_server_fds[g_server_num_fds].fd = fd;
+            g_server_fds[g_server_num_fds].events = POLLIN;
+            g_server_fds[g_server_num_fds++].revents = 0;
+        }
+    }
+
+    for (i = 0; i < g_server_num_fds; i++)
+        close(g_server_fds[i].fd);
+    unlink(path);
+    return 0;
+}
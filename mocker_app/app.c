@@ -15,14 +15,247 @@
  * limitations under the License.
 **/
 
+#include <pthread.h>
 #include "val_interface.h"
 
+#define SUITE_LOG_SIZE (256 * 1024)
+
+/* Exit status of a rejected command line. A run that completes, or a --list,
+   exits with 1, and a platform that fails to initialize with 0. */
+#define APP_EXIT_BAD_ARGUMENTS 2
+
+typedef struct {
+    const char *banner;
+    uint32_t protocol_id;
+    uint32_t (*execute_tests)(void);
+    bool parallel;      /* false when the suite changes the state of the whole system */
+} SUITE_s;
+
+typedef struct {
+    const SUITE_s *suite;
+    uint32_t channel_id;
+    VAL_PRINT_BUFFER_s log;
+    pthread_t thread;
+    bool started;
+} SUITE_THREAD_s;
+
+/* Suites run after base, in this order when running sequentially. A suite
+   none of whose tests run, see val_registry_select(), is not dispatched */
+static const SUITE_s g_suites[] = {
+#ifdef POWER_DOMAIN_PROTOCOL
+    {"\n\n          *** Starting POWER tests *** ", PROTOCOL_POWER_DOMAIN,
+     val_power_domain_execute_tests, true},
+#endif
+#ifdef SYSTEM_POWER_PROTOCOL
+    {"\n\n          *** Starting SYSTEM POWER tests ***  ", PROTOCOL_SYSTEM_POWER,
+     val_system_power_execute_tests, false},
+#endif
+#ifdef PERFORMANCE_PROTOCOL
+    {"\n\n          *** Starting PERFORMANCE tests ***  ", PROTOCOL_PERFORMANCE,
+     val_performance_execute_tests, true},
+#endif
+#ifdef CLOCK_PROTOCOL
+    {"\n\n          *** Starting CLOCK tests ***", PROTOCOL_CLOCK,
+     val_clock_execute_tests, true},
+#endif
+#ifdef SENSOR_PROTOCOL
+    {"\n\n          *** Starting SENSOR tests ***  ", PROTOCOL_SENSOR,
+     val_sensor_execute_tests, true},
+#endif
+#ifdef RESET_PROTOCOL
+    {"\n\n          *** Starting RESET tests ***  ", PROTOCOL_RESET,
+     val_reset_execute_tests, true},
+#endif
+};
+
+/**
+  @brief   Runs one suite on the calling thread
+  @param   suite  suite to be run
+  @return  none
+**/
+static void run_suite(const SUITE_s *suite)
+{
+    val_print(VAL_PRINT_ERR, "%s", suite->banner);
+    suite->execute_tests();
+}
+
+/**
+  @brief   Suite thread entry, runs the suite on its own channel and captures
+           its log so that it can be printed once the suite has completed
+  @param   arg  suite thread
+  @return  none
+**/
+static void *suite_thread_entry(void *arg)
+{
+    SUITE_THREAD_s *suite_thread = (SUITE_THREAD_s *)arg;
+
+    if (suite_thread->log.data != NULL)
+        val_print_buffer_set(&suite_thread->log);
+
+    if (val_select_channel(suite_thread->channel_id) == VAL_STATUS_PASS)
+        run_suite(suite_thread->suite);
+    else
+        val_print(VAL_PRINT_ERR, "\n **** CHANNEL %d SELECT FAILED ***",
+                  suite_thread->channel_id);
+
+    val_print_buffer_set(NULL);
+    return NULL;
+}
+
+/**
+  @brief   Starts a suite thread, the suite runs on the calling thread if no
+           thread can be created
+  @param   suite_thread  suite thread
+  @param   channel_id    channel the suite sends its commands on
+  @return  none
+**/
+static void start_suite_thread(SUITE_THREAD_s *suite_thread, uint32_t channel_id)
+{
+    suite_thread->channel_id = channel_id;
+    suite_thread->log.data = malloc(SUITE_LOG_SIZE);
+    suite_thread->log.size = SUITE_LOG_SIZE;
+    suite_thread->log.used = 0;
+    suite_thread->started = (pthread_create(&suite_thread->thread, NULL,
+                                            suite_thread_entry, suite_thread) == 0);
+    if (!suite_thread->started)
+        suite_thread_entry(suite_thread);
+}
+
+/**
+  @brief   Waits for a suite thread and prints its log
+  @param   suite_thread  suite thread
+  @return  none
+**/
+static void join_suite_thread(SUITE_THREAD_s *suite_thread)
+{
+    if (suite_thread->started)
+        pthread_join(suite_thread->thread, NULL);
+
+    if (suite_thread->log.data != NULL) {
+        val_print_buffer_flush(&suite_thread->log);
+        free(suite_thread->log.data);
+    }
+}
+
+/**
+  @brief   Runs the suites, the parallel ones concurrently with one thread per
+           channel when more than one channel is available
+  @param   parallel  run the parallel suites concurrently
+  @return  none
+**/
+static void run_suites(bool parallel)
+{
+    const SUITE_s *suites[NUM_ELEMS(g_suites) + 1];
+    uint32_t num_suites = 0;
+    SUITE_THREAD_s suite_thread[NUM_ELEMS(g_suites) + 1];
+    uint32_t num_channels = val_get_num_channels();
+    uint32_t num_threads = 0;
+    uint32_t batch;
+    uint32_t i;
+
+    for (i = 0; i < NUM_ELEMS(g_suites); i++) {
+        if (val_registry_protocol_enabled(g_suites[i].protocol_id))
+            suites[num_suites++] = &g_suites[i];
+    }
+
+    if (!parallel || (num_channels < 2)) {
+        for (i = 0; i < num_suites; i++)
+            run_suite(suites[i]);
+        return;
+    }
+
+    for (i = 0; i < num_suites; i++) {
+        if (suites[i]->parallel)
+            suite_thread[num_threads++].suite = suites[i];
+    }
+
+    /* A channel serves one thread at a time, extra suites wait for the next batch */
+    for (batch = 0; batch < num_threads; batch += num_channels) {
+        for (i = batch; (i < num_threads) && (i < batch + num_channels); i++)
+            start_suite_thread(&suite_thread[i], i - batch);
+        for (i = batch; (i < num_threads) && (i < batch + num_channels); i++)
+            join_suite_thread(&suite_thread[i]);
+    }
+
+    /* Suites that affect the whole system run alone, on the main channel */
+    val_select_channel(0);
+    for (i = 0; i < num_suites; i++) {
+        if (!suites[i]->parallel)
+            run_suite(suites[i]);
+    }
+}
+
+/**
+  @brief   Parses a shard option value of the form <i>/<n>
+  @param   value        option value
+  @param   shard_index  shard run by this agent
+  @param   shard_count  number of shards
+  @return  true when both numbers are present, n is not 0 and i is below n
+**/
+static bool parse_shard(const char *value, uint32_t *shard_index, uint32_t *shard_count)
+{
+    char *end;
+
+    if ((*value < '0') || (*value > '9'))
+        return false;
+    *shard_index = strtoul(value, &end, 10);
+
+    if ((end[0] != '/') || (end[1] < '0') || (end[1] > '9'))
+        return false;
+    *shard_count = strtoul(end + 1, &end, 10);
+
+    return (*end == '\0') && (*shard_count != 0) && (*shard_index < *shard_count);
+}
+
+/**
+  @brief   Parses an option value that must be a whole number
+  @param   value   option value, decimal, or hexadecimal with a 0x prefix
+  @param   number  parsed number
+  @return  true when the value is a number and nothing follows it
+**/
+static bool parse_number(const char *value, uint32_t *number)
+{
+    char *end;
+
+    if ((*value < '0') || (*value > '9'))
+        return false;
+    *number = strtoul(value, &end, 0);
+
+    return *end == '\0';
+}
+
+/**
+  @brief   Prints the options of the suite
+  @param   program  name of the executable
+  @return  none
+**/
+static void app_usage(const char *program)
+{
+    printf("Usage: %s [options]\n", program);
+    printf("  --parallel        run independent protocol suites concurrently\n");
+    printf("  --test-budget=MS  wall clock budget of each test, default 10000, 0 for none\n");
+    printf("  --tests=FILTER    tests to run: numbers, ranges and globs such as 101,501-510,6*\n");
+    printf("  --shard=I/N       run shard I of N, for splitting a run across boards\n");
+    printf("  --list            list the tests that would run, then exit\n");
+    printf("  --transport=NAME[:ARG] transport to the platform (default: platform choice)\n");
+    printf("  --stats-rate=N    read the statistics regions N times/s, up to %d (default off)\n",
+           VAL_STATS_MAX_RATE_HZ);
+}
+
 /**
   @brief   Entry point to SCMI suite
            1. Caller       -  Platform layer.
            2. Prerequisite -  Power domain protocol info table.
-  @param   none
-  @return  none
+  @param   --parallel  run independent protocol suites concurrently
+  @param   --test-budget=<ms>  wall clock budget of each test, default 10000, 0 for none
+  @param   --tests=<filter>  tests to run: numbers, ranges and globs such as 101,501-510,6*
+  @param   --shard=<i>/<n>   run shard i of n, for splitting a run across boards
+  @param   --list      list the tests that would run, then exit
+  @param   --transport=<name>[:<argument>]  transport to the platform, such as socket:/tmp/scmi.sock
+  @param   --stats-rate=<hz>  read the statistics regions of the platform at this rate during the run
+  @return  1 once the tests or --list complete, 0 if the platform fails to
+           initialize, APP_EXIT_BAD_ARGUMENTS on an unknown option, a
+           malformed value or filter, or an unknown transport
 **/
 
 int main(int argc, char *argv[])
@@ -30,58 +263,98 @@ int main(int argc, char *argv[])
     uint32_t num_pass;
     uint32_t num_fail;
     uint32_t num_skip;
+    uint32_t num_timeout;
+    bool parallel = false;
+    bool list = false;
+    const char *filter = NULL;
+    const char *transport = NULL;
+    uint32_t shard_index = 0;
+    uint32_t shard_count = 0;
+    uint32_t stats_rate = 0;
+    uint32_t test_budget;
+    uint32_t rate;
+    bool bad_shard = false;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--parallel") == 0)
+            parallel = true;
+        else if ((strncmp(argv[i], "--test-budget=", strlen("--test-budget=")) == 0) &&
+                 parse_number(argv[i] + strlen("--test-budget="), &test_budget))
+            val_set_test_budget(test_budget);
+        else if (strncmp(argv[i], "--tests=", strlen("--tests=")) == 0)
+            filter = argv[i] + strlen("--tests=");
+        else if (strncmp(argv[i], "--shard=", strlen("--shard=")) == 0)
+            bad_shard = !parse_shard(argv[i] + strlen("--shard="), &shard_index, &shard_count);
+        else if (strcmp(argv[i], "--list") == 0)
+            list = true;
+        else if (strncmp(argv[i], "--transport=", strlen("--transport=")) == 0)
+            transport = argv[i] + strlen("--transport=");
+        else if ((strncmp(argv[i], "--stats-rate=", strlen("--stats-rate=")) == 0) &&
+                 parse_number(argv[i] + strlen("--stats-rate="), &rate) &&
+                 (rate <= VAL_STATS_MAX_RATE_HZ))
+            stats_rate = rate;
+        else {
+            app_usage(argv[0]);
+            return APP_EXIT_BAD_ARGUMENTS;
+        }
+    }
 
     val_print(VAL_PRINT_ERR, "\n\n        **** SCMI Compliance Suite **** ");
 
-    if (val_initialize_system((void *) NULL)) {
-        val_print(VAL_PRINT_ERR, "\n **** INIT FAILED ***");
-        return 0;
+    if (bad_shard || (((filter != NULL) || (shard_count != 0) || list) &&
+        val_registry_select(filter, shard_index, shard_count))) {
+        val_print(VAL_PRINT_ERR, "\n **** INVALID TEST SELECTION ***");
+        return APP_EXIT_BAD_ARGUMENTS;
     }
 
-    val_print(VAL_PRINT_ERR, "\n\n          *** Starting BASE tests ***");
-    val_base_execute_tests();
+    if (list) {
+        val_registry_list();
+        return 1;
+    }
 
-#ifdef POWER_DOMAIN_PROTOCOL
-    val_print(VAL_PRINT_ERR, "\n\n          *** Starting POWER tests *** ");
-    val_power_domain_execute_tests();
-#endif
+    if (val_set_transport(transport)) {
+        val_print(VAL_PRINT_ERR, "\n **** INVALID TRANSPORT ***");
+        return APP_EXIT_BAD_ARGUMENTS;
+    }
 
-#ifdef SYSTEM_POWER_PROTOCOL
-    val_print(VAL_PRINT_ERR, "\n\n          *** Starting SYSTEM POWER tests ***  ");
-    val_system_power_execute_tests();
-#endif
+    if (val_initialize_system((void *) NULL)) {
+        val_print(VAL_PRINT_ERR, "\n **** INIT FAILED ***");
+        return 0;
+    }
 
-#ifdef PERFORMANCE_PROTOCOL
-    val_print(VAL_PRINT_ERR, "\n\n          *** Starting PERFORMANCE tests ***  ");
-    val_performance_execute_tests();
-#endif
+    /* The base walk finds the protocols of the agent and keys the cached tables */
+    val_discovery_initialize();
 
- #ifdef CLOCK_PROTOCOL
-    val_print(VAL_PRINT_ERR, "\n\n          *** Starting CLOCK tests ***");
-    val_clock_execute_tests();
-#endif
+    if (stats_rate != 0)
+        val_stats_start(stats_rate);
 
-#ifdef SENSOR_PROTOCOL
-    val_print(VAL_PRINT_ERR, "\n\n          *** Starting SENSOR tests ***  ");
-    val_sensor_execute_tests();
-#endif
+    if (val_registry_protocol_enabled(PROTOCOL_BASE)) {
+        val_print(VAL_PRINT_ERR, "\n\n          *** Starting BASE tests ***");
+        val_base_execute_tests();
+    }
 
-#ifdef RESET_PROTOCOL
-    val_print(VAL_PRINT_ERR, "\n\n          *** Starting RESET tests ***  ");
-    val_reset_execute_tests();
-#endif
+    run_suites(parallel);
 
     num_pass = val_get_test_passed();
     num_fail = val_get_test_failed();
     num_skip = val_get_test_skipped();
+    num_timeout = val_get_test_timeout();
 
     val_print(VAL_PRINT_ERR, "\n****************************************************", 0);
-    val_print(VAL_PRINT_ERR, "\n  TOTAL TESTS: %d", num_pass + num_fail + num_skip);
+    val_print(VAL_PRINT_ERR, "\n  TOTAL TESTS: %d", num_pass + num_fail + num_skip + num_timeout);
     val_print(VAL_PRINT_ERR, "    PASSED: %d", num_pass);
     val_print(VAL_PRINT_ERR, "    FAILED: %d", num_fail);
     val_print(VAL_PRINT_ERR, "    SKIPPED: %d", num_skip);
+    if (num_timeout)
+        val_print(VAL_PRINT_ERR, "    TIMEOUT: %d", num_timeout);
     val_print(VAL_PRINT_ERR, "\n****************************************************", 0);
 
+    val_test_timing_report();
+    val_discovery_report();
+    val_latency_report();
+    val_stats_stop();
+
     val_print(VAL_PRINT_ERR, "\n\n        **** SCMI tests complete **** \n ");
 
     return 1;
@@ -36,6 +36,7 @@ struct arm_scmi_platform_protocol_info {
 struct arm_scmi_platform_info {
     size_t platform_protocol_info_count;
     struct arm_scmi_platform_protocol_info *platform_protocol_info_table;
+    size_t channel_size; /* bytes of shared memory of the channel, 0 for the default */
 };
 
 /*!
@@ -46,8 +47,9 @@ struct arm_scmi_platform_info {
  * @param parameters Outgoing SCMI parameters.
  * @param message_header_rcv Storage for the SCMI message header returned.
  * @param status Storage for the SCMI status returned.
- * @param return_values_count Storage for the number of SCMI parameters
- *                            returned.
+ * @param return_values_count Number of SCMI parameters return_values can
+ *                            hold on entry, storage for the number of SCMI
+ *                            parameters returned.
  * @param return_values Storage for the SCMI parameters returned.
  *
  * @return NO_ERROR if no error occurred, or any other value otherwise.
@@ -91,6 +93,70 @@ int arm_scmi_wait_for_notification(uint32_t *message_header_rcv,
  */
 void arm_scmi_log_output(const char *output);
 
+/*!
+ * @brief Interface function returning a monotonic timestamp. Only needed
+ *        when the test agent is built with LATENCY_STATS=1, RECORD=1,
+ *        RESULTS=1 or WATCHDOG=1.
+ *
+ * @return Time in ns.
+ */
+uint64_t arm_scmi_get_time_ns(void);
+
+/*!
+ * @brief Interface function used to handle binary trace records from the
+ *        test agent. Only needed when the test agent is built with TRACE=1.
+ *
+ * @param record Pointer to the trace record.
+ * @param size Size of the trace record in bytes.
+ *
+ */
+void arm_scmi_trace_output(const void *record, size_t size);
+
+/*!
+ * @brief Interface function used to store records of the SCMI traffic of
+ *        the test agent, for a later replay on a host. Records are to be
+ *        appended after a VAL_RECORD_FILE_s header, see val_record.h. Only
+ *        needed when the test agent is built with RECORD=1.
+ *
+ * @param record Pointer to the VAL_RECORD_s record.
+ * @param size Size of the record in bytes.
+ *
+ */
+void arm_scmi_record_output(const void *record, size_t size);
+
+/*!
+ * @brief Interface function used to handle the results of the test agent,
+ *        one per check as it is made and one per test as it completes.
+ *        Only needed when the test agent is built with RESULTS=1.
+ *
+ * @param result Pointer to the VAL_RESULT_s result, see val_result.h. Its
+ *        strings are only valid for the duration of the call.
+ *
+ */
+void arm_scmi_result_output(const void *result);
+
+/*!
+ * @brief Interface function starting a timer for the budget of the test
+ *        about to run. Once it expires, the pending and later calls to
+ *        arm_scmi_send_message, arm_scmi_wait_for_response and
+ *        arm_scmi_wait_for_notification are expected to return an error
+ *        without waiting, until the timer is disarmed. The test then
+ *        completes and is reported as TIMEOUT. Only needed when the test
+ *        agent is built with WATCHDOG=1.
+ *
+ * @param budget_ms Budget of the test in ms.
+ *
+ */
+void arm_scmi_watchdog_arm(uint32_t budget_ms);
+
+/*!
+ * @brief Interface function stopping the timer of arm_scmi_watchdog_arm
+ *        once the test has completed. Only needed when the test agent is
+ *        built with WATCHDOG=1.
+ *
+ */
+void arm_scmi_watchdog_disarm(void);
+
 int arm_scmi_agent_execute(void *agent_info);
 
 #endif /* _PAL_PLATFORM_H_ */
@@ -82,6 +82,9 @@ void pal_receive_notification(uint32_t *message_header_rcv, size_t *return_value
     arm_scmi_wait_for_notification(message_header_rcv, return_values_count, return_values);
 }
 
+/* Shared memory of the channel in bytes, 0 until the platform says */
+static size_t g_channel_size;
+
 /**
   @brief   This API is used to initialize platform to run tests if needed
   @param   platform info
@@ -96,6 +99,7 @@ uint32_t pal_initialize_system(void *info)
     if (info == NULL)
         return PAL_STATUS_FAIL;
     platform_info = (struct arm_scmi_platform_info *) info;
+    g_channel_size = platform_info->channel_size;
 
     if (platform_info->platform_protocol_info_table == NULL)
         return PAL_STATUS_FAIL;
@@ -159,3 +163,243 @@ void pal_print(uint32_t print_level, const char *format, va_list args)
     vsnprintf(p_str, LOG_STR_SIZE, format, args);
     arm_scmi_log_output(p_str);
 }
+
+/**
+  @brief   This API is used to write a binary trace record
+  @param   record  trace record
+  @param   size    size of the record in bytes
+  @return  none
+**/
+void pal_trace(const void *record, size_t size)
+{
+#ifdef VAL_BINARY_TRACE
+    arm_scmi_trace_output(record, size);
+#endif
+}
+
+/**
+  @brief   This API is used to append a record of the SCMI traffic
+  @param   record  VAL_RECORD_s, see val_record.h
+  @param   size    size of the record in bytes
+  @return  none
+**/
+void pal_record(const void *record, size_t size)
+{
+#ifdef VAL_RECORD
+    arm_scmi_record_output(record, size);
+#endif
+}
+
+/**
+  @brief   This API is used to hand the result of a check or test to the
+           execution environment
+  @param   result  VAL_RESULT_s, see val_result.h
+  @return  none
+**/
+void pal_result(const void *result)
+{
+#ifdef VAL_RESULTS
+    arm_scmi_result_output(result);
+#endif
+}
+
+/**
+  @brief   This API picks the transport, the baremetal agent has only its own
+  @param   name  transport name, NULL for the default
+  @return  status
+**/
+uint32_t pal_set_transport(const char *name)
+{
+    return (name == NULL) ? PAL_STATUS_PASS : PAL_STATUS_FAIL;
+}
+
+/**
+  @brief   This API returns the name of the transport in use
+  @return  transport name
+**/
+const char *pal_get_transport(void)
+{
+    return "arm_scmi";
+}
+
+/**
+  @brief   This API returns the number of transport channels
+  @return  number of channels, the baremetal agent has a single channel
+**/
+uint32_t pal_get_num_channels(void)
+{
+    return 1;
+}
+
+/**
+  @brief   This API binds the calling thread to a transport channel
+  @param   channel_id  channel identifier
+  @return  status
+**/
+uint32_t pal_select_channel(uint32_t channel_id)
+{
+    return (channel_id == 0) ? PAL_STATUS_PASS : PAL_STATUS_FAIL;
+}
+
+/**
+  @brief   This API returns how the last command completed
+  @return  PAL_COMPLETION_NONE, the baremetal agent does not tell
+**/
+uint32_t pal_get_completion_mode(void)
+{
+    return PAL_COMPLETION_NONE;
+}
+
+/**
+  @brief   This API returns the size of the shared memory of the channel
+  @return  bytes, as given in arm_scmi_platform_info, else
+           PAL_CHANNEL_SIZE_DEFAULT
+**/
+uint32_t pal_get_channel_size(void)
+{
+    if (g_channel_size == 0)
+        return PAL_CHANNEL_SIZE_DEFAULT;
+    if (g_channel_size < PAL_CHANNEL_SIZE_MIN)
+        return PAL_CHANNEL_SIZE_MIN;
+    if (g_channel_size > PAL_CHANNEL_SIZE_MAX)
+        return PAL_CHANNEL_SIZE_MAX;
+
+    return (uint32_t)g_channel_size;
+}
+
+/**
+  @brief   This API returns a monotonic timestamp
+  @return  time in ns, 0 when no timing is built in
+**/
+uint64_t pal_get_time_ns(void)
+{
+#if defined(VAL_LATENCY_STATS) || defined(VAL_RECORD) || defined(VAL_RESULTS) || \
+    defined(VAL_WATCHDOG)
+    return arm_scmi_get_time_ns();
+#else
+    return 0;
+#endif
+}
+
+/**
+  @brief   This API starts the budget of the test about to run
+  @param   budget_ms  budget of the test in ms
+  @return  none
+**/
+void pal_watchdog_arm(uint32_t budget_ms)
+{
+#ifdef VAL_WATCHDOG
+    arm_scmi_watchdog_arm(budget_ms);
+#endif
+}
+
+/**
+  @brief   This API stops the budget of the test that just completed
+  @return  none
+**/
+void pal_watchdog_disarm(void)
+{
+#ifdef VAL_WATCHDOG
+    arm_scmi_watchdog_disarm();
+#endif
+}
+
+/**
+  @brief   This API copies a cached info table, there is no cache on baremetal
+  @param   key    VAL_DISCOVERY_KEY_s of the table
+  @param   table  info table to be filled
+  @param   size   size of the table
+  @return  PAL_STATUS_FAIL, the protocol is walked
+**/
+uint32_t pal_discovery_cache_load(const void *key, void *table, uint32_t size)
+{
+    return PAL_STATUS_FAIL;
+}
+
+/**
+  @brief   This API caches a walked info table, there is no cache on baremetal
+  @param   key    VAL_DISCOVERY_KEY_s of the table
+  @param   table  info table
+  @param   size   size of the table
+  @return  none
+**/
+void pal_discovery_cache_store(const void *key, const void *table, uint32_t size)
+{
+    return;
+}
+
+/**
+  @brief   This API maps fast channel memory for the agent to access
+  @param   address  physical address of the fast channel
+  @param   size     size of the fast channel in bytes
+  @return  agent address, flat mapping on baremetal
+**/
+void *pal_fast_channel_map(uint64_t address, uint32_t size)
+{
+    return (void *)(uintptr_t)address;
+}
+
+/**
+  @brief   This API releases a fast channel mapping
+  @param   channel  agent address returned by pal_fast_channel_map
+  @param   size     size of the fast channel in bytes
+  @return  none
+**/
+void pal_fast_channel_unmap(void *channel, uint32_t size)
+{
+    return;
+}
+
+/**
+  @brief   This API maps a statistics region
+  @param   address  physical address of the region
+  @param   size     size of the region in bytes
+  @return  agent address, flat mapping on baremetal
+**/
+void *pal_stats_map(uint64_t address, uint32_t size)
+{
+    return (void *)(uintptr_t)address;
+}
+
+/**
+  @brief   This API releases a statistics region mapping
+  @param   region  agent address returned by pal_stats_map
+  @param   size    size of the region in bytes
+  @return  none
+**/
+void pal_stats_unmap(void *region, uint32_t size)
+{
+    return;
+}
+
+/**
+  @brief   This API starts the statistics sampler. There is no thread to run
+           it on baremetal, regions are read with val_stats_read() instead.
+  @param   rate_hz  calls per second
+  @param   sample   function to call
+  @return  PAL_STATUS_FAIL
+**/
+uint32_t pal_stats_sampler_start(uint32_t rate_hz, void (*sample)(void))
+{
+    return PAL_STATUS_FAIL;
+}
+
+/**
+  @brief   This API stops the statistics sampler
+  @return  number of missed ticks, 0
+**/
+uint32_t pal_stats_sampler_stop(void)
+{
+    return 0;
+}
+
+/**
+  @brief   This API exports statistics samples, there is no sink on baremetal
+  @param   samples  samples
+  @param   count    number of samples
+  @return  none
+**/
+void pal_stats_write(const void *samples, uint32_t count)
+{
+    return;
+}
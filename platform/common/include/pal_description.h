@@ -0,0 +1,152 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef __PAL_DESCRIPTION_H__
+#define __PAL_DESCRIPTION_H__
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*
+ * Platform description: the expected values of a platform, loaded at run
+ * time in place of the pal_*_expected.h tables. It is written as text and
+ * compiled to a blob by scmi_pdesc_compile, see docs/user_guide.md.
+ *
+ * Blob layout, little-endian, every section 4 byte aligned:
+ *   struct pal_description_header
+ *   struct pal_description_key    keys[num_keys]
+ *   struct pal_description_row    rows[num_rows]
+ *   uint32_t                      values[num_values]
+ *   char                          strings[strings_size]
+ *
+ * Each key holds rows of values: a single row for scalars and per domain
+ * vectors, a row per domain for tables indexed by domain and then level or
+ * message. A string value is the offset of a NUL terminated string in
+ * strings, keys of string type have a single row.
+ */
+#define PAL_DESCRIPTION_ENV          "SCMI_PLATFORM_DESCRIPTION"
+#define PAL_DESCRIPTION_MAGIC        0x44504353 /* "SCPD" */
+#define PAL_DESCRIPTION_VERSION      1
+
+struct pal_description_header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t num_keys;
+    uint32_t num_rows;
+    uint32_t num_values;
+    uint32_t strings_size;
+};
+
+struct pal_description_key {
+    uint32_t key;
+    uint32_t first_row;
+    uint32_t num_rows;
+};
+
+struct pal_description_row {
+    uint32_t first_value;
+    uint32_t num_values;
+};
+
+#define PAL_DESCRIPTION_NUMBER       0
+#define PAL_DESCRIPTION_STRING       1
+
+/*
+ * Keys known to the loader and the compiler, as id, name and type. Ids are
+ * stored in the blob, new keys are added at the end with the next id.
+ */
+#define PAL_DESCRIPTION_KEYS(KEY) \
+    KEY(BASE_VENDOR_NAME,               0,  "base.vendor_name",                 PAL_DESCRIPTION_STRING) \
+    KEY(BASE_SUBVENDOR_NAME,            1,  "base.subvendor_name",              PAL_DESCRIPTION_STRING) \
+    KEY(BASE_IMPLEMENTATION_VERSION,    2,  "base.implementation_version",      PAL_DESCRIPTION_NUMBER) \
+    KEY(BASE_NUM_AGENTS,                3,  "base.num_agents",                  PAL_DESCRIPTION_NUMBER) \
+    KEY(BASE_NUM_PROTOCOLS,             4,  "base.num_protocols",               PAL_DESCRIPTION_NUMBER) \
+    KEY(POWER_NUM_DOMAINS,              5,  "power.num_domains",                PAL_DESCRIPTION_NUMBER) \
+    KEY(POWER_STATS_ADDR_LOW,           6,  "power.stats_addr_low",             PAL_DESCRIPTION_NUMBER) \
+    KEY(POWER_STATS_ADDR_LEN,           7,  "power.stats_addr_len",             PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_NUM_DOMAINS,               8,  "perf.num_domains",                 PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_STATS_ADDR_LOW,            9,  "perf.stats_addr_low",              PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_STATS_ADDR_LEN,            10, "perf.stats_addr_len",              PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_NAME,                      11, "perf.name",                        PAL_DESCRIPTION_STRING) \
+    KEY(PERF_SET_LIMIT_SUPPORT,         12, "perf.set_limit_support",           PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_SET_LEVEL_SUPPORT,         13, "perf.set_level_support",           PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_LEVEL_NOTIFY_SUPPORT,      14, "perf.level_notify_support",        PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_LIMIT_NOTIFY_SUPPORT,      15, "perf.limit_notify_support",        PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_FAST_CH_SUPPORT,           16, "perf.fast_ch_support",             PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_RATE_LIMIT,                17, "perf.rate_limit",                  PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_SUSTAINED_FREQ,            18, "perf.sustained_freq",              PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_SUSTAINED_LEVEL,           19, "perf.sustained_level",             PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_NUM_LEVELS,                20, "perf.num_levels",                  PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_LEVEL,                     21, "perf.level",                       PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_POWER_COST,                22, "perf.power_cost",                  PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_LATENCY,                   23, "perf.latency",                     PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_MSG_FAST_CH_SUPPORT,       24, "perf.msg_fast_ch_support",         PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_FC_DOORBELL_SUPPORT,       25, "perf.fc_doorbell_support",         PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_FC_DOORBELL_DATA_WIDTH,    26, "perf.fc_doorbell_data_width",      PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_FC_ADDR_LOW,               27, "perf.fc_addr_low",                 PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_FC_ADDR_HIGH,              28, "perf.fc_addr_high",                PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_FC_SIZE,                   29, "perf.fc_size",                     PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_FC_RATE_LIMIT,             30, "perf.fc_rate_limit",               PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_FC_DOORBELL_ADDR_LOW,      31, "perf.fc_doorbell_addr_low",        PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_FC_DOORBELL_ADDR_HIGH,     32, "perf.fc_doorbell_addr_high",       PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_FC_DOORBELL_SET_LOW,       33, "perf.fc_doorbell_set_mask_low",    PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_FC_DOORBELL_SET_HIGH,      34, "perf.fc_doorbell_set_mask_high",   PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_FC_DOORBELL_PRESERVE_LOW,  35, "perf.fc_doorbell_preserve_mask_low",  PAL_DESCRIPTION_NUMBER) \
+    KEY(PERF_FC_DOORBELL_PRESERVE_HIGH, 36, "perf.fc_doorbell_preserve_mask_high", PAL_DESCRIPTION_NUMBER) \
+    KEY(CLOCK_NUM_CLOCKS,               37, "clock.num_clocks",                 PAL_DESCRIPTION_NUMBER) \
+    KEY(CLOCK_MAX_ASYNC_CMD,            38, "clock.max_async_cmd",              PAL_DESCRIPTION_NUMBER) \
+    KEY(CLOCK_NUM_RATES,                39, "clock.num_rates",                  PAL_DESCRIPTION_NUMBER) \
+    KEY(CLOCK_CONFIG_CHANGE_SUPPORT,    40, "clock.config_change_support",      PAL_DESCRIPTION_NUMBER) \
+    KEY(SENSOR_NUM_SENSORS,             41, "sensor.num_sensors",               PAL_DESCRIPTION_NUMBER) \
+    KEY(SENSOR_STATS_ADDR_LOW,          42, "sensor.stats_addr_low",            PAL_DESCRIPTION_NUMBER) \
+    KEY(SENSOR_STATS_ADDR_LEN,          43, "sensor.stats_addr_len",            PAL_DESCRIPTION_NUMBER) \
+    KEY(SENSOR_ASYNC_SUPPORT,           44, "sensor.async_support",             PAL_DESCRIPTION_NUMBER) \
+    KEY(SENSOR_TRIP_POINTS,             45, "sensor.trip_points",               PAL_DESCRIPTION_NUMBER) \
+    KEY(SENSOR_MAX_PENDING_ASYNC_CMDS,  46, "sensor.max_pending_async_cmds",    PAL_DESCRIPTION_NUMBER) \
+    KEY(SENSOR_READING,                 47, "sensor.reading",                   PAL_DESCRIPTION_NUMBER) \
+    KEY(RESET_NUM_DOMAINS,              48, "reset.num_domains",                PAL_DESCRIPTION_NUMBER) \
+    KEY(RESET_NAME,                     49, "reset.name",                       PAL_DESCRIPTION_STRING) \
+    KEY(RESET_ASYNC_SUPPORT,            50, "reset.async_support",              PAL_DESCRIPTION_NUMBER) \
+    KEY(RESET_NOTIFY_SUPPORT,           51, "reset.notify_support",             PAL_DESCRIPTION_NUMBER) \
+    KEY(RESET_LATENCY,                  52, "reset.latency",                    PAL_DESCRIPTION_NUMBER) \
+    KEY(TRANSPORT_CHANNEL_SIZE,         53, "transport.channel_size",           PAL_DESCRIPTION_NUMBER)
+
+#define PAL_DESCRIPTION_KEY_ID(name, id, text, type) PDESC_##name = id,
+enum pal_description_key_id {
+    PAL_DESCRIPTION_KEYS(PAL_DESCRIPTION_KEY_ID)
+    PDESC_NUM_KEYS
+};
+#undef PAL_DESCRIPTION_KEY_ID
+
+/*
+ * Expected value of an accessor: from the loaded description when it
+ * describes the key, from the compiled-in table otherwise. Tables are
+ * indexed by row (domain) then index (level, message, ...).
+ */
+#define PAL_EXPECTED(key, row, index, compiled) \
+    (pal_description_has(key) ? pal_description_value(key, row, index) : (compiled))
+#define PAL_EXPECTED_STRING(key, index, compiled) \
+    (pal_description_has(key) ? pal_description_string(key, index) : (compiled))
+
+uint32_t pal_description_load(const void *blob, size_t size);
+uint32_t pal_description_load_file(const char *path);
+bool pal_description_has(uint32_t key);
+uint32_t pal_description_value(uint32_t key, uint32_t row, uint32_t index);
+char *pal_description_string(uint32_t key, uint32_t index);
+
+#endif /* __PAL_DESCRIPTION_H__ */
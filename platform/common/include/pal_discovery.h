@@ -0,0 +1,51 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef __PAL_DISCOVERY_H__
+#define __PAL_DISCOVERY_H__
+
+#include <inttypes.h>
+#include <val_discovery.h>
+
+/*
+ * Discovery cache of the hosted platforms. SCMI_DISCOVERY_CACHE names a
+ * file holding the info tables walked by earlier runs, each keyed by the
+ * firmware and protocol it was walked from, see val_discovery.h. The file
+ * is read when the agent starts and written back when it exits, if a
+ * table was walked. Delete it when the firmware changes without a new
+ * implementation version.
+ */
+#define PAL_DISCOVERY_ENV        "SCMI_DISCOVERY_CACHE"
+#define PAL_DISCOVERY_MAGIC      0x53444353 /* "SCDS" */
+#define PAL_DISCOVERY_VERSION    1
+#define PAL_DISCOVERY_MAX_TABLE  65536 /* Largest table kept */
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t num_entries;
+} PAL_DISCOVERY_FILE_s;
+
+/* Each entry is followed by table_size bytes of table, table_size is in the key */
+typedef struct {
+    VAL_DISCOVERY_KEY_s key;
+} PAL_DISCOVERY_ENTRY_s;
+
+uint32_t pal_discovery_open(const char *path);
+void pal_discovery_close(void);
+
+#endif /* __PAL_DISCOVERY_H__ */
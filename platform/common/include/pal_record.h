@@ -0,0 +1,51 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef __PAL_RECORD_H__
+#define __PAL_RECORD_H__
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <val_record.h>
+
+/*
+ * Recording and replay of the SCMI traffic of a run, see val_record.h for
+ * the file format. An agent built with RECORD=1 appends its traffic to the
+ * file named by SCMI_RECORD. An agent given SCMI_REPLAY serves the commands
+ * it sends from a recording instead of the platform, with the latencies of
+ * the recorded run.
+ */
+#define PAL_RECORD_ENV           "SCMI_RECORD"
+#define PAL_REPLAY_ENV           "SCMI_REPLAY"
+#define PAL_RECORD_CAPACITY      65536 /* Records preallocated in the recording file */
+#define PAL_REPLAY_MAX_CHANNELS  16
+
+uint32_t pal_record_open(const char *path);
+void pal_record_close(void);
+void pal_record_write(const void *record, size_t size);
+
+uint32_t pal_replay_open(const char *path);
+void pal_replay_close(void);
+uint32_t pal_replay_select(uint32_t channel_id);
+void pal_replay_send_message(uint32_t message_header_send, size_t parameter_count,
+        const uint32_t *parameters, uint32_t *message_header_rcv, int32_t *status,
+        size_t *return_values_count, uint32_t *return_values);
+void pal_replay_receive(uint32_t kind, uint32_t *message_header_rcv, int32_t *status,
+        size_t *return_values_count, uint32_t *return_values);
+
+#endif /* __PAL_RECORD_H__ */
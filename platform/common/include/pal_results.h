@@ -0,0 +1,39 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef __PAL_RESULTS_H__
+#define __PAL_RESULTS_H__
+
+#include <inttypes.h>
+#include <val_result.h>
+
+/*
+ * Results sink of the hosted platforms. Each result is written out as it
+ * is handed over, so that the files hold every result up to a hang:
+ *  - SCMI_RESULTS_JSON names a JSON Lines file, one line per check and
+ *    per test
+ *  - SCMI_RESULTS_JUNIT names a JUnit XML file, one testcase per test,
+ *    kept well formed after each test
+ */
+#define PAL_RESULTS_JSON_ENV     "SCMI_RESULTS_JSON"
+#define PAL_RESULTS_JUNIT_ENV    "SCMI_RESULTS_JUNIT"
+
+uint32_t pal_results_open(const char *json_path, const char *junit_path);
+void pal_results_close(void);
+void pal_results_write(const VAL_RESULT_s *result);
+
+#endif /* __PAL_RESULTS_H__ */
@@ -0,0 +1,37 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef __PAL_STATS_H__
+#define __PAL_STATS_H__
+
+#include <inttypes.h>
+
+/*
+ * Statistics sink of the hosted platforms. The samples val_stats_start()
+ * reads from the statistics regions are written out as the sampler hands
+ * them over:
+ *  - SCMI_STATS_BIN names a binary file, a VAL_STATS_FILE_s header followed
+ *    by VAL_STATS_SAMPLE_s records
+ *  - SCMI_STATS_CSV names a CSV file, one line per sample
+ */
+#define PAL_STATS_BIN_ENV     "SCMI_STATS_BIN"
+#define PAL_STATS_CSV_ENV     "SCMI_STATS_CSV"
+
+uint32_t pal_stats_open(const char *bin_path, const char *csv_path);
+void pal_stats_close(void);
+
+#endif /* __PAL_STATS_H__ */
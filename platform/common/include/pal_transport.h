@@ -0,0 +1,64 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef __PAL_TRANSPORT_H__
+#define __PAL_TRANSPORT_H__
+
+#include <inttypes.h>
+#include <stddef.h>
+
+/*
+ * Transports of the hosted platforms. A transport carries the messages of
+ * the agent to an SCMI platform: the mailbox of a board, the mocker models
+ * called in process, scmi_mock_server over a socket, or a recording. Each
+ * platform lists the transports it is built with in g_pal_transports, and
+ * --transport=<name>[:<argument>] picks one at run time, so the same agent
+ * runs the same load over each of them. Without --transport, the first
+ * transport whose environment variable is set is used, else the first one
+ * that needs no argument.
+ */
+#define PAL_TRANSPORT_GENERIC_ERROR    (-8) /* SCMI GENERIC_ERROR */
+
+typedef struct {
+    const char *name;
+    const char *env;           /* names the argument when none is given, NULL if none is needed */
+    uint32_t (*open)(const char *argument);
+    void (*close)(void);
+    uint32_t (*get_num_channels)(void);
+    uint32_t (*select_channel)(uint32_t channel_id);
+    void (*send_message)(uint32_t message_header_send, size_t parameter_count,
+            const uint32_t *parameters, uint32_t *message_header_rcv, int32_t *status,
+            size_t *return_values_count, uint32_t *return_values);
+    void (*receive_delayed_response)(uint32_t *message_header_rcv, int32_t *status,
+            size_t *return_values_count, uint32_t *return_values);
+    void (*receive_notification)(uint32_t *message_header_rcv, size_t *return_values_count,
+            uint32_t *return_values);
+    uint32_t (*get_completion_mode)(void); /* NULL if the transport has a single mode */
+    uint32_t (*get_channel_size)(void);    /* NULL if the transport does not know it */
+} PAL_TRANSPORT_s;
+
+/* Transports of the platform, NULL terminated */
+extern const PAL_TRANSPORT_s *const g_pal_transports[];
+
+/* Serves the commands of the agent from a recording, see pal_record.h */
+extern const PAL_TRANSPORT_s g_pal_replay_transport;
+
+uint32_t pal_transport_open(void);
+void pal_transport_close(void);
+const PAL_TRANSPORT_s *pal_transport_current(void);
+
+#endif /* __PAL_TRANSPORT_H__ */
@@ -0,0 +1,35 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef __PAL_WATCHDOG_H__
+#define __PAL_WATCHDOG_H__
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+/*
+ * Test watchdog of the hosted platforms. A thread watches the budget of the
+ * test run by each agent thread. Once a test is over budget, its thread is
+ * signalled out of any blocking wait and its later messages fail at once,
+ * so that the test unwinds and is reported as TIMEOUT.
+ */
+#define PAL_WATCHDOG_MAX_THREADS  16
+#define PAL_WATCHDOG_TICK_MS      10
+
+bool pal_watchdog_expired(void);
+
+#endif /* __PAL_WATCHDOG_H__ */
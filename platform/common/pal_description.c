@@ -0,0 +1,187 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pal_interface.h>
+#include <pal_description.h>
+
+/* Rows of each key of the loaded description, indexed by key id for constant time lookups */
+struct pal_description_table {
+    const struct pal_description_row *rows;
+    uint32_t num_rows;
+};
+
+static struct pal_description_table g_table[PDESC_NUM_KEYS];
+static const uint32_t *g_values;
+static const char *g_strings;
+
+#define PAL_DESCRIPTION_KEY_TYPE(name, id, text, type) [id] = type,
+static const uint8_t g_key_types[PDESC_NUM_KEYS] = {
+    PAL_DESCRIPTION_KEYS(PAL_DESCRIPTION_KEY_TYPE)
+};
+#undef PAL_DESCRIPTION_KEY_TYPE
+
+/**
+  @brief   Checks a description blob and indexes its keys. The blob is used
+           in place and must stay valid while the agent runs.
+  @param   blob  description, 4 byte aligned
+  @param   size  size of the blob in bytes
+  @return  PAL_STATUS_PASS, or PAL_STATUS_FAIL if the blob is malformed
+**/
+uint32_t pal_description_load(const void *blob, size_t size)
+{
+    const struct pal_description_header *header = blob;
+    const struct pal_description_key *keys;
+    const struct pal_description_row *rows;
+    const uint32_t *values;
+    const char *strings;
+    uint64_t length;
+    uint32_t i, j, k;
+
+    memset(g_table, 0, sizeof(g_table));
+
+    if ((blob == NULL) || ((uintptr_t)blob % sizeof(uint32_t)) || (size < sizeof(*header)) ||
+        (header->magic != PAL_DESCRIPTION_MAGIC) || (header->version != PAL_DESCRIPTION_VERSION))
+        return PAL_STATUS_FAIL;
+
+    length = sizeof(*header) + ((uint64_t)header->num_keys * sizeof(*keys)) +
+             ((uint64_t)header->num_rows * sizeof(*rows)) +
+             ((uint64_t)header->num_values * sizeof(*values)) + header->strings_size;
+    if ((length > size) ||
+        ((header->strings_size != 0) &&
+         (((const char *)blob)[length - 1] != '\0')))
+        return PAL_STATUS_FAIL;
+
+    keys = (const void *)(header + 1);
+    rows = (const void *)(keys + header->num_keys);
+    values = (const void *)(rows + header->num_rows);
+    strings = (const char *)(values + header->num_values);
+
+    for (i = 0; i < header->num_rows; i++) {
+        if ((uint64_t)rows[i].first_value + rows[i].num_values > header->num_values)
+            return PAL_STATUS_FAIL;
+    }
+
+    for (i = 0; i < header->num_keys; i++) {
+        if ((uint64_t)keys[i].first_row + keys[i].num_rows > header->num_rows)
+            return PAL_STATUS_FAIL;
+
+        /* Keys of a newer compiler are skipped, as are empty keys */
+        if ((keys[i].key >= PDESC_NUM_KEYS) || (keys[i].num_rows == 0))
+            continue;
+
+        if (g_key_types[keys[i].key] == PAL_DESCRIPTION_STRING) {
+            for (j = keys[i].first_row; j < keys[i].first_row + keys[i].num_rows; j++) {
+                for (k = 0; k < rows[j].num_values; k++) {
+                    if (values[rows[j].first_value + k] >= header->strings_size)
+                        return PAL_STATUS_FAIL;
+                }
+            }
+        }
+
+        g_table[keys[i].key].rows = &rows[keys[i].first_row];
+        g_table[keys[i].key].num_rows = keys[i].num_rows;
+    }
+
+    g_values = values;
+    g_strings = strings;
+    return PAL_STATUS_PASS;
+}
+
+/**
+  @brief   Loads a description blob from a file
+  @param   path  file written by scmi_pdesc_compile
+  @return  PAL_STATUS_PASS, or PAL_STATUS_FAIL if it cannot be loaded
+**/
+uint32_t pal_description_load_file(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    uint32_t *blob = NULL;
+    long size;
+
+    if (file == NULL) {
+        printf("\nERROR: cannot open platform description %s\n", path);
+        return PAL_STATUS_FAIL;
+    }
+
+    if ((fseek(file, 0, SEEK_END) == 0) && ((size = ftell(file)) > 0) &&
+        (fseek(file, 0, SEEK_SET) == 0) &&
+        ((blob = malloc(size)) != NULL) &&
+        (fread(blob, 1, size, file) == (size_t)size) &&
+        (pal_description_load(blob, size) == PAL_STATUS_PASS)) {
+        fclose(file);
+        return PAL_STATUS_PASS;
+    }
+
+    printf("\nERROR: invalid platform description %s\n", path);
+    free(blob);
+    fclose(file);
+    return PAL_STATUS_FAIL;
+}
+
+/**
+  @brief   Tells whether the loaded description gives the expected values of a key
+  @param   key  PDESC_* key
+  @return  true if the accessors of the key read the description
+**/
+bool pal_description_has(uint32_t key)
+{
+    return (key < PDESC_NUM_KEYS) && (g_table[key].rows != NULL);
+}
+
+/**
+  @brief   Returns a value of a key of the loaded description
+  @param   key    PDESC_* key
+  @param   row    row, 0 for scalars and per domain vectors
+  @param   index  index in the row
+  @return  value, 0 if the description has none at this place
+**/
+uint32_t pal_description_value(uint32_t key, uint32_t row, uint32_t index)
+{
+    const struct pal_description_row *entry;
+
+    if (!pal_description_has(key) || (row >= g_table[key].num_rows))
+        return 0;
+
+    entry = &g_table[key].rows[row];
+    if (index >= entry->num_values)
+        return 0;
+
+    return g_values[entry->first_value + index];
+}
+
+/**
+  @brief   Returns a string of a key of the loaded description
+  @param   key    PDESC_* key of string type
+  @param   index  0 for scalars, the domain for per domain names
+  @return  string, empty if the description has none at this place
+**/
+char *pal_description_string(uint32_t key, uint32_t index)
+{
+    const struct pal_description_row *entry;
+
+    if (!pal_description_has(key))
+        return "";
+
+    entry = &g_table[key].rows[0];
+    if (index >= entry->num_values)
+        return "";
+
+    return (char *)&g_strings[g_values[entry->first_value + index]];
+}
@@ -0,0 +1,223 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <pal_interface.h>
+#include <pal_discovery.h>
+
+/* Entries of the cache, read from the file and added to by the walks */
+typedef struct pal_discovery_node {
+    struct pal_discovery_node *next;
+    VAL_DISCOVERY_KEY_s key;
+    uint8_t table[];
+} PAL_DISCOVERY_NODE_s;
+
+static PAL_DISCOVERY_NODE_s *g_discovery_entries;
+static char *g_discovery_path;
+static uint32_t g_discovery_dirty;
+static pthread_mutex_t g_discovery_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+  @brief   Finds the entry of a key, with the lock held
+  @param   key  VAL_DISCOVERY_KEY_s
+  @return  entry, or NULL
+**/
+static PAL_DISCOVERY_NODE_s *pal_discovery_find(const VAL_DISCOVERY_KEY_s *key)
+{
+    PAL_DISCOVERY_NODE_s *node;
+
+    for (node = g_discovery_entries; node != NULL; node = node->next) {
+        if (memcmp(&node->key, key, sizeof(*key)) == 0)
+            return node;
+    }
+
+    return NULL;
+}
+
+/**
+  @brief   Adds an entry, or replaces the table of an existing one, with the
+           lock held
+  @param   key    VAL_DISCOVERY_KEY_s, its table_size is the size of the table
+  @param   table  info table
+  @return  PAL_STATUS_PASS, or PAL_STATUS_FAIL if out of memory
+**/
+static uint32_t pal_discovery_insert(const VAL_DISCOVERY_KEY_s *key, const void *table)
+{
+    PAL_DISCOVERY_NODE_s *node = pal_discovery_find(key);
+
+    if (node == NULL) {
+        node = malloc(sizeof(*node) + key->table_size);
+        if (node == NULL)
+            return PAL_STATUS_FAIL;
+
+        node->key = *key;
+        node->next = g_discovery_entries;
+        g_discovery_entries = node;
+    }
+
+    memcpy(node->table, table, key->table_size);
+    return PAL_STATUS_PASS;
+}
+
+/**
+  @brief   Reads the cache file. A missing file is an empty cache, as is a
+           file of another format, which is replaced on close.
+  @param   path  cache file
+  @return  PAL_STATUS_PASS, or PAL_STATUS_FAIL if out of memory
+**/
+uint32_t pal_discovery_open(const char *path)
+{
+    PAL_DISCOVERY_FILE_s header;
+    PAL_DISCOVERY_ENTRY_s entry;
+    uint8_t *table;
+    FILE *file;
+    uint32_t i;
+
+    g_discovery_path = strdup(path);
+    if (g_discovery_path == NULL)
+        return PAL_STATUS_FAIL;
+
+    file = fopen(path, "rb");
+    if (file == NULL)
+        return PAL_STATUS_PASS;
+
+    if ((fread(&header, sizeof(header), 1, file) != 1) ||
+        (header.magic != PAL_DISCOVERY_MAGIC) || (header.version != PAL_DISCOVERY_VERSION)) {
+        printf("\nWARNING: discovery cache %s not read, it will be replaced\n", path);
+        fclose(file);
+        return PAL_STATUS_PASS;
+    }
+
+    table = malloc(PAL_DISCOVERY_MAX_TABLE);
+    if (table == NULL) {
+        fclose(file);
+        return PAL_STATUS_FAIL;
+    }
+
+    pthread_mutex_lock(&g_discovery_lock);
+    for (i = 0; i < header.num_entries; i++) {
+        if ((fread(&entry, sizeof(entry), 1, file) != 1) ||
+            (entry.key.table_size > PAL_DISCOVERY_MAX_TABLE) ||
+            (fread(table, entry.key.table_size, 1, file) != 1)) {
+            printf("\nWARNING: discovery cache %s truncated\n", path);
+            break;
+        }
+
+        if (pal_discovery_insert(&entry.key, table) != PAL_STATUS_PASS)
+            break;
+    }
+    pthread_mutex_unlock(&g_discovery_lock);
+
+    free(table);
+    fclose(file);
+    return PAL_STATUS_PASS;
+}
+
+/**
+  @brief   Writes the cache file if a table was added, to a temporary file
+           renamed over it so that an interrupted write leaves the old one
+  @return  none
+**/
+void pal_discovery_close(void)
+{
+    PAL_DISCOVERY_FILE_s header = { PAL_DISCOVERY_MAGIC, PAL_DISCOVERY_VERSION, 0 };
+    PAL_DISCOVERY_NODE_s *node;
+    PAL_DISCOVERY_NODE_s *next;
+    char temp_path[4096];
+    FILE *file = NULL;
+    int written = 0;
+
+    pthread_mutex_lock(&g_discovery_lock);
+
+    if (g_discovery_dirty && (g_discovery_path != NULL) &&
+        (snprintf(temp_path, sizeof(temp_path), "%s.tmp", g_discovery_path) <
+         (int)sizeof(temp_path)))
+        file = fopen(temp_path, "wb");
+
+    if (file != NULL) {
+        for (node = g_discovery_entries; node != NULL; node = node->next)
+            header.num_entries++;
+
+        written = (fwrite(&header, sizeof(header), 1, file) == 1);
+        for (node = g_discovery_entries; written && (node != NULL); node = node->next)
+            written = (fwrite(&node->key, sizeof(PAL_DISCOVERY_ENTRY_s), 1, file) == 1) &&
+                      (fwrite(node->table, node->key.table_size, 1, file) == 1);
+
+        if ((fclose(file) != 0) || !written || (rename(temp_path, g_discovery_path) != 0)) {
+            printf("\nWARNING: discovery cache %s not written\n", g_discovery_path);
+            remove(temp_path);
+        }
+    }
+
+    for (node = g_discovery_entries; node != NULL; node = next) {
+        next = node->next;
+        free(node);
+    }
+    g_discovery_entries = NULL;
+    g_discovery_dirty = 0;
+    free(g_discovery_path);
+    g_discovery_path = NULL;
+
+    pthread_mutex_unlock(&g_discovery_lock);
+}
+
+/**
+  @brief   This API copies the cached table of a key, from any thread
+  @param   key    VAL_DISCOVERY_KEY_s
+  @param   table  info table to be filled
+  @param   size   size of the table
+  @return  PAL_STATUS_PASS, or PAL_STATUS_FAIL if the table is not cached
+**/
+uint32_t pal_discovery_cache_load(const void *key, void *table, uint32_t size)
+{
+    PAL_DISCOVERY_NODE_s *node;
+    uint32_t status = PAL_STATUS_FAIL;
+
+    pthread_mutex_lock(&g_discovery_lock);
+    node = pal_discovery_find(key);
+    if ((g_discovery_path != NULL) && (node != NULL) && (node->key.table_size == size)) {
+        memcpy(table, node->table, size);
+        status = PAL_STATUS_PASS;
+    }
+    pthread_mutex_unlock(&g_discovery_lock);
+
+    return status;
+}
+
+/**
+  @brief   This API caches the table of a key, from any thread. Tables
+           larger than PAL_DISCOVERY_MAX_TABLE are not kept.
+  @param   key    VAL_DISCOVERY_KEY_s
+  @param   table  info table
+  @param   size   size of the table
+  @return  none
+**/
+void pal_discovery_cache_store(const void *key, const void *table, uint32_t size)
+{
+    const VAL_DISCOVERY_KEY_s *cache_key = key;
+
+    if ((size != cache_key->table_size) || (size > PAL_DISCOVERY_MAX_TABLE))
+        return;
+
+    pthread_mutex_lock(&g_discovery_lock);
+    if ((g_discovery_path != NULL) && (pal_discovery_insert(cache_key, table) == PAL_STATUS_PASS))
+        g_discovery_dirty = 1;
+    pthread_mutex_unlock(&g_discovery_lock);
+}
@@ -0,0 +1,127 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <pal_interface.h>
+#include <pal_record.h>
+
+/*
+ * The recording file is sized for PAL_RECORD_CAPACITY records up front and
+ * mapped, so that appending a record is a copy into memory with no system
+ * call on the path of a command. It is cut to the records written on close.
+ */
+static VAL_RECORD_FILE_s *g_record_file;
+static VAL_RECORD_s *g_records;
+static uint32_t g_record_claimed;
+static int g_record_fd = -1;
+
+#define PAL_RECORD_FILE_SIZE(num_records) \
+    (sizeof(VAL_RECORD_FILE_s) + ((size_t)(num_records) * sizeof(VAL_RECORD_s)))
+
+/**
+  @brief   Creates a recording file and maps it
+  @param   path  file to be written, replaced if it exists
+  @return  PAL_STATUS_PASS, or PAL_STATUS_FAIL if it cannot be created
+**/
+uint32_t pal_record_open(const char *path)
+{
+    size_t size = PAL_RECORD_FILE_SIZE(PAL_RECORD_CAPACITY);
+    void *map;
+
+    g_record_fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (g_record_fd < 0) {
+        printf("\nERROR: cannot create recording %s\n", path);
+        return PAL_STATUS_FAIL;
+    }
+
+    /* Allocate the blocks now rather than on the first write to each page */
+    if (posix_fallocate(g_record_fd, 0, size) != 0) {
+        printf("\nERROR: cannot allocate recording %s\n", path);
+        close(g_record_fd);
+        g_record_fd = -1;
+        return PAL_STATUS_FAIL;
+    }
+
+    map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, g_record_fd, 0);
+    if (map == MAP_FAILED) {
+        printf("\nERROR: cannot map recording %s\n", path);
+        close(g_record_fd);
+        g_record_fd = -1;
+        return PAL_STATUS_FAIL;
+    }
+
+    g_record_file = map;
+    g_record_file->magic = VAL_RECORD_MAGIC;
+    g_record_file->version = VAL_RECORD_VERSION;
+    g_record_file->record_size = sizeof(VAL_RECORD_s);
+    g_record_file->num_records = 0;
+    g_records = (VAL_RECORD_s *)(g_record_file + 1);
+    g_record_claimed = 0;
+    return PAL_STATUS_PASS;
+}
+
+/**
+  @brief   Cuts the recording file to the records written and closes it
+  @return  none
+**/
+void pal_record_close(void)
+{
+    uint32_t num_records;
+
+    if (g_record_file == NULL)
+        return;
+
+    num_records = __atomic_load_n(&g_record_file->num_records, __ATOMIC_ACQUIRE);
+    if (g_record_claimed > PAL_RECORD_CAPACITY)
+        printf("\nWARNING: recording full, %u records dropped\n",
+               g_record_claimed - PAL_RECORD_CAPACITY);
+
+    munmap(g_record_file, PAL_RECORD_FILE_SIZE(PAL_RECORD_CAPACITY));
+    g_record_file = NULL;
+    g_records = NULL;
+
+    if (ftruncate(g_record_fd, PAL_RECORD_FILE_SIZE(num_records)) != 0)
+        printf("\nWARNING: recording not truncated\n");
+    close(g_record_fd);
+    g_record_fd = -1;
+}
+
+/**
+  @brief   Appends a record, from any thread. Records past the capacity of
+           the file are dropped.
+  @param   record  VAL_RECORD_s
+  @param   size    size of the record in bytes
+  @return  none
+**/
+void pal_record_write(const void *record, size_t size)
+{
+    uint32_t slot;
+
+    if ((g_record_file == NULL) || (size != sizeof(VAL_RECORD_s)))
+        return;
+
+    slot = __atomic_fetch_add(&g_record_claimed, 1, __ATOMIC_RELAXED);
+    if (slot >= PAL_RECORD_CAPACITY)
+        return;
+
+    memcpy(&g_records[slot], record, size);
+    __atomic_fetch_add(&g_record_file->num_records, 1, __ATOMIC_RELEASE);
+}
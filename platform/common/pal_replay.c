@@ -0,0 +1,385 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <pal_interface.h>
+#include <pal_record.h>
+#include <pal_transport.h>
+#include <scmi_codec.h>
+
+/* Status of a command the recording has no response for, SCMI GENERIC_ERROR */
+#define PAL_REPLAY_GENERIC_ERROR  -8
+#define PAL_REPLAY_NUM_TOKENS     (1u << (SCMI_CODEC_TOKEN_HIGH - SCMI_CODEC_TOKEN_LOW + 1))
+
+/*
+ * Replay state of a channel. The records of a channel are served in order
+ * from its cursor. Tokens are handed out by the live run, so the recorded
+ * commands replayed on the channel are kept by recorded token along with
+ * the token they were replayed with, for the delayed responses that follow.
+ */
+struct pal_replay_channel {
+    uint32_t cursor;
+    uint32_t last_protocol_id;
+    uint32_t commands[PAL_REPLAY_NUM_TOKENS];
+    uint16_t tokens[PAL_REPLAY_NUM_TOKENS];
+};
+
+static const VAL_RECORD_FILE_s *g_replay_file;
+static const VAL_RECORD_s *g_replay_records;
+static size_t g_replay_size;
+static uint8_t *g_replay_used;
+static uint32_t g_replay_num_channels;
+static struct pal_replay_channel g_replay_channels[PAL_REPLAY_MAX_CHANNELS];
+
+/* channel used by the calling thread, see pal_replay_select() */
+static __thread uint32_t g_replay_channel;
+
+/**
+  @brief   Maps a recording to be replayed
+  @param   path  file written by an agent built with RECORD=1
+  @return  PAL_STATUS_PASS, or PAL_STATUS_FAIL if it cannot be replayed
+**/
+uint32_t pal_replay_open(const char *path)
+{
+    const VAL_RECORD_FILE_s *file;
+    struct stat info;
+    uint32_t i;
+    void *map;
+    int fd;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        printf("\nERROR: cannot open recording %s\n", path);
+        return PAL_STATUS_FAIL;
+    }
+
+    if ((fstat(fd, &info) != 0) || ((size_t)info.st_size < sizeof(*file))) {
+        printf("\nERROR: invalid recording %s\n", path);
+        close(fd);
+        return PAL_STATUS_FAIL;
+    }
+
+    map = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); /* The mapping outlives the descriptor */
+    if (map == MAP_FAILED) {
+        printf("\nERROR: cannot map recording %s\n", path);
+        return PAL_STATUS_FAIL;
+    }
+
+    file = map;
+    if ((file->magic != VAL_RECORD_MAGIC) || (file->version != VAL_RECORD_VERSION) ||
+        (file->record_size != sizeof(VAL_RECORD_s)) ||
+        (sizeof(*file) + ((uint64_t)file->num_records * sizeof(VAL_RECORD_s)) >
+         (uint64_t)info.st_size) ||
+        ((g_replay_used = calloc(file->num_records + 1, 1)) == NULL)) {
+        printf("\nERROR: invalid recording %s\n", path);
+        munmap(map, info.st_size);
+        return PAL_STATUS_FAIL;
+    }
+
+    g_replay_file = file;
+    g_replay_records = (const VAL_RECORD_s *)(file + 1);
+    g_replay_size = info.st_size;
+    memset(g_replay_channels, 0, sizeof(g_replay_channels));
+
+    /* As many channels as the recorded run used, so --parallel runs the same batches */
+    g_replay_num_channels = 1;
+    for (i = 0; i < file->num_records; i++) {
+        if ((g_replay_records[i].channel < PAL_REPLAY_MAX_CHANNELS) &&
+            (g_replay_records[i].channel >= g_replay_num_channels))
+            g_replay_num_channels = g_replay_records[i].channel + 1;
+    }
+    return PAL_STATUS_PASS;
+}
+
+/**
+  @brief   Releases the recording being replayed
+  @return  none
+**/
+void pal_replay_close(void)
+{
+    if (g_replay_file == NULL)
+        return;
+
+    munmap((void *)g_replay_file, g_replay_size);
+    free(g_replay_used);
+    g_replay_file = NULL;
+    g_replay_records = NULL;
+    g_replay_used = NULL;
+}
+
+/**
+  @brief   Returns the number of channels of the recording
+  @return  number of channels
+**/
+static uint32_t pal_replay_get_num_channels(void)
+{
+    return g_replay_num_channels;
+}
+
+/**
+  @brief   Binds the calling thread to a channel of the recording
+  @param   channel_id  channel identifier
+  @return  status
+**/
+uint32_t pal_replay_select(uint32_t channel_id)
+{
+    if (channel_id >= PAL_REPLAY_MAX_CHANNELS)
+        return PAL_STATUS_FAIL;
+
+    g_replay_channel = channel_id;
+    return PAL_STATUS_PASS;
+}
+
+/**
+  @brief   Tells whether a record answers what the agent is waiting for. A
+           delayed response must follow a command replayed on the channel,
+           a notification must be of the protocol last used on it.
+  @param   channel         channel of the agent
+  @param   record          record
+  @param   kind            VAL_RECORD_COMMAND, _DELAYED_RESPONSE or _NOTIFICATION
+  @param   command_header  header sent, its token is not compared
+  @param   parameter_count number of parameters sent
+  @param   parameters      parameters sent
+  @return  true if the record matches
+**/
+static bool pal_replay_match(const struct pal_replay_channel *channel,
+        const VAL_RECORD_s *record, uint32_t kind, uint32_t command_header,
+        size_t parameter_count, const uint32_t *parameters)
+{
+    uint32_t issuer;
+    size_t i;
+
+    if (record->kind != kind)
+        return false;
+
+    if (kind == VAL_RECORD_DELAYED_RESPONSE) {
+        issuer = channel->commands[scmi_codec_token(record->header)];
+        return (issuer != 0) &&
+               (scmi_codec_protocol_id(issuer) == scmi_codec_protocol_id(record->header)) &&
+               (scmi_codec_message_id(issuer) == scmi_codec_message_id(record->header));
+    }
+
+    if (kind == VAL_RECORD_NOTIFICATION)
+        return scmi_codec_protocol_id(record->header) == channel->last_protocol_id;
+
+    if ((scmi_codec_protocol_id(record->command_header) !=
+         scmi_codec_protocol_id(command_header)) ||
+        (scmi_codec_message_id(record->command_header) != scmi_codec_message_id(command_header)) ||
+        (scmi_codec_type(record->command_header) != scmi_codec_type(command_header)) ||
+        (record->num_parameters != parameter_count))
+        return false;
+
+    for (i = 0; (i < parameter_count) && (i < VAL_RECORD_MAX_PARAMETERS); i++) {
+        if (record->parameters[i] != parameters[i])
+            return false;
+    }
+
+    return true;
+}
+
+/**
+  @brief   Takes the record answering what the agent is waiting for: the
+           next one of the channel, else the first one left on any channel,
+           so that a sequential run can replay a parallel one
+  @param   kind            VAL_RECORD_COMMAND, _DELAYED_RESPONSE or _NOTIFICATION
+  @param   command_header  header sent, 0 when waiting for a message
+  @param   parameter_count number of parameters sent
+  @param   parameters      parameters sent
+  @return  record, NULL if the recording has none
+**/
+static const VAL_RECORD_s *pal_replay_claim(uint32_t kind, uint32_t command_header,
+        size_t parameter_count, const uint32_t *parameters)
+{
+    struct pal_replay_channel *channel = &g_replay_channels[g_replay_channel];
+    uint32_t num_records = g_replay_file->num_records;
+    uint32_t i;
+
+    for (i = channel->cursor; i < num_records; i++) {
+        if ((g_replay_records[i].channel == g_replay_channel) &&
+            pal_replay_match(channel, &g_replay_records[i], kind, command_header,
+                             parameter_count, parameters) &&
+            !__atomic_exchange_n(&g_replay_used[i], 1, __ATOMIC_ACQ_REL)) {
+            channel->cursor = i + 1;
+            return &g_replay_records[i];
+        }
+    }
+
+    for (i = 0; i < num_records; i++) {
+        if (pal_replay_match(channel, &g_replay_records[i], kind, command_header,
+                             parameter_count, parameters) &&
+            !__atomic_exchange_n(&g_replay_used[i], 1, __ATOMIC_ACQ_REL))
+            return &g_replay_records[i];
+    }
+
+    return NULL;
+}
+
+/**
+  @brief   Hands a recorded message to the agent once it has taken as long
+           as it took in the recorded run
+  @param   record  record to be served
+  @param   header  header to be received
+  @param   start   CLOCK_MONOTONIC time the agent started waiting
+  @param   message_header_rcv, status, return_values_count, return_values
+                   message received by the agent
+  @return  none
+**/
+static void pal_replay_serve(const VAL_RECORD_s *record, uint32_t header,
+        const struct timespec *start, uint32_t *message_header_rcv, int32_t *status,
+        size_t *return_values_count, uint32_t *return_values)
+{
+    uint64_t deadline = ((uint64_t)start->tv_sec * 1000000000ull) + start->tv_nsec +
+                        record->latency_ns;
+    struct timespec until = { deadline / 1000000000ull, deadline % 1000000000ull };
+    uint32_t count = record->num_returns;
+    uint32_t i;
+
+    if (count > VAL_RECORD_MAX_RETURNS)
+        count = VAL_RECORD_MAX_RETURNS;
+    if (count > *return_values_count)
+        count = *return_values_count;
+
+    for (i = 0; i < count; i++)
+        return_values[i] = record->returns[i];
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &until, NULL) != 0)
+        ;
+
+    *message_header_rcv = header;
+    *status = record->status;
+    *return_values_count = count;
+}
+
+/**
+  @brief   Answers a command with the response of the recorded run
+  @param   see pal_send_message()
+  @return  none
+**/
+void pal_replay_send_message(uint32_t message_header_send, size_t parameter_count,
+        const uint32_t *parameters, uint32_t *message_header_rcv, int32_t *status,
+        size_t *return_values_count, uint32_t *return_values)
+{
+    struct pal_replay_channel *channel = &g_replay_channels[g_replay_channel];
+    uint32_t token = scmi_codec_token(message_header_send);
+    const VAL_RECORD_s *record;
+    struct timespec start;
+    uint32_t header;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    record = pal_replay_claim(VAL_RECORD_COMMAND, message_header_send, parameter_count,
+                              parameters);
+    if (record == NULL) {
+        printf("\nWARNING: no recorded response to 0x%08x\n", message_header_send);
+        *message_header_rcv = 0;
+        *status = PAL_REPLAY_GENERIC_ERROR;
+        *return_values_count = 0;
+        return;
+    }
+
+    /* The response carries the token of the live command, unless it did not in the recording */
+    header = record->header;
+    if ((header != 0) && (scmi_codec_token(header) == scmi_codec_token(record->command_header)))
+        header = scmi_codec_header(scmi_codec_protocol_id(header), scmi_codec_message_id(header),
+                                   scmi_codec_type(header), token);
+    channel->commands[scmi_codec_token(record->command_header)] = record->command_header;
+    channel->tokens[scmi_codec_token(record->command_header)] = token;
+    channel->last_protocol_id = scmi_codec_protocol_id(message_header_send);
+
+    pal_replay_serve(record, header, &start, message_header_rcv, status, return_values_count,
+                     return_values);
+}
+
+/**
+  @brief   Delivers the next recorded delayed response or notification
+  @param   kind  VAL_RECORD_DELAYED_RESPONSE or VAL_RECORD_NOTIFICATION
+  @param   see pal_receive_delayed_response()
+  @return  none
+**/
+void pal_replay_receive(uint32_t kind, uint32_t *message_header_rcv, int32_t *status,
+        size_t *return_values_count, uint32_t *return_values)
+{
+    struct pal_replay_channel *channel = &g_replay_channels[g_replay_channel];
+    const VAL_RECORD_s *record;
+    struct timespec start;
+    uint32_t header;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    record = pal_replay_claim(kind, 0, 0, NULL);
+    if (record == NULL) {
+        *message_header_rcv = 0;
+        *status = PAL_REPLAY_GENERIC_ERROR;
+        *return_values_count = 0;
+        return;
+    }
+
+    header = record->header;
+    if ((kind == VAL_RECORD_DELAYED_RESPONSE) && (header != 0))
+        header = scmi_codec_header(scmi_codec_protocol_id(header), scmi_codec_message_id(header),
+                                   scmi_codec_type(header),
+                                   channel->tokens[scmi_codec_token(header)]);
+
+    pal_replay_serve(record, header, &start, message_header_rcv, status, return_values_count,
+                     return_values);
+}
+
+/**
+  @brief   Delivers the next recorded delayed response
+  @param   see pal_receive_delayed_response()
+  @return  none
+**/
+static void pal_replay_receive_delayed_response(uint32_t *message_header_rcv, int32_t *status,
+        size_t *return_values_count, uint32_t *return_values)
+{
+    pal_replay_receive(VAL_RECORD_DELAYED_RESPONSE, message_header_rcv, status,
+            return_values_count, return_values);
+}
+
+/**
+  @brief   Delivers the next recorded notification
+  @param   see pal_receive_notification()
+  @return  none
+**/
+static void pal_replay_receive_notification(uint32_t *message_header_rcv,
+        size_t *return_values_count, uint32_t *return_values)
+{
+    int32_t status;
+
+    pal_replay_receive(VAL_RECORD_NOTIFICATION, message_header_rcv, &status,
+            return_values_count, return_values);
+}
+
+const PAL_TRANSPORT_s g_pal_replay_transport = {
+    .name = "replay",
+    .env = PAL_REPLAY_ENV,
+    .open = pal_replay_open,
+    .close = pal_replay_close,
+    .get_num_channels = pal_replay_get_num_channels,
+    .select_channel = pal_replay_select,
+    .send_message = pal_replay_send_message,
+    .receive_delayed_response = pal_replay_receive_delayed_response,
+    .receive_notification = pal_replay_receive_notification,
+};
@@ -0,0 +1,310 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <pal_interface.h>
+#include <pal_results.h>
+
+#define PAL_RESULTS_FAILURES_SIZE 2048
+
+/* The JUnit file always ends with this, each testcase is written over it */
+static const char g_junit_tail[] = "  </testsuite>\n</testsuites>\n";
+
+static FILE *g_json_file;
+static FILE *g_junit_file;
+static long g_junit_tail_offset;
+static pthread_mutex_t g_results_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Failed checks of the test run by the calling thread, for its JUnit testcase */
+static __thread char g_failures[PAL_RESULTS_FAILURES_SIZE];
+static __thread size_t g_failures_used;
+static __thread uint32_t g_failures_test_num;
+
+/**
+  @brief   Returns the length of a string without its trailing blanks, test
+           descriptions and check names are padded for the text log
+  @param   string  string
+  @return  length
+**/
+static size_t pal_results_length(const char *string)
+{
+    size_t length = strlen(string);
+
+    while ((length > 0) && (string[length - 1] == ' '))
+        length--;
+
+    return length;
+}
+
+/**
+  @brief   Writes a JSON string, quoted and escaped
+  @param   file    output
+  @param   string  string
+  @return  none
+**/
+static void pal_results_json_string(FILE *file, const char *string)
+{
+    size_t length = pal_results_length(string);
+    size_t i;
+
+    fputc('"', file);
+    for (i = 0; i < length; i++) {
+        if ((string[i] == '"') || (string[i] == '\\'))
+            fprintf(file, "\\%c", string[i]);
+        else if ((unsigned char)string[i] < 0x20)
+            fprintf(file, "\\u%04x", string[i]);
+        else
+            fputc(string[i], file);
+    }
+    fputc('"', file);
+}
+
+/**
+  @brief   Writes an XML attribute value or text, escaped
+  @param   file    output
+  @param   string  string
+  @param   length  bytes of the string to write
+  @return  none
+**/
+static void pal_results_xml_string(FILE *file, const char *string, size_t length)
+{
+    size_t i;
+
+    for (i = 0; i < length; i++) {
+        switch (string[i]) {
+        case '&':
+            fputs("&amp;", file);
+            break;
+        case '<':
+            fputs("&lt;", file);
+            break;
+        case '>':
+            fputs("&gt;", file);
+            break;
+        case '"':
+            fputs("&quot;", file);
+            break;
+        default:
+            if (((unsigned char)string[i] >= 0x20) || (string[i] == '\n'))
+                fputc(string[i], file);
+        }
+    }
+}
+
+/**
+  @brief   Returns the name of a test or check status
+  @param   status  VAL_STATUS_PASS, _FAIL, _SKIP or _TIMEOUT
+  @return  name
+**/
+static const char *pal_results_status(uint32_t status)
+{
+    switch (status) {
+    case PAL_STATUS_PASS:
+        return "PASSED";
+    case PAL_STATUS_FAIL:
+        return "FAILED";
+    case PAL_STATUS_SKIP:
+        return "SKIPPED";
+    case PAL_STATUS_TIMEOUT:
+        return "TIMEOUT";
+    default:
+        return "UNKNOWN";
+    }
+}
+
+/**
+  @brief   Creates the result files that are asked for
+  @param   json_path   JSON Lines file, NULL for none
+  @param   junit_path  JUnit XML file, NULL for none
+  @return  PAL_STATUS_PASS, or PAL_STATUS_FAIL if a file cannot be created
+**/
+uint32_t pal_results_open(const char *json_path, const char *junit_path)
+{
+    if (json_path != NULL) {
+        g_json_file = fopen(json_path, "w");
+        if (g_json_file == NULL) {
+            printf("\nERROR: cannot create results %s\n", json_path);
+            return PAL_STATUS_FAIL;
+        }
+    }
+
+    if (junit_path != NULL) {
+        g_junit_file = fopen(junit_path, "w");
+        if (g_junit_file == NULL) {
+            printf("\nERROR: cannot create results %s\n", junit_path);
+            return PAL_STATUS_FAIL;
+        }
+
+        fputs("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+              "<testsuites name=\"scmi\">\n"
+              "  <testsuite name=\"scmi\">\n", g_junit_file);
+        g_junit_tail_offset = ftell(g_junit_file);
+        fputs(g_junit_tail, g_junit_file);
+        fflush(g_junit_file);
+    }
+
+    return PAL_STATUS_PASS;
+}
+
+/**
+  @brief   Closes the result files
+  @return  none
+**/
+void pal_results_close(void)
+{
+    pthread_mutex_lock(&g_results_lock);
+    if (g_json_file != NULL)
+        fclose(g_json_file);
+    if (g_junit_file != NULL)
+        fclose(g_junit_file);
+    g_json_file = NULL;
+    g_junit_file = NULL;
+    pthread_mutex_unlock(&g_results_lock);
+}
+
+/**
+  @brief   Writes a result as a JSON line
+  @param   result  result of a check or a test
+  @return  none
+**/
+static void pal_results_write_json(const VAL_RESULT_s *result)
+{
+    FILE *file = g_json_file;
+
+    fprintf(file, "{\"type\":\"%s\",\"test\":%u,\"suite\":",
+            (result->kind == VAL_RESULT_TEST) ? "test" : "check", result->test_num);
+    pal_results_json_string(file, result->suite);
+    fputs(",\"description\":", file);
+    pal_results_json_string(file, result->description);
+
+    if (result->kind == VAL_RESULT_CHECK) {
+        fputs(",\"check\":", file);
+        pal_results_json_string(file, result->check);
+    }
+
+    fprintf(file, ",\"result\":\"%s\",\"elapsed_ns\":%" PRIu64 ",\"duration_ns\":%" PRIu64,
+            pal_results_status(result->status), result->elapsed_ns, result->duration_ns);
+
+    if (result->value_type == VAL_RESULT_NUMBER) {
+        fprintf(file, ",\"expected\":%u,\"received\":%u", result->expected, result->received);
+    } else if (result->value_type == VAL_RESULT_STRING) {
+        fputs(",\"expected\":", file);
+        pal_results_json_string(file, result->expected_string);
+        fputs(",\"received\":", file);
+        pal_results_json_string(file, result->received_string);
+    }
+
+    fputs("}\n", file);
+    fflush(file);
+}
+
+/**
+  @brief   Notes a failed check of the running test, for its JUnit testcase
+  @param   result  result of a check
+  @return  none
+**/
+static void pal_results_note_failure(const VAL_RESULT_s *result)
+{
+    size_t space;
+    int length;
+
+    if (g_failures_test_num != result->test_num) {
+        g_failures_used = 0;
+        g_failures_test_num = result->test_num;
+    }
+
+    space = sizeof(g_failures) - g_failures_used;
+    if (result->value_type == VAL_RESULT_NUMBER)
+        length = snprintf(g_failures + g_failures_used, space,
+                          "CHECK %.*s: expected 0x%08x, received 0x%08x\n",
+                          (int)pal_results_length(result->check), result->check,
+                          result->expected, result->received);
+    else
+        length = snprintf(g_failures + g_failures_used, space,
+                          "CHECK %.*s: expected %.*s, received %.*s\n",
+                          (int)pal_results_length(result->check), result->check,
+                          (int)pal_results_length(result->expected_string),
+                          result->expected_string,
+                          (int)pal_results_length(result->received_string),
+                          result->received_string);
+
+    if ((length > 0) && ((size_t)length < space))
+        g_failures_used += length;
+}
+
+/**
+  @brief   Writes a test as a JUnit testcase, over the tail of the file which
+           is written again after it
+  @param   result  result of a test
+  @return  none
+**/
+static void pal_results_write_junit(const VAL_RESULT_s *result)
+{
+    FILE *file = g_junit_file;
+    size_t failures = (g_failures_test_num == result->test_num) ? g_failures_used : 0;
+
+    fseek(file, g_junit_tail_offset, SEEK_SET);
+
+    fprintf(file, "    <testcase classname=\"scmi.%s\" name=\"%u: ", result->suite,
+            result->test_num);
+    pal_results_xml_string(file, result->description, pal_results_length(result->description));
+    fprintf(file, "\" time=\"%.6f\"", result->elapsed_ns / 1e9);
+
+    if (result->status == PAL_STATUS_FAIL) {
+        fputs(">\n      <failure message=\"NON CONFORMANT\">", file);
+        pal_results_xml_string(file, g_failures, failures);
+        fputs("</failure>\n    </testcase>\n", file);
+    } else if (result->status == PAL_STATUS_TIMEOUT) {
+        fputs(">\n      <error message=\"TIMEOUT\">", file);
+        pal_results_xml_string(file, g_failures, failures);
+        fputs("</error>\n    </testcase>\n", file);
+    } else if (result->status == PAL_STATUS_SKIP) {
+        fputs(">\n      <skipped/>\n    </testcase>\n", file);
+    } else {
+        fputs("/>\n", file);
+    }
+
+    g_junit_tail_offset = ftell(file);
+    fputs(g_junit_tail, file);
+    fflush(file);
+}
+
+/**
+  @brief   Writes a result to the result files, from any thread
+  @param   result  result of a check or a test
+  @return  none
+**/
+void pal_results_write(const VAL_RESULT_s *result)
+{
+    if ((result->kind == VAL_RESULT_CHECK) && (result->status == PAL_STATUS_FAIL))
+        pal_results_note_failure(result);
+
+    pthread_mutex_lock(&g_results_lock);
+
+    if (g_json_file != NULL)
+        pal_results_write_json(result);
+
+    if ((g_junit_file != NULL) && (result->kind == VAL_RESULT_TEST))
+        pal_results_write_junit(result);
+
+    pthread_mutex_unlock(&g_results_lock);
+
+    if (result->kind == VAL_RESULT_TEST)
+        g_failures_used = 0;
+}
@@ -0,0 +1,199 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include <stdio.h>
+#include <pthread.h>
+#include <time.h>
+#include <pal_interface.h>
+#include <pal_stats.h>
+#include <val_stats.h>
+
+static FILE *g_stats_bin_file;
+static FILE *g_stats_csv_file;
+
+/* Sampler thread and the callback it runs on each tick */
+static pthread_t g_stats_thread;
+static bool g_stats_running;
+static bool g_stats_stopping;
+static void (*g_stats_sample)(void);
+static uint64_t g_stats_period_ns;
+static uint32_t g_stats_missed;
+
+/**
+  @brief   Creates the statistics files that are asked for
+  @param   bin_path  binary file, NULL for none
+  @param   csv_path  CSV file, NULL for none
+  @return  PAL_STATUS_PASS, or PAL_STATUS_FAIL if a file cannot be created
+**/
+uint32_t pal_stats_open(const char *bin_path, const char *csv_path)
+{
+    if (bin_path != NULL) {
+        g_stats_bin_file = fopen(bin_path, "wb");
+        if (g_stats_bin_file == NULL) {
+            printf("\nERROR: cannot create statistics %s\n", bin_path);
+            return PAL_STATUS_FAIL;
+        }
+    }
+
+    if (csv_path != NULL) {
+        g_stats_csv_file = fopen(csv_path, "w");
+        if (g_stats_csv_file == NULL) {
+            printf("\nERROR: cannot create statistics %s\n", csv_path);
+            return PAL_STATUS_FAIL;
+        }
+    }
+
+    return PAL_STATUS_PASS;
+}
+
+/**
+  @brief   Stops the sampler if the run did not, and closes the statistics
+           files
+  @return  none
+**/
+void pal_stats_close(void)
+{
+    pal_stats_sampler_stop();
+
+    if (g_stats_bin_file != NULL)
+        fclose(g_stats_bin_file);
+    if (g_stats_csv_file != NULL)
+        fclose(g_stats_csv_file);
+    g_stats_bin_file = NULL;
+    g_stats_csv_file = NULL;
+}
+
+/**
+  @brief   Adds ns to a time
+  @param   time  time to advance
+  @param   ns    ns to add
+  @return  none
+**/
+static void pal_stats_advance(struct timespec *time, uint64_t ns)
+{
+    ns += time->tv_nsec;
+    time->tv_sec += ns / 1000000000;
+    time->tv_nsec = ns % 1000000000;
+}
+
+/**
+  @brief   Sampler thread. Ticks are absolute so that the time the callback
+           takes does not drift the rate, ticks the callback overran are
+           counted as missed rather than run late.
+  @param   arg  unused
+  @return  none
+**/
+static void *pal_stats_thread(void *arg)
+{
+    struct timespec next, now;
+    int64_t late_ns;
+    uint64_t missed;
+
+    (void)arg;
+
+    clock_gettime(CLOCK_MONOTONIC, &next);
+    while (!__atomic_load_n(&g_stats_stopping, __ATOMIC_ACQUIRE)) {
+        g_stats_sample();
+
+        pal_stats_advance(&next, g_stats_period_ns);
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        late_ns = ((int64_t)(now.tv_sec - next.tv_sec) * 1000000000) +
+                  (now.tv_nsec - next.tv_nsec);
+        if (late_ns > 0) {
+            missed = (uint64_t)late_ns / g_stats_period_ns;
+            g_stats_missed += missed;
+            pal_stats_advance(&next, missed * g_stats_period_ns);
+        }
+
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL) != 0)
+            ;
+    }
+
+    return NULL;
+}
+
+/**
+  @brief   This API starts calling a function at a fixed rate, on a thread of
+           its own
+  @param   rate_hz  calls per second
+  @param   sample   function to call
+  @return  PAL_STATUS_PASS, or PAL_STATUS_FAIL if the thread cannot start
+**/
+uint32_t pal_stats_sampler_start(uint32_t rate_hz, void (*sample)(void))
+{
+    VAL_STATS_FILE_s header = { VAL_STATS_MAGIC, VAL_STATS_VERSION,
+                                sizeof(VAL_STATS_SAMPLE_s), rate_hz };
+
+    if (g_stats_running || (rate_hz == 0))
+        return PAL_STATUS_FAIL;
+
+    g_stats_sample = sample;
+    g_stats_period_ns = 1000000000ull / rate_hz;
+    g_stats_missed = 0;
+    g_stats_stopping = false;
+
+    if (g_stats_bin_file != NULL)
+        fwrite(&header, sizeof(header), 1, g_stats_bin_file);
+    if (g_stats_csv_file != NULL)
+        fputs("time_ns,protocol,domain,index,current,count,value,last_change_us\n",
+              g_stats_csv_file);
+
+    if (pthread_create(&g_stats_thread, NULL, pal_stats_thread, NULL) != 0)
+        return PAL_STATUS_FAIL;
+
+    g_stats_running = true;
+    return PAL_STATUS_PASS;
+}
+
+/**
+  @brief   This API stops the sampler and waits for its last call to return
+  @return  number of ticks the sampler missed
+**/
+uint32_t pal_stats_sampler_stop(void)
+{
+    if (!g_stats_running)
+        return 0;
+
+    __atomic_store_n(&g_stats_stopping, true, __ATOMIC_RELEASE);
+    pthread_join(g_stats_thread, NULL);
+    g_stats_running = false;
+
+    return g_stats_missed;
+}
+
+/**
+  @brief   This API writes samples to the statistics files
+  @param   samples  VAL_STATS_SAMPLE_s records
+  @param   count    number of samples
+  @return  none
+**/
+void pal_stats_write(const void *samples, uint32_t count)
+{
+    const VAL_STATS_SAMPLE_s *sample = samples;
+    uint32_t i;
+
+    if (g_stats_bin_file != NULL)
+        fwrite(samples, sizeof(*sample), count, g_stats_bin_file);
+
+    if (g_stats_csv_file == NULL)
+        return;
+
+    for (i = 0; i < count; i++, sample++)
+        fprintf(g_stats_csv_file, "%" PRIu64 ",%u,%u,%u,%u,%" PRIu64 ",%" PRIu64 ",%" PRIu64 "\n",
+                sample->time_ns, sample->protocol_id, sample->domain_id, sample->index,
+                sample->current, sample->count, sample->value, sample->last_change_us);
+}
@@ -0,0 +1,300 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pal_interface.h>
+#include <pal_transport.h>
+#include <pal_watchdog.h>
+#include <pal_description.h>
+
+/* --transport, NULL for the default transport */
+static const char *g_transport_name;
+
+/* Transport carrying the messages, set once before the suites start */
+static const PAL_TRANSPORT_s *g_transport;
+
+/**
+  @brief   Finds a transport of the platform by name
+  @param   name      name, up to its end or a ':'
+  @param   argument  storage for the argument following the ':', NULL if none
+  @return  transport, NULL if the platform has none of that name
+**/
+static const PAL_TRANSPORT_s *pal_transport_find(const char *name, const char **argument)
+{
+    const char *separator = strchr(name, ':');
+    size_t length = (separator != NULL) ? (size_t)(separator - name) : strlen(name);
+    uint32_t i;
+
+    *argument = (separator != NULL) ? separator + 1 : NULL;
+
+    for (i = 0; g_pal_transports[i] != NULL; i++) {
+        if ((strlen(g_pal_transports[i]->name) == length) &&
+            (strncmp(g_pal_transports[i]->name, name, length) == 0))
+            return g_pal_transports[i];
+    }
+
+    return NULL;
+}
+
+/**
+  @brief   Prints the transports of the platform
+  @return  none
+**/
+static void pal_transport_list(void)
+{
+    uint32_t i;
+
+    printf("\nTransports:");
+    for (i = 0; g_pal_transports[i] != NULL; i++) {
+        if (g_pal_transports[i]->env != NULL)
+            printf(" %s:<%s>", g_pal_transports[i]->name, g_pal_transports[i]->env);
+        else
+            printf(" %s", g_pal_transports[i]->name);
+    }
+    printf("\n");
+}
+
+/**
+  @brief   This API picks the transport opened by pal_initialize_system()
+  @param   name  <name>[:<argument>] of a transport of the platform, NULL
+                 for the default
+  @return  PAL_STATUS_PASS, or PAL_STATUS_FAIL if the platform has no such
+           transport
+**/
+uint32_t pal_set_transport(const char *name)
+{
+    const char *argument;
+
+    if ((name != NULL) && (pal_transport_find(name, &argument) == NULL)) {
+        printf("\nERROR: unknown transport %s", name);
+        pal_transport_list();
+        return PAL_STATUS_FAIL;
+    }
+
+    g_transport_name = name;
+    return PAL_STATUS_PASS;
+}
+
+/**
+  @brief   This API returns the name of the transport in use
+  @return  name, "none" before pal_initialize_system()
+**/
+const char *pal_get_transport(void)
+{
+    return (g_transport != NULL) ? g_transport->name : "none";
+}
+
+/**
+  @brief   Opens the transport picked by pal_set_transport(), else the
+           default one, see pal_transport.h
+  @return  PAL_STATUS_PASS, or PAL_STATUS_FAIL if it cannot be opened
+**/
+uint32_t pal_transport_open(void)
+{
+    const PAL_TRANSPORT_s *transport = NULL;
+    const char *argument = NULL;
+    uint32_t i;
+
+    if (g_transport_name != NULL) {
+        transport = pal_transport_find(g_transport_name, &argument);
+    } else {
+        for (i = 0; (transport == NULL) && (g_pal_transports[i] != NULL); i++) {
+            if ((g_pal_transports[i]->env == NULL) || (getenv(g_pal_transports[i]->env) != NULL))
+                transport = g_pal_transports[i];
+        }
+    }
+
+    if (transport == NULL)
+        return PAL_STATUS_FAIL;
+
+    if ((argument == NULL) && (transport->env != NULL)) {
+        argument = getenv(transport->env);
+        if (argument == NULL) {
+            printf("\nERROR: transport %s needs --transport=%s:<argument> or %s\n",
+                   transport->name, transport->name, transport->env);
+            return PAL_STATUS_FAIL;
+        }
+    }
+
+    if (transport->open(argument))
+        return PAL_STATUS_FAIL;
+
+    g_transport = transport;
+    return PAL_STATUS_PASS;
+}
+
+/**
+  @brief   Closes the transport
+  @return  none
+**/
+void pal_transport_close(void)
+{
+    if ((g_transport != NULL) && (g_transport->close != NULL))
+        g_transport->close();
+    g_transport = NULL;
+}
+
+/**
+  @brief   Returns the transport in use
+  @return  transport, NULL before pal_transport_open()
+**/
+const PAL_TRANSPORT_s *pal_transport_current(void)
+{
+    return g_transport;
+}
+
+/**
+  @brief   Fails a message at once when there is no transport, or when the
+           test of the calling thread is over budget, see pal_watchdog.h
+  @param   message_header_rcv   response message header
+  @param   status               status, NULL for notifications
+  @param   return_values_count  return values count
+  @return  true if the message failed
+**/
+static bool pal_transport_failed(uint32_t *message_header_rcv, int32_t *status,
+        size_t *return_values_count)
+{
+    if ((g_transport != NULL) && !pal_watchdog_expired())
+        return false;
+
+    *message_header_rcv = 0;
+    if (status != NULL)
+        *status = PAL_TRANSPORT_GENERIC_ERROR;
+    *return_values_count = 0;
+    return true;
+}
+
+/**
+  @brief   This API sends a command over the transport and waits for its
+           response
+  @param   message_header_send  command message header
+  @param   parameter_count      number of parameters
+  @param   parameters           parameters
+  @param   message_header_rcv   response message header
+  @param   status               status of the command
+  @param   return_values_count  return values count
+  @param   return_values        return values
+  @return  none
+**/
+void pal_send_message(uint32_t message_header_send, size_t parameter_count,
+        const uint32_t *parameters, uint32_t *message_header_rcv, int32_t *status,
+        size_t *return_values_count, uint32_t *return_values)
+{
+    if (pal_transport_failed(message_header_rcv, status, return_values_count))
+        return;
+
+    g_transport->send_message(message_header_send, parameter_count, parameters,
+            message_header_rcv, status, return_values_count, return_values);
+}
+
+/**
+  @brief   This API waits for a delayed response over the transport
+  @param   message_header_rcv   message header received
+  @param   status               status of the command processed
+  @param   return_values_count  return values count
+  @param   return_values        return values
+  @return  none
+**/
+void pal_receive_delayed_response(uint32_t *message_header_rcv, int32_t *status,
+        size_t *return_values_count, uint32_t *return_values)
+{
+    if (pal_transport_failed(message_header_rcv, status, return_values_count))
+        return;
+
+    g_transport->receive_delayed_response(message_header_rcv, status, return_values_count,
+            return_values);
+}
+
+/**
+  @brief   This API waits for a notification over the transport
+  @param   message_header_rcv   message header received
+  @param   return_values_count  return values count
+  @param   return_values        return values
+  @return  none
+**/
+void pal_receive_notification(uint32_t *message_header_rcv, size_t *return_values_count,
+        uint32_t *return_values)
+{
+    if (pal_transport_failed(message_header_rcv, NULL, return_values_count))
+        return;
+
+    g_transport->receive_notification(message_header_rcv, return_values_count, return_values);
+}
+
+/**
+  @brief   This API returns the number of channels of the transport
+  @return  number of channels
+**/
+uint32_t pal_get_num_channels(void)
+{
+    return (g_transport != NULL) ? g_transport->get_num_channels() : 0;
+}
+
+/**
+  @brief   This API binds the calling thread to a channel of the transport
+  @param   channel_id  channel identifier
+  @return  status
+**/
+uint32_t pal_select_channel(uint32_t channel_id)
+{
+    if (g_transport == NULL)
+        return PAL_STATUS_FAIL;
+
+    return g_transport->select_channel(channel_id);
+}
+
+/**
+  @brief   This API returns how the last command of the calling thread
+           completed, so that its latency can be told apart from the
+           latencies of the other mode
+  @return  PAL_COMPLETION_POLL, _INTERRUPT, or _NONE if the transport has a
+           single mode
+**/
+uint32_t pal_get_completion_mode(void)
+{
+    if ((g_transport == NULL) || (g_transport->get_completion_mode == NULL))
+        return PAL_COMPLETION_NONE;
+
+    return g_transport->get_completion_mode();
+}
+
+/**
+  @brief   This API returns the size of the shared memory of a channel, which
+           bounds the number of entries a paginated command returns. The
+           transport knows it when it is given as an option or fixed by the
+           wire format, else it comes from the platform description.
+  @return  size in bytes, PAL_CHANNEL_SIZE_DEFAULT if nothing tells it
+**/
+uint32_t pal_get_channel_size(void)
+{
+    uint32_t size = 0;
+
+    if ((g_transport != NULL) && (g_transport->get_channel_size != NULL))
+        size = g_transport->get_channel_size();
+
+    if (size == 0)
+        size = PAL_EXPECTED(PDESC_TRANSPORT_CHANNEL_SIZE, 0, 0, PAL_CHANNEL_SIZE_DEFAULT);
+
+    if (size < PAL_CHANNEL_SIZE_MIN)
+        return PAL_CHANNEL_SIZE_MIN;
+    if (size > PAL_CHANNEL_SIZE_MAX)
+        return PAL_CHANNEL_SIZE_MAX;
+
+    return size;
+}
@@ -0,0 +1,229 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#include <pthread.h>
+#include <time.h>
+#include <pal_interface.h>
+#include <pal_watchdog.h>
+
+/* Interrupts the blocking system call of an expired thread, see pal_watchdog_signal() */
+#define PAL_WATCHDOG_SIGNAL SIGUSR2
+
+/* Budget of the test run by an agent thread */
+struct pal_watchdog_slot {
+    pthread_t thread;
+    uint64_t deadline_ns;
+    bool in_use;
+    bool armed;
+    bool expired;
+};
+
+static struct pal_watchdog_slot g_watchdog_slots[PAL_WATCHDOG_MAX_THREADS];
+static uint32_t g_watchdog_num_slots;
+static pthread_mutex_t g_watchdog_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t g_watchdog_once = PTHREAD_ONCE_INIT;
+static pthread_key_t g_watchdog_key;
+static bool g_watchdog_running;
+static bool g_watchdog_full_reported;
+
+/* slot of the calling thread, claimed when it first arms the watchdog and
+   released when the thread exits, see pal_watchdog_release() */
+static __thread struct pal_watchdog_slot *g_watchdog_slot;
+
+/**
+  @brief   Handler of PAL_WATCHDOG_SIGNAL. It has nothing to do, being run is
+           what makes the interrupted system call return EINTR.
+  @param   signal  signal number
+  @return  none
+**/
+static void pal_watchdog_signal(int signal)
+{
+    (void)signal;
+}
+
+/**
+  @brief   Destructor of g_watchdog_key, frees the slot of an exiting thread
+           for the threads of later suites and benchmark runs
+  @param   value  slot of the thread
+  @return  none
+**/
+static void pal_watchdog_release(void *value)
+{
+    struct pal_watchdog_slot *slot = value;
+
+    pthread_mutex_lock(&g_watchdog_lock);
+    slot->armed = false;
+    slot->expired = false;
+    slot->in_use = false;
+    pthread_mutex_unlock(&g_watchdog_lock);
+}
+
+/**
+  @brief   Claims a slot for the calling thread, called with g_watchdog_lock
+           held
+  @return  slot, NULL when every slot is in use
+**/
+static struct pal_watchdog_slot *pal_watchdog_claim(void)
+{
+    struct pal_watchdog_slot *slot = NULL;
+    uint32_t i;
+
+    for (i = 0; i < g_watchdog_num_slots; i++) {
+        if (!g_watchdog_slots[i].in_use) {
+            slot = &g_watchdog_slots[i];
+            break;
+        }
+    }
+
+    if ((slot == NULL) && (g_watchdog_num_slots < PAL_WATCHDOG_MAX_THREADS))
+        slot = &g_watchdog_slots[g_watchdog_num_slots++];
+
+    if (slot == NULL)
+        return NULL;
+
+    slot->thread = pthread_self();
+    slot->armed = false;
+    slot->expired = false;
+    slot->in_use = true;
+    pthread_setspecific(g_watchdog_key, slot);
+
+    return slot;
+}
+
+/**
+  @brief   Watchdog thread, marks the threads whose test is over budget and
+           signals them every tick until they disarm
+  @param   arg  unused
+  @return  none
+**/
+static void *pal_watchdog_thread(void *arg)
+{
+    struct timespec tick = { 0, PAL_WATCHDOG_TICK_MS * 1000000 };
+    struct pal_watchdog_slot *slot;
+    uint64_t now;
+    uint32_t i;
+
+    (void)arg;
+
+    while (1) {
+        nanosleep(&tick, NULL);
+        now = pal_get_time_ns();
+
+        pthread_mutex_lock(&g_watchdog_lock);
+        for (i = 0; i < g_watchdog_num_slots; i++) {
+            slot = &g_watchdog_slots[i];
+            if (!slot->armed || (now < slot->deadline_ns))
+                continue;
+
+            __atomic_store_n(&slot->expired, true, __ATOMIC_RELEASE);
+            pthread_kill(slot->thread, PAL_WATCHDOG_SIGNAL);
+        }
+        pthread_mutex_unlock(&g_watchdog_lock);
+    }
+
+    return NULL;
+}
+
+/**
+  @brief   Installs the signal handler and starts the watchdog thread
+  @return  none
+**/
+static void pal_watchdog_start(void)
+{
+    struct sigaction action;
+    pthread_t thread;
+
+    /* No SA_RESTART, blocking system calls must return on the signal */
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = pal_watchdog_signal;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(PAL_WATCHDOG_SIGNAL, &action, NULL) != 0)
+        return;
+
+    if (pthread_key_create(&g_watchdog_key, pal_watchdog_release) != 0)
+        return;
+
+    if (pthread_create(&thread, NULL, pal_watchdog_thread, NULL) != 0)
+        return;
+
+    pthread_detach(thread);
+    g_watchdog_running = true;
+}
+
+/**
+  @brief   This API starts the budget of the test run by the calling thread
+  @param   budget_ms  budget of the test in ms
+  @return  none
+**/
+void pal_watchdog_arm(uint32_t budget_ms)
+{
+    struct pal_watchdog_slot *slot;
+
+    pthread_once(&g_watchdog_once, pal_watchdog_start);
+    if (!g_watchdog_running)
+        return;
+
+    pthread_mutex_lock(&g_watchdog_lock);
+    slot = g_watchdog_slot;
+    if (slot == NULL) {
+        slot = pal_watchdog_claim();
+        g_watchdog_slot = slot;
+    }
+
+    if (slot != NULL) {
+        slot->deadline_ns = pal_get_time_ns() + ((uint64_t)budget_ms * 1000000);
+        slot->expired = false;
+        slot->armed = true;
+    } else if (!g_watchdog_full_reported) {
+        printf("\nWARNING: %d threads hold a watchdog slot, test budgets of further"
+               " threads are not enforced\n", PAL_WATCHDOG_MAX_THREADS);
+        g_watchdog_full_reported = true;
+    }
+    pthread_mutex_unlock(&g_watchdog_lock);
+}
+
+/**
+  @brief   This API stops the budget of the test run by the calling thread
+  @return  none
+**/
+void pal_watchdog_disarm(void)
+{
+    struct pal_watchdog_slot *slot = g_watchdog_slot;
+
+    if (slot == NULL)
+        return;
+
+    pthread_mutex_lock(&g_watchdog_lock);
+    slot->armed = false;
+    slot->expired = false;
+    pthread_mutex_unlock(&g_watchdog_lock);
+}
+
+/**
+  @brief   Tells whether the test run by the calling thread is over budget,
+           the transports then fail its messages without waiting
+  @return  true once the budget has run out, until the watchdog is disarmed
+**/
+bool pal_watchdog_expired(void)
+{
+    struct pal_watchdog_slot *slot = g_watchdog_slot;
+
+    return (slot != NULL) && __atomic_load_n(&slot->expired, __ATOMIC_ACQUIRE);
+}
@@ -0,0 +1,53 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef __MOCK_MAILBOX_H__
+#define __MOCK_MAILBOX_H__
+
+/*
+ * Mailbox memory exchanged with scmi_mock_server, one socket message per
+ * mailbox write. The layout is the one of the sgm776 mailbox transport,
+ * with a larger memory so that every mocker response fits unpaged.
+ */
+#define MOCK_MAILBOX_LENGTH       256
+#define MOCK_SERVER_ENV           "SCMI_MOCK_SERVER"
+#define MOCK_SERVER_DEFAULT_PATH  "/tmp/scmi_mock_server.sock"
+
+/* mailbox memory byte offset mapping */
+enum {
+    MB_RESERVED =                        0x0,
+    MB_CHANNEL_STATUS =                  0x4,
+    MB_RESERVED_IMPLEMENTATION_DEFINED = 0x8,
+    MB_FLAGS =                           0x10,
+    MB_HEADER_PAYLOAD_LENGTH =           0x14,
+    MB_MESSAGE_HEADER =                  0x18,
+    MB_MESSAGE_PAYLOAD =                 0x1c
+};
+
+#define MB_CHANNEL_STATUS_FREE    0x1 /* Set by the platform once the response is written */
+#define MB_CHANNEL_STATUS_ERROR   0x2
+#define MB_FLAGS_INTERRUPT        0x1 /* Agent wants a completion interrupt, else it polls */
+
+/* number of 32 bit payload words that fit in the mailbox memory */
+#define MB_MAX_PAYLOAD_WORDS ((MOCK_MAILBOX_LENGTH - MB_MESSAGE_PAYLOAD) / 4)
+
+/* The mailbox memory is little-endian, messages are marshalled with native word stores */
+#if !defined(__BYTE_ORDER__) || (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+#error "mock mailbox requires a little-endian host"
+#endif
+
+#endif /*__MOCK_MAILBOX_H__*/
@@ -0,0 +1,46 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef __PAL_ASYNC_EXPECTED_H__
+#define __PAL_ASYNC_EXPECTED_H__
+
+#include <pal_platform.h>
+
+/*
+ * Delay between a command and the delayed responses or notifications it
+ * causes, per protocol. The delay is latency_us plus a pseudo random
+ * 0..jitter_us.
+ */
+struct async_latency {
+    const char *name;
+    uint32_t protocol_id;
+    uint32_t latency_us;
+    uint32_t jitter_us;
+};
+
+static struct async_latency async_latency[] =
+{
+    { "power_domain", POWER_DOMAIN_PROTOCOL_ID, 500,  100 },
+    { "performance",  PERFORMANCE_PROTOCOL_ID,  200,  50  },
+    { "clock",        CLOCK_PROTOCOL_ID,        1000, 250 },
+    { "sensor",       SENSOR_PROTOCOL_ID,       300,  100 },
+    { "reset",        RESET_PROTOCOL_ID,        2000, 500 }
+};
+
+static uint32_t async_jitter_seed = 1;
+
+#endif /* __PAL_ASYNC_EXPECTED_H__ */
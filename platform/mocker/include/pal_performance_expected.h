@@ -22,13 +22,13 @@
 #define PERF_EXPECTED_NUM_OF_DOMAIN 4
 static uint32_t num_performance_domains = PERF_EXPECTED_NUM_OF_DOMAIN;
 
-static uint32_t statistics_address_low_perf = 0x1234;
-static uint32_t statistics_address_len_perf = 0xFF;
+static uint32_t statistics_address_low_perf = 0x2000;
+static uint32_t statistics_address_len_perf = 0x400;
 
 static uint8_t  set_limit_capable[] = {1, 1, 1 ,0};
 static uint8_t  set_performance_level_capable[] = {1, 1, 1 ,0};
-static uint8_t  performance_level_notification_support[] = {0, 0, 0 ,0};
-static uint8_t  performance_limit_notification_support[] = {0, 0, 0 ,0};
+static uint8_t  performance_level_notification_support[] = {1, 1, 1 ,0};
+static uint8_t  performance_limit_notification_support[] = {1, 1, 1 ,0};
 static uint32_t performance_rate_limit[] = {10, 20, 30 ,40};
 static uint32_t performance_sustained_freq[] = {100, 200, 300 ,400};
 static uint32_t performance_sustained_level[] = {110, 120, 130 ,140};
@@ -141,9 +141,9 @@ static uint8_t perf_msg_fast_ch_support[] = {
     0, /* Domain attr*/
     0, /* Describe level*/
     1, /* Limit set*/
-    0, /* limit get*/
+    1, /* limit get*/
     1, /* Level set*/
-    0, /* Level get*/
+    1, /* Level get*/
     0, /* Notify limit*/
     0, /* Notify level*/
     0, /* Describe fast ch*/
@@ -159,27 +159,27 @@ static uint8_t perf_domain_fast_ch_support[] = {
 static uint8_t * perf_performance_fast_ch_doorbell_support[] = {
     (uint8_t[]) { /* Domain 0 */
         1, /* Limit set*/
-        1, /* Limit get*/
+        0, /* Limit get*/
         0, /* Level set*/
-        1, /* Level get*/
+        0, /* Level get*/
     },
     (uint8_t[]) { /* Domain 1 */
         0, /* Limit set*/
-        1, /* Limit get*/
+        0, /* Limit get*/
         0, /* Level set*/
-        1, /* Level get*/
+        0, /* Level get*/
     },
     (uint8_t[]) { /* Domain 2*/
         0, /* Limit set*/
-        1, /* Limit get*/
+        0, /* Limit get*/
         1, /* Level set*/
-        1, /* Level get*/
+        0, /* Level get*/
     },
     (uint8_t[]) { /* Domain 3 */
         0, /* Limit set*/
-        1, /* Limit get*/
+        0, /* Limit get*/
         0, /* Level set*/
-        1, /* Level get*/
+        0, /* Level get*/
     },
 };
 
@@ -192,7 +192,7 @@ static uint8_t * perf_performance_fast_ch_doorbell_data_width[] = {
     },
     (uint8_t[]) { /* Domain 1 */
         0, /* Limit set*/
-        1, /* Limit get*/
+        0, /* Limit get*/
         0, /* Level set*/
         0, /* Level get*/
     },
@@ -206,7 +206,7 @@ static uint8_t * perf_performance_fast_ch_doorbell_data_width[] = {
         0, /* Limit set*/
         0, /* Limit get*/
         0, /* Level set*/
-        3, /* Level get*/
+        0, /* Level get*/
     },
 };
 
@@ -20,6 +20,7 @@
 
 #include <inttypes.h>
 #include <stddef.h>
+#include <stdbool.h>
 #include <assert.h>
 
 #define BASE_PROTOCOL_ID              0x10
@@ -30,6 +31,17 @@
 #define SENSOR_PROTOCOL_ID            0x15
 #define RESET_PROTOCOL_ID             0x16
 
+/* Simulated agent channels, one per concurrently running suite */
+#define MOCKER_NUM_CHANNELS           8
+
+/* How long an agent waits for the response to a command */
+#define MOCKER_RESPONSE_TIMEOUT_MS    1000
+
+/* Copies of a response the transport delivers, see fault_profile.h */
+#define MOCKER_RESPONSE_DROPPED       0
+#define MOCKER_RESPONSE_DELIVERED     1
+#define MOCKER_RESPONSE_DUPLICATED    2
+
 enum BITS_HEADER {
     RESERVED_LOW =      28,
     RESERVED_HIGH =     31,
@@ -91,4 +103,34 @@ void fill_sensor_protocol(void);
 void fill_performance_protocol(void);
 void fill_reset_protocol(void);
 
+void *performance_fast_channel_map(uint64_t address);
+
+void mocker_stats_init(uint32_t protocol_id, uint32_t address, uint32_t length,
+        uint32_t num_domains);
+void mocker_stats_add_domain(uint32_t protocol_id, uint32_t domain_id, uint32_t num_entries,
+        uint32_t current);
+void mocker_stats_transition(uint32_t protocol_id, uint32_t domain_id, uint32_t index);
+void mocker_stats_record(uint32_t protocol_id, uint32_t domain_id, uint32_t index,
+        uint64_t value);
+void *mocker_stats_map(uint64_t address, uint32_t size);
+
+void mocker_initialize(void);
+void mocker_select_agent(uint32_t agent);
+uint32_t mocker_current_agent(void);
+uint32_t mocker_current_header(void);
+void mocker_set_channel_size(uint32_t size);
+uint32_t mocker_max_return_values(void);
+uint32_t mocker_send_message(uint32_t message_header_send, size_t parameter_count,
+        const uint32_t *parameters, uint32_t *message_header_rcv, int32_t *status,
+        size_t *return_values_count, uint32_t *return_values);
+
+int32_t mock_socket_open(const char *path);
+void mock_socket_close(void);
+int32_t mock_socket_select(uint32_t channel_id);
+int32_t mock_socket_send_message(uint32_t message_header_send, size_t parameter_count,
+        const uint32_t *parameters, uint32_t *message_header_rcv, int32_t *status,
+        size_t *return_values_count, uint32_t *return_values);
+int32_t mock_socket_receive(uint32_t type, uint32_t timeout_ms, uint32_t *message_header_rcv,
+        int32_t *status, size_t *return_values_count, uint32_t *return_values);
+
 #endif /*__PAL_PLATFORM__*/
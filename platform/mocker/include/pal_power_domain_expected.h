@@ -23,7 +23,7 @@
 /* Expected POWER DOMAIN parameters */
 
 static uint32_t num_power_domains = 3;
-static uint32_t statistics_address_low_pow = 0x1234;
-static uint32_t statistics_address_len_pow = 0xFF;
+static uint32_t statistics_address_low_pow = 0x1000;
+static uint32_t statistics_address_len_pow = 0x400;
 
 #endif /* __PAL_POWER_DOMAIN_EXPECTED_H__ */
@@ -29,7 +29,14 @@
 static uint8_t async_sensor_read_support[] =
 {
     SENOR_ASYNC_READ_NOT_SUPPORTED,
-    SENOR_ASYNC_READ_NOT_SUPPORTED
+    SENOR_ASYNC_READ_SUPPORTED
+};
+
+/* Reading returned for each sensor, synchronously or in the delayed response */
+static uint32_t sensor_reading_value[] =
+{
+    25000,
+    40000
 };
 
 /*
@@ -43,8 +50,9 @@ static uint8_t number_of_trip_points_supported[] =
 };
 
 static uint32_t num_sensors = NUM_OF_SENSORS_SUPPORTED;
+static uint32_t max_num_pending_async_cmds_supported = 2;
 
-static uint32_t statistics_address_low_snsr = 0x1234;
-static uint32_t statistics_address_len_snsr = 0xFF;
+static uint32_t statistics_address_low_snsr = 0x3000;
+static uint32_t statistics_address_len_snsr = 0x400;
 
 #endif /* __PAL_SENSOR_EXPECTED_H__ */
@@ -0,0 +1,270 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include <pthread.h>
+#include <time.h>
+#include <protocol_common.h>
+#include <pal_platform.h>
+#include <fault_profile.h>
+
+/*
+ * Latency and fault injection for the mocker models. The profile is a text
+ * file, one rule per line, '#' starts a comment:
+ *
+ *   <protocol> <message_id> [latency=<us>[:<jitter_us>]] [busy=<%>] [drop=<%>]
+ *                           [duplicate=<%>] [corrupt_token=<%>]
+ *
+ * The protocol is a name such as clock, or an id. Either field can be '*'.
+ * The latency is added before the command is processed, plus a uniformly
+ * distributed 0..jitter_us. The other faults are percentages of the
+ * matching commands.
+ */
+struct fault_protocol_name {
+    const char *name;
+    uint32_t protocol_id;
+};
+
+static const struct fault_protocol_name g_protocol_names[] =
+{
+    { "base",         BASE_PROTOCOL_ID },
+    { "power_domain", POWER_DOMAIN_PROTOCOL_ID },
+    { "system_power", SYSTEM_POWER_PROTOCOL_ID },
+    { "performance",  PERFORMANCE_PROTOCOL_ID },
+    { "clock",        CLOCK_PROTOCOL_ID },
+    { "sensor",       SENSOR_PROTOCOL_ID },
+    { "reset",        RESET_PROTOCOL_ID }
+};
+
+static struct fault_rule g_rules[FAULT_PROFILE_MAX_RULES];
+static uint32_t g_num_rules;
+static uint32_t g_random = 1;
+static pthread_mutex_t g_random_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* xorshift32, the faults only need to be repeatable */
+static uint32_t fault_profile_random(void)
+{
+    uint32_t value;
+
+    pthread_mutex_lock(&g_random_lock);
+    g_random ^= g_random << 13;
+    g_random ^= g_random >> 17;
+    g_random ^= g_random << 5;
+    value = g_random;
+    pthread_mutex_unlock(&g_random_lock);
+
+    return value;
+}
+
+static bool fault_profile_parse_id(const char *field, bool protocol, uint32_t *id)
+{
+    char *end;
+    uint32_t i;
+
+    if (strcmp(field, "*") == 0) {
+        *id = FAULT_PROFILE_ANY;
+        return true;
+    }
+
+    if (protocol) {
+        for (i = 0; i < NUM_ELEMS(g_protocol_names); i++) {
+            if (strcmp(field, g_protocol_names[i].name) == 0) {
+                *id = g_protocol_names[i].protocol_id;
+                return true;
+            }
+        }
+    }
+
+    *id = strtoul(field, &end, 0);
+    return (*end == '\0') && (*id <= 0xFF);
+}
+
+/* Percentage to parts per million */
+static bool fault_profile_parse_rate(const char *value, uint32_t *rate)
+{
+    char *end;
+    double percent = strtod(value, &end);
+
+    if ((*end != '\0') || (percent < 0) || (percent > 100))
+        return false;
+
+    *rate = (uint32_t)((percent * FAULT_PROFILE_RATE_SCALE) / 100);
+    return true;
+}
+
+static bool fault_profile_parse_fault(char *setting, struct fault_rule *rule)
+{
+    char *value = strchr(setting, '=');
+    char *end;
+
+    if (value == NULL)
+        return false;
+    *value++ = '\0';
+
+    if (strcmp(setting, "latency") == 0) {
+        rule->latency_us = strtoul(value, &end, 0);
+        rule->jitter_us = (*end == ':') ? strtoul(end + 1, &end, 0) : 0;
+        return *end == '\0';
+    }
+    if (strcmp(setting, "busy") == 0)
+        return fault_profile_parse_rate(value, &rule->busy_rate);
+    if (strcmp(setting, "drop") == 0)
+        return fault_profile_parse_rate(value, &rule->drop_rate);
+    if (strcmp(setting, "duplicate") == 0)
+        return fault_profile_parse_rate(value, &rule->duplicate_rate);
+    if (strcmp(setting, "corrupt_token") == 0)
+        return fault_profile_parse_rate(value, &rule->corrupt_token_rate);
+
+    return false;
+}
+
+static bool fault_profile_parse_line(char *line, struct fault_rule *rule)
+{
+    char *field, *save;
+
+    memset(rule, 0, sizeof(*rule));
+
+    field = strtok_r(line, " \t\r\n", &save);
+    if ((field == NULL) || !fault_profile_parse_id(field, true, &rule->protocol_id))
+        return false;
+
+    field = strtok_r(NULL, " \t\r\n", &save);
+    if ((field == NULL) || !fault_profile_parse_id(field, false, &rule->message_id))
+        return false;
+
+    while ((field = strtok_r(NULL, " \t\r\n", &save)) != NULL) {
+        if (!fault_profile_parse_fault(field, rule))
+            return false;
+    }
+
+    return true;
+}
+
+/**
+  @brief   Loads the rules of the profile named by FAULT_PROFILE_ENV, if any
+  @return  none
+**/
+void fault_profile_init(void)
+{
+    const char *path = getenv(FAULT_PROFILE_ENV);
+    const char *seed = getenv(FAULT_PROFILE_SEED_ENV);
+    char line[256];
+    uint32_t line_number = 0;
+    char *comment;
+    FILE *file;
+
+    g_num_rules = 0;
+    g_random = (seed != NULL) ? strtoul(seed, NULL, 0) : 1;
+    if (g_random == 0)
+        g_random = 1;
+
+    if ((path == NULL) || (path[0] == '\0'))
+        return;
+
+    file = fopen(path, "r");
+    if (file == NULL) {
+        printf("\nERROR: cannot open fault profile %s\n", path);
+        return;
+    }
+
+    while (fgets(line, sizeof(line), file) != NULL) {
+        line_number++;
+        comment = strchr(line, '#');
+        if (comment != NULL)
+            *comment = '\0';
+        if (line[strspn(line, " \t\r\n")] == '\0')
+            continue;
+
+        if (g_num_rules == FAULT_PROFILE_MAX_RULES) {
+            printf("\nIgnoring rules of %s past line %d\n", path, line_number - 1);
+            break;
+        }
+
+        if (!fault_profile_parse_line(line, &g_rules[g_num_rules]))
+            printf("\nIgnoring line %d of %s\n", line_number, path);
+        else
+            g_num_rules++;
+    }
+
+    fclose(file);
+}
+
+/**
+  @brief   Returns the first rule matching a command
+  @param   protocol_id  protocol of the command
+  @param   message_id   message id of the command
+  @return  rule, NULL when the command runs unaltered
+**/
+const struct fault_rule *fault_profile_find(uint32_t protocol_id, uint32_t message_id)
+{
+    uint32_t i;
+
+    for (i = 0; i < g_num_rules; i++) {
+        if (((g_rules[i].protocol_id == FAULT_PROFILE_ANY) ||
+             (g_rules[i].protocol_id == protocol_id)) &&
+            ((g_rules[i].message_id == FAULT_PROFILE_ANY) ||
+             (g_rules[i].message_id == message_id)))
+            return &g_rules[i];
+    }
+
+    return NULL;
+}
+
+/**
+  @brief   Waits for the service latency of a rule
+  @param   rule  matching rule
+  @return  none
+**/
+void fault_profile_delay(const struct fault_rule *rule)
+{
+    uint64_t delay_us = rule->latency_us;
+    struct timespec delay;
+
+    if (rule->jitter_us != 0)
+        delay_us += fault_profile_random() % (rule->jitter_us + 1);
+    if (delay_us == 0)
+        return;
+
+    delay.tv_sec = delay_us / 1000000;
+    delay.tv_nsec = (delay_us % 1000000) * 1000;
+    while (nanosleep(&delay, &delay) != 0)
+        ;
+}
+
+/**
+  @brief   Decides whether a fault happens to the current command
+  @param   rate  probability of the fault, in FAULT_PROFILE_RATE_SCALE parts
+  @return  true if the fault is to be injected
+**/
+bool fault_profile_roll(uint32_t rate)
+{
+    if (rate == 0)
+        return false;
+
+    return (fault_profile_random() % FAULT_PROFILE_RATE_SCALE) < rate;
+}
+
+/**
+  @brief   Changes the token of a response header to another token
+  @param   header  response header
+  @return  corrupted header
+**/
+uint32_t fault_profile_corrupt_token(uint32_t header)
+{
+    uint32_t flip = (fault_profile_random() % ((1 << (TOKEN_HIGH - TOKEN_LOW + 1)) - 1)) + 1;
+
+    return header ^ (flip << TOKEN_LOW);
+}
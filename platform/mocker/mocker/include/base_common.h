@@ -148,4 +148,51 @@ struct arm_scmi_base_reset_agent_configuration {
     } flags_bits;
 };
 
+/* The layouts above must match the message codec */
+CODEC_CHECK_RET(struct arm_scmi_base_protocol_version, version,
+                SCMI_BASE_PROTOCOL_VERSION_RET_VERSION);
+CODEC_CHECK_RET(struct arm_scmi_base_protocol_attributes, attributes,
+                SCMI_BASE_PROTOCOL_ATTRIBUTES_RET_ATTRIBUTES);
+CODEC_CHECK_PARAM(struct arm_scmi_base_protocol_message_attributes, message_id,
+                  SCMI_BASE_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_MESSAGE_ID);
+CODEC_CHECK_RET(struct arm_scmi_base_protocol_message_attributes, attributes,
+                SCMI_BASE_PROTOCOL_MESSAGE_ATTRIBUTES_RET_ATTRIBUTES);
+CODEC_CHECK_RET(struct arm_scmi_base_discover_vendor, vendor_identifier,
+                SCMI_BASE_DISCOVER_VENDOR_RET_VENDOR_IDENTIFIER);
+CODEC_CHECK_RET(struct arm_scmi_base_discover_subvendor, vendor_identifier,
+                SCMI_BASE_DISCOVER_SUB_VENDOR_RET_VENDOR_IDENTIFIER);
+CODEC_CHECK_RET(struct arm_scmi_base_discover_implementation_version, implementation_version,
+                SCMI_BASE_DISCOVER_IMPLEMENTATION_VERSION_RET_IMPLEMENTATION_VERSION);
+CODEC_CHECK_PARAM(struct arm_scmi_base_discover_list_protocols, skip,
+                  SCMI_BASE_DISCOVER_LIST_PROTOCOLS_PARAM_SKIP);
+CODEC_CHECK_RET(struct arm_scmi_base_discover_list_protocols, num_protocols,
+                SCMI_BASE_DISCOVER_LIST_PROTOCOLS_RET_NUM_PROTOCOLS);
+CODEC_CHECK_RET(struct arm_scmi_base_discover_list_protocols, protocols,
+                SCMI_BASE_DISCOVER_LIST_PROTOCOLS_RET_PROTOCOLS);
+CODEC_CHECK_PARAM(struct arm_scmi_base_discover_agent, agent_id,
+                  SCMI_BASE_DISCOVER_AGENT_PARAM_AGENT_ID);
+CODEC_CHECK_RET(struct arm_scmi_base_discover_agent, ret_agent_id,
+                SCMI_BASE_DISCOVER_AGENT_RET_AGENT_ID);
+CODEC_CHECK_RET(struct arm_scmi_base_discover_agent, name, SCMI_BASE_DISCOVER_AGENT_RET_NAME);
+CODEC_CHECK_PARAM(struct arm_scmi_base_notify_error, notify_enable,
+                  SCMI_BASE_NOTIFY_ERRORS_PARAM_NOTIFY_ENABLE);
+CODEC_CHECK_PARAM(struct arm_scmi_base_set_device_permissions, agent_id,
+                  SCMI_BASE_SET_DEVICE_PERMISSIONS_PARAM_AGENT_ID);
+CODEC_CHECK_PARAM(struct arm_scmi_base_set_device_permissions, device_id,
+                  SCMI_BASE_SET_DEVICE_PERMISSIONS_PARAM_DEVICE_ID);
+CODEC_CHECK_PARAM(struct arm_scmi_base_set_device_permissions, flags,
+                  SCMI_BASE_SET_DEVICE_PERMISSIONS_PARAM_FLAGS);
+CODEC_CHECK_PARAM(struct arm_scmi_base_set_protocol_permissions, agent_id,
+                  SCMI_BASE_SET_PROTOCOL_PERMISSIONS_PARAM_AGENT_ID);
+CODEC_CHECK_PARAM(struct arm_scmi_base_set_protocol_permissions, device_id,
+                  SCMI_BASE_SET_PROTOCOL_PERMISSIONS_PARAM_DEVICE_ID);
+CODEC_CHECK_PARAM(struct arm_scmi_base_set_protocol_permissions, command_id,
+                  SCMI_BASE_SET_PROTOCOL_PERMISSIONS_PARAM_COMMAND_ID);
+CODEC_CHECK_PARAM(struct arm_scmi_base_set_protocol_permissions, flags,
+                  SCMI_BASE_SET_PROTOCOL_PERMISSIONS_PARAM_FLAGS);
+CODEC_CHECK_PARAM(struct arm_scmi_base_reset_agent_configuration, agent_id,
+                  SCMI_BASE_RESET_AGENT_CONFIGURATION_PARAM_AGENT_ID);
+CODEC_CHECK_PARAM(struct arm_scmi_base_reset_agent_configuration, flags,
+                  SCMI_BASE_RESET_AGENT_CONFIGURATION_PARAM_FLAGS);
+
 #endif /*_BASE_COMMON_H_ */
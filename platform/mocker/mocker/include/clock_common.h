@@ -128,4 +128,32 @@ struct arm_scmi_clock_config_set {
     } config_set_flags;
 };
 
+/* The layouts above must match the message codec */
+CODEC_CHECK_RET(struct arm_scmi_clock_protocol_version, version,
+                SCMI_CLOCK_PROTOCOL_VERSION_RET_VERSION);
+CODEC_CHECK_RET(struct arm_scmi_clock_protocol_attributes, attributes,
+                SCMI_CLOCK_PROTOCOL_ATTRIBUTES_RET_ATTRIBUTES);
+CODEC_CHECK_PARAM(struct arm_scmi_clock_attributes, clock_id, SCMI_CLOCK_ATTRIBUTES_PARAM_CLOCK_ID);
+CODEC_CHECK_RET(struct arm_scmi_clock_attributes, attributes, SCMI_CLOCK_ATTRIBUTES_RET_ATTRIBUTES);
+CODEC_CHECK_RET(struct arm_scmi_clock_attributes, clock_name, SCMI_CLOCK_ATTRIBUTES_RET_CLOCK_NAME);
+CODEC_CHECK_PARAM(struct arm_scmi_clock_protocol_message_attributes, message_id,
+                  SCMI_CLOCK_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_MESSAGE_ID);
+CODEC_CHECK_RET(struct arm_scmi_clock_protocol_message_attributes, attributes,
+                SCMI_CLOCK_PROTOCOL_MESSAGE_ATTRIBUTES_RET_ATTRIBUTES);
+CODEC_CHECK_PARAM(struct arm_scmi_clock_describe_rates, clock_id,
+                  SCMI_CLOCK_DESCRIBE_RATES_PARAM_CLOCK_ID);
+CODEC_CHECK_PARAM(struct arm_scmi_clock_describe_rates, rate_index,
+                  SCMI_CLOCK_DESCRIBE_RATES_PARAM_RATE_INDEX);
+CODEC_CHECK_RET(struct arm_scmi_clock_describe_rates, num_rates_flags,
+                SCMI_CLOCK_DESCRIBE_RATES_RET_NUM_RATES_FLAGS);
+CODEC_CHECK_RET(struct arm_scmi_clock_describe_rates, rates, SCMI_CLOCK_DESCRIBE_RATES_RET_RATES);
+CODEC_CHECK_PARAM(struct arm_scmi_clock_rate_set, flags, SCMI_CLOCK_RATE_SET_PARAM_FLAGS);
+CODEC_CHECK_PARAM(struct arm_scmi_clock_rate_set, clock_id, SCMI_CLOCK_RATE_SET_PARAM_CLOCK_ID);
+CODEC_CHECK_PARAM(struct arm_scmi_clock_rate_set, rate, SCMI_CLOCK_RATE_SET_PARAM_RATE);
+CODEC_CHECK_PARAM(struct arm_scmi_clock_rate_get, clock_id, SCMI_CLOCK_RATE_GET_PARAM_CLOCK_ID);
+CODEC_CHECK_RET(struct arm_scmi_clock_rate_get, rate, SCMI_CLOCK_RATE_GET_RET_RATE);
+CODEC_CHECK_PARAM(struct arm_scmi_clock_config_set, clock_id, SCMI_CLOCK_CONFIG_SET_PARAM_CLOCK_ID);
+CODEC_CHECK_PARAM(struct arm_scmi_clock_config_set, attributes,
+                  SCMI_CLOCK_CONFIG_SET_PARAM_ATTRIBUTES);
+
 #endif /* CLOCK_COMMON_H_ */
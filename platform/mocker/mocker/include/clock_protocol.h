@@ -32,6 +32,7 @@
 #define CLK_RATE_SET_MSG_ID         0x5
 #define CLK_RATE_GET_MSG_ID         0x6
 #define CLK_CONFIG_SET_MSG_ID       0x7
+#define CLK_RATE_SET_COMPLETE_MSG_ID 0x5 /* Delayed response */
 
 #define MAX_NUM_CLOCK           16
 #define MAX_NUM_RATES_SUPPORTED 16
@@ -0,0 +1,55 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _FAULT_PROFILE_H_
+#define _FAULT_PROFILE_H_
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+/* File holding the injection rules, read once when the models are initialized */
+#define FAULT_PROFILE_ENV            "SCMI_MOCK_FAULT_PROFILE"
+/* Seed of the injection decisions, the same seed gives the same faults */
+#define FAULT_PROFILE_SEED_ENV       "SCMI_MOCK_FAULT_SEED"
+
+#define FAULT_PROFILE_MAX_RULES      32
+#define FAULT_PROFILE_ANY            0xFFFFFFFF /* '*' in place of a protocol or message id */
+#define FAULT_PROFILE_RATE_SCALE     1000000    /* Rates are kept in parts per million */
+
+/*
+ * Faults injected into the commands of one protocol and message id. The
+ * first rule matching a command applies. Rates are probabilities per
+ * command, latencies in microseconds.
+ */
+struct fault_rule {
+    uint32_t protocol_id;
+    uint32_t message_id;
+    uint32_t latency_us;
+    uint32_t jitter_us;
+    uint32_t busy_rate;
+    uint32_t drop_rate;
+    uint32_t duplicate_rate;
+    uint32_t corrupt_token_rate;
+};
+
+void fault_profile_init(void);
+const struct fault_rule *fault_profile_find(uint32_t protocol_id, uint32_t message_id);
+void fault_profile_delay(const struct fault_rule *rule);
+bool fault_profile_roll(uint32_t rate);
+uint32_t fault_profile_corrupt_token(uint32_t header);
+
+#endif /* _FAULT_PROFILE_H_ */
@@ -189,4 +189,95 @@ struct arm_scmi_performance_describe_fast_channel {
         PERFORMANCE_DESCRIBE_FAST_CH_ATTR_DOORBELL_SUPPORT = 0,
     }arm_scmi_performance_describe_fst_ch_attributes_bits;
 };
+
+/* The layouts above must match the message codec */
+CODEC_CHECK_RET(struct arm_scmi_performance_protocol_version, version,
+                SCMI_PERFORMANCE_PROTOCOL_VERSION_RET_VERSION);
+CODEC_CHECK_RET(struct arm_scmi_performance_protocol_attributes, attributes,
+                SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_RET_ATTRIBUTES);
+CODEC_CHECK_RET(struct arm_scmi_performance_protocol_attributes, statistics_address_low,
+                SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_RET_STATISTICS_ADDRESS_LOW);
+CODEC_CHECK_RET(struct arm_scmi_performance_protocol_attributes, statistics_address_high,
+                SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_RET_STATISTICS_ADDRESS_HIGH);
+CODEC_CHECK_RET(struct arm_scmi_performance_protocol_attributes, statistics_len,
+                SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_RET_STATISTICS_LEN);
+CODEC_CHECK_PARAM(struct arm_scmi_performance_protocol_message_attributes, message_id,
+                  SCMI_PERFORMANCE_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_MESSAGE_ID);
+CODEC_CHECK_RET(struct arm_scmi_performance_protocol_message_attributes, attributes,
+                SCMI_PERFORMANCE_PROTOCOL_MESSAGE_ATTRIBUTES_RET_ATTRIBUTES);
+CODEC_CHECK_PARAM(struct arm_scmi_performance_domain_attributes, domain_id,
+                  SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_PARAM_DOMAIN_ID);
+CODEC_CHECK_RET(struct arm_scmi_performance_domain_attributes, attributes,
+                SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_RET_ATTRIBUTES);
+CODEC_CHECK_RET(struct arm_scmi_performance_domain_attributes, rate_limit,
+                SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_RET_RATE_LIMIT);
+CODEC_CHECK_RET(struct arm_scmi_performance_domain_attributes, sustained_freq,
+                SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_RET_SUSTAINED_FREQ);
+CODEC_CHECK_RET(struct arm_scmi_performance_domain_attributes, sustained_perf_level,
+                SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_RET_SUSTAINED_PERF_LEVEL);
+CODEC_CHECK_RET(struct arm_scmi_performance_domain_attributes, name,
+                SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_RET_NAME);
+CODEC_CHECK_PARAM(struct arm_scmi_performance_describe_levels, domain_id,
+                  SCMI_PERFORMANCE_DESCRIBE_LEVELS_PARAM_DOMAIN_ID);
+CODEC_CHECK_PARAM(struct arm_scmi_performance_describe_levels, level_index,
+                  SCMI_PERFORMANCE_DESCRIBE_LEVELS_PARAM_LEVEL_INDEX);
+CODEC_CHECK_RET(struct arm_scmi_performance_describe_levels, num_levels,
+                SCMI_PERFORMANCE_DESCRIBE_LEVELS_RET_NUM_LEVELS);
+CODEC_CHECK_RET(struct arm_scmi_performance_describe_levels, perf_levels,
+                SCMI_PERFORMANCE_DESCRIBE_LEVELS_RET_PERF_LEVELS);
+CODEC_CHECK_PARAM(struct arm_scmi_performance_limits_set, domain_id,
+                  SCMI_PERFORMANCE_LIMITS_SET_PARAM_DOMAIN_ID);
+CODEC_CHECK_PARAM(struct arm_scmi_performance_limits_set, range_max,
+                  SCMI_PERFORMANCE_LIMITS_SET_PARAM_RANGE_MAX);
+CODEC_CHECK_PARAM(struct arm_scmi_performance_limits_set, range_min,
+                  SCMI_PERFORMANCE_LIMITS_SET_PARAM_RANGE_MIN);
+CODEC_CHECK_PARAM(struct arm_scmi_performance_limits_get, domain_id,
+                  SCMI_PERFORMANCE_LIMITS_GET_PARAM_DOMAIN_ID);
+CODEC_CHECK_RET(struct arm_scmi_performance_limits_get, range_max,
+                SCMI_PERFORMANCE_LIMITS_GET_RET_RANGE_MAX);
+CODEC_CHECK_RET(struct arm_scmi_performance_limits_get, range_min,
+                SCMI_PERFORMANCE_LIMITS_GET_RET_RANGE_MIN);
+CODEC_CHECK_PARAM(struct arm_scmi_performance_levels_set, domain_id,
+                  SCMI_PERFORMANCE_LEVEL_SET_PARAM_DOMAIN_ID);
+CODEC_CHECK_PARAM(struct arm_scmi_performance_levels_set, performance_level,
+                  SCMI_PERFORMANCE_LEVEL_SET_PARAM_PERFORMANCE_LEVEL);
+CODEC_CHECK_PARAM(struct arm_scmi_performance_levels_get, domain_id,
+                  SCMI_PERFORMANCE_LEVEL_GET_PARAM_DOMAIN_ID);
+CODEC_CHECK_RET(struct arm_scmi_performance_levels_get, performance_level,
+                SCMI_PERFORMANCE_LEVEL_GET_RET_PERFORMANCE_LEVEL);
+CODEC_CHECK_PARAM(struct arm_scmi_performance_notify_limits, domain_id,
+                  SCMI_PERFORMANCE_NOTIFY_LIMITS_PARAM_DOMAIN_ID);
+CODEC_CHECK_PARAM(struct arm_scmi_performance_notify_limits, notify_enable,
+                  SCMI_PERFORMANCE_NOTIFY_LIMITS_PARAM_NOTIFY_ENABLE);
+CODEC_CHECK_PARAM(struct arm_scmi_performance_notify_level, domain_id,
+                  SCMI_PERFORMANCE_NOTIFY_LEVEL_PARAM_DOMAIN_ID);
+CODEC_CHECK_PARAM(struct arm_scmi_performance_notify_level, notify_enable,
+                  SCMI_PERFORMANCE_NOTIFY_LEVEL_PARAM_NOTIFY_ENABLE);
+CODEC_CHECK_PARAM(struct arm_scmi_performance_describe_fast_channel, domain_id,
+                  SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_PARAM_DOMAIN_ID);
+CODEC_CHECK_PARAM(struct arm_scmi_performance_describe_fast_channel, message_id,
+                  SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_PARAM_MESSAGE_ID);
+CODEC_CHECK_RET(struct arm_scmi_performance_describe_fast_channel, attributes,
+                SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_ATTRIBUTES);
+CODEC_CHECK_RET(struct arm_scmi_performance_describe_fast_channel, rate_limit,
+                SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_RATE_LIMIT);
+CODEC_CHECK_RET(struct arm_scmi_performance_describe_fast_channel, chan_addr_low,
+                SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_CHAN_ADDR_LOW);
+CODEC_CHECK_RET(struct arm_scmi_performance_describe_fast_channel, chan_addr_high,
+                SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_CHAN_ADDR_HIGH);
+CODEC_CHECK_RET(struct arm_scmi_performance_describe_fast_channel, chan_size,
+                SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_CHAN_SIZE);
+CODEC_CHECK_RET(struct arm_scmi_performance_describe_fast_channel, doorbell_addr_low,
+                SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_DOORBELL_ADDR_LOW);
+CODEC_CHECK_RET(struct arm_scmi_performance_describe_fast_channel, doorbell_addr_high,
+                SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_DOORBELL_ADDR_HIGH);
+CODEC_CHECK_RET(struct arm_scmi_performance_describe_fast_channel, doorbell_set_mask_low,
+                SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_DOORBELL_SET_MASK_LOW);
+CODEC_CHECK_RET(struct arm_scmi_performance_describe_fast_channel, doorbell_set_mask_high,
+                SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_DOORBELL_SET_MASK_HIGH);
+CODEC_CHECK_RET(struct arm_scmi_performance_describe_fast_channel, doorbell_preserve_mask_low,
+                SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_DOORBELL_PRESERVE_MASK_LOW);
+CODEC_CHECK_RET(struct arm_scmi_performance_describe_fast_channel, doorbell_preserve_mask_high,
+                SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_DOORBELL_PRESERVE_MASK_HIGH);
+
 #endif /* PERFORMANCE_COMMON_H_ */
@@ -40,8 +40,12 @@
 #define PERF_NOTIFY_LIMIT_MSG_ID            0x9
 #define PERF_NOTIFY_LVL_MSG_ID              0xA
 #define PERF_DESCRIBE_FASTCHANNEL           0xB
+#define PERF_LIMITS_CHANGED_MSG_ID          0x0 /* Notification */
+#define PERF_LEVEL_CHANGED_MSG_ID           0x1 /* Notification */
 
 #define MAX_PERFORMANCE_DOMAIN_COUNT        10
+/* Limit set/get and level set/get can have a fast channel */
+#define PERF_NUM_FAST_CHAN_MSGS             (PERF_LVL_GET_MSG_ID - PERF_LIMIT_SET_MSG_ID + 1)
 
 struct arm_scmi_performance_protocol {
     /*This enum is to easily specify the flag_mask and have to be ensured that
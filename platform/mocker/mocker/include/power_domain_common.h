@@ -124,5 +124,43 @@ struct arm_scmi_power_state_change_requested_notify {
     } power_notify_bits;
 };
 
+/* The layouts above must match the message codec */
+CODEC_CHECK_RET(struct arm_scmi_power_protocol_version, version,
+                SCMI_POWER_DOMAIN_PROTOCOL_VERSION_RET_VERSION);
+CODEC_CHECK_RET(struct arm_scmi_power_protocol_attributes, attributes,
+                SCMI_POWER_DOMAIN_PROTOCOL_ATTRIBUTES_RET_ATTRIBUTES);
+CODEC_CHECK_RET(struct arm_scmi_power_protocol_attributes, statistics_address_low,
+                SCMI_POWER_DOMAIN_PROTOCOL_ATTRIBUTES_RET_STATISTICS_ADDRESS_LOW);
+CODEC_CHECK_RET(struct arm_scmi_power_protocol_attributes, statistics_address_high,
+                SCMI_POWER_DOMAIN_PROTOCOL_ATTRIBUTES_RET_STATISTICS_ADDRESS_HIGH);
+CODEC_CHECK_RET(struct arm_scmi_power_protocol_attributes, statistics_len,
+                SCMI_POWER_DOMAIN_PROTOCOL_ATTRIBUTES_RET_STATISTICS_LEN);
+CODEC_CHECK_PARAM(struct arm_scmi_power_protocol_message_attributes, message_id,
+                  SCMI_POWER_DOMAIN_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_MESSAGE_ID);
+CODEC_CHECK_RET(struct arm_scmi_power_protocol_message_attributes, attributes,
+                SCMI_POWER_DOMAIN_PROTOCOL_MESSAGE_ATTRIBUTES_RET_ATTRIBUTES);
+CODEC_CHECK_PARAM(struct arm_scmi_power_domain_attributes, domain_id,
+                  SCMI_POWER_DOMAIN_DOMAIN_ATTRIBUTES_PARAM_DOMAIN_ID);
+CODEC_CHECK_RET(struct arm_scmi_power_domain_attributes, attributes,
+                SCMI_POWER_DOMAIN_DOMAIN_ATTRIBUTES_RET_ATTRIBUTES);
+CODEC_CHECK_RET(struct arm_scmi_power_domain_attributes, name,
+                SCMI_POWER_DOMAIN_DOMAIN_ATTRIBUTES_RET_NAME);
+CODEC_CHECK_PARAM(struct arm_scmi_power_state_set, flags, SCMI_POWER_DOMAIN_STATE_SET_PARAM_FLAGS);
+CODEC_CHECK_PARAM(struct arm_scmi_power_state_set, domain_id,
+                  SCMI_POWER_DOMAIN_STATE_SET_PARAM_DOMAIN_ID);
+CODEC_CHECK_PARAM(struct arm_scmi_power_state_set, power_state,
+                  SCMI_POWER_DOMAIN_STATE_SET_PARAM_POWER_STATE);
+CODEC_CHECK_PARAM(struct arm_scmi_power_state_get, domain_id,
+                  SCMI_POWER_DOMAIN_STATE_GET_PARAM_DOMAIN_ID);
+CODEC_CHECK_RET(struct arm_scmi_power_state_get, power_state,
+                SCMI_POWER_DOMAIN_STATE_GET_RET_POWER_STATE);
+CODEC_CHECK_PARAM(struct arm_scmi_power_state_notify, domain_id,
+                  SCMI_POWER_DOMAIN_STATE_NOTIFY_PARAM_DOMAIN_ID);
+CODEC_CHECK_PARAM(struct arm_scmi_power_state_notify, notify_enable,
+                  SCMI_POWER_DOMAIN_STATE_NOTIFY_PARAM_NOTIFY_ENABLE);
+CODEC_CHECK_PARAM(struct arm_scmi_power_state_change_requested_notify, domain_id,
+                  SCMI_POWER_DOMAIN_STATE_CHANGE_REQUESTED_NOTIFY_PARAM_DOMAIN_ID);
+CODEC_CHECK_PARAM(struct arm_scmi_power_state_change_requested_notify, notify_enable,
+                  SCMI_POWER_DOMAIN_STATE_CHANGE_REQUESTED_NOTIFY_PARAM_NOTIFY_ENABLE);
 
 #endif /* POWER_COMMON_H_ */
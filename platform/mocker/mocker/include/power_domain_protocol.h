@@ -36,6 +36,10 @@
 #define PWR_STATE_GET_MSG_ID                        0x5
 #define PWR_STATE_NOTIFY_MSG_ID                     0x6
 #define PWR_STATE_CHANGE_REQUESTED_NOTIFY_MSG_ID    0x7
+#define PWR_STATE_CHANGED_MSG_ID                    0x0 /* Notification */
+#define PWR_STATE_CHANGE_REQUESTED_MSG_ID           0x1 /* Notification */
+
+#define MAX_NUM_POWER_DOMAINS       16
 
 #define PWR_NOTIFY_ENABLE_SET       1
 #define PWR_NOTIFY_ENABLE_UNSET     0
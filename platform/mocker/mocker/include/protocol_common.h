@@ -28,6 +28,7 @@
 #include <inttypes.h>
 #include <base_protocol.h>
 #include <assert.h>
+#include <scmi_codec.h>
 
 #define SCMI_NAME_STR_SIZE 16
 #define NUM_ELEMS(x) (sizeof(x) / sizeof((x)[0]))
@@ -43,6 +44,16 @@
 #define OFFSET_PARAM(st, elem) \
 (((offsetof(st, parameters.elem) - offsetof(st, parameters)))/sizeof(uint32_t))
 
+/*
+ * These macros check at compile time that a field of the structs above sits
+ * at the offset the message codec generated from tools/scmi_messages.spec
+ * gives, so that the models and the tests cannot drift apart.
+*/
+#define CODEC_CHECK_PARAM(st, elem, offset) \
+    _Static_assert(OFFSET_PARAM(st, elem) == (offset), #st "." #elem " differs from the codec")
+#define CODEC_CHECK_RET(st, elem, offset) \
+    _Static_assert(OFFSET_RET(st, elem) == (offset), #st "." #elem " differs from the codec")
+
 enum SCMI_STATUS_CODES {
     SCMI_STATUS_SUCCESS =                0,
     SCMI_STATUS_NOT_SUPPORTED =         -1,
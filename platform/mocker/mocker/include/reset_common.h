@@ -96,4 +96,31 @@ struct arm_scmi_reset_protocol_notify_enable {
      } notify_en_bits;
 };
 
+/* The layouts above must match the message codec */
+CODEC_CHECK_RET(struct arm_scmi_reset_protocol_version, version,
+                SCMI_RESET_PROTOCOL_VERSION_RET_VERSION);
+CODEC_CHECK_RET(struct arm_scmi_reset_protocol_attributes, attributes,
+                SCMI_RESET_PROTOCOL_ATTRIBUTES_RET_ATTRIBUTES);
+CODEC_CHECK_PARAM(struct arm_scmi_reset_protocol_message_attributes, message_id,
+                  SCMI_RESET_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_MESSAGE_ID);
+CODEC_CHECK_RET(struct arm_scmi_reset_protocol_message_attributes, attributes,
+                SCMI_RESET_PROTOCOL_MESSAGE_ATTRIBUTES_RET_ATTRIBUTES);
+CODEC_CHECK_PARAM(struct arm_scmi_reset_protocol_domain_attributes, domain_id,
+                  SCMI_RESET_DOMAIN_ATTRIBUTES_PARAM_DOMAIN_ID);
+CODEC_CHECK_RET(struct arm_scmi_reset_protocol_domain_attributes, attributes,
+                SCMI_RESET_DOMAIN_ATTRIBUTES_RET_ATTRIBUTES);
+CODEC_CHECK_RET(struct arm_scmi_reset_protocol_domain_attributes, latency,
+                SCMI_RESET_DOMAIN_ATTRIBUTES_RET_LATENCY);
+CODEC_CHECK_RET(struct arm_scmi_reset_protocol_domain_attributes, domain_name,
+                SCMI_RESET_DOMAIN_ATTRIBUTES_RET_NAME);
+CODEC_CHECK_PARAM(struct arm_scmi_reset_protocol_reset, domain_id,
+                  SCMI_RESET_RESET_PARAM_DOMAIN_ID);
+CODEC_CHECK_PARAM(struct arm_scmi_reset_protocol_reset, flags, SCMI_RESET_RESET_PARAM_FLAGS);
+CODEC_CHECK_PARAM(struct arm_scmi_reset_protocol_reset, reset_state,
+                  SCMI_RESET_RESET_PARAM_RESET_STATE);
+CODEC_CHECK_PARAM(struct arm_scmi_reset_protocol_notify_enable, domain_id,
+                  SCMI_RESET_NOTIFY_PARAM_DOMAIN_ID);
+CODEC_CHECK_PARAM(struct arm_scmi_reset_protocol_notify_enable, notify_enable,
+                  SCMI_RESET_NOTIFY_PARAM_NOTIFY_ENABLE);
+
 #endif /* RESET_COMMON_H_ */
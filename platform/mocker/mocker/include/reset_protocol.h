@@ -30,6 +30,10 @@
 #define RESET_PROTO_DOMAIN_ATTRIB_MSG_ID 0x3
 #define RESET_PROTO_RESET_MSG_ID         0x4
 #define RESET_PROTO_NOTIFY_MSG_ID        0x5
+#define RESET_PROTO_COMPLETE_MSG_ID      0x4 /* Delayed response */
+#define RESET_PROTO_ISSUED_MSG_ID        0x0 /* Notification */
+
+#define MAX_NUM_RESET_DOMAINS            16
 
 struct arm_scmi_reset_protocol {
     /*
@@ -150,4 +150,45 @@ struct arm_scmi_sensor_reading_get {
     }sensor_reading_flags_bits;
 };
 
+/* The layouts above must match the message codec */
+CODEC_CHECK_RET(struct arm_scmi_sensor_protocol_version, version,
+                SCMI_SENSOR_PROTOCOL_VERSION_RET_VERSION);
+CODEC_CHECK_RET(struct arm_scmi_sensor_protocol_attributes, attributes,
+                SCMI_SENSOR_PROTOCOL_ATTRIBUTES_RET_ATTRIBUTES);
+CODEC_CHECK_RET(struct arm_scmi_sensor_protocol_attributes, sensor_reg_address_low,
+                SCMI_SENSOR_PROTOCOL_ATTRIBUTES_RET_SENSOR_REG_ADDRESS_LOW);
+CODEC_CHECK_RET(struct arm_scmi_sensor_protocol_attributes, sensor_reg_address_high,
+                SCMI_SENSOR_PROTOCOL_ATTRIBUTES_RET_SENSOR_REG_ADDRESS_HIGH);
+CODEC_CHECK_RET(struct arm_scmi_sensor_protocol_attributes, sensor_reg_len,
+                SCMI_SENSOR_PROTOCOL_ATTRIBUTES_RET_SENSOR_REG_LEN);
+CODEC_CHECK_PARAM(struct arm_scmi_sensor_protocol_message_attributes, message_id,
+                  SCMI_SENSOR_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_MESSAGE_ID);
+CODEC_CHECK_RET(struct arm_scmi_sensor_protocol_message_attributes, attributes,
+                SCMI_SENSOR_PROTOCOL_MESSAGE_ATTRIBUTES_RET_ATTRIBUTES);
+CODEC_CHECK_PARAM(struct arm_scmi_sensor_description_get, desc_index,
+                  SCMI_SENSOR_DESCRIPTION_GET_PARAM_DESC_INDEX);
+CODEC_CHECK_RET(struct arm_scmi_sensor_description_get, num_sensor_flags,
+                SCMI_SENSOR_DESCRIPTION_GET_RET_NUM_SENSOR_FLAGS);
+CODEC_CHECK_RET(struct arm_scmi_sensor_description_get, sensor_descriptors,
+                SCMI_SENSOR_DESCRIPTION_GET_RET_SENSOR_DESCRIPTORS);
+CODEC_CHECK_PARAM(struct arm_scmi_sensor_trip_point_notify, sensor_id,
+                  SCMI_SENSOR_TRIP_POINT_NOTIFY_PARAM_SENSOR_ID);
+CODEC_CHECK_PARAM(struct arm_scmi_sensor_trip_point_notify, sensor_event_control,
+                  SCMI_SENSOR_TRIP_POINT_NOTIFY_PARAM_EVENT_CONTROL);
+CODEC_CHECK_PARAM(struct arm_scmi_sensor_trip_point_config, sensor_id,
+                  SCMI_SENSOR_TRIP_POINT_CONFIG_PARAM_SENSOR_ID);
+CODEC_CHECK_PARAM(struct arm_scmi_sensor_trip_point_config, trip_point_ev_ctrl,
+                  SCMI_SENSOR_TRIP_POINT_CONFIG_PARAM_TRIP_POINT_EV_CTRL);
+CODEC_CHECK_PARAM(struct arm_scmi_sensor_trip_point_config, trip_point_val_low,
+                  SCMI_SENSOR_TRIP_POINT_CONFIG_PARAM_TRIP_POINT_VAL_LOW);
+CODEC_CHECK_PARAM(struct arm_scmi_sensor_trip_point_config, trip_point_val_high,
+                  SCMI_SENSOR_TRIP_POINT_CONFIG_PARAM_TRIP_POINT_VAL_HIGH);
+CODEC_CHECK_PARAM(struct arm_scmi_sensor_reading_get, sensor_id,
+                  SCMI_SENSOR_READING_GET_PARAM_SENSOR_ID);
+CODEC_CHECK_PARAM(struct arm_scmi_sensor_reading_get, flags, SCMI_SENSOR_READING_GET_PARAM_FLAGS);
+CODEC_CHECK_RET(struct arm_scmi_sensor_reading_get, sensor_value_low,
+                SCMI_SENSOR_READING_GET_RET_SENSOR_VALUE_LOW);
+CODEC_CHECK_RET(struct arm_scmi_sensor_reading_get, sensor_value_high,
+                SCMI_SENSOR_READING_GET_RET_SENSOR_VALUE_HIGH);
+
 #endif /* SENSOR_COMMON_H_ */
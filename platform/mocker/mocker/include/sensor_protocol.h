@@ -31,6 +31,7 @@
 #define SNSR_TRIP_POINT_NOTIFY_ID       0x4
 #define SNSR_TRIP_POINT_CONFIG_ID       0x5
 #define SNSR_READING_GET_MSG_ID         0x6
+#define SNSR_READING_COMPLETE_MSG_ID    0x6 /* Delayed response */
 
 #define MAX_NUMBER_SENSOR   32
 #define SENSOR_ASYNC        1
@@ -75,4 +75,21 @@ struct arm_scmi_system_power_state_set_notify {
         SYSTEM_POWER_SET_NOTIFY_RESERVED_HIGH=31,
     } notify_sys_pwr_set_enable_bits;
 };
+
+/* The layouts above must match the message codec */
+CODEC_CHECK_RET(struct arm_scmi_system_power_protocol_version, version,
+                SCMI_SYSTEM_POWER_PROTOCOL_VERSION_RET_VERSION);
+CODEC_CHECK_RET(struct arm_scmi_system_power_protocol_attributes, attributes,
+                SCMI_SYSTEM_POWER_PROTOCOL_ATTRIBUTES_RET_ATTRIBUTES);
+CODEC_CHECK_PARAM(struct arm_scmi_system_power_protocol_message_attributes, message_id,
+                  SCMI_SYSTEM_POWER_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_MESSAGE_ID);
+CODEC_CHECK_RET(struct arm_scmi_system_power_protocol_message_attributes, attributes,
+                SCMI_SYSTEM_POWER_PROTOCOL_MESSAGE_ATTRIBUTES_RET_ATTRIBUTES);
+CODEC_CHECK_PARAM(struct arm_scmi_system_power_state_set, flags,
+                  SCMI_SYSTEM_POWER_STATE_SET_PARAM_FLAGS);
+CODEC_CHECK_PARAM(struct arm_scmi_system_power_state_set, system_state,
+                  SCMI_SYSTEM_POWER_STATE_SET_PARAM_SYSTEM_STATE);
+CODEC_CHECK_PARAM(struct arm_scmi_system_power_state_set_notify, notify_enable,
+                  SCMI_SYSTEM_POWER_STATE_NOTIFY_PARAM_NOTIFY_ENABLE);
+
 #endif /* SYSTEM_POWER_COMMON_H_ */
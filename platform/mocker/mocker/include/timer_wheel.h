@@ -0,0 +1,62 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _TIMER_WHEEL_H_
+#define _TIMER_WHEEL_H_
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <scmi_codec.h>
+
+/* Message types of the header, as seen by the agent */
+#define MOCKER_DELAYED_RESPONSE_MSG  SCMI_CODEC_DELAYED_RESPONSE
+#define MOCKER_NOTIFICATION_MSG      SCMI_CODEC_NOTIFICATION
+
+/* Agents known to the models, notification subscribers are kept as a mask */
+#define MOCKER_MAX_AGENTS            32
+
+#define TIMER_WHEEL_MAX_PENDING      64  /* Messages scheduled and not yet received */
+#define TIMER_WHEEL_MAX_VALUES       8   /* Payload words of the largest message */
+#define TIMER_WHEEL_TICK_NS          10000
+#define TIMER_WHEEL_SLOTS            256
+
+/* Overrides the latency table, "clock=1000:250,sensor=0" in microseconds */
+#define TIMER_WHEEL_LATENCY_ENV      "SCMI_MOCK_ASYNC_LATENCY"
+/* Seed of the jitter, the same seed gives the same delays */
+#define TIMER_WHEEL_SEED_ENV         "SCMI_MOCK_ASYNC_SEED"
+
+/* Asynchronous message generated by a model, delivered when due */
+struct timer_wheel_message {
+    uint32_t agent;
+    uint32_t header;
+    int32_t status;   /* Delayed responses only */
+    uint32_t count;
+    uint32_t values[TIMER_WHEEL_MAX_VALUES];
+};
+
+void timer_wheel_init(void);
+bool timer_wheel_delayed_response(uint32_t message_id, const uint32_t *values, size_t count);
+void timer_wheel_notify(uint32_t protocol_id, uint32_t message_id, uint32_t agents,
+        const uint32_t *values, size_t count);
+uint32_t timer_wheel_pending(uint32_t agent, uint32_t protocol_id);
+bool timer_wheel_receive(uint32_t agent, uint32_t type, uint32_t timeout_ms,
+        struct timer_wheel_message *message);
+bool timer_wheel_pop(struct timer_wheel_message *message);
+int64_t timer_wheel_next_expiry(void);
+
+#endif /* _TIMER_WHEEL_H_ */
@@ -0,0 +1,240 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include <time.h>
+#include <protocol_common.h>
+#include <pal_platform.h>
+#include <val_stats.h>
+
+/*
+ * Statistics regions of the models, laid out as val_stats.h describes: the
+ * SCMI layout for power domains and performance, the suite one for sensors.
+ * Entries are indexed like the states and levels of the models. The
+ * agent maps a region by the address PROTOCOL_ATTRIBUTES returns, see
+ * mocker_stats_map(). Each region is written by the suite of its protocol
+ * only, so a region has a single writer at a time, as match requires.
+ * Performance levels set through a fast channel bypass the model and are
+ * not counted.
+ */
+#define STATS_REGION_SIZE   1024
+
+struct stats_region {
+    uint32_t protocol_id;
+    uint32_t address;
+    uint32_t length;
+    uint32_t used;       /* bytes laid out so far */
+    uint64_t memory[STATS_REGION_SIZE / sizeof(uint64_t)];
+};
+
+static struct stats_region stats_regions[] = {
+    { POWER_DOMAIN_PROTOCOL_ID },
+    { PERFORMANCE_PROTOCOL_ID },
+    { SENSOR_PROTOCOL_ID },
+};
+
+static const uint32_t stats_signatures[] = {
+    VAL_STATS_SIGNATURE_POWER,
+    VAL_STATS_SIGNATURE_PERF,
+    VAL_STATS_SIGNATURE_SENSOR,
+};
+
+/*!
+ * @brief Returns the time of the models in us, for residencies.
+ */
+static uint64_t stats_time_us(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000) + (now.tv_nsec / 1000);
+}
+
+static struct stats_region *stats_find(uint32_t protocol_id)
+{
+    uint32_t i;
+
+    for (i = 0; i < NUM_ELEMS(stats_regions); i++) {
+        if (stats_regions[i].protocol_id == protocol_id)
+            return &stats_regions[i];
+    }
+
+    return NULL;
+}
+
+static VAL_STATS_HEADER_s *stats_header(struct stats_region *region)
+{
+    return (VAL_STATS_HEADER_s *)region->memory;
+}
+
+static VAL_STATS_DOMAIN_s *stats_domain(struct stats_region *region, uint32_t domain_id)
+{
+    VAL_STATS_HEADER_s *header = stats_header(region);
+    uint32_t *domain_offset = (uint32_t *)(header + 1);
+
+    if ((domain_id >= header->num_domains) || (domain_offset[domain_id] == 0))
+        return NULL;
+
+    return (VAL_STATS_DOMAIN_s *)((uint8_t *)region->memory + domain_offset[domain_id]);
+}
+
+/*!
+ * @brief Lays out the header of the region of a protocol, its domains are
+ *        added by mocker_stats_add_domain(). A region larger than the model
+ *        memory is cut to it.
+ */
+void mocker_stats_init(uint32_t protocol_id, uint32_t address, uint32_t length,
+        uint32_t num_domains)
+{
+    struct stats_region *region = stats_find(protocol_id);
+    VAL_STATS_HEADER_s *header;
+
+    if (region == NULL)
+        return;
+
+    memset(region->memory, 0, sizeof(region->memory));
+    region->address = address;
+    region->length = (length < STATS_REGION_SIZE) ? length : STATS_REGION_SIZE;
+    region->used = sizeof(*header) + (num_domains * sizeof(uint32_t));
+    region->used = (region->used + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1);
+    if (region->used > region->length)
+        return;
+
+    header = stats_header(region);
+    header->signature = stats_signatures[region - stats_regions];
+    if (protocol_id == SENSOR_PROTOCOL_ID)
+        header->revision = VAL_STATS_SENSOR_REVISION;
+    header->num_domains = num_domains;
+}
+
+/*!
+ * @brief Adds a domain with num_entries entries to the region of a protocol,
+ *        the domain starts in entry current. A domain that does not fit is
+ *        left out, its offset stays 0.
+ */
+void mocker_stats_add_domain(uint32_t protocol_id, uint32_t domain_id, uint32_t num_entries,
+        uint32_t current)
+{
+    struct stats_region *region = stats_find(protocol_id);
+    VAL_STATS_HEADER_s *header;
+    VAL_STATS_DOMAIN_s *domain;
+    uint32_t size;
+
+    if ((region == NULL) || (region->length == 0))
+        return;
+
+    header = stats_header(region);
+    size = sizeof(*domain) + (num_entries * sizeof(VAL_STATS_ENTRY_s));
+    if ((domain_id >= header->num_domains) || (region->used + size > region->length))
+        return;
+
+    ((uint32_t *)(header + 1))[domain_id] = region->used;
+    domain = stats_domain(region, domain_id);
+    domain->num_entries = num_entries;
+    domain->current = current;
+    domain->last_change_us = stats_time_us();
+
+    region->used += size;
+}
+
+/*!
+ * @brief Opens an update of a region, readers retry while match is odd.
+ */
+static void stats_update_begin(VAL_STATS_HEADER_s *header)
+{
+    __atomic_store_n(&header->match, header->match + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+static void stats_update_end(VAL_STATS_HEADER_s *header)
+{
+    __atomic_store_n(&header->match, header->match + 1, __ATOMIC_RELEASE);
+}
+
+/*!
+ * @brief Moves a domain into an entry: the residency of the entry it leaves
+ *        grows by the time spent in it, and the entry it enters counts one
+ *        more transition. Staying in the same entry changes nothing.
+ */
+void mocker_stats_transition(uint32_t protocol_id, uint32_t domain_id, uint32_t index)
+{
+    struct stats_region *region = stats_find(protocol_id);
+    VAL_STATS_DOMAIN_s *domain;
+    VAL_STATS_ENTRY_s *entry;
+    uint64_t now;
+
+    if ((region == NULL) || (region->length == 0))
+        return;
+
+    domain = stats_domain(region, domain_id);
+    if ((domain == NULL) || (index >= domain->num_entries) || (index == domain->current))
+        return;
+
+    entry = (VAL_STATS_ENTRY_s *)(domain + 1);
+    now = stats_time_us();
+
+    stats_update_begin(stats_header(region));
+    entry[domain->current].value += now - domain->last_change_us;
+    entry[index].count++;
+    domain->current = index;
+    domain->last_change_us = now;
+    stats_update_end(stats_header(region));
+}
+
+/*!
+ * @brief Records a new value of an entry, such as a sensor reading, and
+ *        counts the update.
+ */
+void mocker_stats_record(uint32_t protocol_id, uint32_t domain_id, uint32_t index,
+        uint64_t value)
+{
+    struct stats_region *region = stats_find(protocol_id);
+    VAL_STATS_DOMAIN_s *domain;
+    VAL_STATS_ENTRY_s *entry;
+
+    if ((region == NULL) || (region->length == 0))
+        return;
+
+    domain = stats_domain(region, domain_id);
+    if ((domain == NULL) || (index >= domain->num_entries))
+        return;
+
+    entry = (VAL_STATS_ENTRY_s *)(domain + 1);
+
+    stats_update_begin(stats_header(region));
+    entry[index].count++;
+    entry[index].value = value;
+    domain->last_change_us = stats_time_us();
+    stats_update_end(stats_header(region));
+}
+
+/*!
+ * @brief Returns the memory of the region at address. The models report the
+ *        low word of the address only, the high word is not compared.
+ */
+void *mocker_stats_map(uint64_t address, uint32_t size)
+{
+    uint32_t i;
+
+    for (i = 0; i < NUM_ELEMS(stats_regions); i++) {
+        if ((stats_regions[i].length != 0) &&
+            ((uint32_t)address == stats_regions[i].address) &&
+            (size <= stats_regions[i].length))
+            return stats_regions[i].memory;
+    }
+
+    return NULL;
+}
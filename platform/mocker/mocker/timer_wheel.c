@@ -0,0 +1,407 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include <pthread.h>
+#include <time.h>
+#include <protocol_common.h>
+#include <pal_platform.h>
+#include <timer_wheel.h>
+#include <pal_async_expected.h>
+
+/*
+ * Hashed timer wheel holding the delayed responses and notifications of the
+ * models until they are due. A message is hashed into the slot of its expiry
+ * tick, messages due more than one turn of the wheel away simply stay in
+ * their slot for the following turns. Expired messages move to the ready
+ * list in expiry order, from which an agent takes the first message of the
+ * type it waits for, so that messages can be consumed out of order.
+ */
+struct timer_wheel_entry {
+    struct timer_wheel_entry *next;
+    uint64_t expiry;    /* tick at which the message is due */
+    uint64_t sequence;  /* scheduling order, orders messages due on the same tick */
+    bool used;
+    struct timer_wheel_message message;
+};
+
+static struct timer_wheel_entry g_entries[TIMER_WHEEL_MAX_PENDING];
+static struct timer_wheel_entry *g_slots[TIMER_WHEEL_SLOTS];
+static struct timer_wheel_entry *g_ready;
+static uint64_t g_tick;
+static uint64_t g_sequence;
+static uint32_t g_random;
+
+static pthread_mutex_t g_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_ready_cond;
+
+static uint64_t timer_wheel_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000ull) + now.tv_nsec;
+}
+
+/* xorshift32, the jitter only needs to be repeatable */
+static uint32_t timer_wheel_random(void)
+{
+    g_random ^= g_random << 13;
+    g_random ^= g_random >> 17;
+    g_random ^= g_random << 5;
+    return g_random;
+}
+
+/*
+ * Applies TIMER_WHEEL_LATENCY_ENV, a comma separated list of
+ * <protocol>=<latency_us>[:<jitter_us>]
+ */
+static void timer_wheel_parse_latency(const char *setting)
+{
+    const char *next;
+    char *end;
+    size_t length;
+    uint32_t i;
+
+    for (; setting != NULL && *setting != '\0'; setting = next) {
+        next = strchr(setting, ',');
+        length = (next != NULL) ? (size_t)(next - setting) : strlen(setting);
+        if (next != NULL)
+            next++;
+
+        for (i = 0; i < NUM_ELEMS(async_latency); i++) {
+            if ((strncmp(setting, async_latency[i].name, strlen(async_latency[i].name)) != 0) ||
+                (setting[strlen(async_latency[i].name)] != '='))
+                continue;
+
+            async_latency[i].latency_us =
+                    strtoul(setting + strlen(async_latency[i].name) + 1, &end, 0);
+            async_latency[i].jitter_us = (*end == ':') ? strtoul(end + 1, NULL, 0) : 0;
+            break;
+        }
+
+        if (i == NUM_ELEMS(async_latency))
+            printf("\nIgnoring %.*s in %s\n", (int)length, setting, TIMER_WHEEL_LATENCY_ENV);
+    }
+}
+
+void timer_wheel_init(void)
+{
+    pthread_condattr_t attributes;
+    const char *seed;
+
+    pthread_condattr_init(&attributes);
+    pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+    pthread_cond_init(&g_ready_cond, &attributes);
+    pthread_condattr_destroy(&attributes);
+
+    seed = getenv(TIMER_WHEEL_SEED_ENV);
+    g_random = (seed != NULL) ? strtoul(seed, NULL, 0) : async_jitter_seed;
+    if (g_random == 0)
+        g_random = 1;
+
+    timer_wheel_parse_latency(getenv(TIMER_WHEEL_LATENCY_ENV));
+    g_tick = timer_wheel_now() / TIMER_WHEEL_TICK_NS;
+}
+
+/* Inserts an expired entry into the ready list, in expiry order */
+static void timer_wheel_make_ready(struct timer_wheel_entry *entry)
+{
+    struct timer_wheel_entry **link = &g_ready;
+
+    while ((*link != NULL) && (((*link)->expiry < entry->expiry) ||
+           (((*link)->expiry == entry->expiry) && ((*link)->sequence < entry->sequence))))
+        link = &(*link)->next;
+
+    entry->next = *link;
+    *link = entry;
+}
+
+/* Moves every entry due by the current time from its slot to the ready list */
+static void timer_wheel_advance(void)
+{
+    struct timer_wheel_entry **link, *entry;
+    uint64_t now = timer_wheel_now() / TIMER_WHEEL_TICK_NS;
+    uint64_t steps, tick;
+
+    if (now <= g_tick)
+        return;
+
+    /* After a full turn every slot has been visited */
+    steps = now - g_tick;
+    if (steps > TIMER_WHEEL_SLOTS)
+        steps = TIMER_WHEEL_SLOTS;
+
+    for (tick = g_tick + 1; tick <= g_tick + steps; tick++) {
+        link = &g_slots[tick % TIMER_WHEEL_SLOTS];
+        while ((entry = *link) != NULL) {
+            if (entry->expiry > now) {
+                link = &entry->next;
+                continue;
+            }
+
+            *link = entry->next;
+            timer_wheel_make_ready(entry);
+        }
+    }
+
+    g_tick = now;
+}
+
+/* Schedules a message after the latency of its protocol, called with the lock held */
+static bool timer_wheel_schedule(const struct timer_wheel_message *message)
+{
+    uint32_t protocol_id = scmi_codec_protocol_id(message->header);
+    uint64_t delay = 0;
+    struct timer_wheel_entry *entry;
+    uint32_t i;
+
+    for (i = 0; i < TIMER_WHEEL_MAX_PENDING; i++) {
+        if (!g_entries[i].used)
+            break;
+    }
+    if (i == TIMER_WHEEL_MAX_PENDING)
+        return false;
+
+    entry = &g_entries[i];
+    for (i = 0; i < NUM_ELEMS(async_latency); i++) {
+        if (async_latency[i].protocol_id != protocol_id)
+            continue;
+
+        delay = async_latency[i].latency_us;
+        if (async_latency[i].jitter_us != 0)
+            delay += timer_wheel_random() % (async_latency[i].jitter_us + 1);
+        break;
+    }
+
+    timer_wheel_advance();
+    entry->used = true;
+    entry->message = *message;
+    entry->sequence = g_sequence++;
+    entry->expiry = (timer_wheel_now() + (delay * 1000) + TIMER_WHEEL_TICK_NS - 1) /
+                    TIMER_WHEEL_TICK_NS;
+
+    if (entry->expiry <= g_tick) {
+        timer_wheel_make_ready(entry);
+    } else {
+        entry->next = g_slots[entry->expiry % TIMER_WHEEL_SLOTS];
+        g_slots[entry->expiry % TIMER_WHEEL_SLOTS] = entry;
+    }
+
+    pthread_cond_broadcast(&g_ready_cond);
+    return true;
+}
+
+/**
+  @brief   Schedules the delayed response to the command being processed
+  @param   message_id  message id of the delayed response
+  @param   values      return values of the delayed response
+  @param   count       number of return values
+  @return  false if too many messages are pending
+**/
+bool timer_wheel_delayed_response(uint32_t message_id, const uint32_t *values, size_t count)
+{
+    struct timer_wheel_message message;
+    uint32_t header = mocker_current_header();
+    bool scheduled;
+
+    if (count > TIMER_WHEEL_MAX_VALUES)
+        return false;
+
+    /* Same protocol and token as the command */
+    message.agent = mocker_current_agent();
+    message.header = scmi_codec_header(scmi_codec_protocol_id(header), message_id,
+                                       MOCKER_DELAYED_RESPONSE_MSG, scmi_codec_token(header));
+    message.status = SCMI_STATUS_SUCCESS;
+    message.count = count;
+    memcpy(message.values, values, count * sizeof(uint32_t));
+
+    pthread_mutex_lock(&g_lock);
+    scheduled = timer_wheel_schedule(&message);
+    pthread_mutex_unlock(&g_lock);
+    return scheduled;
+}
+
+/**
+  @brief   Schedules a notification to each subscribed agent. A notification
+           that does not fit is dropped, as a platform out of resources would.
+  @param   protocol_id  protocol of the notification
+  @param   message_id   message id of the notification
+  @param   agents       mask of the subscribed agents
+  @param   values       payload of the notification
+  @param   count        number of payload words
+  @return  none
+**/
+void timer_wheel_notify(uint32_t protocol_id, uint32_t message_id, uint32_t agents,
+        const uint32_t *values, size_t count)
+{
+    struct timer_wheel_message message;
+    uint32_t agent;
+
+    if (count > TIMER_WHEEL_MAX_VALUES)
+        return;
+
+    message.header = scmi_codec_header(protocol_id, message_id, MOCKER_NOTIFICATION_MSG, 0);
+    message.status = SCMI_STATUS_SUCCESS;
+    message.count = count;
+    memcpy(message.values, values, count * sizeof(uint32_t));
+
+    pthread_mutex_lock(&g_lock);
+    for (agent = 0; agent < MOCKER_MAX_AGENTS; agent++) {
+        if (!(agents & (1u << agent)))
+            continue;
+
+        message.agent = agent;
+        timer_wheel_schedule(&message);
+    }
+    pthread_mutex_unlock(&g_lock);
+}
+
+/**
+  @brief   Counts the delayed responses of a protocol not yet received by an agent
+  @param   agent        agent
+  @param   protocol_id  protocol
+  @return  number of pending delayed responses
+**/
+uint32_t timer_wheel_pending(uint32_t agent, uint32_t protocol_id)
+{
+    uint32_t header, count = 0;
+    uint32_t i;
+
+    pthread_mutex_lock(&g_lock);
+    for (i = 0; i < TIMER_WHEEL_MAX_PENDING; i++) {
+        header = g_entries[i].message.header;
+        if (g_entries[i].used && (g_entries[i].message.agent == agent) &&
+            (scmi_codec_protocol_id(header) == protocol_id) &&
+            (scmi_codec_type(header) == MOCKER_DELAYED_RESPONSE_MSG))
+            count++;
+    }
+    pthread_mutex_unlock(&g_lock);
+
+    return count;
+}
+
+/* Takes the first ready message matching agent and type, called with the lock held */
+static bool timer_wheel_take(uint32_t agent, uint32_t type, bool any,
+        struct timer_wheel_message *message)
+{
+    struct timer_wheel_entry **link, *entry;
+
+    for (link = &g_ready; (entry = *link) != NULL; link = &entry->next) {
+        if (!any && ((entry->message.agent != agent) ||
+            (scmi_codec_type(entry->message.header) != type)))
+            continue;
+
+        *link = entry->next;
+        *message = entry->message;
+        entry->used = false;
+        return true;
+    }
+
+    return false;
+}
+
+/**
+  @brief   Returns the time until the next message is due
+  @return  nanoseconds, 0 if a message is ready, -1 if none is scheduled
+**/
+int64_t timer_wheel_next_expiry(void)
+{
+    uint64_t expiry = UINT64_MAX;
+    uint64_t now;
+    uint32_t i;
+
+    pthread_mutex_lock(&g_lock);
+    timer_wheel_advance();
+    if (g_ready != NULL) {
+        pthread_mutex_unlock(&g_lock);
+        return 0;
+    }
+
+    for (i = 0; i < TIMER_WHEEL_MAX_PENDING; i++) {
+        if (g_entries[i].used && (g_entries[i].expiry < expiry))
+            expiry = g_entries[i].expiry;
+    }
+    pthread_mutex_unlock(&g_lock);
+
+    if (expiry == UINT64_MAX)
+        return -1;
+
+    now = timer_wheel_now();
+    return (expiry * TIMER_WHEEL_TICK_NS > now) ? (int64_t)(expiry * TIMER_WHEEL_TICK_NS - now) : 0;
+}
+
+/**
+  @brief   Waits for the next message of a type addressed to an agent. Other
+           messages stay queued for a later call.
+  @param   agent       agent
+  @param   type        MOCKER_DELAYED_RESPONSE_MSG or MOCKER_NOTIFICATION_MSG
+  @param   timeout_ms  time to wait for a message
+  @param   message     storage for the message
+  @return  false if no message arrived in time
+**/
+bool timer_wheel_receive(uint32_t agent, uint32_t type, uint32_t timeout_ms,
+        struct timer_wheel_message *message)
+{
+    uint64_t deadline = timer_wheel_now() + ((uint64_t)timeout_ms * 1000000);
+    uint64_t now, wake, expiry;
+    struct timespec until;
+    bool received;
+    uint32_t i;
+
+    pthread_mutex_lock(&g_lock);
+    for (;;) {
+        timer_wheel_advance();
+        received = timer_wheel_take(agent, type, false, message);
+        now = timer_wheel_now();
+        if (received || (now >= deadline))
+            break;
+
+        /* Sleep until the next message is due or another thread schedules one */
+        wake = deadline;
+        for (i = 0; i < TIMER_WHEEL_MAX_PENDING; i++) {
+            expiry = g_entries[i].expiry * TIMER_WHEEL_TICK_NS;
+            if (g_entries[i].used && (g_entries[i].message.agent == agent) &&
+                (expiry > now) && (expiry < wake))
+                wake = expiry;
+        }
+
+        until.tv_sec = wake / 1000000000ull;
+        until.tv_nsec = wake % 1000000000ull;
+        pthread_cond_timedwait(&g_ready_cond, &g_lock, &until);
+    }
+    pthread_mutex_unlock(&g_lock);
+
+    return received;
+}
+
+/**
+  @brief   Takes the first ready message, whatever its agent. Used by
+           scmi_mock_server to deliver messages to the agents.
+  @param   message  storage for the message
+  @return  false if no message is ready
+**/
+bool timer_wheel_pop(struct timer_wheel_message *message)
+{
+    bool popped;
+
+    pthread_mutex_lock(&g_lock);
+    timer_wheel_advance();
+    popped = timer_wheel_take(0, 0, true, message);
+    pthread_mutex_unlock(&g_lock);
+
+    return popped;
+}
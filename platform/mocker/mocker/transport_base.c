@@ -177,7 +177,7 @@ void base_send_message(uint32_t message_id, uint32_t parameter_count,
     case BASE_DISC_VENDOR_MSG_ID:
         *status = SCMI_STATUS_SUCCESS;
         sprintf((char *)return_values, "%s", base_protocol.vendor_identifier);
-        *return_values_count = strlen((const char*)return_values);
+        *return_values_count = SCMI_NAME_STR_SIZE/4;
         break;
     case BASE_DISC_SUBVENDOR_MSG_ID:
         if(base_protocol.subvendor_cmd_supported == false)
@@ -187,7 +187,7 @@ void base_send_message(uint32_t message_id, uint32_t parameter_count,
         }
         *status = SCMI_STATUS_SUCCESS;
         sprintf((char *)return_values, "%s", base_protocol.subvendor_identifier);
-        *return_values_count = strlen((const char*)return_values);
+        *return_values_count = SCMI_NAME_STR_SIZE/4;
         break;
     case BASE_DISC_IMPLEMENTATION_VERSION_MSG_ID:
         *status = SCMI_STATUS_SUCCESS;
@@ -241,7 +241,7 @@ void base_send_message(uint32_t message_id, uint32_t parameter_count,
                         (parameters[parameter_idx] == 0 ?
                                 "platform_mock" : agent_name_get(parameters[parameter_idx])));
             }
-            *return_values_count = strlen((const char*)return_values) + 1;
+            *return_values_count = 1 + (SCMI_NAME_STR_SIZE/4);
         }
         break;
     case BASE_NOTIFY_ERRORS_MSG_ID:
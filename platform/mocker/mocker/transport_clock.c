@@ -18,6 +18,8 @@
 #include <clock_protocol.h>
 #include <clock_common.h>
 #include <pal_clock_expected.h>
+#include <pal_platform.h>
+#include <timer_wheel.h>
 
 struct arm_scmi_clock_protocol clock_protocol;
 static unsigned int clock_status[MAX_NUM_CLOCK];
@@ -37,7 +39,9 @@ void clock_send_message(uint32_t message_id, uint32_t parameter_count,
         size_t *return_values_count, uint32_t *return_values)
 {
 
-    uint32_t parameter_idx, return_idx, clock_id;
+    uint32_t parameter_idx, return_idx, clock_id, flags;
+    uint32_t rate_index, num_rates;
+    uint32_t delayed_response[3];
     char * str;
     int i, j;
 
@@ -105,18 +109,27 @@ void clock_send_message(uint32_t message_id, uint32_t parameter_count,
         }
         *status = SCMI_STATUS_SUCCESS;
         j = 100;
+        /* As many rates from rate_index as the channel holds, the others remain */
+        rate_index = parameters[OFFSET_PARAM(struct arm_scmi_clock_describe_rates,
+                rate_index)];
+        num_rates = clock_protocol.num_rates[clock_id] - rate_index;
+        if (num_rates > (mocker_max_return_values() - 1) / 2)
+            num_rates = (mocker_max_return_values() - 1) / 2;
         return_values[OFFSET_RET(
                 struct arm_scmi_clock_describe_rates,
-                num_rates_flags)] = (clock_protocol.num_rates[clock_id] <<
-                        CLK_DESC_RATE_NUM_RATES_RETURNED_LOW);
-        for (i = 0; i < clock_protocol.num_rates[clock_id]; ++i) {
+                num_rates_flags)] = (num_rates << CLK_DESC_RATE_NUM_RATES_RETURNED_LOW) |
+                ((clock_protocol.num_rates[clock_id] - rate_index - num_rates) <<
+                        CLK_DESC_RATE_NUM_RATES_REMAINING_LOW);
+        for (i = 0; i < num_rates; ++i) {
             return_values[OFFSET_RET(
                     struct arm_scmi_clock_describe_rates,
-                    rates) + 2 * i] = j * (i + 1);
+                    rates) + 2 * i] = j * (rate_index + i + 1);
             return_values[OFFSET_RET(
                     struct arm_scmi_clock_describe_rates,
-                    rates) + 2 * i + 1] = j * (i + 1) + 50;
+                    rates) + 2 * i + 1] = j * (rate_index + i + 1) + 50;
         }
+        *return_values_count = OFFSET_RET(struct arm_scmi_clock_describe_rates,
+                rates) + 2 * num_rates;
         break;
     case CLK_RATE_SET_MSG_ID:
         clock_id = parameters[OFFSET_PARAM(struct arm_scmi_clock_rate_set, clock_id)];
@@ -136,11 +149,28 @@ void clock_send_message(uint32_t message_id, uint32_t parameter_count,
             *status = SCMI_STATUS_INVALID_PARAMETERS;
             break;
         }
+        flags = parameters[OFFSET_PARAM(struct arm_scmi_clock_rate_set, flags)];
+        if ((flags & (1 << CLK_RATESET_ASYNC_FLAG_LOW)) &&
+            (timer_wheel_pending(mocker_current_agent(), CLOCK_PROTOCOL_ID) >=
+             clock_protocol.max_num_pending_async_rate_chg_supported)) {
+            *status = SCMI_STATUS_BUSY;
+            break;
+        }
         clock_rate[clock_id].lower = parameters[OFFSET_PARAM(
                                      struct arm_scmi_clock_rate_set, rate)];
         clock_rate[clock_id].upper = parameters[OFFSET_PARAM(
                                      struct arm_scmi_clock_rate_set, rate) + 1];
         *status = SCMI_STATUS_SUCCESS;
+        /* Async rate change completes with a delayed response, unless asked to skip it */
+        if ((flags & (1 << CLK_RATESET_ASYNC_FLAG_LOW)) &&
+            !(flags & (1 << CLK_RATESET_IGNORE_DELAY_RSP_LOW))) {
+            delayed_response[0] = clock_id;
+            delayed_response[1] = clock_rate[clock_id].lower;
+            delayed_response[2] = clock_rate[clock_id].upper;
+            if (!timer_wheel_delayed_response(CLK_RATE_SET_COMPLETE_MSG_ID, delayed_response,
+                                              NUM_ELEMS(delayed_response)))
+                *status = SCMI_STATUS_BUSY;
+        }
         break;
     case CLK_RATE_GET_MSG_ID:
         clock_id = parameters[OFFSET_PARAM(struct arm_scmi_clock_rate_get, clock_id)];
@@ -166,6 +196,7 @@ void clock_send_message(uint32_t message_id, uint32_t parameter_count,
                     struct arm_scmi_clock_rate_get,
                     rate) + 1] = clock_rate[clock_id].upper;
         }
+        *return_values_count = OFFSET_RET(struct arm_scmi_clock_rate_get, rate) + 2;
         break;
     case CLK_CONFIG_SET_MSG_ID:
         parameter_idx = OFFSET_PARAM(struct arm_scmi_clock_config_set, clock_id);
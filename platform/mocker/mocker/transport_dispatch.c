@@ -0,0 +1,156 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include <stdio.h>
+#include <protocol_common.h>
+#include <pal_platform.h>
+#include <mock_mailbox.h>
+#include <timer_wheel.h>
+#include <fault_profile.h>
+
+/* Agent and command being processed by the calling thread, for the async models */
+static __thread uint32_t g_mocker_agent;
+static __thread uint32_t g_mocker_header;
+
+/* Return values a response carries at most, paginated commands fill pages up to it */
+static uint32_t g_mocker_max_returns = MB_MAX_PAYLOAD_WORDS - 1;
+
+void mocker_select_agent(uint32_t agent)
+{
+    g_mocker_agent = agent;
+}
+
+uint32_t mocker_current_agent(void)
+{
+    return g_mocker_agent;
+}
+
+uint32_t mocker_current_header(void)
+{
+    return g_mocker_header;
+}
+
+/*!
+ * @brief Sizes the responses of the models for a channel of size bytes.
+ */
+void mocker_set_channel_size(uint32_t size)
+{
+    g_mocker_max_returns = ((size - MB_MESSAGE_PAYLOAD) / 4) - 1;
+}
+
+uint32_t mocker_max_return_values(void)
+{
+    return g_mocker_max_returns;
+}
+
+void mocker_initialize(void)
+{
+    timer_wheel_init();
+    fault_profile_init();
+    fill_base_protocol();
+    fill_power_protocol();
+    fill_performance_protocol();
+    fill_sensor_protocol();
+    fill_clock_protocol();
+    fill_reset_protocol();
+}
+
+/*!
+ * @brief Processes a command and returns how many copies of the response the
+ *        transport delivers, as decided by the fault profile.
+ */
+uint32_t mocker_send_message(uint32_t message_header_send, size_t parameter_count,
+        const uint32_t *parameters, uint32_t *message_header_rcv, int32_t *status,
+        size_t *return_values_count, uint32_t *return_values)
+{
+    const struct fault_rule *rule;
+    int32_t expected_count;
+    int message_id;
+    int protocol_id;
+
+    *message_header_rcv = message_header_send;
+    g_mocker_header = message_header_send;
+    protocol_id = scmi_codec_protocol_id(message_header_send);
+    message_id = scmi_codec_message_id(message_header_send);
+
+    /* A busy platform turns the command down without processing it */
+    rule = fault_profile_find(protocol_id, message_id);
+    if (rule != NULL) {
+        fault_profile_delay(rule);
+        if (fault_profile_roll(rule->busy_rate)) {
+            *status = SCMI_STATUS_BUSY;
+            *return_values_count = 0;
+            return MOCKER_RESPONSE_DELIVERED;
+        }
+    }
+
+    /* A command of the wrong length is turned down before the models see it */
+    expected_count = scmi_codec_param_count(protocol_id, message_id);
+    if ((expected_count >= 0) && (parameter_count != (size_t)expected_count)) {
+        *status = SCMI_STATUS_PROTOCOL_ERROR;
+        *return_values_count = 0;
+        return MOCKER_RESPONSE_DELIVERED;
+    }
+
+    switch (protocol_id)
+    {
+    case BASE_PROTOCOL_ID:
+        base_send_message(message_id, parameter_count, parameters, status,
+                return_values_count, return_values);
+        break;
+    case POWER_DOMAIN_PROTOCOL_ID:
+        power_send_message(message_id, parameter_count, parameters, status,
+                return_values_count, return_values);
+        break;
+    case SYSTEM_POWER_PROTOCOL_ID:
+        system_power_send_message(message_id, parameter_count, parameters, status,
+                return_values_count, return_values);
+        break;
+    case PERFORMANCE_PROTOCOL_ID:
+        performance_send_message(message_id, parameter_count, parameters, status,
+                return_values_count, return_values);
+        break;
+    case CLOCK_PROTOCOL_ID:
+        clock_send_message(message_id, parameter_count, parameters, status,
+                return_values_count, return_values);
+        break;
+    case SENSOR_PROTOCOL_ID:
+        sensor_send_message(message_id, parameter_count, parameters, status,
+                return_values_count, return_values);
+        break;
+    case RESET_PROTOCOL_ID:
+        reset_send_message(message_id, parameter_count, parameters, status,
+                return_values_count, return_values);
+        break;
+    default:
+        printf("\nProtocol: %d\n", message_id);
+        assert(!"\nUnknown protocol id\n");
+        break;
+    }
+
+    if (rule == NULL)
+        return MOCKER_RESPONSE_DELIVERED;
+
+    if (fault_profile_roll(rule->corrupt_token_rate))
+        *message_header_rcv = fault_profile_corrupt_token(*message_header_rcv);
+    if (fault_profile_roll(rule->drop_rate))
+        return MOCKER_RESPONSE_DROPPED;
+    if (fault_profile_roll(rule->duplicate_rate))
+        return MOCKER_RESPONSE_DUPLICATED;
+
+    return MOCKER_RESPONSE_DELIVERED;
+}
@@ -18,15 +18,48 @@
 #include <performance_protocol.h>
 #include <performance_common.h>
 #include <pal_performance_expected.h>
+#include <pal_platform.h>
+#include <timer_wheel.h>
 
 struct arm_scmi_performance_protocol performance_protocol;
 
-static unsigned int perf_level_max_limit[MAX_PERFORMANCE_DOMAIN_COUNT];
-static unsigned int perf_level_min_limit[MAX_PERFORMANCE_DOMAIN_COUNT];
+/* Limits in the fast channel layout, range max followed by range min */
+struct perf_limits {
+    unsigned int range_max;
+    unsigned int range_min;
+};
+
+/*
+ * Model state doubles as the fast channel memory, so that commands sent
+ * through either path observe each other immediately
+ */
+static struct perf_limits perf_limits[MAX_PERFORMANCE_DOMAIN_COUNT];
 static unsigned int perf_level_current[MAX_PERFORMANCE_DOMAIN_COUNT];
+static uint64_t perf_fast_chan_doorbell[MAX_PERFORMANCE_DOMAIN_COUNT][PERF_NUM_FAST_CHAN_MSGS];
+
+/* Agents subscribed to limit and level change notifications, per domain */
+static uint32_t perf_limit_notify_agents[MAX_PERFORMANCE_DOMAIN_COUNT];
+static uint32_t perf_level_notify_agents[MAX_PERFORMANCE_DOMAIN_COUNT];
+
+/*!
+ * @brief Returns the entry of the statistics region a level falls in, the
+ *        highest described level not above it.
+ */
+static uint32_t performance_stats_index(uint32_t domain_id, uint32_t level)
+{
+    uint32_t index = 0;
+
+    while ((index + 1 < performance_protocol.num_performance_levels[domain_id]) &&
+           (performance_protocol.performance_level_value[domain_id][index + 1] <= level))
+        index++;
+
+    return index;
+}
 
 void fill_performance_protocol()
 {
+    uint32_t domain_id;
+
     performance_protocol.protocol_version = PERFORMANCE_VERSION;
     performance_protocol.num_performance_domains = num_performance_domains;
     performance_protocol.statistics_address_low = statistics_address_low_perf;
@@ -65,6 +98,53 @@ void fill_performance_protocol()
             perf_performance_fast_chan_doorbell_preserve_mask_low;
     performance_protocol.doorbell_preserve_mask_high =
             perf_performance_fast_chan_doorbell_preserve_mask_high;
+
+    /* The fast channels expose this state as is, so it starts where the
+       commands report it: the lowest level within the full range */
+    for (domain_id = 0; domain_id < performance_protocol.num_performance_domains; domain_id++) {
+        perf_level_current[domain_id] = performance_protocol.performance_level_value[domain_id][0];
+        perf_limits[domain_id].range_min = performance_protocol.performance_level_value[domain_id][0];
+        perf_limits[domain_id].range_max = performance_protocol.performance_level_value[domain_id]
+                [performance_protocol.num_performance_levels[domain_id] - 1];
+    }
+
+    /* One entry per level, domains start at their lowest level */
+    mocker_stats_init(PERFORMANCE_PROTOCOL_ID, performance_protocol.statistics_address_low,
+            performance_protocol.statistics_length, performance_protocol.num_performance_domains);
+    for (domain_id = 0; domain_id < performance_protocol.num_performance_domains; domain_id++)
+        mocker_stats_add_domain(PERFORMANCE_PROTOCOL_ID, domain_id,
+                performance_protocol.num_performance_levels[domain_id], 0);
+}
+
+void *performance_fast_channel_map(uint64_t address)
+{
+    uint64_t chan_addr, doorbell_addr;
+    int domain_id, idx;
+
+    for (domain_id = 0; domain_id < performance_protocol.num_performance_domains; domain_id++) {
+        if (performance_protocol.performance_domain_fast_channel_support[domain_id] == 0)
+            continue;
+
+        for (idx = 0; idx < PERF_NUM_FAST_CHAN_MSGS; idx++) {
+            chan_addr = ((uint64_t)performance_protocol.fast_chan_addr_high[domain_id][idx] << 32) |
+                        performance_protocol.fast_chan_addr_low[domain_id][idx];
+            doorbell_addr =
+                ((uint64_t)performance_protocol.doorbell_addr_high[domain_id][idx] << 32) |
+                performance_protocol.doorbell_addr_low[domain_id][idx];
+
+            if (address == doorbell_addr)
+                return &perf_fast_chan_doorbell[domain_id][idx];
+            if (address != chan_addr)
+                continue;
+
+            /* Limit set/get come first, then level set/get */
+            if (idx + PERF_LIMIT_SET_MSG_ID <= PERF_LIMIT_GET_MSG_ID)
+                return &perf_limits[domain_id];
+            return &perf_level_current[domain_id];
+        }
+    }
+
+    return NULL;
 }
 
 void performance_send_message(uint32_t message_id, uint32_t parameter_count,
@@ -73,8 +153,11 @@ void performance_send_message(uint32_t message_id, uint32_t parameter_count,
 {
 
     uint32_t parameter_idx, return_idx;
+    uint32_t notification[4];
     char * str;
     int i, domain_id, messageid;
+    uint32_t level_index, num_levels;
+    unsigned int range_max, range_min;
 
     switch(message_id)
     {
@@ -156,7 +239,8 @@ void performance_send_message(uint32_t message_id, uint32_t parameter_count,
         str = (char *)
               (&return_values[OFFSET_RET(struct arm_scmi_performance_domain_attributes, name)]);
         sprintf(str, "Domain_%d", domain_id);
-        *return_values_count = 5;
+        *return_values_count = OFFSET_RET(struct arm_scmi_performance_domain_attributes, name) +
+                (SCMI_NAME_STR_SIZE/4);
         break;
     case PERF_DESC_LVL_MSG_ID:
         domain_id = parameters[OFFSET_PARAM(struct arm_scmi_performance_describe_levels,domain_id)];
@@ -173,17 +257,25 @@ void performance_send_message(uint32_t message_id, uint32_t parameter_count,
               return;
         }
         *status = SCMI_STATUS_SUCCESS;
+        /* As many levels from level_index as the channel holds, the others remain */
+        level_index = parameters[OFFSET_PARAM(
+                struct arm_scmi_performance_describe_levels,level_index)];
+        num_levels = performance_protocol.num_performance_levels[domain_id] - level_index;
+        if (num_levels > (mocker_max_return_values() - 1) / 3)
+            num_levels = (mocker_max_return_values() - 1) / 3;
         return_values[OFFSET_RET(struct arm_scmi_performance_describe_levels,num_levels)] =
-            performance_protocol.num_performance_levels[domain_id] << PERFORMANCE_DESC_LEVELS_NUM_LEVELS_LOW;
+            (num_levels << PERFORMANCE_DESC_LEVELS_NUM_LEVELS_LOW) |
+            ((performance_protocol.num_performance_levels[domain_id] - level_index - num_levels) <<
+             PERFORMANCE_DESC_LEVELS_NUM_LEVELS_REMAINING_LOW);
         *return_values_count = 1;
-        for(i = 0; i < performance_protocol.num_performance_levels[domain_id]; i++)
+        for(i = 0; i < num_levels; i++)
         {
             return_values[OFFSET_RET(struct arm_scmi_performance_describe_levels,perf_levels)+i*3] =
-                  performance_protocol.performance_level_value[domain_id][i];
+                  performance_protocol.performance_level_value[domain_id][level_index + i];
             return_values[OFFSET_RET(struct arm_scmi_performance_describe_levels,perf_levels)+i*3+1] =
-                  performance_protocol.performance_level_power_cost[domain_id][i];
+                  performance_protocol.performance_level_power_cost[domain_id][level_index + i];
             return_values[OFFSET_RET(struct arm_scmi_performance_describe_levels,perf_levels)+i*3+2] =
-                  performance_protocol.performance_level_worst_latency[domain_id][i];
+                  performance_protocol.performance_level_worst_latency[domain_id][level_index + i];
             *return_values_count += 3;
         }
         break;
@@ -215,9 +307,17 @@ void performance_send_message(uint32_t message_id, uint32_t parameter_count,
              return;
         }
         *status = SCMI_STATUS_SUCCESS;
-        perf_level_max_limit[domain_id] =
+        notification[0] = mocker_current_agent();
+        notification[1] = domain_id;
+        notification[2] = parameters[OFFSET_PARAM(struct arm_scmi_performance_limits_set,range_max)];
+        notification[3] = parameters[OFFSET_PARAM(struct arm_scmi_performance_limits_set,range_min)];
+        if ((perf_limits[domain_id].range_max != notification[2]) ||
+            (perf_limits[domain_id].range_min != notification[3]))
+            timer_wheel_notify(PERFORMANCE_PROTOCOL_ID, PERF_LIMITS_CHANGED_MSG_ID,
+                    perf_limit_notify_agents[domain_id], notification, 4);
+        perf_limits[domain_id].range_max =
              parameters[OFFSET_PARAM(struct arm_scmi_performance_limits_set,range_max)];
-        perf_level_min_limit[domain_id] =
+        perf_limits[domain_id].range_min =
              parameters[OFFSET_PARAM(struct arm_scmi_performance_limits_set,range_min)] ;
         break;
     case PERF_LIMIT_GET_MSG_ID:
@@ -229,9 +329,9 @@ void performance_send_message(uint32_t message_id, uint32_t parameter_count,
         }
         *status = SCMI_STATUS_SUCCESS;
         return_values[OFFSET_RET(struct arm_scmi_performance_limits_get,range_max)] =
-             perf_level_max_limit[domain_id];
+             perf_limits[domain_id].range_max;
         return_values[OFFSET_RET(struct arm_scmi_performance_limits_get,range_min)] =
-             perf_level_min_limit[domain_id];
+             perf_limits[domain_id].range_min;
         if( return_values[OFFSET_RET(struct arm_scmi_performance_limits_get,range_max)] == 0 &&
                 return_values[OFFSET_RET(struct arm_scmi_performance_limits_get,range_min)] == 0)
         {
@@ -255,17 +355,34 @@ void performance_send_message(uint32_t message_id, uint32_t parameter_count,
             *status = SCMI_STATUS_DENIED;
              return;
         }
-        if((perf_level_max_limit[domain_id] <
+        /* No limits set yet means the full range, as reported by LIMITS_GET */
+        range_max = perf_limits[domain_id].range_max;
+        range_min = perf_limits[domain_id].range_min;
+        if ((range_max == 0) && (range_min == 0)) {
+            range_max = performance_protocol.performance_level_value[domain_id]
+                        [performance_protocol.num_performance_levels[domain_id] - 1];
+            range_min = performance_protocol.performance_level_value[domain_id][0];
+        }
+        if((range_max <
             parameters[OFFSET_PARAM(struct arm_scmi_performance_levels_set,performance_level)])||
-            (perf_level_min_limit[domain_id] >
+            (range_min >
             parameters[OFFSET_PARAM(struct arm_scmi_performance_levels_set,performance_level)]))
         {
             *status = SCMI_STATUS_OUT_OF_RANGE;
              return;
         }
         *status = SCMI_STATUS_SUCCESS;
+        notification[0] = mocker_current_agent();
+        notification[1] = domain_id;
+        notification[2] =
+            parameters[OFFSET_PARAM(struct arm_scmi_performance_levels_set,performance_level)];
+        if (perf_level_current[domain_id] != notification[2])
+            timer_wheel_notify(PERFORMANCE_PROTOCOL_ID, PERF_LEVEL_CHANGED_MSG_ID,
+                    perf_level_notify_agents[domain_id], notification, 3);
         perf_level_current[domain_id] =
             parameters[OFFSET_PARAM(struct arm_scmi_performance_levels_set,performance_level)];
+        mocker_stats_transition(PERFORMANCE_PROTOCOL_ID, domain_id,
+                performance_stats_index(domain_id, perf_level_current[domain_id]));
         break;
     case PERF_LVL_GET_MSG_ID:
         domain_id = parameters[OFFSET_PARAM(struct arm_scmi_performance_levels_get,domain_id)];
@@ -300,6 +417,10 @@ void performance_send_message(uint32_t message_id, uint32_t parameter_count,
             *status = SCMI_STATUS_INVALID_PARAMETERS;
              return;
         }
+        if (parameters[OFFSET_PARAM(struct arm_scmi_performance_notify_limits,notify_enable)])
+            perf_limit_notify_agents[domain_id] |= 1u << mocker_current_agent();
+        else
+            perf_limit_notify_agents[domain_id] &= ~(1u << mocker_current_agent());
         *status = SCMI_STATUS_SUCCESS;
         break;
     case PERF_NOTIFY_LVL_MSG_ID:
@@ -320,6 +441,10 @@ void performance_send_message(uint32_t message_id, uint32_t parameter_count,
             *status = SCMI_STATUS_INVALID_PARAMETERS;
              return;
         }
+        if (parameters[OFFSET_PARAM(struct arm_scmi_performance_notify_level,notify_enable)])
+            perf_level_notify_agents[domain_id] |= 1u << mocker_current_agent();
+        else
+            perf_level_notify_agents[domain_id] &= ~(1u << mocker_current_agent());
         *status = SCMI_STATUS_SUCCESS;
         break;
     case PERF_DESCRIBE_FASTCHANNEL:
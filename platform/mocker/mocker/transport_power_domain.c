@@ -18,13 +18,26 @@
 #include <power_domain_protocol.h>
 #include <power_domain_common.h>
 #include <pal_power_domain_expected.h>
+#include <pal_platform.h>
+#include <timer_wheel.h>
 
 struct arm_scmi_power_protocol power_protocol;
+/* Agents subscribed to state changed and change requested notifications, per domain */
+static uint32_t power_state_notify_agents[MAX_NUM_POWER_DOMAINS];
+static uint32_t power_state_requested_notify_agents[MAX_NUM_POWER_DOMAINS];
 extern bool device_access_permitted (void);
 extern bool protocol_access_permitted (uint32_t protocol_id);
 
+/* State type bit of a power state, set when the domain loses context */
+#define POWER_STATE_OFF    (1u << 30)
+
+/* Power states with an entry in the statistics region: on, then off */
+#define POWER_STATS_NUM_STATES 2
+
 void fill_power_protocol()
 {
+    uint32_t domain_id;
+
     power_protocol.protocol_version = POWER_DOMAIN_VERSION;
     power_protocol.num_power_domains = num_power_domains;
     power_protocol.statistics_address_low = statistics_address_low_pow;
@@ -33,6 +46,13 @@ void fill_power_protocol()
     power_protocol.statistics_address_low + power_protocol.statistics_length;
     power_protocol.power_state_notify_cmd_supported = true;
     power_protocol.power_state_change_requested_notify_cmd_supported = true;
+
+    /* Domains start on, the other entry counts the times they went off */
+    mocker_stats_init(POWER_DOMAIN_PROTOCOL_ID, power_protocol.statistics_address_low,
+            power_protocol.statistics_length, power_protocol.num_power_domains);
+    for (domain_id = 0; domain_id < power_protocol.num_power_domains; domain_id++)
+        mocker_stats_add_domain(POWER_DOMAIN_PROTOCOL_ID, domain_id,
+                POWER_STATS_NUM_STATES, 0);
 }
 
 void power_send_message(uint32_t message_id, uint32_t parameter_count,
@@ -40,10 +60,10 @@ void power_send_message(uint32_t message_id, uint32_t parameter_count,
         size_t *return_values_count, uint32_t *return_values)
 {
 
-    uint32_t parameter_idx, return_idx;
+    uint32_t parameter_idx, return_idx, domain_id;
+    uint32_t notification[3];
     char * str;
     int num_power_domains = 3;
-    int stats_low = 0x1234, stats_high = stats_low + 0xff;
 
     if(device_access_permitted() == false ||
        protocol_access_permitted(POWER_DOMAIN_PROTOCOL_ID) == false) {
@@ -59,20 +79,20 @@ void power_send_message(uint32_t message_id, uint32_t parameter_count,
             break;
         case PWR_PROTO_ATTR_MSG_ID:
             *status = SCMI_STATUS_SUCCESS;
-            *return_values_count = 1;
+            *return_values_count = 4;
             return_idx = OFFSET_RET(struct arm_scmi_power_protocol_attributes,
                     attributes);
             return_values[return_idx] =
                     (num_power_domains << POWER_PROT_ATTR_NUMBER_DOMAINS_LOW);
             return_idx = OFFSET_RET(struct arm_scmi_power_protocol_attributes,
                     statistics_address_low);
-            return_values[return_idx] = stats_low;
+            return_values[return_idx] = power_protocol.statistics_address_low;
             return_idx = OFFSET_RET(struct arm_scmi_power_protocol_attributes,
                     statistics_address_high);
-            return_values[return_idx] = stats_high;
+            return_values[return_idx] = power_protocol.statistics_address_high;
             return_idx = OFFSET_RET(struct arm_scmi_power_protocol_attributes,
                     statistics_len);
-            return_values[return_idx] = stats_high - stats_low;
+            return_values[return_idx] = power_protocol.statistics_length;
             break;
         case PWR_PROTO_MSG_ATTR_MSG_ID:
             parameter_idx = OFFSET_PARAM(
@@ -136,6 +156,18 @@ void power_send_message(uint32_t message_id, uint32_t parameter_count,
                 break;
             }
             *status = SCMI_STATUS_SUCCESS;
+            domain_id = parameters[OFFSET_PARAM(struct arm_scmi_power_state_set, domain_id)];
+            notification[0] = mocker_current_agent();
+            notification[1] = domain_id;
+            notification[2] = parameters[OFFSET_PARAM(struct arm_scmi_power_state_set,
+                    power_state)];
+            timer_wheel_notify(POWER_DOMAIN_PROTOCOL_ID, PWR_STATE_CHANGE_REQUESTED_MSG_ID,
+                    power_state_requested_notify_agents[domain_id] &
+                    ~(1u << mocker_current_agent()), notification, NUM_ELEMS(notification));
+            timer_wheel_notify(POWER_DOMAIN_PROTOCOL_ID, PWR_STATE_CHANGED_MSG_ID,
+                    power_state_notify_agents[domain_id], notification, NUM_ELEMS(notification));
+            mocker_stats_transition(POWER_DOMAIN_PROTOCOL_ID, domain_id,
+                    (notification[2] & POWER_STATE_OFF) ? 1 : 0);
             break;
         case PWR_STATE_GET_MSG_ID:
             if (parameters[OFFSET_PARAM(
@@ -168,6 +200,11 @@ void power_send_message(uint32_t message_id, uint32_t parameter_count,
                 *status = SCMI_STATUS_NOT_SUPPORTED;
                 break;
             }
+            domain_id = parameters[OFFSET_PARAM(struct arm_scmi_power_state_notify, domain_id)];
+            if (parameters[OFFSET_PARAM(struct arm_scmi_power_state_notify, notify_enable)])
+                power_state_notify_agents[domain_id] |= 1u << mocker_current_agent();
+            else
+                power_state_notify_agents[domain_id] &= ~(1u << mocker_current_agent());
             *status = SCMI_STATUS_SUCCESS;
             break;
         case PWR_STATE_CHANGE_REQUESTED_NOTIFY_MSG_ID:
@@ -183,6 +220,13 @@ void power_send_message(uint32_t message_id, uint32_t parameter_count,
                 *status = SCMI_STATUS_NOT_FOUND;
                 break;
             }
+            domain_id = parameters[OFFSET_PARAM(
+                    struct arm_scmi_power_state_change_requested_notify, domain_id)];
+            if (parameters[OFFSET_PARAM(struct arm_scmi_power_state_change_requested_notify,
+                    notify_enable)])
+                power_state_requested_notify_agents[domain_id] |= 1u << mocker_current_agent();
+            else
+                power_state_requested_notify_agents[domain_id] &= ~(1u << mocker_current_agent());
             *status = SCMI_STATUS_SUCCESS;
             break;
         default:
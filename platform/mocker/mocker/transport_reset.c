@@ -18,8 +18,12 @@
 #include <reset_protocol.h>
 #include <reset_common.h>
 #include <pal_reset_expected.h>
+#include <pal_platform.h>
+#include <timer_wheel.h>
 
 struct arm_scmi_reset_protocol reset_protocol;
+/* Agents subscribed to RESET_ISSUED, per domain */
+static uint32_t reset_notify_agents[MAX_NUM_RESET_DOMAINS];
 
 void fill_reset_protocol()
 {
@@ -39,6 +43,7 @@ void reset_send_message(uint32_t message_id, uint32_t parameter_count,
     uint32_t parameter_idx, domain_id, return_idx;
     char * str;
     uint32_t reset_flag, reset_state , notify_en;
+    uint32_t message[3];
 
     switch(message_id)
     {
@@ -140,6 +145,18 @@ void reset_send_message(uint32_t message_id, uint32_t parameter_count,
             break;
         }
         *status = SCMI_STATUS_SUCCESS;
+        if ((reset_flag >> RESET_FLAG_ASYNC_RESET_BIT) & 0x1) {
+            message[0] = domain_id;
+            if (!timer_wheel_delayed_response(RESET_PROTO_COMPLETE_MSG_ID, message, 1))
+                *status = SCMI_STATUS_BUSY;
+        }
+        /* Other agents learn about the reset if they subscribed */
+        message[0] = mocker_current_agent();
+        message[1] = domain_id;
+        message[2] = reset_state;
+        timer_wheel_notify(RESET_PROTOCOL_ID, RESET_PROTO_ISSUED_MSG_ID,
+                reset_notify_agents[domain_id] & ~(1u << mocker_current_agent()),
+                message, NUM_ELEMS(message));
         break;
     case RESET_PROTO_NOTIFY_MSG_ID:
         /* get domain id */
@@ -160,6 +177,10 @@ void reset_send_message(uint32_t message_id, uint32_t parameter_count,
             *status = SCMI_STATUS_INVALID_PARAMETERS;
             break;
         }
+        if (notify_en && reset_protocol.reset_notify_supported[domain_id])
+            reset_notify_agents[domain_id] |= 1u << mocker_current_agent();
+        else
+            reset_notify_agents[domain_id] &= ~(1u << mocker_current_agent());
         *status = SCMI_STATUS_SUCCESS;
         break;
     default:
@@ -18,12 +18,16 @@
 #include <sensor_protocol.h>
 #include <sensor_common.h>
 #include <pal_sensor_expected.h>
+#include <pal_platform.h>
+#include <timer_wheel.h>
 
 struct arm_scmi_sensor_protocol sensor_protocol;
 #define SENSOR_DESC_LEN 7
 
 void fill_sensor_protocol()
 {
+    uint32_t sensor_id;
+
     sensor_protocol.protocol_version = SENSOR_VERSION;
     sensor_protocol.number_sensors = num_sensors;
     sensor_protocol.sensor_trip_point_notify_supported = true;
@@ -34,8 +38,16 @@ void fill_sensor_protocol()
     sensor_protocol.sensor_reg_address_low + sensor_protocol.sensor_reg_length;
     sensor_protocol.asynchronous_sensor_read_support =
             async_sensor_read_support;
+    sensor_protocol.max_num_pending_async_cmds_supported =
+            max_num_pending_async_cmds_supported;
     sensor_protocol.number_of_trip_points_supported =
             number_of_trip_points_supported;
+
+    /* A domain per sensor, its single entry holds the last reading */
+    mocker_stats_init(SENSOR_PROTOCOL_ID, sensor_protocol.sensor_reg_address_low,
+            sensor_protocol.sensor_reg_length, sensor_protocol.number_sensors);
+    for (sensor_id = 0; sensor_id < sensor_protocol.number_sensors; sensor_id++)
+        mocker_stats_add_domain(SENSOR_PROTOCOL_ID, sensor_id, 1, 0);
 }
 
 void sensor_send_message(uint32_t message_id, uint32_t parameter_count,
@@ -43,7 +55,8 @@ void sensor_send_message(uint32_t message_id, uint32_t parameter_count,
         size_t *return_values_count, uint32_t *return_values)
 {
 
-    uint32_t parameter_idx, return_idx;
+    uint32_t parameter_idx, return_idx, sensor_id, num_descs;
+    uint32_t delayed_response[3];
     char * str;
     int i;
 
@@ -97,20 +110,27 @@ void sensor_send_message(uint32_t message_id, uint32_t parameter_count,
             *status = SCMI_STATUS_INVALID_PARAMETERS;
             break;
         }
+        /* As many descriptors from desc_index as the channel holds, the others remain */
+        num_descs = sensor_protocol.number_sensors - parameter_idx;
+        if (num_descs > (mocker_max_return_values() - 1) / SENSOR_DESC_LEN)
+            num_descs = (mocker_max_return_values() - 1) / SENSOR_DESC_LEN;
         return_values[OFFSET_RET(
                 struct arm_scmi_sensor_description_get,
-                num_sensor_flags)] = sensor_protocol.number_sensors;
-        for (i = 0; i < sensor_protocol.number_sensors; i++)
+                num_sensor_flags)] = (num_descs << SNR_NUMBER_SNR_DESC_LOW) |
+                ((sensor_protocol.number_sensors - parameter_idx - num_descs) <<
+                 SNR_NUMBER_REMAIN_SNR_DESC_LOW);
+        for (i = 0; i < num_descs; i++)
         {
+            sensor_id = parameter_idx + i;
             return_values[OFFSET_RET(
                     struct arm_scmi_sensor_description_get,
-                    sensor_descriptors) + SENSOR_DESC_LEN * i] = i;
+                    sensor_descriptors) + SENSOR_DESC_LEN * i] = sensor_id;
             return_values[OFFSET_RET(
                     struct arm_scmi_sensor_description_get,
                     sensor_descriptors) + (SENSOR_DESC_LEN * i) + 1] =
-                            (sensor_protocol.asynchronous_sensor_read_support[i] <<
+                            (sensor_protocol.asynchronous_sensor_read_support[sensor_id] <<
                                     SNR_DESC_ATTRLOW_ASYNC_READ_SUPPORT) |
-                                    (sensor_protocol.number_of_trip_points_supported[i] <<
+                                    (sensor_protocol.number_of_trip_points_supported[sensor_id] <<
                                             SNR_DESC_ATTRLOW_NUM_TRIPPOINT_SPRT_LOW);
             return_values[OFFSET_RET(
                     struct arm_scmi_sensor_description_get,
@@ -119,11 +139,10 @@ void sensor_send_message(uint32_t message_id, uint32_t parameter_count,
                                                 (&return_values[OFFSET_RET(
                                                         struct arm_scmi_sensor_description_get,
                                                         sensor_descriptors) + (SENSOR_DESC_LEN * i) + 3]);
-            sprintf(str, "SENSOR_%d", i);
+            sprintf(str, "SENSOR_%d", sensor_id);
         }
         *status = SCMI_STATUS_SUCCESS;
-        *return_values_count = 1 +
-                (sensor_protocol.number_sensors * SENSOR_DESC_LEN);
+        *return_values_count = 1 + (num_descs * SENSOR_DESC_LEN);
         break;
     case SNSR_TRIP_POINT_NOTIFY_ID:
         if (parameters[OFFSET_PARAM(
@@ -192,8 +211,29 @@ void sensor_send_message(uint32_t message_id, uint32_t parameter_count,
             *status = SCMI_STATUS_NOT_SUPPORTED;
             break;
         }
+        sensor_id = parameters[OFFSET_PARAM(struct arm_scmi_sensor_reading_get, sensor_id)];
+        if (parameters[OFFSET_PARAM(struct arm_scmi_sensor_reading_get, flags)] == SENSOR_ASYNC) {
+            if (timer_wheel_pending(mocker_current_agent(), SENSOR_PROTOCOL_ID) >=
+                sensor_protocol.max_num_pending_async_cmds_supported) {
+                *status = SCMI_STATUS_BUSY;
+                break;
+            }
+            /* The reading comes with the delayed response */
+            delayed_response[0] = sensor_id;
+            delayed_response[1] = sensor_reading_value[sensor_id];
+            delayed_response[2] = 0;
+            mocker_stats_record(SENSOR_PROTOCOL_ID, sensor_id, 0, sensor_reading_value[sensor_id]);
+            *status = timer_wheel_delayed_response(SNSR_READING_COMPLETE_MSG_ID,
+                    delayed_response, NUM_ELEMS(delayed_response)) ?
+                    SCMI_STATUS_SUCCESS : SCMI_STATUS_BUSY;
+            break;
+        }
         *status = SCMI_STATUS_SUCCESS;
         *return_values_count = 2;
+        return_values[OFFSET_RET(struct arm_scmi_sensor_reading_get, sensor_value_low)] =
+                sensor_reading_value[sensor_id];
+        return_values[OFFSET_RET(struct arm_scmi_sensor_reading_get, sensor_value_high)] = 0;
+        mocker_stats_record(SENSOR_PROTOCOL_ID, sensor_id, 0, sensor_reading_value[sensor_id]);
         break;
     default:
         *status = SCMI_STATUS_NOT_FOUND;
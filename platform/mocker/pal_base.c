@@ -17,6 +17,7 @@
 #include <pal_interface.h>
 #include <pal_platform.h>
 #include <pal_base_expected.h>
+#include <pal_description.h>
 
 /*-----------  Common PAL_BASE API's across platforms ----------*/
 
@@ -42,26 +43,26 @@ uint32_t pal_check_trusted_agent(uint32_t agent_id)
 
 char *pal_base_get_expected_vendor_name(void)
 {
-    return &(vendor_name[0]);
+    return PAL_EXPECTED_STRING(PDESC_BASE_VENDOR_NAME, 0, &(vendor_name[0]));
 }
 
 char *pal_base_get_expected_subvendor_name(void)
 {
-    return &(subvendor_name[0]);
+    return PAL_EXPECTED_STRING(PDESC_BASE_SUBVENDOR_NAME, 0, &(subvendor_name[0]));
 }
 
 uint32_t pal_base_get_expected_implementation_version(void)
 {
-    return implementation_version;
+    return PAL_EXPECTED(PDESC_BASE_IMPLEMENTATION_VERSION, 0, 0, implementation_version);
 }
 
 uint32_t pal_base_get_expected_num_agents(void)
 {
-    return NUM_ELEMS(agents);
+    return PAL_EXPECTED(PDESC_BASE_NUM_AGENTS, 0, 0, NUM_ELEMS(agents));
 }
 
 uint32_t pal_base_get_expected_num_protocols(void)
 {
-    return NUM_ELEMS(supported_protocols);
+    return PAL_EXPECTED(PDESC_BASE_NUM_PROTOCOLS, 0, 0, NUM_ELEMS(supported_protocols));
 }
 
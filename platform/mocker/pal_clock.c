@@ -17,25 +17,26 @@
 
 #include <pal_interface.h>
 #include <pal_clock_expected.h>
+#include <pal_description.h>
 
 /*-----------  Common CLOCK API's across platforms ----------*/
 
 uint32_t pal_clock_get_expected_num_clocks(void)
 {
-    return num_clocks;
+    return PAL_EXPECTED(PDESC_CLOCK_NUM_CLOCKS, 0, 0, num_clocks);
 }
 
 uint32_t pal_clock_get_expected_max_async_cmd(void)
 {
-    return max_num_pending_async_rate_chg_supported;
+    return PAL_EXPECTED(PDESC_CLOCK_MAX_ASYNC_CMD, 0, 0, max_num_pending_async_rate_chg_supported);
 }
 
 uint32_t pal_clock_get_expected_number_of_rates(uint32_t clock_id)
 {
-    return num_of_clock_rates[clock_id];
+    return PAL_EXPECTED(PDESC_CLOCK_NUM_RATES, 0, clock_id, num_of_clock_rates[clock_id]);
 }
 
 uint32_t pal_check_clock_config_change_support(uint32_t clock_id)
 {
-    return 0;
+    return PAL_EXPECTED(PDESC_CLOCK_CONFIG_CHANGE_SUPPORT, 0, clock_id, 0);
 }
@@ -18,97 +18,113 @@
 #include <pal_interface.h>
 #include <pal_performance_expected.h>
 #include <performance_protocol.h>
+#include <pal_description.h>
 
 /*-----------  Common PERFORMANCE API's across platforms ----------*/
 
 uint32_t pal_performance_get_expected_num_domains(void)
 {
-    return num_performance_domains;
+    return PAL_EXPECTED(PDESC_PERF_NUM_DOMAINS, 0, 0, num_performance_domains);
 }
 
 uint32_t pal_performance_get_expected_stats_addr_low(void)
 {
-    return statistics_address_low_perf;
+    return PAL_EXPECTED(PDESC_PERF_STATS_ADDR_LOW, 0, 0, statistics_address_low_perf);
 }
 
-uint32_t pal_performance_get_expected_stats_addr_high(void)
+uint32_t pal_performance_get_expected_stats_addr_len(void)
 {
-    return (statistics_address_low_perf + statistics_address_len_perf);
+    return PAL_EXPECTED(PDESC_PERF_STATS_ADDR_LEN, 0, 0, statistics_address_len_perf);
 }
 
-uint32_t pal_performance_get_expected_stats_addr_len(void)
+uint32_t pal_performance_get_expected_stats_addr_high(void)
 {
-    return statistics_address_len_perf;
+    return (pal_performance_get_expected_stats_addr_low() +
+            pal_performance_get_expected_stats_addr_len());
 }
 
 uint32_t pal_performance_get_expected_command_fast_ch_support(uint32_t message_id)
 {
-    return perf_msg_fast_ch_support[message_id];
+    return PAL_EXPECTED(PDESC_PERF_MSG_FAST_CH_SUPPORT, 0, message_id,
+                        perf_msg_fast_ch_support[message_id]);
 }
 
 uint32_t pal_performance_get_expected_set_limit_support(uint32_t domain_id)
 {
-    return set_limit_capable[domain_id];
+    return PAL_EXPECTED(PDESC_PERF_SET_LIMIT_SUPPORT, 0, domain_id,
+                        set_limit_capable[domain_id]);
 }
 
 uint32_t pal_performance_get_expected_set_level_support(uint32_t domain_id)
 {
-    return set_performance_level_capable[domain_id];
+    return PAL_EXPECTED(PDESC_PERF_SET_LEVEL_SUPPORT, 0, domain_id,
+                        set_performance_level_capable[domain_id]);
 }
 
 uint32_t pal_performance_get_expected_level_notification_support(uint32_t domain_id)
 {
-    return performance_level_notification_support[domain_id];
+    return PAL_EXPECTED(PDESC_PERF_LEVEL_NOTIFY_SUPPORT, 0, domain_id,
+                        performance_level_notification_support[domain_id]);
 }
 
 uint32_t pal_performance_get_expected_limit_notification_support(uint32_t domain_id)
 {
-    return performance_limit_notification_support[domain_id];
+    return PAL_EXPECTED(PDESC_PERF_LIMIT_NOTIFY_SUPPORT, 0, domain_id,
+                        performance_limit_notification_support[domain_id]);
 }
 
 uint32_t pal_performance_get_expected_fast_channel_support(uint32_t domain_id)
 {
-    return perf_domain_fast_ch_support[domain_id];
+    return PAL_EXPECTED(PDESC_PERF_FAST_CH_SUPPORT, 0, domain_id,
+                        perf_domain_fast_ch_support[domain_id]);
 }
 
 uint32_t pal_performance_get_expected_rate_limit(uint32_t domain_id)
 {
-    return performance_rate_limit[domain_id];
+    return PAL_EXPECTED(PDESC_PERF_RATE_LIMIT, 0, domain_id,
+                        performance_rate_limit[domain_id]);
 }
 
 uint32_t pal_performance_get_expected_sustaind_freq(uint32_t domain_id)
 {
-    return performance_sustained_freq[domain_id];
+    return PAL_EXPECTED(PDESC_PERF_SUSTAINED_FREQ, 0, domain_id,
+                        performance_sustained_freq[domain_id]);
 }
 
 uint32_t pal_performance_get_expected_sustaind_level(uint32_t domain_id)
 {
-    return performance_sustained_level[domain_id];
+    return PAL_EXPECTED(PDESC_PERF_SUSTAINED_LEVEL, 0, domain_id,
+                        performance_sustained_level[domain_id]);
 }
 
 uint32_t pal_performance_get_expected_performance_level(uint32_t domain_id, uint32_t index)
 {
-    return perf_performance_level_values[domain_id][index];
+    return PAL_EXPECTED(PDESC_PERF_LEVEL, domain_id, index,
+                        perf_performance_level_values[domain_id][index]);
 }
 
 uint32_t pal_performance_get_expected_power_cost(uint32_t domain_id, uint32_t index)
 {
-    return perf_performance_level_power_costs[domain_id][index];
+    return PAL_EXPECTED(PDESC_PERF_POWER_COST, domain_id, index,
+                        perf_performance_level_power_costs[domain_id][index]);
 }
 
 uint32_t pal_performance_get_expected_latency(uint32_t domain_id, uint32_t index)
 {
-    return perf_performance_level_worst_latency[domain_id][index];
+    return PAL_EXPECTED(PDESC_PERF_LATENCY, domain_id, index,
+                        perf_performance_level_worst_latency[domain_id][index]);
 }
 
 uint8_t* pal_performance_get_expected_name(uint32_t domain_id)
 {
-    return (uint8_t*)&performance_domain_names[domain_id][0];
+    return (uint8_t*)PAL_EXPECTED_STRING(PDESC_PERF_NAME, domain_id,
+                                        &performance_domain_names[domain_id][0]);
 }
 
 uint32_t pal_performance_get_expected_number_of_level(uint32_t domain_id)
 {
-    return perf_num_performance_levels[domain_id];
+    return PAL_EXPECTED(PDESC_PERF_NUM_LEVELS, 0, domain_id,
+                        perf_num_performance_levels[domain_id]);
 }
 
 uint8_t pal_performance_get_expected_fast_ch_doorbell_support(uint32_t domain_id,uint32_t message_id)
@@ -116,7 +132,8 @@ uint8_t pal_performance_get_expected_fast_ch_doorbell_support(uint32_t domain_id
     if(message_id < PERF_LIMIT_SET_MSG_ID || message_id > PERF_LVL_GET_MSG_ID)
         return 0;
 
-    return perf_performance_fast_ch_doorbell_support[domain_id][message_id-PERF_LIMIT_SET_MSG_ID];
+    return PAL_EXPECTED(PDESC_PERF_FC_DOORBELL_SUPPORT, domain_id, message_id - PERF_LIMIT_SET_MSG_ID,
+                        perf_performance_fast_ch_doorbell_support[domain_id][message_id-PERF_LIMIT_SET_MSG_ID]);
 }
 
 uint8_t pal_performance_get_expected_fast_ch_doorbell_data_width(uint32_t domain_id,uint32_t message_id)
@@ -124,7 +141,8 @@ uint8_t pal_performance_get_expected_fast_ch_doorbell_data_width(uint32_t domain
     if(message_id < PERF_LIMIT_SET_MSG_ID || message_id > PERF_LVL_GET_MSG_ID)
         return 0;
 
-    return perf_performance_fast_ch_doorbell_data_width[domain_id][message_id-PERF_LIMIT_SET_MSG_ID];
+    return PAL_EXPECTED(PDESC_PERF_FC_DOORBELL_DATA_WIDTH, domain_id, message_id - PERF_LIMIT_SET_MSG_ID,
+                        perf_performance_fast_ch_doorbell_data_width[domain_id][message_id-PERF_LIMIT_SET_MSG_ID]);
 }
 
 uint32_t pal_performance_get_expected_fast_ch_addr_low(uint32_t domain_id,uint32_t message_id)
@@ -132,7 +150,8 @@ uint32_t pal_performance_get_expected_fast_ch_addr_low(uint32_t domain_id,uint32
     if(message_id < PERF_LIMIT_SET_MSG_ID || message_id > PERF_LVL_GET_MSG_ID)
         return 0;
 
-    return perf_performance_fast_chan_addr_low[domain_id][message_id-PERF_LIMIT_SET_MSG_ID];
+    return PAL_EXPECTED(PDESC_PERF_FC_ADDR_LOW, domain_id, message_id - PERF_LIMIT_SET_MSG_ID,
+                        perf_performance_fast_chan_addr_low[domain_id][message_id-PERF_LIMIT_SET_MSG_ID]);
 }
 
 uint32_t pal_performance_get_expected_fast_ch_addr_high(uint32_t domain_id,uint32_t message_id)
@@ -140,7 +159,8 @@ uint32_t pal_performance_get_expected_fast_ch_addr_high(uint32_t domain_id,uint3
     if(message_id < PERF_LIMIT_SET_MSG_ID || message_id > PERF_LVL_GET_MSG_ID)
         return 0;
 
-    return perf_performance_fast_chan_addr_high[domain_id][message_id-PERF_LIMIT_SET_MSG_ID];
+    return PAL_EXPECTED(PDESC_PERF_FC_ADDR_HIGH, domain_id, message_id - PERF_LIMIT_SET_MSG_ID,
+                        perf_performance_fast_chan_addr_high[domain_id][message_id-PERF_LIMIT_SET_MSG_ID]);
 }
 
 uint32_t pal_performance_get_expected_fast_ch_size(uint32_t domain_id,uint32_t message_id)
@@ -148,7 +168,8 @@ uint32_t pal_performance_get_expected_fast_ch_size(uint32_t domain_id,uint32_t m
     if(message_id < PERF_LIMIT_SET_MSG_ID || message_id > PERF_LVL_GET_MSG_ID)
         return 0;
 
-    return perf_performance_fast_chan_size[domain_id][message_id-PERF_LIMIT_SET_MSG_ID];
+    return PAL_EXPECTED(PDESC_PERF_FC_SIZE, domain_id, message_id - PERF_LIMIT_SET_MSG_ID,
+                        perf_performance_fast_chan_size[domain_id][message_id-PERF_LIMIT_SET_MSG_ID]);
 }
 
 uint32_t pal_performance_get_expected_fast_ch_rate_limit(uint32_t domain_id,uint32_t message_id)
@@ -156,7 +177,8 @@ uint32_t pal_performance_get_expected_fast_ch_rate_limit(uint32_t domain_id,uint
     if(message_id < PERF_LIMIT_SET_MSG_ID || message_id > PERF_LVL_GET_MSG_ID)
         return 0;
 
-    return perf_performance_fast_chan_rate_limit[domain_id][message_id-PERF_LIMIT_SET_MSG_ID];
+    return PAL_EXPECTED(PDESC_PERF_FC_RATE_LIMIT, domain_id, message_id - PERF_LIMIT_SET_MSG_ID,
+                        perf_performance_fast_chan_rate_limit[domain_id][message_id-PERF_LIMIT_SET_MSG_ID]);
 }
 
 uint32_t pal_performance_get_expected_fast_ch_doorbell_addr_low(uint32_t domain_id,uint32_t message_id)
@@ -164,7 +186,8 @@ uint32_t pal_performance_get_expected_fast_ch_doorbell_addr_low(uint32_t domain_
     if(message_id < PERF_LIMIT_SET_MSG_ID || message_id > PERF_LVL_GET_MSG_ID)
         return 0;
 
-    return perf_performance_fast_chan_doorbell_addr_low[domain_id][message_id-PERF_LIMIT_SET_MSG_ID];
+    return PAL_EXPECTED(PDESC_PERF_FC_DOORBELL_ADDR_LOW, domain_id, message_id - PERF_LIMIT_SET_MSG_ID,
+                        perf_performance_fast_chan_doorbell_addr_low[domain_id][message_id-PERF_LIMIT_SET_MSG_ID]);
 }
 
 uint32_t pal_performance_get_expected_fast_ch_doorbell_addr_high(uint32_t domain_id,uint32_t message_id)
@@ -172,7 +195,8 @@ uint32_t pal_performance_get_expected_fast_ch_doorbell_addr_high(uint32_t domain
     if(message_id < PERF_LIMIT_SET_MSG_ID || message_id > PERF_LVL_GET_MSG_ID)
         return 0;
 
-    return perf_performance_fast_chan_doorbell_addr_high[domain_id][message_id-PERF_LIMIT_SET_MSG_ID];
+    return PAL_EXPECTED(PDESC_PERF_FC_DOORBELL_ADDR_HIGH, domain_id, message_id - PERF_LIMIT_SET_MSG_ID,
+                        perf_performance_fast_chan_doorbell_addr_high[domain_id][message_id-PERF_LIMIT_SET_MSG_ID]);
 }
 
 uint32_t pal_performance_get_expected_fast_ch_doorbell_set_mask_low(uint32_t domain_id,uint32_t message_id)
@@ -180,7 +204,8 @@ uint32_t pal_performance_get_expected_fast_ch_doorbell_set_mask_low(uint32_t dom
     if(message_id < PERF_LIMIT_SET_MSG_ID || message_id > PERF_LVL_GET_MSG_ID)
         return 0;
 
-    return perf_performance_fast_chan_doorbell_set_mask_low[domain_id][message_id-PERF_LIMIT_SET_MSG_ID];
+    return PAL_EXPECTED(PDESC_PERF_FC_DOORBELL_SET_LOW, domain_id, message_id - PERF_LIMIT_SET_MSG_ID,
+                        perf_performance_fast_chan_doorbell_set_mask_low[domain_id][message_id-PERF_LIMIT_SET_MSG_ID]);
 }
 
 uint32_t pal_performance_get_expected_fast_ch_doorbell_set_mask_high(uint32_t domain_id,uint32_t message_id)
@@ -188,7 +213,8 @@ uint32_t pal_performance_get_expected_fast_ch_doorbell_set_mask_high(uint32_t do
     if(message_id < PERF_LIMIT_SET_MSG_ID || message_id > PERF_LVL_GET_MSG_ID)
         return 0;
 
-    return perf_performance_fast_chan_doorbell_set_mask_high[domain_id][message_id-PERF_LIMIT_SET_MSG_ID];
+    return PAL_EXPECTED(PDESC_PERF_FC_DOORBELL_SET_HIGH, domain_id, message_id - PERF_LIMIT_SET_MSG_ID,
+                        perf_performance_fast_chan_doorbell_set_mask_high[domain_id][message_id-PERF_LIMIT_SET_MSG_ID]);
 }
 
 uint32_t pal_performance_get_expected_fast_ch_doorbell_preserve_mask_low(uint32_t domain_id,uint32_t message_id)
@@ -196,7 +222,8 @@ uint32_t pal_performance_get_expected_fast_ch_doorbell_preserve_mask_low(uint32_
     if(message_id < PERF_LIMIT_SET_MSG_ID || message_id > PERF_LVL_GET_MSG_ID)
         return 0;
 
-    return perf_performance_fast_chan_doorbell_preserve_mask_low[domain_id][message_id-PERF_LIMIT_SET_MSG_ID];
+    return PAL_EXPECTED(PDESC_PERF_FC_DOORBELL_PRESERVE_LOW, domain_id, message_id - PERF_LIMIT_SET_MSG_ID,
+                        perf_performance_fast_chan_doorbell_preserve_mask_low[domain_id][message_id-PERF_LIMIT_SET_MSG_ID]);
 }
 
 uint32_t pal_performance_get_expected_fast_ch_doorbell_preserve_mask_high(uint32_t domain_id,uint32_t message_id)
@@ -204,5 +231,6 @@ uint32_t pal_performance_get_expected_fast_ch_doorbell_preserve_mask_high(uint32
     if(message_id < PERF_LIMIT_SET_MSG_ID || message_id > PERF_LVL_GET_MSG_ID)
         return 0;
 
-    return perf_performance_fast_chan_doorbell_preserve_mask_high[domain_id][message_id-PERF_LIMIT_SET_MSG_ID];
+    return PAL_EXPECTED(PDESC_PERF_FC_DOORBELL_PRESERVE_HIGH, domain_id, message_id - PERF_LIMIT_SET_MSG_ID,
+                        perf_performance_fast_chan_doorbell_preserve_mask_high[domain_id][message_id-PERF_LIMIT_SET_MSG_ID]);
 }
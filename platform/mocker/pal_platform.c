@@ -15,80 +15,250 @@
  * limitations under the License.
 **/
 
+#include <time.h>
 #include <pal_platform.h>
 #include <pal_interface.h>
+#include <protocol_common.h>
+#include <mock_mailbox.h>
+#include <timer_wheel.h>
+#include <pal_description.h>
+#include <pal_discovery.h>
+#include <pal_record.h>
+#include <pal_results.h>
+#include <pal_stats.h>
+#include <pal_transport.h>
 
-void pal_send_message(uint32_t message_header_send, size_t parameter_count,
+/* How long the agent waits for a delayed response or a notification */
+#define MOCKER_ASYNC_TIMEOUT_MS 1000
+
+/**
+  @brief   Waits for the next asynchronous message of a type for the agent
+           bound to the calling thread
+**/
+static void mocker_receive_async(uint32_t type, uint32_t *message_header_rcv, int32_t *status,
+        size_t *return_values_count, uint32_t *return_values)
+{
+    struct timer_wheel_message message;
+    size_t capacity = *return_values_count;
+    uint32_t i;
+
+    if (!timer_wheel_receive(mocker_current_agent(), type, MOCKER_ASYNC_TIMEOUT_MS, &message)) {
+        *message_header_rcv = 0;
+        *status = SCMI_STATUS_GENERIC_ERROR;
+        *return_values_count = 0;
+        return ;
+    }
+
+    *message_header_rcv = message.header;
+    *status = message.status;
+    *return_values_count = (message.count < capacity) ? message.count : capacity;
+    for (i = 0; i < *return_values_count; i++)
+        return_values[i] = message.values[i];
+}
+
+static uint32_t mocker_transport_open(const char *argument)
+{
+    mocker_initialize();
+    mocker_set_channel_size(pal_get_channel_size());
+    return PAL_STATUS_PASS;
+}
+
+static uint32_t mocker_transport_get_num_channels(void)
+{
+    return MOCKER_NUM_CHANNELS;
+}
+
+static uint32_t mocker_transport_select(uint32_t channel_id)
+{
+    /* Every mocker channel is a direct call into the protocol models, as its own agent */
+    if (channel_id >= MOCKER_NUM_CHANNELS)
+        return PAL_STATUS_FAIL;
+
+    mocker_select_agent(channel_id);
+    return PAL_STATUS_PASS;
+}
+
+static void mocker_transport_send_message(uint32_t message_header_send, size_t parameter_count,
         const uint32_t *parameters, uint32_t *message_header_rcv, int32_t *status,
         size_t *return_values_count, uint32_t *return_values)
 {
-    int message_id;
-    int protocol_id;
-
-    *message_header_rcv = message_header_send;
-    protocol_id = SCMI_EXRACT_BITS(message_header_send,
-            PROTOCOL_ID_HIGH, PROTOCOL_ID_LOW);
-    message_id = SCMI_EXRACT_BITS(message_header_send,
-            MESSAGE_ID_HIGH, MESSAGE_ID_LOW);
-
-    switch (protocol_id)
-    {
-    case BASE_PROTOCOL_ID:
-        base_send_message(message_id, parameter_count, parameters, status,
-                return_values_count, return_values);
-        break;
-    case POWER_DOMAIN_PROTOCOL_ID:
-        power_send_message(message_id, parameter_count, parameters, status,
-                return_values_count, return_values);
-        break;
-    case SYSTEM_POWER_PROTOCOL_ID:
-        system_power_send_message(message_id, parameter_count, parameters, status,
-                return_values_count, return_values);
-        break;
-    case PERFORMANCE_PROTOCOL_ID:
-        performance_send_message(message_id, parameter_count, parameters, status,
-                return_values_count, return_values);
-        break;
-    case CLOCK_PROTOCOL_ID:
-        clock_send_message(message_id, parameter_count, parameters, status,
-                return_values_count, return_values);
-        break;
-    case SENSOR_PROTOCOL_ID:
-        sensor_send_message(message_id, parameter_count, parameters, status,
-                return_values_count, return_values);
-        break;
-    case RESET_PROTOCOL_ID:
-        reset_send_message(message_id, parameter_count, parameters, status,
-                return_values_count, return_values);
-        break;
-    default:
-        printf("\nProtocol: %d\n", message_id);
-        assert(!"\nUnknown protocol id\n");
-        break;
+    struct timespec timeout = { MOCKER_RESPONSE_TIMEOUT_MS / 1000,
+                                (MOCKER_RESPONSE_TIMEOUT_MS % 1000) * 1000000 };
+    uint32_t values[PAL_CHANNEL_MAX_RETURNS(PAL_CHANNEL_SIZE_MAX)];
+    size_t capacity = *return_values_count;
+    size_t count = 0;
+    uint32_t delivery;
+    size_t i;
+
+    /* The models fill a full channel, the caller gets what its buffer holds */
+    delivery = mocker_send_message(message_header_send, parameter_count, parameters,
+            message_header_rcv, status, &count, values);
+    *return_values_count = (count < capacity) ? count : capacity;
+    for (i = 0; i < *return_values_count; i++)
+        return_values[i] = values[i];
+
+    /* A duplicated response is discarded by the transport, as the socket transport does */
+    if (delivery == MOCKER_RESPONSE_DROPPED) {
+        /* Dropped by the fault profile, the agent gives up after the response timeout */
+        nanosleep(&timeout, NULL);
+        *message_header_rcv = 0;
+        *status = SCMI_STATUS_GENERIC_ERROR;
+        *return_values_count = 0;
     }
 }
 
-void pal_receive_delayed_response(uint32_t *message_header_rcv, int32_t *status,
+static void mocker_transport_receive_delayed_response(uint32_t *message_header_rcv,
+        int32_t *status, size_t *return_values_count, uint32_t *return_values)
+{
+    mocker_receive_async(MOCKER_DELAYED_RESPONSE_MSG, message_header_rcv, status,
+            return_values_count, return_values);
+}
+
+static void mocker_transport_receive_notification(uint32_t *message_header_rcv,
         size_t *return_values_count, uint32_t *return_values)
 {
-    return ;
+    int32_t status;
+
+    mocker_receive_async(MOCKER_NOTIFICATION_MSG, message_header_rcv, &status,
+            return_values_count, return_values);
 }
 
-void pal_receive_notification(uint32_t *message_header_rcv, size_t *return_values_count,
-       uint32_t *return_values)
+/* The protocol models, called on the agent thread */
+static const PAL_TRANSPORT_s g_mocker_transport = {
+    .name = "mocker",
+    .env = NULL,
+    .open = mocker_transport_open,
+    .close = NULL,
+    .get_num_channels = mocker_transport_get_num_channels,
+    .select_channel = mocker_transport_select,
+    .send_message = mocker_transport_send_message,
+    .receive_delayed_response = mocker_transport_receive_delayed_response,
+    .receive_notification = mocker_transport_receive_notification,
+};
+
+static uint32_t socket_transport_open(const char *path)
 {
-    return ;
+    return mock_socket_open(path) ? PAL_STATUS_FAIL : PAL_STATUS_PASS;
+}
+
+static uint32_t socket_transport_select(uint32_t channel_id)
+{
+    return mock_socket_select(channel_id) ? PAL_STATUS_FAIL : PAL_STATUS_PASS;
+}
+
+static void socket_transport_send_message(uint32_t message_header_send, size_t parameter_count,
+        const uint32_t *parameters, uint32_t *message_header_rcv, int32_t *status,
+        size_t *return_values_count, uint32_t *return_values)
+{
+    mock_socket_send_message(message_header_send, parameter_count, parameters,
+            message_header_rcv, status, return_values_count, return_values);
+}
+
+static void socket_transport_receive(uint32_t type, uint32_t *message_header_rcv,
+        int32_t *status, size_t *return_values_count, uint32_t *return_values)
+{
+    if (mock_socket_receive(type, MOCKER_ASYNC_TIMEOUT_MS, message_header_rcv, status,
+            return_values_count, return_values) != 0) {
+        *message_header_rcv = 0;
+        *status = SCMI_STATUS_GENERIC_ERROR;
+        *return_values_count = 0;
+    }
+}
+
+static void socket_transport_receive_delayed_response(uint32_t *message_header_rcv,
+        int32_t *status, size_t *return_values_count, uint32_t *return_values)
+{
+    socket_transport_receive(MOCKER_DELAYED_RESPONSE_MSG, message_header_rcv, status,
+            return_values_count, return_values);
+}
+
+static void socket_transport_receive_notification(uint32_t *message_header_rcv,
+        size_t *return_values_count, uint32_t *return_values)
+{
+    int32_t status;
+
+    socket_transport_receive(MOCKER_NOTIFICATION_MSG, message_header_rcv, &status,
+            return_values_count, return_values);
 }
 
+static uint32_t socket_transport_get_channel_size(void)
+{
+    return MOCK_MAILBOX_LENGTH;
+}
+
+/* scmi_mock_server, over the mailbox layout */
+static const PAL_TRANSPORT_s g_socket_transport = {
+    .name = "socket",
+    .env = MOCK_SERVER_ENV,
+    .open = socket_transport_open,
+    .close = mock_socket_close,
+    .get_num_channels = mocker_transport_get_num_channels,
+    .select_channel = socket_transport_select,
+    .send_message = socket_transport_send_message,
+    .receive_delayed_response = socket_transport_receive_delayed_response,
+    .receive_notification = socket_transport_receive_notification,
+    .get_channel_size = socket_transport_get_channel_size,
+};
+
+/* A recording is preferred to the server, which is preferred to the models */
+const PAL_TRANSPORT_s *const g_pal_transports[] = {
+    &g_pal_replay_transport,
+    &g_socket_transport,
+    &g_mocker_transport,
+    NULL
+};
+
 uint32_t pal_initialize_system(void *info)
 {
-    fill_base_protocol();
-    fill_power_protocol();
-    fill_performance_protocol();
-    fill_sensor_protocol();
-    fill_clock_protocol();
-    fill_reset_protocol();
+    const char *description = getenv(PAL_DESCRIPTION_ENV);
+    const char *discovery = getenv(PAL_DISCOVERY_ENV);
+    const char *record = getenv(PAL_RECORD_ENV);
+    const char *results_json = getenv(PAL_RESULTS_JSON_ENV);
+    const char *results_junit = getenv(PAL_RESULTS_JUNIT_ENV);
+    const char *stats_bin = getenv(PAL_STATS_BIN_ENV);
+    const char *stats_csv = getenv(PAL_STATS_CSV_ENV);
+
+    /* Expected values of another platform, without a rebuild */
+    if ((description != NULL) && pal_description_load_file(description))
+        return PAL_STATUS_FAIL;
+
+    /* Info tables walked by earlier runs of the same firmware */
+    if (discovery != NULL) {
+        if (pal_discovery_open(discovery))
+            return PAL_STATUS_FAIL;
+
+        atexit(pal_discovery_close);
+    }
+
+    /* Results of the checks and tests, written as they complete */
+    if ((results_json != NULL) || (results_junit != NULL)) {
+        if (pal_results_open(results_json, results_junit))
+            return PAL_STATUS_FAIL;
+
+        atexit(pal_results_close);
+    }
+
+    /* Samples of the statistics regions, written as the sampler hands them over */
+    if ((stats_bin != NULL) || (stats_csv != NULL)) {
+        if (pal_stats_open(stats_bin, stats_csv))
+            return PAL_STATUS_FAIL;
 
+        atexit(pal_stats_close);
+    }
+
+    /* Traffic of the run, appended by an agent built with RECORD=1 */
+    if (record != NULL) {
+        if (pal_record_open(record))
+            return PAL_STATUS_FAIL;
+
+        atexit(pal_record_close);
+    }
+
+    /* The transport given by --transport, else the first of g_pal_transports that applies */
+    if (pal_transport_open())
+        return PAL_STATUS_FAIL;
+
+    atexit(pal_transport_close);
     return PAL_STATUS_PASS;
 }
 
@@ -97,9 +267,63 @@ void pal_print(uint32_t print_level, const char *format, va_list args)
     vprintf(format, args);
 }
 
+void pal_trace(const void *record, size_t size)
+{
+    /* Binary records, redirect stdout to a file for scmi_trace_decode */
+    fwrite(record, 1, size, stdout);
+}
+
+void pal_record(const void *record, size_t size)
+{
+    pal_record_write(record, size);
+}
+
+void pal_result(const void *result)
+{
+    pal_results_write(result);
+}
+
 void *pal_memcpy(void *dest, const void *src, size_t size)
 {
     if (dest == NULL || src == NULL || size == 0)
         return NULL;
     return memcpy(dest, src, size);
 }
+
+uint64_t pal_get_time_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC_RAW, &now);
+    return ((uint64_t)now.tv_sec * 1000000000ull) + now.tv_nsec;
+}
+
+void *pal_fast_channel_map(uint64_t address, uint32_t size)
+{
+    /* Fast channel addresses are keys into the performance model memory,
+       which is out of reach when the models run in scmi_mock_server or
+       are not run at all in a replay */
+    if (pal_transport_current() != &g_mocker_transport)
+        return NULL;
+
+    return performance_fast_channel_map(address);
+}
+
+void pal_fast_channel_unmap(void *channel, uint32_t size)
+{
+    return ;
+}
+
+void *pal_stats_map(uint64_t address, uint32_t size)
+{
+    /* Statistics regions live in the models, as fast channels do */
+    if (pal_transport_current() != &g_mocker_transport)
+        return NULL;
+
+    return mocker_stats_map(address, size);
+}
+
+void pal_stats_unmap(void *region, uint32_t size)
+{
+    return ;
+}
@@ -17,25 +17,26 @@
 
 #include <pal_interface.h>
 #include <pal_power_domain_expected.h>
+#include <pal_description.h>
 
 /*-----------  Common POWER API's across platforms ----------*/
 
 uint32_t pal_power_get_expected_num_domains(void)
 {
-    return num_power_domains;
+    return PAL_EXPECTED(PDESC_POWER_NUM_DOMAINS, 0, 0, num_power_domains);
 }
 
 uint32_t pal_power_get_expected_stats_addr_low(void)
 {
-    return statistics_address_low_pow;
+    return PAL_EXPECTED(PDESC_POWER_STATS_ADDR_LOW, 0, 0, statistics_address_low_pow);
 }
 
-uint32_t pal_power_get_expected_stats_addr_high(void)
+uint32_t pal_power_get_expected_stats_addr_len(void)
 {
-    return (statistics_address_len_pow + statistics_address_low_pow);
+    return PAL_EXPECTED(PDESC_POWER_STATS_ADDR_LEN, 0, 0, statistics_address_len_pow);
 }
 
-uint32_t pal_power_get_expected_stats_addr_len(void)
+uint32_t pal_power_get_expected_stats_addr_high(void)
 {
-    return statistics_address_len_pow;
+    return (pal_power_get_expected_stats_addr_len() + pal_power_get_expected_stats_addr_low());
 }
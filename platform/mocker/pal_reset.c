@@ -17,30 +17,32 @@
 
 #include <pal_interface.h>
 #include <pal_reset_expected.h>
+#include <pal_description.h>
 
 /*-----------  Common RESET API's across platforms ----------*/
 
 uint32_t pal_reset_get_expected_num_domains(void)
 {
-    return num_reset_domains;
+    return PAL_EXPECTED(PDESC_RESET_NUM_DOMAINS, 0, 0, num_reset_domains);
 }
 
 uint8_t *pal_reset_get_expected_name(uint32_t domain_id)
 {
-    return (uint8_t *)reset_domain_names[domain_id];
+    return (uint8_t *)PAL_EXPECTED_STRING(PDESC_RESET_NAME, domain_id,
+                                         reset_domain_names[domain_id]);
 }
 
 uint32_t pal_reset_get_expected_async_support(uint32_t domain_id)
 {
-    return async_reset_support[domain_id];
+    return PAL_EXPECTED(PDESC_RESET_ASYNC_SUPPORT, 0, domain_id, async_reset_support[domain_id]);
 }
 
 uint32_t pal_reset_get_expected_notify_support(uint32_t domain_id)
 {
-    return reset_notify_support[domain_id];
+    return PAL_EXPECTED(PDESC_RESET_NOTIFY_SUPPORT, 0, domain_id, reset_notify_support[domain_id]);
 }
 
 uint32_t pal_reset_get_expected_latency(uint32_t domain_id)
 {
-    return reset_latency[domain_id];
+    return PAL_EXPECTED(PDESC_RESET_LATENCY, 0, domain_id, reset_latency[domain_id]);
 }
@@ -17,35 +17,46 @@
 
 #include <pal_interface.h>
 #include <pal_sensor_expected.h>
+#include <pal_description.h>
 
 /*-----------  Common SENSOR API's across platforms ----------*/
 
 uint32_t pal_sensor_get_expected_num_sensors(void)
 {
-    return num_sensors;
+    return PAL_EXPECTED(PDESC_SENSOR_NUM_SENSORS, 0, 0, num_sensors);
 }
 
 uint32_t pal_sensor_get_expected_stats_addr_low(void)
 {
-    return statistics_address_low_snsr;
+    return PAL_EXPECTED(PDESC_SENSOR_STATS_ADDR_LOW, 0, 0, statistics_address_low_snsr);
 }
 
-uint32_t pal_sensor_get_expected_stats_addr_high(void)
+uint32_t pal_sensor_get_expected_stats_addr_len(void)
 {
-    return (statistics_address_len_snsr + statistics_address_low_snsr);
+    return PAL_EXPECTED(PDESC_SENSOR_STATS_ADDR_LEN, 0, 0, statistics_address_len_snsr);
 }
 
-uint32_t pal_sensor_get_expected_stats_addr_len(void)
+uint32_t pal_sensor_get_expected_stats_addr_high(void)
 {
-    return statistics_address_len_snsr;
+    return (pal_sensor_get_expected_stats_addr_len() + pal_sensor_get_expected_stats_addr_low());
 }
 
 uint8_t pal_sensor_get_expected_async_support(uint32_t sensor_id)
 {
-    return async_sensor_read_support[sensor_id];
+    return PAL_EXPECTED(PDESC_SENSOR_ASYNC_SUPPORT, 0, sensor_id, async_sensor_read_support[sensor_id]);
 }
 
 uint8_t pal_sensor_get_expected_trip_points(uint32_t sensor_id)
 {
-    return number_of_trip_points_supported[sensor_id];
+    return PAL_EXPECTED(PDESC_SENSOR_TRIP_POINTS, 0, sensor_id, number_of_trip_points_supported[sensor_id]);
+}
+
+uint32_t pal_sensor_get_expected_max_pending_async_cmds(void)
+{
+    return PAL_EXPECTED(PDESC_SENSOR_MAX_PENDING_ASYNC_CMDS, 0, 0, max_num_pending_async_cmds_supported);
+}
+
+uint32_t pal_sensor_get_expected_reading(uint32_t sensor_id)
+{
+    return PAL_EXPECTED(PDESC_SENSOR_READING, 0, sensor_id, sensor_reading_value[sensor_id]);
 }
@@ -0,0 +1,346 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <poll.h>
+#include <time.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <pal_platform.h>
+#include <pal_interface.h>
+#include <protocol_common.h>
+#include <mock_mailbox.h>
+
+#define NO_ERROR 0
+#define ERROR 5
+
+/* Delayed responses and notifications read while waiting for a response */
+#define MOCK_SOCKET_MAX_STASHED 16
+
+#define MB_HEADER_TYPE(header) (((header) >> 8) & 0x3)
+#define MB_HEADER_TYPE_DELAYED_RESPONSE 2
+
+/*
+ * socket transport to scmi_mock_server. Each channel is a separate
+ * connection, i.e. a separate agent, and is used by one thread at a time.
+ * Channels other than 0 connect on first use.
+ */
+struct mock_socket_channel {
+    int fd;
+    /* shared memory image of the mailbox, sent and received whole */
+    uint8_t buffer[MOCK_MAILBOX_LENGTH] __attribute__((aligned(8)));
+    /* asynchronous messages received ahead of a response, oldest first */
+    uint8_t stash[MOCK_SOCKET_MAX_STASHED][MOCK_MAILBOX_LENGTH] __attribute__((aligned(8)));
+    ssize_t stash_length[MOCK_SOCKET_MAX_STASHED];
+    uint32_t num_stashed;
+    /* header of the previous response, or command if it timed out. A late or
+       duplicated response to the previous command carries it and is discarded */
+    uint32_t last_header;
+};
+
+static struct mock_socket_channel g_socket_channels[MOCKER_NUM_CHANNELS];
+static const char *g_socket_path;
+
+/* channel used by the calling thread, see mock_socket_select() */
+static __thread struct mock_socket_channel *g_current_channel = &g_socket_channels[0];
+
+/* word accessors into the mailbox memory layout, offsets are byte offsets */
+static inline void mb_write_word(struct mock_socket_channel *channel, uint32_t offset,
+        uint32_t value)
+{
+    *(uint32_t *)&channel->buffer[offset] = value;
+}
+
+static inline uint32_t mb_read_word(struct mock_socket_channel *channel, uint32_t offset)
+{
+    return *(const uint32_t *)&channel->buffer[offset];
+}
+
+/*!
+ * @brief Keeps an asynchronous message read from the channel for a later
+ *        mock_socket_receive(), the oldest one is dropped when full.
+ */
+static void mock_socket_stash(struct mock_socket_channel *channel, ssize_t length)
+{
+    if (channel->num_stashed == MOCK_SOCKET_MAX_STASHED) {
+        memmove(channel->stash[0], channel->stash[1],
+                (MOCK_SOCKET_MAX_STASHED - 1) * sizeof(channel->stash[0]));
+        memmove(&channel->stash_length[0], &channel->stash_length[1],
+                (MOCK_SOCKET_MAX_STASHED - 1) * sizeof(channel->stash_length[0]));
+        channel->num_stashed--;
+    }
+
+    memcpy(channel->stash[channel->num_stashed], channel->buffer, length);
+    channel->stash_length[channel->num_stashed++] = length;
+}
+
+/*!
+ * @brief Moves the oldest stashed message of a type into the mailbox image.
+ */
+static ssize_t mock_socket_unstash(struct mock_socket_channel *channel, uint32_t type)
+{
+    ssize_t length;
+    uint32_t i;
+
+    for (i = 0; i < channel->num_stashed; i++) {
+        if (MB_HEADER_TYPE(*(const uint32_t *)&channel->stash[i][MB_MESSAGE_HEADER]) != type)
+            continue;
+
+        length = channel->stash_length[i];
+        memcpy(channel->buffer, channel->stash[i], length);
+        memmove(channel->stash[i], channel->stash[i + 1],
+                (channel->num_stashed - i - 1) * sizeof(channel->stash[0]));
+        memmove(&channel->stash_length[i], &channel->stash_length[i + 1],
+                (channel->num_stashed - i - 1) * sizeof(channel->stash_length[0]));
+        channel->num_stashed--;
+        return length;
+    }
+
+    return 0;
+}
+
+/*!
+ * @brief Connects one channel to the server.
+ */
+static int32_t mock_socket_connect(struct mock_socket_channel *channel)
+{
+    struct timeval timeout = { MOCKER_RESPONSE_TIMEOUT_MS / 1000,
+                               (MOCKER_RESPONSE_TIMEOUT_MS % 1000) * 1000 };
+    struct sockaddr_un address;
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (strlen(g_socket_path) >= sizeof(address.sun_path))
+        return ERROR;
+    strcpy(address.sun_path, g_socket_path);
+
+    /* Sequenced packets keep one mailbox image per message */
+    channel->fd = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+    if (channel->fd < 0)
+        return ERROR;
+
+    if (connect(channel->fd, (struct sockaddr *)&address, sizeof(address)) != 0) {
+        printf("\nERROR: cannot connect to %s, is scmi_mock_server running?\n", g_socket_path);
+        close(channel->fd);
+        channel->fd = -1;
+        return ERROR;
+    }
+
+    /* A response the server does not send, e.g. dropped on purpose, times out */
+    setsockopt(channel->fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    channel->last_header = 0;
+    channel->num_stashed = 0;
+    return NO_ERROR;
+}
+
+/*!
+ * @brief Connects the agent to scmi_mock_server, at the path given by the
+ *        SCMI_MOCK_SERVER environment variable.
+ */
+int32_t mock_socket_open(const char *path)
+{
+    uint32_t channel_id;
+
+    for (channel_id = 0; channel_id < MOCKER_NUM_CHANNELS; channel_id++)
+        g_socket_channels[channel_id].fd = -1;
+
+    g_socket_path = (path[0] != '\0') ? path : MOCK_SERVER_DEFAULT_PATH;
+    return mock_socket_connect(&g_socket_channels[0]);
+}
+
+/*!
+ * @brief Closes every connected channel.
+ */
+void mock_socket_close(void)
+{
+    uint32_t channel_id;
+
+    for (channel_id = 0; channel_id < MOCKER_NUM_CHANNELS; channel_id++) {
+        if (g_socket_channels[channel_id].fd >= 0)
+            close(g_socket_channels[channel_id].fd);
+        g_socket_channels[channel_id].fd = -1;
+    }
+
+    g_socket_path = NULL;
+}
+
+/*!
+ * @brief Binds the calling thread to a channel, connecting it if needed.
+ */
+int32_t mock_socket_select(uint32_t channel_id)
+{
+    struct mock_socket_channel *channel;
+
+    if (channel_id >= MOCKER_NUM_CHANNELS)
+        return ERROR;
+
+    channel = &g_socket_channels[channel_id];
+    if ((channel->fd < 0) && (mock_socket_connect(channel) != NO_ERROR))
+        return ERROR;
+
+    g_current_channel = channel;
+    return NO_ERROR;
+}
+
+/*!
+ * @brief Writes a command into the mailbox memory, rings the server and
+ *        reads back its response.
+ */
+int32_t mock_socket_send_message(uint32_t message_header_send, size_t parameter_count,
+        const uint32_t *parameters, uint32_t *message_header_rcv, int32_t *status,
+        size_t *return_values_count, uint32_t *return_values)
+{
+    struct mock_socket_channel *channel = g_current_channel;
+    uint32_t payload_length, header, previous_header;
+    size_t capacity = *return_values_count;
+    ssize_t received;
+    size_t i;
+
+    *message_header_rcv = 0;
+    *status = SCMI_STATUS_GENERIC_ERROR;
+    *return_values_count = 0;
+
+    if (parameter_count > MB_MAX_PAYLOAD_WORDS)
+        return ERROR;
+
+    memset(channel->buffer, 0, MB_MESSAGE_PAYLOAD);
+    mb_write_word(channel, MB_FLAGS, 0); /* Polled completion */
+    mb_write_word(channel, MB_HEADER_PAYLOAD_LENGTH, sizeof(uint32_t) * (parameter_count + 1));
+    mb_write_word(channel, MB_MESSAGE_HEADER, message_header_send);
+    for (i = 0; i < parameter_count; i++)
+        mb_write_word(channel, MB_MESSAGE_PAYLOAD + (i * sizeof(uint32_t)), parameters[i]);
+
+    if (send(channel->fd, channel->buffer, MB_MESSAGE_PAYLOAD + (parameter_count *
+             sizeof(uint32_t)), 0) < 0)
+        return ERROR;
+
+    /*
+     * The server may deliver delayed responses and notifications first, and
+     * a late or duplicated response to the previous command
+     */
+    previous_header = channel->last_header;
+    channel->last_header = message_header_send;
+    while (1) {
+        received = recv(channel->fd, channel->buffer, sizeof(channel->buffer), 0);
+        if (received < MB_MESSAGE_PAYLOAD)
+            break;
+
+        header = mb_read_word(channel, MB_MESSAGE_HEADER);
+        if (MB_HEADER_TYPE(header) != 0) {
+            mock_socket_stash(channel, received);
+        } else if ((header != previous_header) || (header == message_header_send)) {
+            channel->last_header = header;
+            break;
+        }
+    }
+
+    if ((received < MB_MESSAGE_PAYLOAD + (ssize_t)sizeof(uint32_t)) ||
+        !(mb_read_word(channel, MB_CHANNEL_STATUS) & MB_CHANNEL_STATUS_FREE) ||
+        (mb_read_word(channel, MB_CHANNEL_STATUS) & MB_CHANNEL_STATUS_ERROR))
+        return ERROR;
+
+    /* The payload of a response is the status followed by the return values */
+    payload_length = mb_read_word(channel, MB_HEADER_PAYLOAD_LENGTH);
+    if ((payload_length < 2 * sizeof(uint32_t)) ||
+        (MB_MESSAGE_HEADER + payload_length > (size_t)received))
+        return ERROR;
+
+    *message_header_rcv = mb_read_word(channel, MB_MESSAGE_HEADER);
+    *status = (int32_t)mb_read_word(channel, MB_MESSAGE_PAYLOAD);
+    *return_values_count = (payload_length / sizeof(uint32_t)) - 2;
+    if (*return_values_count > capacity)
+        *return_values_count = capacity;
+    for (i = 0; i < *return_values_count; i++)
+        return_values[i] = mb_read_word(channel, MB_MESSAGE_PAYLOAD +
+                                        ((i + 1) * sizeof(uint32_t)));
+
+    return NO_ERROR;
+}
+
+/*!
+ * @brief Waits for the next delayed response or notification sent by the
+ *        server on the channel of the calling thread.
+ */
+int32_t mock_socket_receive(uint32_t type, uint32_t timeout_ms, uint32_t *message_header_rcv,
+        int32_t *status, size_t *return_values_count, uint32_t *return_values)
+{
+    struct mock_socket_channel *channel = g_current_channel;
+    struct pollfd poll_fd = { .fd = channel->fd, .events = POLLIN };
+    struct timespec now, deadline;
+    uint32_t payload_length, first;
+    size_t capacity = *return_values_count;
+    ssize_t received;
+    int64_t wait_ms;
+    size_t i;
+
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec += timeout_ms / 1000;
+    deadline.tv_nsec += (timeout_ms % 1000) * 1000000l;
+    if (deadline.tv_nsec >= 1000000000l) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000l;
+    }
+
+    received = mock_socket_unstash(channel, type);
+    while (received == 0) {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        wait_ms = ((int64_t)(deadline.tv_sec - now.tv_sec) * 1000) +
+                  ((deadline.tv_nsec - now.tv_nsec) / 1000000);
+        if ((wait_ms < 0) || (poll(&poll_fd, 1, (int)wait_ms) <= 0))
+            return ERROR;
+
+        received = recv(channel->fd, channel->buffer, sizeof(channel->buffer), 0);
+        if (received < MB_MESSAGE_PAYLOAD)
+            return ERROR;
+
+        /* Messages of the other type wait for their own receive */
+        if (MB_HEADER_TYPE(mb_read_word(channel, MB_MESSAGE_HEADER)) != type) {
+            mock_socket_stash(channel, received);
+            received = 0;
+        }
+    }
+
+    payload_length = mb_read_word(channel, MB_HEADER_PAYLOAD_LENGTH);
+    if ((payload_length < sizeof(uint32_t)) ||
+        (MB_MESSAGE_HEADER + payload_length > (size_t)received))
+        return ERROR;
+
+    /* A delayed response carries a status ahead of its values, a notification does not */
+    *message_header_rcv = mb_read_word(channel, MB_MESSAGE_HEADER);
+    *return_values_count = (payload_length / sizeof(uint32_t)) - 1;
+    first = 0;
+    if (type == MB_HEADER_TYPE_DELAYED_RESPONSE) {
+        if (*return_values_count == 0)
+            return ERROR;
+        *status = (int32_t)mb_read_word(channel, MB_MESSAGE_PAYLOAD);
+        (*return_values_count)--;
+        first = 1;
+    }
+    if (*return_values_count > capacity)
+        *return_values_count = capacity;
+
+    for (i = 0; i < *return_values_count; i++)
+        return_values[i] = mb_read_word(channel, MB_MESSAGE_PAYLOAD +
+                                        ((i + first) * sizeof(uint32_t)));
+
+    return NO_ERROR;
+}
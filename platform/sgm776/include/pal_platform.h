@@ -21,8 +21,14 @@
 #include <stddef.h>
 #include <stdbool.h>
 #include <inttypes.h>
+#include <stdarg.h>
 
+#ifdef VAL_BINARY_TRACE
+#define LOG_FILE "arm_scmi_test_trace.bin"
+#else
 #define LOG_FILE "arm_scmi_test_log.txt"
+#endif
+#define DEV_MEM_FILE "/dev/mem"
 
 #define VERSION_ENCODE32(MAJOR, MINOR, PATCH) (((MAJOR & 0xff) << 24) | \
                                                 ((MINOR & 0xff) << 16)| \
@@ -38,6 +44,20 @@
 
 #define TIMEOUT  100
 
+/* Raw mode directories of the kernel SCMI instances, see sgm_raw_open() */
+#define SGM_RAW_ENV          "SCMI_RAW"
+#define SGM_RAW_DEFAULT_DIR  "/sys/kernel/debug/scmi/0/raw"
+
+int32_t sgm_log_write(const char *format, va_list args);
+int32_t sgm_log_write_raw(const void *bytes, size_t size);
+
+int32_t sgm_mailbox_open(const char *options);
+void sgm_mailbox_close(void);
+uint32_t sgm_mailbox_get_num_channels(void);
+int32_t sgm_mailbox_select(uint32_t channel_id);
+uint32_t sgm_mailbox_get_completion_mode(void);
+uint32_t sgm_mailbox_get_channel_size(void);
+
 int32_t sgm_send_message(uint32_t message_header_send, size_t parameter_count,
         const uint32_t *parameters, uint32_t *message_header_rcv, int32_t *status,
         size_t *return_values_count, uint32_t *return_values);
@@ -50,6 +70,23 @@ int sgm_wait_for_response(uint32_t *message_header_rcv,
         int32_t *status, size_t *return_values_count, uint32_t *return_values,
         bool *message_ready, uint32_t timeout);
 
+int32_t sgm_raw_open(const char *dirs);
+void sgm_raw_close(void);
+uint32_t sgm_raw_get_num_channels(void);
+int32_t sgm_raw_select(uint32_t channel_id);
+
+int32_t sgm_raw_send_message(uint32_t message_header_send, size_t parameter_count,
+        const uint32_t *parameters, uint32_t *message_header_rcv, int32_t *status,
+        size_t *return_values_count, uint32_t *return_values);
+
+int sgm_raw_wait_for_notification(uint32_t *message_header_rcv,
+        size_t *return_values_count, uint32_t *return_values,
+        uint32_t timeout);
+
+int sgm_raw_wait_for_response(uint32_t *message_header_rcv,
+        int32_t *status, size_t *return_values_count, uint32_t *return_values,
+        uint32_t timeout);
+
 uint32_t sgm_agent_get_accessible_device(uint32_t agent_id);
 uint32_t sgm_agent_get_inaccessible_device(uint32_t agent_id);
 uint32_t sgm_device_get_accessible_protocol(uint32_t device_id);
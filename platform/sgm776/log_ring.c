@@ -0,0 +1,328 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <pal_platform.h>
+
+/* logger macros */
+#define LOG_RING_SIZE        (64 * 1024) /* Bytes per thread, power of two */
+#define LOG_RECORD_SIZE      1024        /* Prints longer than this are formatted on the heap */
+#define LOG_WRITER_IDLE_NS   1000000     /* Writer sleep when every ring is empty */
+#define LOG_CRASH_SPIN       1000000     /* Attempts to take the drain lock on a crash */
+
+/*
+ * log ring of one thread. The owning thread is the only producer and the
+ * writer thread the only consumer, so head and tail need no lock. Rings are
+ * never freed, the ring of an exited thread is reused by a later thread
+ * once the writer has drained it.
+ */
+struct sgm_log_ring {
+    struct sgm_log_ring *next; // all rings, pushed at the head only
+    uint32_t head;             // bytes produced, written by the owner
+    uint32_t tail;             // bytes consumed, written by the writer
+    bool owned;                // a live thread is producing into the ring
+    char data[LOG_RING_SIZE];
+};
+
+static struct sgm_log_ring *g_log_rings;
+static __thread struct sgm_log_ring *g_log_ring;
+
+static pthread_once_t g_log_once = PTHREAD_ONCE_INIT;
+static pthread_key_t g_log_key;
+static pthread_t g_log_writer;
+static int g_log_fd = -1;
+static bool g_log_stop;
+static bool g_log_draining; // drain lock, see sgm_log_drain()
+
+static const int g_log_crash_signals[] = { SIGSEGV, SIGBUS, SIGILL, SIGFPE, SIGABRT };
+
+/*!
+ * @brief Writes the pending bytes of a ring to the log file.
+ */
+static bool sgm_log_drain_ring(struct sgm_log_ring *ring)
+{
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    uint32_t tail = ring->tail;
+    uint32_t offset, length;
+    ssize_t written;
+
+    if (head == tail)
+        return false;
+
+    while (tail != head) {
+        /* The pending bytes wrap at most once */
+        offset = tail & (LOG_RING_SIZE - 1);
+        length = head - tail;
+        if (length > LOG_RING_SIZE - offset)
+            length = LOG_RING_SIZE - offset;
+
+        written = write(g_log_fd, &ring->data[offset], length);
+        if (written <= 0)
+            break;
+        tail += written;
+    }
+
+    /* Drop what could not be written rather than block the producer forever */
+    __atomic_store_n(&ring->tail, head, __ATOMIC_RELEASE);
+    return true;
+}
+
+/*!
+ * @brief Writes the pending bytes of every ring to the log file. The drain
+ *        lock keeps the writer thread and a crash handler from writing the
+ *        same bytes twice.
+ */
+static bool sgm_log_drain(void)
+{
+    struct sgm_log_ring *ring;
+    bool drained = false;
+
+    if (__atomic_exchange_n(&g_log_draining, true, __ATOMIC_ACQUIRE))
+        return false;
+
+    for (ring = __atomic_load_n(&g_log_rings, __ATOMIC_ACQUIRE); ring != NULL; ring = ring->next)
+        drained |= sgm_log_drain_ring(ring);
+
+    __atomic_store_n(&g_log_draining, false, __ATOMIC_RELEASE);
+    return drained;
+}
+
+/*!
+ * @brief Background writer, drains the rings until the logger is closed.
+ */
+static void *sgm_log_writer(void *arg)
+{
+    struct timespec idle = { 0, LOG_WRITER_IDLE_NS };
+
+    (void)arg;
+    while (!__atomic_load_n(&g_log_stop, __ATOMIC_ACQUIRE)) {
+        if (!sgm_log_drain())
+            nanosleep(&idle, NULL);
+    }
+
+    return NULL;
+}
+
+/*!
+ * @brief Flushes the rings on a fatal signal, then lets the signal take its
+ *        default course so that the agent still dumps core.
+ */
+static void sgm_log_crash(int signal_number)
+{
+    uint32_t spin = LOG_CRASH_SPIN;
+
+    /* The writer thread may hold the drain lock, it releases it shortly */
+    while (!sgm_log_drain() && __atomic_load_n(&g_log_draining, __ATOMIC_ACQUIRE) && --spin)
+        ;
+
+    signal(signal_number, SIG_DFL);
+    raise(signal_number);
+}
+
+/*!
+ * @brief Releases the ring of an exiting thread for reuse.
+ */
+static void sgm_log_release(void *ring)
+{
+    __atomic_store_n(&((struct sgm_log_ring *)ring)->owned, false, __ATOMIC_RELEASE);
+}
+
+/*!
+ * @brief Stops the writer thread, writes out what is left and closes the
+ *        log file. Registered with atexit().
+ */
+static void sgm_log_close(void)
+{
+    if (g_log_fd < 0)
+        return;
+
+    __atomic_store_n(&g_log_stop, true, __ATOMIC_RELEASE);
+    pthread_join(g_log_writer, NULL);
+
+    sgm_log_drain();
+    close(g_log_fd);
+    g_log_fd = -1;
+}
+
+/*!
+ * @brief Opens the log file once and starts the writer thread.
+ */
+static void sgm_log_open(void)
+{
+    uint32_t i;
+
+    g_log_fd = open(LOG_FILE, O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (g_log_fd < 0)
+        return;
+
+    if ((pthread_key_create(&g_log_key, sgm_log_release) != 0) ||
+        (pthread_create(&g_log_writer, NULL, sgm_log_writer, NULL) != 0)) {
+        close(g_log_fd);
+        g_log_fd = -1;
+        return;
+    }
+
+    atexit(sgm_log_close);
+    for (i = 0; i < sizeof(g_log_crash_signals) / sizeof(g_log_crash_signals[0]); i++)
+        signal(g_log_crash_signals[i], sgm_log_crash);
+}
+
+/*!
+ * @brief Returns the ring of the calling thread, reusing a released ring or
+ *        allocating a new one on the first print of the thread.
+ */
+static struct sgm_log_ring *sgm_log_get_ring(void)
+{
+    struct sgm_log_ring *ring;
+    bool owned;
+
+    if (g_log_ring != NULL)
+        return g_log_ring;
+
+    for (ring = __atomic_load_n(&g_log_rings, __ATOMIC_ACQUIRE); ring != NULL; ring = ring->next) {
+        owned = false;
+        if (__atomic_compare_exchange_n(&ring->owned, &owned, true, false,
+                                        __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+            break;
+    }
+
+    if (ring == NULL) {
+        ring = calloc(1, sizeof(*ring));
+        if (ring == NULL)
+            return NULL;
+
+        ring->owned = true;
+        ring->next = __atomic_load_n(&g_log_rings, __ATOMIC_RELAXED);
+        while (!__atomic_compare_exchange_n(&g_log_rings, &ring->next, ring, true,
+                                            __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+            ;
+    }
+
+    pthread_setspecific(g_log_key, ring);
+    g_log_ring = ring;
+    return ring;
+}
+
+/*!
+ * @brief Copies bytes into a ring, waiting for the writer thread whenever
+ *        the ring is full. A print that fits the ring is published whole, so
+ *        that the writer never splits it around the prints of other threads.
+ */
+static void sgm_log_copy(struct sgm_log_ring *ring, const char *bytes, uint32_t length)
+{
+    uint32_t head = ring->head;
+    uint32_t offset, space, chunk;
+
+    while (length > 0) {
+        space = LOG_RING_SIZE - (head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE));
+        if ((space == 0) || ((length <= LOG_RING_SIZE) && (space < length))) {
+            sched_yield();
+            continue;
+        }
+
+        chunk = (length < space) ? length : space;
+        offset = head & (LOG_RING_SIZE - 1);
+        if (chunk > LOG_RING_SIZE - offset) {
+            memcpy(&ring->data[offset], bytes, LOG_RING_SIZE - offset);
+            memcpy(ring->data, bytes + LOG_RING_SIZE - offset, chunk - (LOG_RING_SIZE - offset));
+        } else {
+            memcpy(&ring->data[offset], bytes, chunk);
+        }
+
+        head += chunk;
+        bytes += chunk;
+        length -= chunk;
+        __atomic_store_n(&ring->head, head, __ATOMIC_RELEASE);
+    }
+}
+
+/*!
+ * @brief Returns the ring of the calling thread, opening the logger on the
+ *        first print of the agent.
+ */
+static struct sgm_log_ring *sgm_log_prepare(void)
+{
+    pthread_once(&g_log_once, sgm_log_open);
+    if (g_log_fd < 0)
+        return NULL;
+
+    return sgm_log_get_ring();
+}
+
+/*!
+ * @brief Copies bytes that are already formatted, such as binary trace
+ *        records, into the ring of the calling thread.
+ */
+int32_t sgm_log_write_raw(const void *bytes, size_t size)
+{
+    struct sgm_log_ring *ring = sgm_log_prepare();
+
+    if (ring == NULL)
+        return -1;
+
+    sgm_log_copy(ring, bytes, size);
+    return 0;
+}
+
+/*!
+ * @brief Formats a print into the ring of the calling thread. The print is
+ *        written to the log file by the writer thread; the caller only
+ *        waits when its ring is full.
+ */
+int32_t sgm_log_write(const char *format, va_list args)
+{
+    struct sgm_log_ring *ring;
+    char record[LOG_RECORD_SIZE];
+    char *text = record;
+    va_list args_copy;
+    int printed;
+
+    ring = sgm_log_prepare();
+    if (ring == NULL)
+        return -1;
+
+    va_copy(args_copy, args);
+    printed = vsnprintf(record, sizeof(record), format, args_copy);
+    va_end(args_copy);
+    if (printed <= 0)
+        return 0;
+
+    /* Captured suite logs are printed in one piece and exceed the record */
+    if ((size_t)printed >= sizeof(record)) {
+        text = malloc(printed + 1);
+        if (text == NULL)
+            return -1;
+        vsnprintf(text, printed + 1, format, args);
+    }
+
+    sgm_log_copy(ring, text, printed);
+
+    if (text != record)
+        free(text);
+    return 0;
+}
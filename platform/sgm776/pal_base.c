@@ -17,6 +17,7 @@
 
 #include "pal_interface.h"
 #include "pal_base_expected.h"
+#include "pal_description.h"
 
 /**
   @brief   This API is used to check vendor name
@@ -25,7 +26,7 @@
 **/
 char *pal_base_get_expected_vendor_name(void)
 {
-    return vendor_name;
+    return PAL_EXPECTED_STRING(PDESC_BASE_VENDOR_NAME, 0, vendor_name);
 }
 
 /**
@@ -35,7 +36,7 @@ char *pal_base_get_expected_vendor_name(void)
 **/
 char *pal_base_get_expected_subvendor_name(void)
 {
-    return subvendor_name;
+    return PAL_EXPECTED_STRING(PDESC_BASE_SUBVENDOR_NAME, 0, subvendor_name);
 }
 
 /**
@@ -45,7 +46,7 @@ char *pal_base_get_expected_subvendor_name(void)
 **/
 uint32_t pal_base_get_expected_implementation_version(void)
 {
-    return implementation_version;
+    return PAL_EXPECTED(PDESC_BASE_IMPLEMENTATION_VERSION, 0, 0, implementation_version);
 }
 
 /**
@@ -55,7 +56,7 @@ uint32_t pal_base_get_expected_implementation_version(void)
 **/
 uint32_t pal_base_get_expected_num_agents(void)
 {
-    return NUM_ELEMS(agents);
+    return PAL_EXPECTED(PDESC_BASE_NUM_AGENTS, 0, 0, NUM_ELEMS(agents));
 }
 
 /**
@@ -65,7 +66,7 @@ uint32_t pal_base_get_expected_num_agents(void)
 **/
 uint32_t pal_base_get_expected_num_protocols(void)
 {
-    return NUM_ELEMS(supported_protocols);
+    return PAL_EXPECTED(PDESC_BASE_NUM_PROTOCOLS, 0, 0, NUM_ELEMS(supported_protocols));
 }
 
 /**
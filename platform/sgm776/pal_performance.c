@@ -18,6 +18,7 @@
 
 #include "pal_interface.h"
 #include "pal_performance_expected.h"
+#include "pal_description.h"
 
 /**
   @brief   This API is used for checking number of perf domains
@@ -26,7 +27,7 @@
 **/
 uint32_t  pal_performance_get_expected_num_domains(void)
 {
-    return num_perf_domains;
+    return PAL_EXPECTED(PDESC_PERF_NUM_DOMAINS, 0, 0, num_perf_domains);
 }
 
 /**
@@ -36,7 +37,7 @@ uint32_t  pal_performance_get_expected_num_domains(void)
 **/
 uint32_t  pal_performance_get_expected_stats_addr_low(void)
 {
-    return statistics_address_low_perf;
+    return PAL_EXPECTED(PDESC_PERF_STATS_ADDR_LOW, 0, 0, statistics_address_low_perf);
 }
 
 /**
@@ -46,7 +47,8 @@ uint32_t  pal_performance_get_expected_stats_addr_low(void)
 **/
 uint32_t  pal_performance_get_expected_stats_addr_high(void)
 {
-    return (statistics_address_low_perf + statistics_address_len_perf);
+    return (pal_performance_get_expected_stats_addr_low() +
+            pal_performance_get_expected_stats_addr_len());
 }
 
 /**
@@ -56,7 +58,7 @@ uint32_t  pal_performance_get_expected_stats_addr_high(void)
 **/
 uint32_t  pal_performance_get_expected_stats_addr_len(void)
 {
-    return statistics_address_len_perf;
+    return PAL_EXPECTED(PDESC_PERF_STATS_ADDR_LEN, 0, 0, statistics_address_len_perf);
 }
 
 /**
@@ -66,7 +68,8 @@ uint32_t  pal_performance_get_expected_stats_addr_len(void)
 **/
 uint8_t *pal_performance_get_expected_name(uint32_t domain_id)
 {
-    return (uint8_t *)&performance_domain_names[domain_id][0];
+    return (uint8_t *)PAL_EXPECTED_STRING(PDESC_PERF_NAME, domain_id,
+                                         &performance_domain_names[domain_id][0]);
 }
 
 /**
@@ -76,7 +79,8 @@ uint8_t *pal_performance_get_expected_name(uint32_t domain_id)
 **/
 uint32_t  pal_performance_get_expected_number_of_level(uint32_t domain_id)
 {
-    return perf_num_performance_levels[domain_id];
+    return PAL_EXPECTED(PDESC_PERF_NUM_LEVELS, 0, domain_id,
+                        perf_num_performance_levels[domain_id]);
 }
 
 #endif
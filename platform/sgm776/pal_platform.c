@@ -15,29 +15,207 @@
  * limitations under the License.
 **/
 
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
 #include "pal_platform.h"
 #include "pal_interface.h"
+#include "pal_description.h"
+#include "pal_discovery.h"
+#include "pal_record.h"
+#include "pal_results.h"
+#include "pal_stats.h"
+#include "pal_transport.h"
 
 /**
-  @brief   This API is used to call platform function to send command
-  @param   cmd message header
-  @param   num of cmd parameter
-  @param   parameter list
-  @param   response message header
-  @param   cmd status
-  @param   return values count
-  @param   return values list
-  @return  vendor name
+  @brief   Reports a command that got no response, the board drivers leave
+           the outputs untouched when they fail
+  @param   message_header_rcv   message header received
+  @param   status               status of the command processed, NULL for
+                                notifications
+  @param   return_values_count  return values count
+  @return  none
+**/
+static void sgm_transport_failed(uint32_t *message_header_rcv, int32_t *status,
+        size_t *return_values_count)
+{
+    *message_header_rcv = 0;
+    if (status != NULL)
+        *status = PAL_TRANSPORT_GENERIC_ERROR;
+    *return_values_count = 0;
+}
+
+/**
+  @brief   Opens the mailbox channels, they are released when the agent exits
+  @param   argument  completion and size options, NULL to complete by
+                     interrupt over a channel of pal_get_channel_size()
+                     bytes, see sgm_mailbox_open()
+  @return  status
+**/
+static uint32_t sgm_mailbox_transport_open(const char *argument)
+{
+    return sgm_mailbox_open(argument) ? PAL_STATUS_FAIL : PAL_STATUS_PASS;
+}
+
+/**
+  @brief   Binds the calling thread to a mailbox channel
+  @param   channel_id  channel identifier
+  @return  status
+**/
+static uint32_t sgm_mailbox_transport_select(uint32_t channel_id)
+{
+    return sgm_mailbox_select(channel_id) ? PAL_STATUS_FAIL : PAL_STATUS_PASS;
+}
+
+/**
+  @brief   Sends a command over the mailbox and waits for its response
+  @param   see pal_send_message()
+  @return  none
+**/
+static void sgm_mailbox_transport_send_message(uint32_t message_header_send,
+        size_t parameter_count, const uint32_t *parameters, uint32_t *message_header_rcv,
+        int32_t *status, size_t *return_values_count, uint32_t *return_values)
+{
+    if (sgm_send_message(message_header_send, parameter_count, parameters,
+                         message_header_rcv, status, return_values_count,
+                         return_values))
+        sgm_transport_failed(message_header_rcv, status, return_values_count);
+}
+
+/**
+   @brief   Waits for a delayed response on the mailbox
+   @param   see pal_receive_delayed_response()
+   @return  none
+ **/
+static void sgm_mailbox_transport_receive_delayed_response(uint32_t *message_header_rcv,
+        int32_t *status, size_t *return_values_count, uint32_t *return_values)
+{
+    uint32_t timeout = TIMEOUT; /* In ms*/
+
+    if (sgm_wait_for_response(message_header_rcv, status,
+            return_values_count, return_values, NULL, timeout))
+        sgm_transport_failed(message_header_rcv, status, return_values_count);
+}
+
+/**
+   @brief   Waits for a notification on the mailbox
+   @param   see pal_receive_notification()
+   @return  none
+ **/
+static void sgm_mailbox_transport_receive_notification(uint32_t *message_header_rcv,
+        size_t *return_values_count, uint32_t *return_values)
+{
+    uint32_t timeout = TIMEOUT; /* In ms*/
+
+    if (sgm_wait_for_notification(message_header_rcv,
+            return_values_count, return_values, timeout))
+        sgm_transport_failed(message_header_rcv, NULL, return_values_count);
+}
+
+/* The mailbox of the board */
+static const PAL_TRANSPORT_s g_sgm_mailbox_transport = {
+    .name = "mailbox",
+    .env = NULL,
+    .open = sgm_mailbox_transport_open,
+    .close = sgm_mailbox_close,
+    .get_num_channels = sgm_mailbox_get_num_channels,
+    .select_channel = sgm_mailbox_transport_select,
+    .send_message = sgm_mailbox_transport_send_message,
+    .receive_delayed_response = sgm_mailbox_transport_receive_delayed_response,
+    .receive_notification = sgm_mailbox_transport_receive_notification,
+    .get_completion_mode = sgm_mailbox_get_completion_mode,
+    .get_channel_size = sgm_mailbox_get_channel_size,
+};
+
+/**
+  @brief   Opens the raw mode interfaces of the kernel SCMI driver
+  @param   argument  comma separated raw directories, one per channel, empty
+                     for SGM_RAW_DEFAULT_DIR
+  @return  status
+**/
+static uint32_t sgm_raw_transport_open(const char *argument)
+{
+    return sgm_raw_open(argument) ? PAL_STATUS_FAIL : PAL_STATUS_PASS;
+}
+
+/**
+  @brief   Binds the calling thread to a raw mode channel
+  @param   channel_id  channel identifier
+  @return  status
 **/
-void pal_send_message(uint32_t message_header_send, size_t parameter_count,
-        const uint32_t *parameters, uint32_t *message_header_rcv, int32_t *status,
+static uint32_t sgm_raw_transport_select(uint32_t channel_id)
+{
+    return sgm_raw_select(channel_id) ? PAL_STATUS_FAIL : PAL_STATUS_PASS;
+}
+
+/**
+  @brief   Sends a command through the kernel SCMI driver and waits for its
+           response
+  @param   see pal_send_message()
+  @return  none
+**/
+static void sgm_raw_transport_send_message(uint32_t message_header_send,
+        size_t parameter_count, const uint32_t *parameters, uint32_t *message_header_rcv,
+        int32_t *status, size_t *return_values_count, uint32_t *return_values)
+{
+    if (sgm_raw_send_message(message_header_send, parameter_count, parameters,
+                             message_header_rcv, status, return_values_count,
+                             return_values))
+        sgm_transport_failed(message_header_rcv, status, return_values_count);
+}
+
+/**
+   @brief   Waits for a delayed response through the kernel SCMI driver
+   @param   see pal_receive_delayed_response()
+   @return  none
+ **/
+static void sgm_raw_transport_receive_delayed_response(uint32_t *message_header_rcv,
+        int32_t *status, size_t *return_values_count, uint32_t *return_values)
+{
+    uint32_t timeout = TIMEOUT; /* In ms*/
+
+    if (sgm_raw_wait_for_response(message_header_rcv, status,
+            return_values_count, return_values, timeout))
+        sgm_transport_failed(message_header_rcv, status, return_values_count);
+}
+
+/**
+   @brief   Waits for a notification through the kernel SCMI driver
+   @param   see pal_receive_notification()
+   @return  none
+ **/
+static void sgm_raw_transport_receive_notification(uint32_t *message_header_rcv,
         size_t *return_values_count, uint32_t *return_values)
 {
-    sgm_send_message(message_header_send, parameter_count, parameters,
-                        message_header_rcv, status, return_values_count,
-                        return_values);
+    uint32_t timeout = TIMEOUT; /* In ms*/
+
+    if (sgm_raw_wait_for_notification(message_header_rcv,
+            return_values_count, return_values, timeout))
+        sgm_transport_failed(message_header_rcv, NULL, return_values_count);
 }
 
+/* The raw mode of the upstream kernel SCMI driver, no mailbox module is needed */
+static const PAL_TRANSPORT_s g_sgm_raw_transport = {
+    .name = "raw",
+    .env = SGM_RAW_ENV,
+    .open = sgm_raw_transport_open,
+    .close = sgm_raw_close,
+    .get_num_channels = sgm_raw_get_num_channels,
+    .select_channel = sgm_raw_transport_select,
+    .send_message = sgm_raw_transport_send_message,
+    .receive_delayed_response = sgm_raw_transport_receive_delayed_response,
+    .receive_notification = sgm_raw_transport_receive_notification,
+};
+
+/* A recording is preferred to the board, and the raw mode to the mailbox module */
+const PAL_TRANSPORT_s *const g_pal_transports[] = {
+    &g_pal_replay_transport,
+    &g_sgm_raw_transport,
+    &g_sgm_mailbox_transport,
+    NULL
+};
+
 /**
   @brief   This API is used to initialize platform to run tests if needed
   @param   platform info
@@ -45,7 +223,153 @@ void pal_send_message(uint32_t message_header_send, size_t parameter_count,
 **/
 uint32_t pal_initialize_system(void *info)
 {
-    return 0; /* No initialization needed for SGM to run test */
+    const char *description = getenv(PAL_DESCRIPTION_ENV);
+    const char *discovery = getenv(PAL_DISCOVERY_ENV);
+    const char *record = getenv(PAL_RECORD_ENV);
+    const char *results_json = getenv(PAL_RESULTS_JSON_ENV);
+    const char *results_junit = getenv(PAL_RESULTS_JUNIT_ENV);
+    const char *stats_bin = getenv(PAL_STATS_BIN_ENV);
+    const char *stats_csv = getenv(PAL_STATS_CSV_ENV);
+
+    /* Expected values of the SKU under test, without a rebuild */
+    if ((description != NULL) && pal_description_load_file(description))
+        return PAL_STATUS_FAIL;
+
+    /* Info tables walked by earlier runs of the same firmware */
+    if (discovery != NULL) {
+        if (pal_discovery_open(discovery))
+            return PAL_STATUS_FAIL;
+
+        atexit(pal_discovery_close);
+    }
+
+    /* Results of the checks and tests, written as they complete */
+    if ((results_json != NULL) || (results_junit != NULL)) {
+        if (pal_results_open(results_json, results_junit))
+            return PAL_STATUS_FAIL;
+
+        atexit(pal_results_close);
+    }
+
+    /* Samples of the statistics regions, written as the sampler hands them over */
+    if ((stats_bin != NULL) || (stats_csv != NULL)) {
+        if (pal_stats_open(stats_bin, stats_csv))
+            return PAL_STATUS_FAIL;
+
+        atexit(pal_stats_close);
+    }
+
+    /* Traffic of the run, appended by an agent built with RECORD=1 */
+    if (record != NULL) {
+        if (pal_record_open(record))
+            return PAL_STATUS_FAIL;
+
+        atexit(pal_record_close);
+    }
+
+    /* The transport given by --transport, else the first of g_pal_transports that applies */
+    if (pal_transport_open())
+        return PAL_STATUS_FAIL;
+
+    atexit(pal_transport_close);
+    return PAL_STATUS_PASS;
+}
+
+/**
+  @brief   This API returns a monotonic timestamp, unaffected by NTP slewing
+  @return  time in ns
+**/
+uint64_t pal_get_time_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC_RAW, &now);
+    return ((uint64_t)now.tv_sec * 1000000000ull) + now.tv_nsec;
+}
+
+/**
+  @brief   This API maps fast channel memory through /dev/mem
+  @param   address  physical address of the fast channel
+  @param   size     size of the fast channel in bytes
+  @return  agent address, NULL on failure
+**/
+void *pal_fast_channel_map(uint64_t address, uint32_t size)
+{
+    uint64_t page_mask = (uint64_t)sysconf(_SC_PAGESIZE) - 1;
+    uint64_t offset = address & page_mask;
+    uint8_t *base;
+    int fd;
+
+    /* Fast channel memory is not part of a recording */
+    if (pal_transport_current() == &g_pal_replay_transport)
+        return NULL;
+
+    fd = open(DEV_MEM_FILE, O_RDWR | O_SYNC);
+    if (fd < 0)
+        return NULL;
+
+    base = mmap(NULL, offset + size, PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+                (off_t)(address & ~page_mask));
+    close(fd); /* The mapping outlives the descriptor */
+    if (base == MAP_FAILED)
+        return NULL;
+
+    return base + offset;
+}
+
+/**
+  @brief   This API releases a fast channel mapping
+  @param   channel  agent address returned by pal_fast_channel_map
+  @param   size     size of the fast channel in bytes
+  @return  none
+**/
+void pal_fast_channel_unmap(void *channel, uint32_t size)
+{
+    uintptr_t page_mask = (uintptr_t)sysconf(_SC_PAGESIZE) - 1;
+    uintptr_t offset = (uintptr_t)channel & page_mask;
+
+    if (channel != NULL)
+        munmap((uint8_t *)channel - offset, offset + size);
+}
+
+/**
+  @brief   This API maps a statistics region through /dev/mem, read only
+  @param   address  physical address of the region
+  @param   size     size of the region in bytes
+  @return  agent address of the region, NULL if it cannot be mapped
+**/
+void *pal_stats_map(uint64_t address, uint32_t size)
+{
+    uint64_t page_mask = (uint64_t)sysconf(_SC_PAGESIZE) - 1;
+    uint64_t offset = address & page_mask;
+    uint8_t *base;
+    int fd;
+
+    /* Statistics memory is not part of a recording */
+    if (pal_transport_current() == &g_pal_replay_transport)
+        return NULL;
+
+    fd = open(DEV_MEM_FILE, O_RDONLY | O_SYNC);
+    if (fd < 0)
+        return NULL;
+
+    base = mmap(NULL, offset + size, PROT_READ, MAP_SHARED, fd, (off_t)(address & ~page_mask));
+    close(fd);
+    if (base == MAP_FAILED)
+        return NULL;
+
+    return base + offset;
+}
+
+/**
+  @brief   This API releases a statistics region mapping
+  @param   region  agent address returned by pal_stats_map
+  @param   size    size of the region in bytes
+  @return  none
+**/
+void pal_stats_unmap(void *region, uint32_t size)
+{
+    pal_fast_channel_unmap(region, size);
 }
 
 /**
@@ -55,44 +379,41 @@ uint32_t pal_initialize_system(void *info)
 **/
 void pal_print(uint32_t print_level, const char *format, va_list args)
 {
-    FILE *file_ptr = fopen(LOG_FILE, "a");
-    if (file_ptr)
-    {
-        vfprintf(file_ptr, format, args);
-        fclose(file_ptr);
-    }
-    else
+    /* Formatted into a per-thread ring, the log file is written in the background */
+    if (sgm_log_write(format, args))
         printf("ERROR: Log File opening failed");
 }
 
 /**
-   @brief   This API is used to receive delayed response
-   @param   message header received
-   @param   status of command processed
-   @param   return values count
-   @param   return values list
- **/
-void pal_receive_delayed_response(uint32_t *message_header_rcv, int32_t *status,
-        size_t *return_values_count, uint32_t *return_values)
+  @brief   This API is used to write a binary trace record
+  @param   record  trace record
+  @param   size    size of the record in bytes
+  @return  none
+**/
+void pal_trace(const void *record, size_t size)
 {
-    uint32_t timeout = TIMEOUT; /* In ms*/
-
-    sgm_wait_for_response(message_header_rcv, status,
-            return_values_count, return_values, NULL, timeout);
+    if (sgm_log_write_raw(record, size))
+        printf("ERROR: Log File opening failed");
 }
 
 /**
-   @brief   This API is used to receive notifications from platform
-   @param   message header received
-   @param   return values count
-   @param   return values list
- **/
-void pal_receive_notification(uint32_t *message_header_rcv, size_t *return_values_count,
-       uint32_t *return_values)
+  @brief   This API is used to append a record of the SCMI traffic
+  @param   record  VAL_RECORD_s
+  @param   size    size of the record in bytes
+  @return  none
+**/
+void pal_record(const void *record, size_t size)
 {
-    uint32_t timeout = TIMEOUT; /* In ms*/
-
-    sgm_wait_for_notification(message_header_rcv,
-            return_values_count, return_values, timeout);
+    pal_record_write(record, size);
 }
 
+/**
+  @brief   This API is used to hand the result of a check or test to the
+           results sink
+  @param   result  VAL_RESULT_s
+  @return  none
+**/
+void pal_result(const void *result)
+{
+    pal_results_write(result);
+}
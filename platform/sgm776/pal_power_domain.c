@@ -18,6 +18,7 @@
 
 #include "pal_interface.h"
 #include "pal_power_domain_expected.h"
+#include "pal_description.h"
 
 /**
   @brief   This API is used for checking num of power domain
@@ -26,7 +27,7 @@
 **/
 uint32_t pal_power_get_expected_num_domains(void)
 {
-    return num_power_domains;
+    return PAL_EXPECTED(PDESC_POWER_NUM_DOMAINS, 0, 0, num_power_domains);
 }
 
 /**
@@ -36,7 +37,7 @@ uint32_t pal_power_get_expected_num_domains(void)
 **/
 uint32_t pal_power_get_expected_stats_addr_low(void)
 {
-    return statistics_address_low_pow;
+    return PAL_EXPECTED(PDESC_POWER_STATS_ADDR_LOW, 0, 0, statistics_address_low_pow);
 }
 
 /**
@@ -46,7 +47,7 @@ uint32_t pal_power_get_expected_stats_addr_low(void)
 **/
 uint32_t pal_power_get_expected_stats_addr_high(void)
 {
-    return (statistics_address_low_pow + statistics_address_len_pow);
+    return (pal_power_get_expected_stats_addr_low() + pal_power_get_expected_stats_addr_len());
 }
 
 /**
@@ -56,7 +57,7 @@ uint32_t pal_power_get_expected_stats_addr_high(void)
 **/
 uint32_t pal_power_get_expected_stats_addr_len(void)
 {
-    return statistics_address_len_pow;
+    return PAL_EXPECTED(PDESC_POWER_STATS_ADDR_LEN, 0, 0, statistics_address_len_pow);
 }
 
 #endif
@@ -18,6 +18,7 @@
 
 #include "pal_interface.h"
 #include "pal_reset_expected.h"
+#include "pal_description.h"
 
 /**
   @brief   This API is used for checking num of reset domain
@@ -26,7 +27,7 @@
 **/
 uint32_t pal_reset_get_expected_num_domains(void)
 {
-    return num_reset_domains;
+    return PAL_EXPECTED(PDESC_RESET_NUM_DOMAINS, 0, 0, num_reset_domains);
 }
 
 /**
@@ -36,7 +37,8 @@ uint32_t pal_reset_get_expected_num_domains(void)
 **/
 uint8_t *pal_reset_get_expected_name(uint32_t domain_id)
 {
-    return (uint8_t *)reset_domain_names[domain_id];
+    return (uint8_t *)PAL_EXPECTED_STRING(PDESC_RESET_NAME, domain_id,
+                                         reset_domain_names[domain_id]);
 }
 
 #endif
@@ -18,6 +18,7 @@
 
 #include "pal_interface.h"
 #include "pal_sensor_expected.h"
+#include "pal_description.h"
 
 /**
   @brief   This API is used for checking num of sensors
@@ -26,7 +27,7 @@
 **/
 uint32_t pal_sensor_get_expected_num_sensors(void)
 {
-    return num_sensors;
+    return PAL_EXPECTED(PDESC_SENSOR_NUM_SENSORS, 0, 0, num_sensors);
 }
 
 /**
@@ -36,7 +37,7 @@ uint32_t pal_sensor_get_expected_num_sensors(void)
 **/
 uint32_t pal_sensor_get_expected_stats_addr_low(void)
 {
-    return statistics_address_low_snsr;
+    return PAL_EXPECTED(PDESC_SENSOR_STATS_ADDR_LOW, 0, 0, statistics_address_low_snsr);
 }
 
 /**
@@ -46,7 +47,7 @@ uint32_t pal_sensor_get_expected_stats_addr_low(void)
 **/
 uint32_t pal_sensor_get_expected_stats_addr_high(void)
 {
-    return (statistics_address_low_snsr + statistics_address_len_snsr);
+    return (pal_sensor_get_expected_stats_addr_low() + pal_sensor_get_expected_stats_addr_len());
 }
 
 /**
@@ -56,7 +57,7 @@ uint32_t pal_sensor_get_expected_stats_addr_high(void)
 **/
 uint32_t pal_sensor_get_expected_stats_addr_len(void)
 {
-    return statistics_address_len_snsr;
+    return PAL_EXPECTED(PDESC_SENSOR_STATS_ADDR_LEN, 0, 0, statistics_address_len_snsr);
 }
 
 #endif
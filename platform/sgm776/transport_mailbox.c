@@ -15,27 +15,36 @@
  * limitations under the License.
  **/
 
-#include <poll.h>
+#include <sys/epoll.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <signal.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <time.h>
 #include <stdint.h>
-#include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <pal_platform.h>
+#include <pal_interface.h>
 
 /* mailbox transport macros and libraries */
-#define MAX_MEMORY_LENGTH 128
 #define REV(x) ((x << 24) | ((x & 0xff00) << 8) | ((x >> 8) & 0xff00) | (x >> 24))
-#define MB_SIGNAL_FILE "/sys/kernel/debug/mailbox/signal"
-#define MB_MESSAGE_FILE "/sys/kernel/debug/mailbox/message"
+#define MB_SIGNAL_FILE "signal"
+#define MB_MESSAGE_FILE "message"
+#define MB_PATH_LENGTH 128
 
 #define NO_ERROR 0
+#define PENDING 1
 #define ERROR 5
 
+/* The mailbox memory is little-endian, messages are marshalled with native word stores */
+#if !defined(__BYTE_ORDER__) || (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+#error "mailbox transport requires a little-endian agent"
+#endif
+
 /* mailbox memory byte offset mapping */
 enum {
     MB_RESERVED =                        0x0,
@@ -56,290 +65,656 @@ enum {
     MB_LENGTH_MESSAGE_HEADER =                  0x4
 } mailbox_byte_length;
 
+/* mailbox memory bits */
+#define MB_CHANNEL_STATUS_FREE   0x1 /* Set by the platform once the response is written */
+#define MB_CHANNEL_STATUS_ERROR  0x2
+#define MB_FLAGS_INTERRUPT       0x1 /* Agent wants a completion interrupt, else it polls */
+
+/* number of 32 bit payload words that fit in mailbox memory of length bytes */
+#define MB_PAYLOAD_WORDS(length) (((length) - MB_MESSAGE_PAYLOAD) / 4)
+#define MB_MAX_PAYLOAD_WORDS     MB_PAYLOAD_WORDS(PAL_CHANNEL_SIZE_MAX)
+
+/* completion engine macros */
+#define MB_RESPONSE_TIMEOUT      1000 /* In ms */
+#define MB_QUEUE_DEPTH           16
+#define MB_NUM_MESSAGE_TYPES     4
+#define MB_MESSAGE_TYPE(header)  (((header) >> 8) & 0x3)
+#define MB_MESSAGE_TOKEN(header) (((header) >> 18) & 0x3ff)
+#define MB_TYPE_COMMAND          0
+#define MB_TYPE_DELAYED_RESPONSE 2
+#define MB_TYPE_NOTIFICATION     3
+
+/* busy-poll completion macros */
+#define MB_SPIN_BUDGET           100 /* In us, default spin before falling back to interrupts */
+#define MB_POLL_SLICE            1   /* In ms, interrupt waits re-check the channel status */
+#define MB_SHMEM_OPTION          "shmem="
+#define MB_SPIN_OPTION           "spin="
+#define MB_SIZE_OPTION           "size="
+
+/* platform message copied out of the mailbox memory */
+struct sgm_mailbox_message {
+    uint32_t num_words;                       // header and payload words
+    uint32_t words[MB_MAX_PAYLOAD_WORDS + 1]; // header followed by payload
+};
+
+/* received messages waiting to be consumed, one queue per message type */
+struct sgm_mailbox_queue {
+    struct sgm_mailbox_message entry[MB_QUEUE_DEPTH];
+    uint32_t head;
+    uint32_t count;
+};
+
+/*
+ * mailbox channel, opened once by sgm_mailbox_open() and reused for every
+ * message. Each channel is a separate mailbox test driver instance, i.e. a
+ * separate agent, and is used by one thread at a time.
+ */
+struct sgm_mailbox_channel {
+    const char *dir; // debugfs directory of the mailbox test driver instance
+    int fd_message;  // mailbox test driver message interface
+    int fd_signal;   // mailbox test driver doorbell interface
+    int fd_epoll;    // completion engine, multiplexes the platform to agent interfaces
+    uint64_t shmem_address;  // physical address of the mailbox memory, 0 if not polled
+    volatile uint8_t *shmem; // mailbox memory mapped for busy-poll completion, else NULL
+    uint32_t stale_header;   // response read by polling, its late interrupt is discarded until the next send
+    struct sgm_mailbox_queue queue[MB_NUM_MESSAGE_TYPES];
+    /* shared memory image used by the send, delayed response and notification paths */
+    uint8_t buffer[PAL_CHANNEL_SIZE_MAX] __attribute__((aligned(8)));
+};
+
+/* Add one entry per additional agent mailbox exposed by the kernel */
+static struct sgm_mailbox_channel g_mailbox_channels[] = {
+    { "/sys/kernel/debug/mailbox", -1, -1, -1 },
+};
+
+/* channel used by the calling thread, see sgm_mailbox_select() */
+static __thread struct sgm_mailbox_channel *g_current_channel = &g_mailbox_channels[0];
+
+/* mailbox memory length of every channel in bytes, see sgm_mailbox_get_channel_size() */
+static uint32_t g_mailbox_length;
+
+/* spin budget of the polled channels, in us */
+static uint32_t g_mailbox_spin_budget = MB_SPIN_BUDGET;
+
+/* how the last command of the calling thread completed, see sgm_mailbox_get_completion_mode() */
+static __thread uint32_t g_completion_mode = PAL_COMPLETION_INTERRUPT;
+
+/* word accessors into the mailbox memory layout, offsets are byte offsets */
+static inline void mb_write_word(struct sgm_mailbox_channel *channel, uint32_t offset,
+        uint32_t value)
+{
+    *(uint32_t *)&channel->buffer[offset] = value;
+}
+
+static inline uint32_t mb_read_word(struct sgm_mailbox_channel *channel, uint32_t offset)
+{
+    return *(const uint32_t *)&channel->buffer[offset];
+}
+
 /*!
- * @brief Interface function that sends a
- * command to mailbox driver interfaces and receives a platform
- * message.
- *
- * This function builds the mailbox message using the data passed in. The
- * format is based on the table of mailbox memory layout described in Section 5.1.2
- * Mailbox Memory in the SCMI specification.
- *
+ * @brief Opens the mailbox driver interfaces of one channel.
  */
-int32_t sgm_send_message(uint32_t message_header_send, size_t parameter_count,
-        const uint32_t *parameters, uint32_t *message_header_rcv, int32_t *status,
-        size_t *return_values_count, uint32_t *return_values)
+static int32_t sgm_mailbox_channel_open(struct sgm_mailbox_channel *channel)
 {
-    /* variables to be used in this function */
-    uint32_t fd_signal, fd_message; // file descriptors for each mailbox interface
-    uint32_t ret = 0; // return polling signal
-    uint8_t *buffer; // pointer to access mailbox memory
-    uint32_t counter;
-    uint32_t *header_payload_length; // pointer to read payload length
-    struct pollfd pfd;
-
-    /* initialise buffer */
-    buffer = (uint8_t *)malloc(MAX_MEMORY_LENGTH);
-    if (buffer == NULL)
+    struct epoll_event event;
+    char path[MB_PATH_LENGTH];
+
+    if (channel->fd_message >= 0)
+        return NO_ERROR;
+
+    snprintf(path, sizeof(path), "%s/%s", channel->dir, MB_MESSAGE_FILE);
+    channel->fd_message = open(path, O_RDWR);
+    if (channel->fd_message < 0)
         return ERROR;
-    memset(buffer, 0x0, MAX_MEMORY_LENGTH);
 
-    /* prepare the message to be sent to mailbox driver interfaces in the following order:
-     *      - RESERVED 1 (skipped as it has already been defaulted to zero)
-     *      - CHANNEL STATUS (skipped as it has already been defaulted to zero)
-     *      - RESERVED 2 (skipped as it has already been defaulted to zero)
-     *      - MAILBOX FLAGS (always set to 1 to indicate completion via an interrupt)
-     *      - LENGTH (this will be particularly useful to dertermine the returned payload length)
-     *      - MESSAGE HEADER (as the data passed in)
-     *      - MESSAGE PAYLOAD (used to hold parameter when sending OR return values upon receipt)
-     * */
+    snprintf(path, sizeof(path), "%s/%s", channel->dir, MB_SIGNAL_FILE);
+    channel->fd_signal = open(path, O_WRONLY);
+    if (channel->fd_signal < 0)
+        return ERROR;
 
-    buffer[MB_FLAGS] = 0x1; // populating MAILBOX_FLAGS
+    channel->fd_epoll = epoll_create1(0);
+    if (channel->fd_epoll < 0)
+        return ERROR;
 
-    buffer[MB_HEADER_PAYLOAD_LENGTH] = 0x04 + (parameter_count * 4); // populating LENGTH (4+N)
+    event.events = EPOLLIN;
+    event.data.fd = channel->fd_message;
+    if (epoll_ctl(channel->fd_epoll, EPOLL_CTL_ADD, channel->fd_message, &event) < 0)
+        return ERROR;
+
+    memset(channel->queue, 0x0, sizeof(channel->queue));
+    channel->stale_header = 0;
 
-    for (counter = 0; counter < 4; ++counter) // populating MESSAGE HEADER (4 bytes)
-    {
-        buffer[MB_MESSAGE_HEADER+counter] = (message_header_send >> (counter * 8)) & 0xFF;
+    /* The test driver only hands over the mailbox memory on an interrupt */
+    if (channel->shmem_address != 0) {
+        channel->shmem = pal_fast_channel_map(channel->shmem_address, g_mailbox_length);
+        if (channel->shmem == NULL) {
+            printf("\nERROR: cannot map the mailbox memory at 0x%" PRIx64 "\n",
+                   channel->shmem_address);
+            return ERROR;
+        }
     }
 
-    if (parameter_count != 0) { // populating MESSAGE PAYLOAD
-        for (counter = 0; counter < (parameter_count * 4); counter += 4) {
-            uint32_t byte_shift;
+    return NO_ERROR;
+}
 
-            for (byte_shift = 0; byte_shift < 4; ++byte_shift) {
-                buffer[MB_MESSAGE_PAYLOAD+counter+byte_shift] =
-                        (parameters[counter/4] >> (byte_shift * 8)) & 0xFF;
-            }
+/*!
+ * @brief Parses the completion options of the mailbox transport, a comma
+ * separated list out of shmem=<address>[+<address>...], the physical
+ * address of the mailbox memory of each channel that completes by busy
+ * polling, spin=<us>, the spin budget of those channels, and size=<bytes>,
+ * the length of the mailbox memory of every channel.
+ */
+static int32_t sgm_mailbox_parse_options(const char *options)
+{
+    const char *option = options;
+    uint32_t channel_id = 0;
+    char *end;
+
+    while ((option != NULL) && (*option != '\0')) {
+        if (strncmp(option, MB_SHMEM_OPTION, strlen(MB_SHMEM_OPTION)) == 0) {
+            end = (char *)option + strlen(MB_SHMEM_OPTION) - 1;
+            do {
+                if (channel_id == NUM_ELEMS(g_mailbox_channels))
+                    return ERROR;
+                g_mailbox_channels[channel_id++].shmem_address = strtoull(end + 1, &end, 0);
+            } while (*end == '+');
+        } else if (strncmp(option, MB_SPIN_OPTION, strlen(MB_SPIN_OPTION)) == 0) {
+            g_mailbox_spin_budget = strtoul(option + strlen(MB_SPIN_OPTION), &end, 0);
+        } else if (strncmp(option, MB_SIZE_OPTION, strlen(MB_SIZE_OPTION)) == 0) {
+            g_mailbox_length = strtoul(option + strlen(MB_SIZE_OPTION), &end, 0);
+            if ((g_mailbox_length < PAL_CHANNEL_SIZE_MIN) ||
+                (g_mailbox_length > PAL_CHANNEL_SIZE_MAX) || (g_mailbox_length % 4 != 0))
+                return ERROR;
+        } else {
+            return ERROR;
         }
+
+        if ((*end != ',') && (*end != '\0'))
+            return ERROR;
+        option = (*end == ',') ? end + 1 : NULL;
     }
 
-    /* Send message to the mailbox driver interface
-     * defined by the MB_MESSAGE_FILE macro
-     * */
-    fd_message = open(MB_MESSAGE_FILE, 0x0002);
-    if (fd_message < 0) {
-        free(buffer);
+    return NO_ERROR;
+}
+
+/*!
+ * @brief Interface function that opens the mailbox driver interfaces.
+ *
+ * The message and signal files are opened once and kept open for the whole
+ * run. The debugfs files of the mailbox test driver cannot be mapped, so
+ * every transfer is done with pread/pwrite at offset zero on the persistent
+ * descriptors. Channels given a mailbox memory address in the options have
+ * that memory mapped as well, see sgm_mailbox_parse_options(). Without a
+ * size option the mailbox memory is as long as pal_get_channel_size() says.
+ *
+ */
+int32_t sgm_mailbox_open(const char *options)
+{
+    uint32_t channel_id;
+
+    g_mailbox_length = 0;
+    if (sgm_mailbox_parse_options(options) != NO_ERROR) {
+        printf("\nERROR: invalid mailbox options %s\n", options);
         return ERROR;
     }
-    write(fd_message, buffer, MAX_MEMORY_LENGTH);
 
-    /* Send Signal to the mailbox driver interface
-     * defined by the MB_SIGNAL_FILE macro
-     * */
-    fd_signal = open(MB_SIGNAL_FILE, 0x0001);
-    if (fd_signal < 0) {
-        free(buffer);
-        return ERROR;
+    if (g_mailbox_length == 0)
+        g_mailbox_length = pal_get_channel_size();
+
+    for (channel_id = 0; channel_id < NUM_ELEMS(g_mailbox_channels); channel_id++) {
+        if (sgm_mailbox_channel_open(&g_mailbox_channels[channel_id]) != NO_ERROR) {
+            sgm_mailbox_close();
+            return ERROR;
+        }
     }
-    memset(buffer, 0x0, MAX_MEMORY_LENGTH);
-    buffer[0] = 0x01;
-    write(fd_signal, buffer, 1);
-
-    /* polling */
-    pfd.fd = fd_message;
-    pfd.revents = POLLIN;
-    ret = poll(&pfd, 1, 1000);
-
-    // non-negative indicates successful completion
-    if (ret < 0) {
-        free(buffer);
-        return ERROR;
+
+    return NO_ERROR;
+}
+
+/*!
+ * @brief Interface function that closes the mailbox driver interfaces.
+ */
+void sgm_mailbox_close(void)
+{
+    struct sgm_mailbox_channel *channel;
+    uint32_t channel_id;
+
+    for (channel_id = 0; channel_id < NUM_ELEMS(g_mailbox_channels); channel_id++) {
+        channel = &g_mailbox_channels[channel_id];
+
+        if (channel->fd_epoll >= 0)
+            close(channel->fd_epoll);
+        if (channel->fd_signal >= 0)
+            close(channel->fd_signal);
+        if (channel->fd_message >= 0)
+            close(channel->fd_message);
+        if (channel->shmem != NULL)
+            pal_fast_channel_unmap((void *)channel->shmem, g_mailbox_length);
+
+        channel->shmem = NULL;
+        channel->fd_epoll = -1;
+        channel->fd_signal = -1;
+        channel->fd_message = -1;
     }
+}
+
+/*!
+ * @brief Interface function that returns the number of mailbox channels.
+ */
+uint32_t sgm_mailbox_get_num_channels(void)
+{
+    return NUM_ELEMS(g_mailbox_channels);
+}
+
+/*!
+ * @brief Interface function that binds the calling thread to a channel.
+ */
+int32_t sgm_mailbox_select(uint32_t channel_id)
+{
+    if (channel_id >= NUM_ELEMS(g_mailbox_channels))
+        return ERROR;
+
+    g_current_channel = &g_mailbox_channels[channel_id];
+    return NO_ERROR;
+}
+
+/*!
+ * @brief Interface function that returns the length of the mailbox memory,
+ * 0 until the transport is open.
+ */
+uint32_t sgm_mailbox_get_channel_size(void)
+{
+    return g_mailbox_length;
+}
+
+/*!
+ * @brief Interface function that returns how the last command of the
+ * calling thread completed, PAL_COMPLETION_POLL or _INTERRUPT.
+ */
+uint32_t sgm_mailbox_get_completion_mode(void)
+{
+    return g_completion_mode;
+}
+
+/*!
+ * @brief Returns the monotonic time in ms.
+ */
+static uint64_t sgm_mailbox_time_ms(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000) + (now.tv_nsec / 1000000);
+}
+
+/*!
+ * @brief Returns the monotonic time in us.
+ */
+static uint64_t sgm_mailbox_time_us(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000) + (now.tv_nsec / 1000);
+}
+
+/*!
+ * @brief Waits up to timeout ms for a platform message, reads it from the
+ * mailbox memory and queues it according to its message type.
+ */
+static int32_t sgm_mailbox_receive(struct sgm_mailbox_channel *channel, int timeout)
+{
+    struct epoll_event event;
+    struct sgm_mailbox_queue *queue;
+    struct sgm_mailbox_message *message;
+    uint32_t num_words;
+    uint32_t header;
+
+    if (epoll_wait(channel->fd_epoll, &event, 1, timeout) <= 0)
+        return ERROR;
 
     /* read returned message into the buffer */
-    read(fd_message, buffer, MAX_MEMORY_LENGTH);
+    if (pread(channel->fd_message, channel->buffer, g_mailbox_length, 0) < 0)
+        return ERROR;
 
-    /* Extract bytes using an uint32_t pointer. */
-    header_payload_length = (uint32_t *) &buffer[MB_HEADER_PAYLOAD_LENGTH];
+    /* LENGTH covers the header and the payload */
+    num_words = mb_read_word(channel, MB_HEADER_PAYLOAD_LENGTH) / 4;
+    if (num_words == 0)
+        return ERROR;
+    if (num_words > (MB_PAYLOAD_WORDS(g_mailbox_length) + 1))
+        num_words = MB_PAYLOAD_WORDS(g_mailbox_length) + 1;
 
-    /* read the payload part */
-    for (counter = 0; counter < (*(header_payload_length) / 4); ++counter) {
-        if (counter == 0) {
-            // extract header
-            // plus 1 to skip the Length
-            *message_header_rcv = *(header_payload_length + 1 + counter);
-        }
-        else if (counter == 1) {
-            // extract status
-            // plus 1 to skip the Length
-            *status = *(header_payload_length + 1 + counter);
+    header = mb_read_word(channel, MB_MESSAGE_HEADER);
+
+    /* Interrupt of a response already read by polling */
+    if ((channel->stale_header != 0) && (header == channel->stale_header)) {
+        channel->stale_header = 0;
+        return NO_ERROR;
+    }
+
+    queue = &channel->queue[MB_MESSAGE_TYPE(header)];
+    /* Nobody is consuming this type, drop the message rather than failing
+       the wait in progress for another type */
+    if (queue->count == MB_QUEUE_DEPTH) {
+        printf("\nWARNING: dropped message 0x%08x, queue full\n", header);
+        return NO_ERROR;
+    }
+
+    message = &queue->entry[(queue->head + queue->count) % MB_QUEUE_DEPTH];
+    message->num_words = num_words;
+    memcpy(message->words, &channel->buffer[MB_MESSAGE_HEADER], num_words * 4);
+    queue->count++;
+
+    return NO_ERROR;
+}
+
+/*!
+ * @brief Removes a message from the queue of the given type. When match is
+ * set only a message carrying exactly that header is taken, otherwise the
+ * oldest one is.
+ */
+static int32_t sgm_mailbox_dequeue(struct sgm_mailbox_channel *channel, uint32_t type,
+        bool match, uint32_t header, struct sgm_mailbox_message *message)
+{
+    struct sgm_mailbox_queue *queue = &channel->queue[type];
+    uint32_t index, slot, next;
+
+    for (index = 0; index < queue->count; index++) {
+        slot = (queue->head + index) % MB_QUEUE_DEPTH;
+        if (match && (queue->entry[slot].words[0] != header))
+            continue;
+
+        *message = queue->entry[slot];
+
+        /* close the gap left by the message */
+        for (; index > 0; index--) {
+            next = slot;
+            slot = (slot + MB_QUEUE_DEPTH - 1) % MB_QUEUE_DEPTH;
+            queue->entry[next] = queue->entry[slot];
         }
-        else {
-            // extract payload
-            // plus 1 to skip the Length
-            // return_values starts from 0, hence subtract 2 here
-            return_values[(counter - 2)] = *(header_payload_length + 1 + counter);
-            (*return_values_count)++;
+        queue->head = (queue->head + 1) % MB_QUEUE_DEPTH;
+        queue->count--;
+        return NO_ERROR;
+    }
+
+    return ERROR;
+}
+
+/*!
+ * @brief Drops the queued command responses that do not answer the command
+ * sent with header. A channel carries one command at a time, so a response
+ * with another token has no outstanding command, e.g. the late response of
+ * a command that timed out, and is reported as stale. A response with the
+ * same token but another header answers the command wrongly and fails it.
+ */
+static int32_t sgm_mailbox_drop_stale(struct sgm_mailbox_channel *channel, uint32_t header)
+{
+    struct sgm_mailbox_queue *queue = &channel->queue[MB_TYPE_COMMAND];
+    uint32_t index, slot, kept = 0;
+    int32_t status = NO_ERROR;
+    uint32_t received;
+
+    for (index = 0; index < queue->count; index++) {
+        slot = (queue->head + index) % MB_QUEUE_DEPTH;
+        received = queue->entry[slot].words[0];
+
+        if (received == header) {
+            queue->entry[(queue->head + kept++) % MB_QUEUE_DEPTH] = queue->entry[slot];
+        } else if (MB_MESSAGE_TOKEN(received) != MB_MESSAGE_TOKEN(header)) {
+            printf("\nWARNING: dropped stale response 0x%08x\n", received);
+        } else {
+            printf("\nERROR: response 0x%08x does not match command 0x%08x\n",
+                   received, header);
+            status = ERROR;
         }
     }
-    free(buffer);
-    return NO_ERROR;
+    queue->count = kept;
+
+    return status;
 }
 
 /*!
- * @brief Interface function that waits for
- * delayed response.
+ * @brief Completion engine entry point. Returns an already queued message
+ * of the requested type without touching the mailbox, otherwise keeps
+ * receiving and demultiplexing platform messages until one arrives or the
+ * timeout expires. When match is set stale command responses are dropped
+ * while waiting, and the wait fails rather than handing back a response
+ * to another command.
  */
-int sgm_wait_for_response(uint32_t *message_header_rcv,
-        int32_t *status, size_t *return_values_count, uint32_t *return_values,
-        bool *message_ready, uint32_t timeout)
+static int32_t sgm_mailbox_wait(struct sgm_mailbox_channel *channel, uint32_t type,
+        bool match, uint32_t header, uint32_t timeout, struct sgm_mailbox_message *message)
 {
-    /* variables to be used in this function */
-    uint32_t fd_message; // file descriptors for each mailbox interface
-    uint32_t ret = 0; // return polling signal
-    uint8_t *buffer; // pointer to access mailbox memory
-    uint32_t counter;
-    uint32_t *header_payload_length; // pointer to read payload length
-    struct pollfd pfd;
-
-    /* initialise buffer */
-    buffer = (uint8_t *)malloc(MAX_MEMORY_LENGTH);
-    if (buffer == NULL)
+    uint64_t deadline = sgm_mailbox_time_ms() + timeout;
+    uint64_t now;
+
+    if (channel->fd_epoll < 0)
         return ERROR;
-    memset(buffer, 0x0, MAX_MEMORY_LENGTH);
 
-    /* prepare the message to be sent to mailbox driver interfaces in the following order:
-     *      - RESERVED 1 (skipped as it has already been defaulted to zero)
-     *      - CHANNEL STATUS (skipped as it has already been defaulted to zero)
-     *      - RESERVED 2 (skipped as it has already been defaulted to zero)
-     *      - MAILBOX FLAGS (always set to 1 to indicate completion via an interrupt)
-     *      - LENGTH (this will be particularly useful to dertermine the returned payload length)
-     *      - MESSAGE HEADER (as the data passed in)
-     *      - MESSAGE PAYLOAD (used to hold parameter when sending OR return values upon receipt)
-     * */
+    while (sgm_mailbox_dequeue(channel, type, match, header, message) != NO_ERROR) {
+        if (match && (sgm_mailbox_drop_stale(channel, header) != NO_ERROR))
+            return ERROR;
 
-    buffer[MB_FLAGS] = 0x1; // populating MAILBOX_FLAGS
+        now = sgm_mailbox_time_ms();
+        if ((now >= deadline) || (sgm_mailbox_receive(channel, deadline - now) != NO_ERROR))
+            return ERROR;
+    }
 
-    /* Send message to the mailbox driver interface
-     * defined by the MB_MESSAGE_FILE macro
-     * */
-    fd_message = open(MB_MESSAGE_FILE, 0x0002);
-    if (fd_message < 0) {
-        free(buffer);
-        return ERROR;
+    return NO_ERROR;
+}
+
+/*!
+ * @brief Extracts header, status and payload of a received message. status
+ * is NULL for notifications, which carry no status. The payload is bounded
+ * by the capacity the caller gives in return_values_count.
+ */
+static void sgm_mailbox_extract(const struct sgm_mailbox_message *message,
+        uint32_t *message_header_rcv, int32_t *status,
+        size_t *return_values_count, uint32_t *return_values)
+{
+    uint32_t num_words = message->num_words - 1;
+    uint32_t offset = 1;
+
+    *message_header_rcv = message->words[0];
+
+    if ((status != NULL) && (num_words != 0)) {
+        *status = (int32_t)message->words[offset++];
+        num_words--;
     }
 
-    /* polling */
-    pfd.fd = fd_message;
-    pfd.revents = POLLIN;
-    ret = poll(&pfd, 1, timeout);
+    if (num_words > *return_values_count)
+        num_words = *return_values_count;
 
-    // non-negative indicates successful completion
-    if (ret < 0) {
-        free(buffer);
+    memcpy(return_values, &message->words[offset], num_words * 4);
+    *return_values_count = num_words;
+}
+
+/*!
+ * @brief Reads the response of a polled channel out of the mailbox memory,
+ * once the platform has marked the channel free. Returns PENDING while the
+ * platform owns the channel.
+ */
+static int32_t sgm_mailbox_shmem_read(struct sgm_mailbox_channel *channel,
+        struct sgm_mailbox_message *message)
+{
+    volatile const uint32_t *words = (volatile const uint32_t *)channel->shmem;
+    uint32_t status = words[MB_CHANNEL_STATUS / 4];
+    uint32_t index;
+
+    if (status & MB_CHANNEL_STATUS_ERROR)
         return ERROR;
-    }
+    if (!(status & MB_CHANNEL_STATUS_FREE))
+        return PENDING;
 
-    /* read returned message into the buffer */
-    read(fd_message, buffer, MAX_MEMORY_LENGTH);
+    __atomic_thread_fence(__ATOMIC_ACQUIRE); /* The response is read after the status */
 
-    /* Extract bytes using an uint32_t pointer. */
-    header_payload_length = (uint32_t *) &buffer[MB_HEADER_PAYLOAD_LENGTH];
+    /* LENGTH covers the header and the payload */
+    message->num_words = words[MB_HEADER_PAYLOAD_LENGTH / 4] / 4;
+    if (message->num_words == 0)
+        return ERROR;
+    if (message->num_words > (MB_PAYLOAD_WORDS(g_mailbox_length) + 1))
+        message->num_words = MB_PAYLOAD_WORDS(g_mailbox_length) + 1;
 
-    /* read the payload part */
-    for (counter = 0; counter < (*(header_payload_length) / 4); ++counter) {
-        if (counter == 0) {
-            // extract header
-            // plus 1 to skip the Length
-            *message_header_rcv = *(header_payload_length + 1 + counter);
-        }
-        else if (counter == 1) {
-            // extract status
-            // plus 1 to skip the Length
-            *status = *(header_payload_length + 1 + counter);
-        }
-        else {
-            // extract payload
-            // plus 1 to skip the Length
-            // return_values starts from 0, hence subtract 2 here
-            return_values[(counter - 2)] = *(header_payload_length + 1 + counter);
-            (*return_values_count)++;
+    for (index = 0; index < message->num_words; index++)
+        message->words[index] = words[(MB_MESSAGE_HEADER / 4) + index];
+
+    return NO_ERROR;
+}
+
+/*!
+ * @brief Busy-poll completion. Spins on the channel status in the mailbox
+ * memory for the spin budget. Past it, asks the platform for an interrupt
+ * and sleeps on the message interface, still checking the channel status
+ * in case the platform completed before it saw the request.
+ */
+static int32_t sgm_mailbox_poll(struct sgm_mailbox_channel *channel, uint32_t header,
+        struct sgm_mailbox_message *message)
+{
+    uint64_t deadline = sgm_mailbox_time_us() + g_mailbox_spin_budget;
+    int32_t status;
+
+    g_completion_mode = PAL_COMPLETION_POLL;
+    do {
+        status = sgm_mailbox_shmem_read(channel, message);
+        if (status != PENDING)
+            return status;
+    } while (sgm_mailbox_time_us() < deadline);
+
+    __atomic_store_n((volatile uint32_t *)&channel->shmem[MB_FLAGS], MB_FLAGS_INTERRUPT,
+                     __ATOMIC_SEQ_CST);
+
+    deadline = sgm_mailbox_time_ms() + MB_RESPONSE_TIMEOUT;
+    while (sgm_mailbox_dequeue(channel, MB_TYPE_COMMAND, true, header, message) != NO_ERROR) {
+        status = sgm_mailbox_shmem_read(channel, message);
+        if (status != PENDING) {
+            channel->stale_header = header;
+            return status;
         }
-    }
 
-    free(buffer);
+        if (sgm_mailbox_drop_stale(channel, header) != NO_ERROR)
+            return ERROR;
+
+        if (sgm_mailbox_time_ms() >= deadline)
+            return ERROR;
+
+        sgm_mailbox_receive(channel, MB_POLL_SLICE);
+    }
 
+    g_completion_mode = PAL_COMPLETION_INTERRUPT;
     return NO_ERROR;
 }
 
 /*!
- * @brief Interface function that waits for
- * notification.
+ * @brief Interface function that sends a
+ * command to mailbox driver interfaces and receives a platform
+ * message.
+ *
+ * This function builds the mailbox message using the data passed in. The
+ * format is based on the table of mailbox memory layout described in Section 5.1.2
+ * Mailbox Memory in the SCMI specification.
+ *
  */
-int sgm_wait_for_notification(uint32_t *message_header_rcv,
-        size_t *return_values_count, uint32_t *return_values,
-        uint32_t timeout)
+int32_t sgm_send_message(uint32_t message_header_send, size_t parameter_count,
+        const uint32_t *parameters, uint32_t *message_header_rcv, int32_t *status,
+        size_t *return_values_count, uint32_t *return_values)
 {
-    /* variables to be used in this function */
-    uint32_t fd_message; // file descriptors for each mailbox interface
-    uint32_t ret = 0; // return polling signal
-    uint8_t *buffer; // pointer to access mailbox memory
-    uint32_t counter;
-    uint32_t *header_payload_length; // pointer to read payload length
-    struct pollfd pfd;
-
-    /* initialise buffer */
-    buffer = (uint8_t *)malloc(MAX_MEMORY_LENGTH);
-    if (buffer == NULL)
+    static const uint8_t doorbell = 0x01;
+    struct sgm_mailbox_channel *channel = g_current_channel;
+    struct sgm_mailbox_message message;
+    uint8_t *buffer = channel->buffer;
+
+    if (channel->fd_message < 0)
+        return ERROR;
+
+    if (parameter_count > MB_PAYLOAD_WORDS(g_mailbox_length))
         return ERROR;
-    memset(buffer, 0x0, MAX_MEMORY_LENGTH);
+
+    /* The late interrupt of the previous command is only discarded until this
+       one is sent, later it is dropped as a stale response. Kept longer, it
+       would swallow the response of a command reusing the header once the
+       token wraps. */
+    channel->stale_header = 0;
 
     /* prepare the message to be sent to mailbox driver interfaces in the following order:
-     *      - RESERVED 1 (skipped as it has already been defaulted to zero)
-     *      - CHANNEL STATUS (skipped as it has already been defaulted to zero)
-     *      - RESERVED 2 (skipped as it has already been defaulted to zero)
-     *      - MAILBOX FLAGS (always set to 1 to indicate completion via an interrupt)
+     *      - RESERVED 1 (zero)
+     *      - CHANNEL STATUS (zero)
+     *      - RESERVED 2 (zero)
+     *      - MAILBOX FLAGS (1 to indicate completion via an interrupt, 0 on polled channels)
      *      - LENGTH (this will be particularly useful to dertermine the returned payload length)
      *      - MESSAGE HEADER (as the data passed in)
      *      - MESSAGE PAYLOAD (used to hold parameter when sending OR return values upon receipt)
      * */
 
-    buffer[MB_FLAGS] = 0x1; // populating MAILBOX_FLAGS
+    memset(buffer, 0x0, MB_FLAGS);
+    mb_write_word(channel, MB_FLAGS, (channel->shmem != NULL) ? 0 : MB_FLAGS_INTERRUPT);
+    mb_write_word(channel, MB_HEADER_PAYLOAD_LENGTH, 0x04 + (parameter_count * 4)); // LENGTH (4+N)
+    mb_write_word(channel, MB_MESSAGE_HEADER, message_header_send);
+    if (parameter_count != 0)
+        memcpy(&buffer[MB_MESSAGE_PAYLOAD], parameters, parameter_count * 4);
 
     /* Send message to the mailbox driver interface
      * defined by the MB_MESSAGE_FILE macro
      * */
-    fd_message = open(MB_MESSAGE_FILE, 0x0002);
-    if (fd_message < 0) {
-        free(buffer);
+    if (pwrite(channel->fd_message, buffer, g_mailbox_length, 0) < 0)
         return ERROR;
+
+    /* Send Signal to the mailbox driver interface
+     * defined by the MB_SIGNAL_FILE macro
+     * */
+    if (pwrite(channel->fd_signal, &doorbell, sizeof(doorbell), 0) < 0)
+        return ERROR;
+
+    if (channel->shmem != NULL) {
+        if (sgm_mailbox_poll(channel, message_header_send, &message) != NO_ERROR)
+            return ERROR;
+    } else {
+        g_completion_mode = PAL_COMPLETION_INTERRUPT;
+        if (sgm_mailbox_wait(channel, MB_TYPE_COMMAND, true, message_header_send,
+                             MB_RESPONSE_TIMEOUT, &message) != NO_ERROR)
+            return ERROR;
     }
 
-    /* polling */
-    pfd.fd = fd_message;
-    pfd.revents = POLLIN;
-    ret = poll(&pfd, 1, timeout);
+    sgm_mailbox_extract(&message, message_header_rcv, status, return_values_count,
+                        return_values);
 
-    // non-negative indicates successful completion
-    if (ret < 0) {
-        free(buffer);
+    return NO_ERROR;
+}
+
+/*!
+ * @brief Interface function that waits for
+ * delayed response.
+ */
+int sgm_wait_for_response(uint32_t *message_header_rcv,
+        int32_t *status, size_t *return_values_count, uint32_t *return_values,
+        bool *message_ready, uint32_t timeout)
+{
+    struct sgm_mailbox_message message;
+
+    if (sgm_mailbox_wait(g_current_channel, MB_TYPE_DELAYED_RESPONSE, false, 0, timeout,
+                         &message) != NO_ERROR)
         return ERROR;
-    }
 
-    /* read returned message into the buffer */
-    read(fd_message, buffer, MAX_MEMORY_LENGTH);
+    sgm_mailbox_extract(&message, message_header_rcv, status, return_values_count,
+                        return_values);
 
-    /* Extract bytes using an uint32_t pointer. */
-    header_payload_length = (uint32_t *) &buffer[MB_HEADER_PAYLOAD_LENGTH];
+    return NO_ERROR;
+}
 
-    /* read the payload part */
-    for (counter = 0; counter < (*(header_payload_length) / 4); ++counter) {
-        if (counter == 0) {
-            // extract header
-            // plus 1 to skip the Length
-            *message_header_rcv = *(header_payload_length + 1 + counter);
-        }
-        else {
-            // extract payload
-            // plus 1 to skip the Length
-            // return_values starts from 0, hence subtract 2 here
-            return_values[(counter - 2)] = *(header_payload_length + 1 + counter);
-            (*return_values_count)++;
-        }
-    }
+/*!
+ * @brief Interface function that waits for
+ * notification.
+ */
+int sgm_wait_for_notification(uint32_t *message_header_rcv,
+        size_t *return_values_count, uint32_t *return_values,
+        uint32_t timeout)
+{
+    struct sgm_mailbox_message message;
+
+    if (sgm_mailbox_wait(g_current_channel, MB_TYPE_NOTIFICATION, false, 0, timeout,
+                         &message) != NO_ERROR)
+        return ERROR;
 
-    free(buffer);
+    sgm_mailbox_extract(&message, message_header_rcv, NULL, return_values_count,
+                        return_values);
 
     return NO_ERROR;
 }
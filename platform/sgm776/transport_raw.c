@@ -0,0 +1,509 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <poll.h>
+#include <time.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <pal_platform.h>
+#include <pal_interface.h>
+#include <scmi_codec.h>
+
+#define NO_ERROR 0
+#define ERROR 5
+
+/* The raw interface carries little-endian messages, they are copied as native words */
+#if !defined(__BYTE_ORDER__) || (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+#error "raw transport requires a little-endian agent"
+#endif
+
+#define RAW_PATH_LENGTH          128
+#define RAW_MAX_CHANNELS         4
+#define RAW_MAX_MESSAGE_WORDS    (PAL_CHANNEL_SIZE_MAX / 4) /* header, status and payload */
+
+/* completion engine macros */
+#define RAW_RESPONSE_TIMEOUT     1000 /* In ms */
+#define RAW_QUEUE_DEPTH          16
+#define RAW_NUM_MESSAGE_TYPES    4
+
+/* raw mode files of a kernel SCMI instance, see the kernel debugfs-scmi-raw ABI */
+enum {
+    RAW_FILE_MESSAGE,       // synchronous commands and their responses
+    RAW_FILE_MESSAGE_ASYNC, // asynchronous commands, their responses and delayed responses
+    RAW_FILE_NOTIFICATION,  // notifications
+    RAW_FILE_ERRORS,        // late and unexpected platform messages
+    RAW_NUM_FILES
+};
+
+static const char * const g_raw_file_names[RAW_NUM_FILES] = {
+    "message", "message_async", "notification", "errors"
+};
+
+/* platform message read from one of the raw files */
+struct sgm_raw_message {
+    uint32_t num_words;                        // header and payload words
+    uint32_t words[RAW_MAX_MESSAGE_WORDS];     // header followed by payload
+};
+
+/* received messages waiting to be consumed, one queue per message type */
+struct sgm_raw_queue {
+    struct sgm_raw_message entry[RAW_QUEUE_DEPTH];
+    uint32_t head;
+    uint32_t count;
+};
+
+/*
+ * raw channel, opened once by sgm_raw_open() and reused for every message.
+ * Each channel is a separate kernel SCMI instance, i.e. a separate agent,
+ * and is used by one thread at a time. The replies of an instance are
+ * queued by the kernel for whichever reader comes first, so an instance
+ * cannot be shared by two channels.
+ */
+struct sgm_raw_channel {
+    char dir[RAW_PATH_LENGTH]; // raw directory of the instance
+    int fd[RAW_NUM_FILES];
+    struct sgm_raw_queue queue[RAW_NUM_MESSAGE_TYPES];
+};
+
+static struct sgm_raw_channel g_raw_channels[RAW_MAX_CHANNELS];
+static uint32_t g_raw_num_channels;
+
+/* channel used by the calling thread, see sgm_raw_select() */
+static __thread struct sgm_raw_channel *g_current_channel = &g_raw_channels[0];
+
+/*!
+ * @brief Opens the raw files of one channel.
+ */
+static int32_t sgm_raw_channel_open(struct sgm_raw_channel *channel)
+{
+    char path[RAW_PATH_LENGTH + 16];
+    uint32_t file;
+
+    for (file = 0; file < RAW_NUM_FILES; file++) {
+        snprintf(path, sizeof(path), "%s/%s", channel->dir, g_raw_file_names[file]);
+        channel->fd[file] = open(path, (file <= RAW_FILE_MESSAGE_ASYNC) ? O_RDWR : O_RDONLY);
+        if (channel->fd[file] < 0) {
+            printf("\nERROR: cannot open %s\n", path);
+            return ERROR;
+        }
+    }
+
+    memset(channel->queue, 0x0, sizeof(channel->queue));
+    return NO_ERROR;
+}
+
+/*!
+ * @brief Interface function that opens the raw mode interfaces.
+ *
+ * dirs is a comma separated list of raw directories, one per channel, an
+ * empty list opens SGM_RAW_DEFAULT_DIR. The files are opened once and kept
+ * open for the whole run.
+ *
+ */
+int32_t sgm_raw_open(const char *dirs)
+{
+    struct sgm_raw_channel *channel;
+    const char *dir = ((dirs != NULL) && (*dirs != '\0')) ? dirs : SGM_RAW_DEFAULT_DIR;
+    size_t length;
+    uint32_t file;
+
+    g_raw_num_channels = 0;
+    while (*dir != '\0') {
+        length = strcspn(dir, ",");
+        if ((g_raw_num_channels == RAW_MAX_CHANNELS) || (length == 0) ||
+            (length >= RAW_PATH_LENGTH)) {
+            printf("\nERROR: invalid raw directories %s\n", dirs);
+            sgm_raw_close();
+            return ERROR;
+        }
+
+        channel = &g_raw_channels[g_raw_num_channels++];
+        for (file = 0; file < RAW_NUM_FILES; file++)
+            channel->fd[file] = -1;
+        memcpy(channel->dir, dir, length);
+        channel->dir[length] = '\0';
+
+        if (sgm_raw_channel_open(channel) != NO_ERROR) {
+            sgm_raw_close();
+            return ERROR;
+        }
+
+        dir += length + (dir[length] == ',');
+    }
+
+    return NO_ERROR;
+}
+
+/*!
+ * @brief Interface function that closes the raw mode interfaces.
+ */
+void sgm_raw_close(void)
+{
+    struct sgm_raw_channel *channel;
+    uint32_t channel_id;
+    uint32_t file;
+
+    for (channel_id = 0; channel_id < g_raw_num_channels; channel_id++) {
+        channel = &g_raw_channels[channel_id];
+
+        for (file = 0; file < RAW_NUM_FILES; file++) {
+            if (channel->fd[file] >= 0)
+                close(channel->fd[file]);
+            channel->fd[file] = -1;
+        }
+    }
+
+    g_raw_num_channels = 0;
+}
+
+/*!
+ * @brief Interface function that returns the number of raw channels.
+ */
+uint32_t sgm_raw_get_num_channels(void)
+{
+    return g_raw_num_channels;
+}
+
+/*!
+ * @brief Interface function that binds the calling thread to a channel.
+ */
+int32_t sgm_raw_select(uint32_t channel_id)
+{
+    if (channel_id >= g_raw_num_channels)
+        return ERROR;
+
+    g_current_channel = &g_raw_channels[channel_id];
+    return NO_ERROR;
+}
+
+/*!
+ * @brief Returns the monotonic time in ms.
+ */
+static uint64_t sgm_raw_time_ms(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000) + (now.tv_nsec / 1000000);
+}
+
+/*!
+ * @brief Tells whether a command asks for a delayed response. Those go
+ * through message_async, so that the kernel keeps the delayed response for
+ * a later read instead of reporting it as unexpected.
+ */
+static bool sgm_raw_is_async(uint32_t header, size_t parameter_count,
+        const uint32_t *parameters)
+{
+    uint32_t protocol_id = scmi_codec_protocol_id(header);
+    uint32_t message_id = scmi_codec_message_id(header);
+
+    if ((protocol_id == SCMI_POWER_DOMAIN_PROTOCOL_ID) &&
+        (message_id == SCMI_POWER_DOMAIN_STATE_SET_MSG_ID) &&
+        (parameter_count > SCMI_POWER_DOMAIN_STATE_SET_PARAM_FLAGS))
+        return scmi_power_domain_state_set_flags_async(
+                parameters[SCMI_POWER_DOMAIN_STATE_SET_PARAM_FLAGS]);
+
+    if ((protocol_id == SCMI_CLOCK_PROTOCOL_ID) &&
+        (message_id == SCMI_CLOCK_RATE_SET_MSG_ID) &&
+        (parameter_count > SCMI_CLOCK_RATE_SET_PARAM_FLAGS))
+        return scmi_clock_rate_set_flags_async(parameters[SCMI_CLOCK_RATE_SET_PARAM_FLAGS]);
+
+    if ((protocol_id == SCMI_SENSOR_PROTOCOL_ID) &&
+        (message_id == SCMI_SENSOR_READING_GET_MSG_ID) &&
+        (parameter_count > SCMI_SENSOR_READING_GET_PARAM_FLAGS))
+        return scmi_sensor_reading_get_flags_async(
+                parameters[SCMI_SENSOR_READING_GET_PARAM_FLAGS]);
+
+    if ((protocol_id == SCMI_RESET_PROTOCOL_ID) &&
+        (message_id == SCMI_RESET_RESET_MSG_ID) &&
+        (parameter_count > SCMI_RESET_RESET_PARAM_FLAGS))
+        return scmi_reset_reset_flags_async(parameters[SCMI_RESET_RESET_PARAM_FLAGS]);
+
+    return false;
+}
+
+/*!
+ * @brief Reads one message from a raw file and queues it according to its
+ * message type. A raw file returns one message per read, followed by an
+ * end of file that marks the message boundary and is skipped.
+ */
+static int32_t sgm_raw_read(struct sgm_raw_channel *channel, int fd)
+{
+    struct sgm_raw_queue *queue;
+    struct sgm_raw_message *message;
+    uint32_t words[RAW_MAX_MESSAGE_WORDS];
+    ssize_t length;
+
+    do {
+        length = read(fd, words, sizeof(words));
+    } while (length == 0);
+
+    if (length < (ssize_t)sizeof(uint32_t))
+        return ERROR;
+
+    queue = &channel->queue[scmi_codec_type(words[0])];
+    /* Nobody is consuming this type, drop the message rather than failing
+       the wait in progress for another type */
+    if (queue->count == RAW_QUEUE_DEPTH) {
+        printf("\nWARNING: dropped message 0x%08x, queue full\n", words[0]);
+        return NO_ERROR;
+    }
+
+    message = &queue->entry[(queue->head + queue->count) % RAW_QUEUE_DEPTH];
+    message->num_words = length / 4;
+    memcpy(message->words, words, message->num_words * 4);
+    queue->count++;
+
+    return NO_ERROR;
+}
+
+/*!
+ * @brief Waits up to timeout ms for platform messages on any raw file of
+ * the channel and queues the ones that are ready. Responses to commands
+ * that the kernel gave up on arrive on the errors file, they are queued
+ * like any other so that the command they answer still completes.
+ */
+static int32_t sgm_raw_receive(struct sgm_raw_channel *channel, int timeout)
+{
+    struct pollfd fds[RAW_NUM_FILES];
+    uint32_t file;
+    int32_t status = ERROR;
+
+    for (file = 0; file < RAW_NUM_FILES; file++) {
+        fds[file].fd = channel->fd[file];
+        fds[file].events = POLLIN;
+    }
+
+    if (poll(fds, RAW_NUM_FILES, timeout) <= 0)
+        return ERROR;
+
+    for (file = 0; file < RAW_NUM_FILES; file++) {
+        if ((fds[file].revents & POLLIN) && (sgm_raw_read(channel, fds[file].fd) == NO_ERROR))
+            status = NO_ERROR;
+    }
+
+    return status;
+}
+
+/*!
+ * @brief Removes a message from the queue of the given type. When match is
+ * set only a message carrying exactly that header is taken, otherwise the
+ * oldest one is.
+ */
+static int32_t sgm_raw_dequeue(struct sgm_raw_channel *channel, uint32_t type,
+        bool match, uint32_t header, struct sgm_raw_message *message)
+{
+    struct sgm_raw_queue *queue = &channel->queue[type];
+    uint32_t index, slot, next;
+
+    for (index = 0; index < queue->count; index++) {
+        slot = (queue->head + index) % RAW_QUEUE_DEPTH;
+        if (match && (queue->entry[slot].words[0] != header))
+            continue;
+
+        *message = queue->entry[slot];
+
+        /* close the gap left by the message */
+        for (; index > 0; index--) {
+            next = slot;
+            slot = (slot + RAW_QUEUE_DEPTH - 1) % RAW_QUEUE_DEPTH;
+            queue->entry[next] = queue->entry[slot];
+        }
+        queue->head = (queue->head + 1) % RAW_QUEUE_DEPTH;
+        queue->count--;
+        return NO_ERROR;
+    }
+
+    return ERROR;
+}
+
+/*!
+ * @brief Drops the queued command responses that do not answer the command
+ * sent with header. A channel carries one command at a time, so a response
+ * with another token has no outstanding command, e.g. a late response read
+ * from the errors file, and is reported as stale. A response with the same
+ * token but another header answers the command wrongly and fails it.
+ */
+static int32_t sgm_raw_drop_stale(struct sgm_raw_channel *channel, uint32_t header)
+{
+    struct sgm_raw_queue *queue = &channel->queue[SCMI_CODEC_COMMAND];
+    uint32_t index, slot, kept = 0;
+    int32_t status = NO_ERROR;
+    uint32_t received;
+
+    for (index = 0; index < queue->count; index++) {
+        slot = (queue->head + index) % RAW_QUEUE_DEPTH;
+        received = queue->entry[slot].words[0];
+
+        if (received == header) {
+            queue->entry[(queue->head + kept++) % RAW_QUEUE_DEPTH] = queue->entry[slot];
+        } else if (scmi_codec_token(received) != scmi_codec_token(header)) {
+            printf("\nWARNING: dropped stale response 0x%08x\n", received);
+        } else {
+            printf("\nERROR: response 0x%08x does not match command 0x%08x\n",
+                   received, header);
+            status = ERROR;
+        }
+    }
+    queue->count = kept;
+
+    return status;
+}
+
+/*!
+ * @brief Completion engine entry point. Returns an already queued message
+ * of the requested type, otherwise keeps receiving and demultiplexing
+ * platform messages until one arrives or the timeout expires. When match
+ * is set stale command responses are dropped while waiting, and the wait
+ * fails rather than handing back a response to another command.
+ */
+static int32_t sgm_raw_wait(struct sgm_raw_channel *channel, uint32_t type,
+        bool match, uint32_t header, uint32_t timeout, struct sgm_raw_message *message)
+{
+    uint64_t deadline = sgm_raw_time_ms() + timeout;
+    uint64_t now;
+
+    if (channel->fd[RAW_FILE_MESSAGE] < 0)
+        return ERROR;
+
+    while (sgm_raw_dequeue(channel, type, match, header, message) != NO_ERROR) {
+        if (match && (sgm_raw_drop_stale(channel, header) != NO_ERROR))
+            return ERROR;
+
+        now = sgm_raw_time_ms();
+        if ((now >= deadline) || (sgm_raw_receive(channel, deadline - now) != NO_ERROR))
+            return ERROR;
+    }
+
+    return NO_ERROR;
+}
+
+/*!
+ * @brief Extracts header, status and payload of a received message. status
+ * is NULL for notifications, which carry no status. The payload is bounded
+ * by the capacity the caller gives in return_values_count.
+ */
+static void sgm_raw_extract(const struct sgm_raw_message *message,
+        uint32_t *message_header_rcv, int32_t *status,
+        size_t *return_values_count, uint32_t *return_values)
+{
+    uint32_t num_words = message->num_words - 1;
+    uint32_t offset = 1;
+
+    *message_header_rcv = message->words[0];
+
+    if ((status != NULL) && (num_words != 0)) {
+        *status = (int32_t)message->words[offset++];
+        num_words--;
+    }
+
+    if (num_words > *return_values_count)
+        num_words = *return_values_count;
+
+    memcpy(return_values, &message->words[offset], num_words * 4);
+    *return_values_count = num_words;
+}
+
+/*!
+ * @brief Interface function that sends a command through the raw mode
+ * interfaces and receives its response.
+ *
+ * The header and parameters are written with a single write, which the
+ * kernel turns into one transfer on its own transport. Commands asking for
+ * a delayed response are written to message_async and their delayed
+ * response is collected later, so several of them can be in flight.
+ *
+ */
+int32_t sgm_raw_send_message(uint32_t message_header_send, size_t parameter_count,
+        const uint32_t *parameters, uint32_t *message_header_rcv, int32_t *status,
+        size_t *return_values_count, uint32_t *return_values)
+{
+    struct sgm_raw_channel *channel = g_current_channel;
+    struct sgm_raw_message message;
+    uint32_t words[RAW_MAX_MESSAGE_WORDS];
+    size_t length = (parameter_count + 1) * 4;
+    int fd;
+
+    if (channel->fd[RAW_FILE_MESSAGE] < 0)
+        return ERROR;
+
+    if (parameter_count >= RAW_MAX_MESSAGE_WORDS)
+        return ERROR;
+
+    words[0] = message_header_send;
+    if (parameter_count != 0)
+        memcpy(&words[1], parameters, parameter_count * 4);
+
+    fd = channel->fd[sgm_raw_is_async(message_header_send, parameter_count, parameters) ?
+                     RAW_FILE_MESSAGE_ASYNC : RAW_FILE_MESSAGE];
+    if (write(fd, words, length) != (ssize_t)length)
+        return ERROR;
+
+    if (sgm_raw_wait(channel, SCMI_CODEC_COMMAND, true, message_header_send,
+                     RAW_RESPONSE_TIMEOUT, &message) != NO_ERROR)
+        return ERROR;
+
+    sgm_raw_extract(&message, message_header_rcv, status, return_values_count,
+                    return_values);
+
+    return NO_ERROR;
+}
+
+/*!
+ * @brief Interface function that waits for
+ * delayed response.
+ */
+int sgm_raw_wait_for_response(uint32_t *message_header_rcv,
+        int32_t *status, size_t *return_values_count, uint32_t *return_values,
+        uint32_t timeout)
+{
+    struct sgm_raw_message message;
+
+    if (sgm_raw_wait(g_current_channel, SCMI_CODEC_DELAYED_RESPONSE, false, 0, timeout,
+                     &message) != NO_ERROR)
+        return ERROR;
+
+    sgm_raw_extract(&message, message_header_rcv, status, return_values_count,
+                    return_values);
+
+    return NO_ERROR;
+}
+
+/*!
+ * @brief Interface function that waits for
+ * notification.
+ */
+int sgm_raw_wait_for_notification(uint32_t *message_header_rcv,
+        size_t *return_values_count, uint32_t *return_values,
+        uint32_t timeout)
+{
+    struct sgm_raw_message message;
+
+    if (sgm_raw_wait(g_current_channel, SCMI_CODEC_NOTIFICATION, false, 0, timeout,
+                     &message) != NO_ERROR)
+        return ERROR;
+
+    sgm_raw_extract(&message, message_header_rcv, NULL, return_values_count,
+                    return_values);
+
+    return NO_ERROR;
+}
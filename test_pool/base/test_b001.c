@@ -20,6 +20,9 @@
 
 #define TEST_NUM  (SCMI_BASE_TEST_NUM_BASE + 1)
 #define TEST_DESC "Base protocol version check                  "
+
+VAL_REGISTER_TEST(PROTOCOL_BASE, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(0));
+
 #define RETURN_VALUE_COUNT 1
 
 uint32_t base_query_protocol_version(uint32_t *version)
@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_BASE_TEST_NUM_BASE + 2)
 #define TEST_DESC "Base protocol attributes check               "
 
+VAL_REGISTER_TEST(PROTOCOL_BASE, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(101));
+
 uint32_t base_query_protocol_attributes(void)
 {
     int32_t  status;
@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_BASE_TEST_NUM_BASE + 3)
 #define TEST_DESC "Base msg attributes mandatory cmd check      "
 
+VAL_REGISTER_TEST(PROTOCOL_BASE, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(101));
+
 uint32_t base_query_mandatory_command_support(void)
 {
     int32_t  status;
@@ -20,6 +20,8 @@
 #define TEST_NUM  (SCMI_BASE_TEST_NUM_BASE + 4)
 #define TEST_DESC "Base msg attributes invalid msg id check     "
 
+VAL_REGISTER_TEST(PROTOCOL_BASE, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(101));
+
 uint32_t base_invalid_messageid_call(void)
 {
     int32_t  status;
@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_BASE_TEST_NUM_BASE + 6)
 #define TEST_DESC "Base query subvendor name check              "
 
+VAL_REGISTER_TEST(PROTOCOL_BASE, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(101));
+
 uint32_t base_query_subvendor_info(void)
 {
     int32_t  status;
@@ -39,6 +41,7 @@ uint32_t base_query_subvendor_info(void)
 
     VAL_INIT_TEST_PARAM(param_count, rsp_msg_hdr, return_value_count, status);
     message_id = BASE_DISCOVER_SUB_VENDOR;
+    param_count++;
     cmd_msg_hdr = val_msg_hdr_create(PROTOCOL_BASE, BASE_PROTOCOL_MESSAGE_ATTRIBUTES, COMMAND_MSG);
     val_send_message(cmd_msg_hdr, param_count, &message_id, &rsp_msg_hdr, &status,
                      &return_value_count, return_values);
@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_BASE_TEST_NUM_BASE + 7)
 #define TEST_DESC "Base query implementation version check      "
 
+VAL_REGISTER_TEST(PROTOCOL_BASE, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(101));
+
 uint32_t base_query_implementation_version(void)
 {
     int32_t  status;
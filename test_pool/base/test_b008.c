@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_BASE_TEST_NUM_BASE + 8)
 #define TEST_DESC "Base query protocol list                     "
 
+VAL_REGISTER_TEST(PROTOCOL_BASE, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(101));
+
 uint32_t base_query_protocol_list(void)
 {
     int32_t  status;
@@ -28,7 +30,7 @@ uint32_t base_query_protocol_list(void)
     uint32_t cmd_msg_hdr;
     size_t   param_count;
     size_t   return_value_count;
-    uint32_t return_values[MAX_RETURNS_SIZE];
+    uint32_t *return_values;
     uint32_t num_protocols_returned, total_num_protocols;
     uint32_t i, protocol_list = 0;
     uint32_t skip = 0;
@@ -41,6 +43,11 @@ uint32_t base_query_protocol_list(void)
     /* Reset protocol list, if test failed or skipped*/
     val_agent_set_supported_protocol_list(0);
 
+    /* Pages hold as many entries as the channel allows */
+    return_values = val_buffer_get();
+    if (return_values == NULL)
+        return VAL_STATUS_FAIL;
+
     total_num_protocols = val_base_get_info(BASE_NUM_PROTOCOLS);
     if (total_num_protocols == 0) {
         val_print(VAL_PRINT_ERR, "\n       No protocols supported for agent            ");
@@ -69,6 +76,11 @@ uint32_t base_query_protocol_list(void)
         num_protocols_returned = return_values[NUM_OF_PROTOCOLS_OFFSET];
         val_print(VAL_PRINT_DEBUG, "\n       NUM OF PROTOCOLS: %d", num_protocols_returned);
 
+        /* Four protocols to a word */
+        if (val_check_return_count(return_value_count,
+                PROTOCOL_LIST_OFFSET + ((num_protocols_returned + 3) / 4)) != VAL_STATUS_PASS)
+            return VAL_STATUS_FAIL;
+
         protocols = &return_values[PROTOCOL_LIST_OFFSET];
         for (i = 0; i < num_protocols_returned; i++) {
             prot = (uint8_t)(protocols[i/4] >> ((i % 4) * 8));
@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_BASE_TEST_NUM_BASE + 9)
 #define TEST_DESC "Base discover agent check                    "
 
+VAL_REGISTER_TEST(PROTOCOL_BASE, PROTOCOL_VERSION_1, PROTOCOL_VERSION_1, VAL_TEST_DEPS(101));
+
 uint32_t base_discover_agent_v1(void)
 {
     int32_t  status;
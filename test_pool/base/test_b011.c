@@ -20,6 +20,9 @@
 
 #define TEST_NUM  (SCMI_BASE_TEST_NUM_BASE + 11)
 #define TEST_DESC "Base set device permissions check            "
+
+VAL_REGISTER_TEST(PROTOCOL_BASE, PROTOCOL_VERSION_2, VAL_VERSION_ANY, VAL_TEST_DEPS(101, 109));
+
 #define PARAMETER_SIZE 3
 
 uint32_t base_set_device_permissions_check(void)
@@ -47,6 +50,7 @@ uint32_t base_set_device_permissions_check(void)
     /* If SET DEVICE PERMISSIONS not supported, skip the test */
     VAL_INIT_TEST_PARAM(param_count, rsp_msg_hdr, return_value_count, status);
     message_id = BASE_SET_DEVICE_PERMISSIONS;
+    param_count++;
     cmd_msg_hdr = val_msg_hdr_create(PROTOCOL_BASE, BASE_PROTOCOL_MESSAGE_ATTRIBUTES, COMMAND_MSG);
     val_send_message(cmd_msg_hdr, param_count, &message_id, &rsp_msg_hdr, &status,
                      &return_value_count, return_values);
@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_CLOCK_TEST_NUM_BASE + 2)
 #define TEST_DESC "Clock protocol attributes check              "
 
+VAL_REGISTER_TEST(PROTOCOL_CLOCK, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(501));
+
 uint32_t clock_query_protocol_attributes(void)
 {
     int32_t  status;
@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_CLOCK_TEST_NUM_BASE + 3)
 #define TEST_DESC "Clock msg attributes mandatory cmd check     "
 
+VAL_REGISTER_TEST(PROTOCOL_CLOCK, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(501));
+
 uint32_t clock_query_mandatory_command_support(void)
 {
     int32_t  status;
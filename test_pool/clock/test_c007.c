@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_CLOCK_TEST_NUM_BASE + 7)
 #define TEST_DESC "Clock describe rates check                   "
 
+VAL_REGISTER_TEST(PROTOCOL_CLOCK, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(501));
+
 #define PARAMETER_SIZE 2
 
 uint32_t clock_query_describe_rates(void)
@@ -30,7 +32,7 @@ uint32_t clock_query_describe_rates(void)
     uint32_t cmd_msg_hdr;
     size_t   param_count;
     size_t   return_value_count;
-    uint32_t return_values[MAX_RETURNS_SIZE];
+    uint32_t *return_values;
     uint32_t clock_id, num_clocks, num_remaining_rates;
     uint32_t i, return_format, num_rates_retured, rate_index;
     uint32_t parameters[PARAMETER_SIZE];
@@ -41,6 +43,11 @@ uint32_t clock_query_describe_rates(void)
     if (val_test_initialize(TEST_NUM, TEST_DESC) != VAL_STATUS_PASS)
         return VAL_STATUS_SKIP;
 
+    /* Pages hold as many entries as the channel allows */
+    return_values = val_buffer_get();
+    if (return_values == NULL)
+        return VAL_STATUS_FAIL;
+
     num_clocks = val_clock_get_info(NUM_CLOCKS, 0);
     if (num_clocks == 0) {
         val_print(VAL_PRINT_ERR, "\n       No Clock found                              ");
@@ -94,6 +101,11 @@ uint32_t clock_query_describe_rates(void)
             num_rates_retured = VAL_EXTRACT_BITS(num_rate_flag, 0, 11);
             val_print(VAL_PRINT_DEBUG, "\n       NUM OF RATES RETURNED  : %d", num_rates_retured);
 
+            /* A rate takes two words, a range six */
+            if (val_check_return_count(return_value_count, RATES_OFFSET + (num_rates_retured *
+                    ((return_format == CLOCK_RATE_FMT_ARRAY) ? 2 : 6))) != VAL_STATUS_PASS)
+                return VAL_STATUS_FAIL;
+
             /* Rate array starts from return_values[1]*/
             rate_array = &return_values[RATES_OFFSET];
 
@@ -109,7 +121,7 @@ uint32_t clock_query_describe_rates(void)
                     val_print(VAL_PRINT_DEBUG, "\n       CLOCK RATE             : 0x%llX",
                             clock_rate);
                     /* Save first & last value*/
-                    if (i == 0) {
+                    if ((rate_index + i) == 0) {
                         val_clock_save_rate(CLOCK_LOWEST_RATE,
                                 clock_id, clock_rate);
                     }
@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_CLOCK_TEST_NUM_BASE + 8)
 #define TEST_DESC "Clock describe rate invalid clock id check   "
 
+VAL_REGISTER_TEST(PROTOCOL_CLOCK, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(501));
+
 #define PARAMETER_SIZE 2
 
 uint32_t clock_query_describe_rates_invalid_clock_id(void)
@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_CLOCK_TEST_NUM_BASE + 11)
 #define TEST_DESC "Clock rate set invalid param check           "
 
+VAL_REGISTER_TEST(PROTOCOL_CLOCK, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(501));
+
 #define PARAMETER_SIZE 4
 
 uint32_t clock_rate_set_invalid_param_check(void)
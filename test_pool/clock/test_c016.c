@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_CLOCK_TEST_NUM_BASE + 16)
 #define TEST_DESC "Clock config set invalid clock id check      "
 
+VAL_REGISTER_TEST(PROTOCOL_CLOCK, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(501));
+
 #define MAX_PARAMETER_SIZE 2
 
 uint32_t clock_config_set_invalid_clock_id_check(void)
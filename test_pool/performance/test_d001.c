@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_PERFORMANCE_TEST_NUM_BASE + 1)
 #define TEST_DESC "Performance protocol version check           "
 
+VAL_REGISTER_TEST(PROTOCOL_PERFORMANCE, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(0));
+
 #define MIN_RET_VAL_EXPECTED 1
 
 uint32_t performance_query_protocol_version(uint32_t *version)
@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_PERFORMANCE_TEST_NUM_BASE + 2)
 #define TEST_DESC "Performance protocol attributes check        "
 
+VAL_REGISTER_TEST(PROTOCOL_PERFORMANCE, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(401));
+
 uint32_t performance_query_protocol_attributes(void)
 {
     int32_t  status;
@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_PERFORMANCE_TEST_NUM_BASE + 3)
 #define TEST_DESC "Perf msg attributes mandatory commands check "
 
+VAL_REGISTER_TEST(PROTOCOL_PERFORMANCE, PROTOCOL_VERSION_2, VAL_VERSION_ANY, VAL_TEST_DEPS(401));
+
 uint32_t performance_query_mandatory_command_support(void)
 {
     int32_t  status;
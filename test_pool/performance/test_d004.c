@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_PERFORMANCE_TEST_NUM_BASE + 4)
 #define TEST_DESC "Perf msg attributes invalid message id check "
 
+VAL_REGISTER_TEST(PROTOCOL_PERFORMANCE, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(401));
+
 uint32_t performance_invalid_messageid_call(void)
 {
     int32_t  status;
@@ -21,6 +21,9 @@
 #define TEST_NUM  (SCMI_PERFORMANCE_TEST_NUM_BASE + 5)
 #define TEST_DESC "Performance domain attributes check          "
 
+VAL_REGISTER_TEST(PROTOCOL_PERFORMANCE, PROTOCOL_VERSION_2, VAL_VERSION_ANY,
+                  VAL_TEST_DEPS(401));
+
 uint32_t performance_query_domain_attributes(void)
 {
     int32_t  status;
@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_PERFORMANCE_TEST_NUM_BASE + 6)
 #define TEST_DESC "Perf domain attributes invalid domain check  "
 
+VAL_REGISTER_TEST(PROTOCOL_PERFORMANCE, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(401));
+
 uint32_t performance_query_domain_attributes_invalid_domain(void)
 {
     int32_t  status;
@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_PERFORMANCE_TEST_NUM_BASE + 7)
 #define TEST_DESC "Performance describe levels check            "
 
+VAL_REGISTER_TEST(PROTOCOL_PERFORMANCE, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(401));
+
 #define PARAMETER_SIZE 2
 #define PERF_LEVEL_ARRAY_COUNT 3
 
@@ -31,7 +33,7 @@ uint32_t performance_query_describe_levels(void)
     uint32_t cmd_msg_hdr;
     size_t   param_count;
     size_t   return_value_count;
-    uint32_t return_values[MAX_RETURNS_SIZE];
+    uint32_t *return_values;
     uint32_t domain_id, num_domains, num_remaining_levels, num_levels_retured;
     uint32_t i, perf_level, power_cost, latency, level_index;
     uint32_t min_perf_level, max_perf_level;
@@ -41,6 +43,11 @@ uint32_t performance_query_describe_levels(void)
     if (val_test_initialize(TEST_NUM, TEST_DESC) != VAL_STATUS_PASS)
         return VAL_STATUS_SKIP;
 
+    /* Pages hold as many entries as the channel allows */
+    return_values = val_buffer_get();
+    if (return_values == NULL)
+        return VAL_STATUS_FAIL;
+
     /* Check performance describe levels for valid domain */
     num_domains = val_performance_get_info(NUM_PERF_DOMAINS, 0x00);
     if (num_domains == 0) {
@@ -91,6 +98,10 @@ uint32_t performance_query_describe_levels(void)
             num_levels_retured = VAL_EXTRACT_BITS(return_values[NUM_LEVEL_OFFSET], 0, 11);
             val_print(VAL_PRINT_DEBUG, "\n       NUM OF LEVELS RETURNED : %d", num_levels_retured);
 
+            if (val_check_return_count(return_value_count, PERF_LEVEL_ARRAY_OFFSET +
+                    (num_levels_retured * PERF_LEVEL_ARRAY_COUNT)) != VAL_STATUS_PASS)
+                return VAL_STATUS_FAIL;
+
             perf_level_array = &return_values[PERF_LEVEL_ARRAY_OFFSET];
             for (i = 0; i < num_levels_retured; i++)
             {
@@ -105,7 +116,7 @@ uint32_t performance_query_describe_levels(void)
                     max_perf_level = perf_level;
 
                 /* Store a intermediate value*/
-                if (i == 1)
+                if ((level_index + i) == 1)
                      val_performance_save_info(PERF_DOMAIN_INTERMEDIATE_LEVEL, domain_id,
                                                perf_level);
 
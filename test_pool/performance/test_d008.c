@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_PERFORMANCE_TEST_NUM_BASE + 8)
 #define TEST_DESC "Perf describe levels invalid domain check    "
 
+VAL_REGISTER_TEST(PROTOCOL_PERFORMANCE, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(401));
+
 #define PARAMETER_SIZE 2
 
 uint32_t performance_query_describe_levels_invalid_domain(void)
@@ -20,6 +20,10 @@
 
 #define TEST_NUM  (SCMI_PERFORMANCE_TEST_NUM_BASE + 9)
 #define TEST_DESC "Performance limits set change limit check    "
+
+VAL_REGISTER_TEST(PROTOCOL_PERFORMANCE, VAL_VERSION_ANY, VAL_VERSION_ANY,
+                  VAL_TEST_DEPS(401));
+
 #define PARAMETER_SIZE 3
 
 /********* TEST ALGO ********************
@@ -21,6 +21,9 @@
 #define TEST_NUM  (SCMI_PERFORMANCE_TEST_NUM_BASE + 10)
 #define TEST_DESC "Performance limits set invalid limits check  "
 
+VAL_REGISTER_TEST(PROTOCOL_PERFORMANCE, VAL_VERSION_ANY, VAL_VERSION_ANY,
+                  VAL_TEST_DEPS(401));
+
 #define PARAMETER_SIZE 3
 
 uint32_t performance_query_set_limit_invalid_range(void)
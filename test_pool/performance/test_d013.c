@@ -20,6 +20,10 @@
 
 #define TEST_NUM  (SCMI_PERFORMANCE_TEST_NUM_BASE + 13)
 #define TEST_DESC "Performance level set change level check     "
+
+VAL_REGISTER_TEST(PROTOCOL_PERFORMANCE, VAL_VERSION_ANY, VAL_VERSION_ANY,
+                  VAL_TEST_DEPS(401));
+
 #define PARAMETER_SIZE 2
 
 /********* TEST ALGO ********************
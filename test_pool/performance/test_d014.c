@@ -20,6 +20,10 @@
 
 #define TEST_NUM  (SCMI_PERFORMANCE_TEST_NUM_BASE + 14)
 #define TEST_DESC "Performance level set invalid level check    "
+
+VAL_REGISTER_TEST(PROTOCOL_PERFORMANCE, VAL_VERSION_ANY, VAL_VERSION_ANY,
+                  VAL_TEST_DEPS(401));
+
 #define PARAMETER_SIZE 2
 
 uint32_t performance_query_set_level_invalid_range(void)
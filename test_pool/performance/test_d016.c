@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_PERFORMANCE_TEST_NUM_BASE + 16)
 #define TEST_DESC "Performance level get invalid domain check   "
 
+VAL_REGISTER_TEST(PROTOCOL_PERFORMANCE, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(401));
+
 uint32_t performance_query_get_level_invalid_domain(void)
 {
     int32_t  status;
@@ -21,6 +21,9 @@
 #define TEST_NUM  (SCMI_PERFORMANCE_TEST_NUM_BASE + 25)
 #define TEST_DESC "Perf desc fast chl unsupported message check "
 
+VAL_REGISTER_TEST(PROTOCOL_PERFORMANCE, PROTOCOL_VERSION_2, VAL_VERSION_ANY,
+                  VAL_TEST_DEPS(401));
+
 #define PARAMETER_SIZE 2
 
 uint32_t performance_query_describe_fast_channel_unsupported_message(void)
@@ -41,15 +44,7 @@ uint32_t performance_query_describe_fast_channel_unsupported_message(void)
     /* Skip if describe fast channel is not supported*/
     val_print(VAL_PRINT_TEST, "\n     [Check 1] Query performance describe fast channel support");
 
-    VAL_INIT_TEST_PARAM(param_count, rsp_msg_hdr, return_value_count, status);
-    message_id = PERFORMANCE_DESCRIBE_FASTCHANNEL;
-    param_count++;
-    cmd_msg_hdr = val_msg_hdr_create(PROTOCOL_PERFORMANCE, PERFORMANCE_PROTOCOL_MESSAGE_ATTRIBUTES,
-                                     COMMAND_MSG);
-    val_send_message(cmd_msg_hdr, param_count, &message_id, &rsp_msg_hdr, &status,
-                     &return_value_count, return_values);
-
-    if (status == SCMI_NOT_FOUND) {
+    if (val_performance_get_info(PERF_DESCRIBE_FAST_CH_SUPPORT, 0x00) == 0) {
         val_print(VAL_PRINT_ERR, "\n       PERF_DESCRIBE_FASTCHANNEL not supported     ");
         return VAL_STATUS_SKIP;
     }
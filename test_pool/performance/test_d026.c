@@ -21,6 +21,9 @@
 #define TEST_NUM  (SCMI_PERFORMANCE_TEST_NUM_BASE + 26)
 #define TEST_DESC "Perf limits changed notification check       "
 
+VAL_REGISTER_TEST(PROTOCOL_PERFORMANCE, VAL_VERSION_ANY, VAL_VERSION_ANY,
+                  VAL_TEST_DEPS(401));
+
 /********* TEST ALGO ********************
  * Get the domain which has limit change noti and set limit support
  * Enable limit notification
@@ -39,7 +42,7 @@ uint32_t performance_limit_set_async(void)
     size_t   param_count;
     size_t   return_value_count;
     uint32_t return_values[MAX_RETURNS_SIZE];
-    uint32_t domain_id, num_domains, attribute;
+    uint32_t domain_id, num_domains;
     uint32_t range_max, range_min, tmp_max;
     uint32_t parameters[3], set_limit_support = 0, limit_notify_support = 0;
 
@@ -62,28 +65,11 @@ uint32_t performance_limit_set_async(void)
         val_print(VAL_PRINT_TEST, "\n     PERFORMANCE DOMAIN ID: %d", domain_id);
         val_print(VAL_PRINT_TEST,
                   "\n     [Check 1] Find set limit & limit notify supported domain");
-        VAL_INIT_TEST_PARAM(param_count, rsp_msg_hdr, return_value_count, status);
-        param_count++;
-        cmd_msg_hdr = val_msg_hdr_create(PROTOCOL_PERFORMANCE, PERFORMANCE_DOMAIN_ATTRIBUTES,
-                                         COMMAND_MSG);
-        val_send_message(cmd_msg_hdr, param_count, &domain_id, &rsp_msg_hdr, &status,
-                         &return_value_count, return_values);
-
-        if (val_compare_status(status, SCMI_SUCCESS) != VAL_STATUS_PASS)
-            return VAL_STATUS_FAIL;
-
-        if (val_compare_msg_hdr(cmd_msg_hdr, rsp_msg_hdr) != VAL_STATUS_PASS)
-            return VAL_STATUS_FAIL;
-
-        val_print_return_values(return_value_count, return_values);
-
-        attribute = return_values[ATTRIBUTE_OFFSET];
-        if (val_reserved_bits_check_is_zero(VAL_EXTRACT_BITS(attribute, 0, 26)) != VAL_STATUS_PASS)
-            return VAL_STATUS_FAIL;
-
-        set_limit_support = VAL_EXTRACT_BITS(attribute, 31, 31);
+        set_limit_support = val_performance_get_info(PERF_DOMAIN_SET_PERFORMANCE_LIMIT_SUPPORT,
+                                                     domain_id);
         val_print(VAL_PRINT_TEST, "\n       SET LIMIT SUPPORT: %d", set_limit_support);
-        limit_notify_support = VAL_EXTRACT_BITS(attribute, 29, 29);
+        limit_notify_support = val_performance_get_info(PERF_DOMAIN_LIMIT_CHANGE_NTFY_SUPPORT,
+                                                        domain_id);
         val_print(VAL_PRINT_TEST, "\n       LIMIT CHG NOTIFY SUPPORT: %d", limit_notify_support);
         if (set_limit_support && limit_notify_support)
             break;
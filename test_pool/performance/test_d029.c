@@ -21,6 +21,9 @@
 #define TEST_NUM  (SCMI_PERFORMANCE_TEST_NUM_BASE + 29)
 #define TEST_DESC "Performance limits get via fast channel      "
 
+VAL_REGISTER_TEST(PROTOCOL_PERFORMANCE, PROTOCOL_VERSION_2, VAL_VERSION_ANY,
+                  VAL_TEST_DEPS(401));
+
 #define PARAMETER_SIZE 2
 
 uint32_t performance_limits_get_fast_channel(void)
@@ -32,10 +35,10 @@ uint32_t performance_limits_get_fast_channel(void)
     size_t   return_value_count;
     uint32_t return_values[MAX_RETURNS_SIZE];
     uint32_t domain_id, num_domains, message_id, attributes;
-    uint32_t parameters[PARAMETER_SIZE], perf_limit_max, perf_limit_min;
-    uint64_t chl_addr_low, chl_addr_high;
+    uint32_t parameters[PARAMETER_SIZE], perf_limits[2];
     uint32_t run_flag = 0;
-    uint64_t chl_addr = 0x0;
+    uint32_t map_status;
+    VAL_FAST_CHANNEL_s fast_channel;
 
     if (val_test_initialize(TEST_NUM, TEST_DESC) != VAL_STATUS_PASS)
         return VAL_STATUS_SKIP;
@@ -43,15 +46,7 @@ uint32_t performance_limits_get_fast_channel(void)
     /* Skip if describe fast channel is not supported*/
     val_print(VAL_PRINT_TEST, "\n     [Check 1] Query performance describe fast channel support");
 
-    VAL_INIT_TEST_PARAM(param_count, rsp_msg_hdr, return_value_count, status);
-    message_id = PERFORMANCE_DESCRIBE_FASTCHANNEL;
-    param_count++;
-    cmd_msg_hdr = val_msg_hdr_create(PROTOCOL_PERFORMANCE, PERFORMANCE_PROTOCOL_MESSAGE_ATTRIBUTES,
-                                     COMMAND_MSG);
-    val_send_message(cmd_msg_hdr, param_count, &message_id, &rsp_msg_hdr, &status,
-                     &return_value_count, return_values);
-
-    if (status == SCMI_NOT_FOUND) {
+    if (val_performance_get_info(PERF_DESCRIBE_FAST_CH_SUPPORT, 0x00) == 0) {
         val_print(VAL_PRINT_ERR, "\n       PERF_DESCRIBE_FASTCHANNEL not supported     ");
         return VAL_STATUS_SKIP;
     }
@@ -102,18 +97,17 @@ uint32_t performance_limits_get_fast_channel(void)
             if (val_compare("DOORBELL SUPPORT", VAL_EXTRACT_BITS(attributes, 0, 0), NOT_SUPPORTED))
                 return VAL_STATUS_FAIL;
 
-            chl_addr_low = return_values[CHAN_ADDR_LOW_OFFSET];
-            chl_addr_high = return_values[CHAN_ADDR_HIGH_OFFSET];
-            chl_addr = chl_addr_high << 32 | chl_addr_low;
+            /* Fast channel holds range max followed by range min */
+            /* Skipped where the fast channel memory is out of reach of the agent */
+            map_status = val_fast_channel_init(return_values, &fast_channel);
+            if (map_status != VAL_STATUS_PASS)
+                return map_status;
 
-            if (chl_addr_high) {
-                perf_limit_max = *(volatile uint64_t *)chl_addr;
-                perf_limit_min = *((volatile uint64_t *)chl_addr + 1);
-            }
-            else {
-                perf_limit_max = *(volatile uint32_t*)chl_addr_low;
-                perf_limit_min = *((volatile uint32_t*)chl_addr_low + 1);
+            if (val_fast_channel_read(&fast_channel, perf_limits, 2) != VAL_STATUS_PASS) {
+                val_fast_channel_close(&fast_channel);
+                return VAL_STATUS_FAIL;
             }
+            val_fast_channel_close(&fast_channel);
 
             /* Get perf limits from normal channel and and compare  */
             val_print(VAL_PRINT_TEST, "\n     [Check 2] Get perf limits via normal channel");
@@ -133,9 +127,9 @@ uint32_t performance_limits_get_fast_channel(void)
 
             val_print_return_values(return_value_count, return_values);
 
-            if (val_compare("LIMIT_MAX ", return_values[RANGE_MAX_OFFSET], perf_limit_max))
+            if (val_compare("LIMIT_MAX ", return_values[RANGE_MAX_OFFSET], perf_limits[0]))
                 return VAL_STATUS_FAIL;
-            if (val_compare("LIMIT_MIN ", return_values[RANGE_MIN_OFFSET], perf_limit_min))
+            if (val_compare("LIMIT_MIN ", return_values[RANGE_MIN_OFFSET], perf_limits[1]))
                 return VAL_STATUS_FAIL;
         }
     }
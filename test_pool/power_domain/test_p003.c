@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_POWER_DOMAIN_TEST_NUM_BASE + 3)
 #define TEST_DESC "Power msg attributes mandatory cmd check     "
 
+VAL_REGISTER_TEST(PROTOCOL_POWER_DOMAIN, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(201));
+
 uint32_t power_domain_query_mandatory_command_support(void)
 {
     int32_t  status;
@@ -20,6 +20,8 @@
 #define TEST_NUM  (SCMI_POWER_DOMAIN_TEST_NUM_BASE + 4)
 #define TEST_DESC "Power msg attributes invalid msg id check    "
 
+VAL_REGISTER_TEST(PROTOCOL_POWER_DOMAIN, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(201));
+
 uint32_t power_domain_invalid_messageid_call(void)
 {
     int32_t  status;
@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_POWER_DOMAIN_TEST_NUM_BASE + 6)
 #define TEST_DESC "Power domain attributes invalid domain check "
 
+VAL_REGISTER_TEST(PROTOCOL_POWER_DOMAIN, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(201));
+
 uint32_t power_domain_query_domain_attributes_invalid_doamin(void)
 {
     int32_t  status;
@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_POWER_DOMAIN_TEST_NUM_BASE + 7)
 #define TEST_DESC "Power state set invalid param check          "
 
+VAL_REGISTER_TEST(PROTOCOL_POWER_DOMAIN, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(201));
+
 #define PARAMETER_SIZE 3
 
 uint32_t power_domain_set_power_state_check(void)
@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_POWER_DOMAIN_TEST_NUM_BASE + 13)
 #define TEST_DESC "Power state notify unsupported domain check  "
 
+VAL_REGISTER_TEST(PROTOCOL_POWER_DOMAIN, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(201));
+
 #define PARAMETER_SIZE 2
 
 uint32_t power_domain_power_state_notify_unspported_domain_check(void)
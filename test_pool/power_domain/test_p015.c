@@ -21,6 +21,9 @@
 #define TEST_NUM  (SCMI_POWER_DOMAIN_TEST_NUM_BASE + 15)
 #define TEST_DESC "State chg rqst invalid notify_enable check   "
 
+VAL_REGISTER_TEST(PROTOCOL_POWER_DOMAIN, PROTOCOL_VERSION_2, VAL_VERSION_ANY,
+                  VAL_TEST_DEPS(201));
+
 #define PARAMETER_SIZE 2
 
 uint32_t power_domain_power_state_change_requested_notify_check(void)
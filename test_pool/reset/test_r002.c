@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_RESET_TEST_NUM_BASE + 2)
 #define TEST_DESC "Reset protocol attributes check              "
 
+VAL_REGISTER_TEST(PROTOCOL_RESET, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(701));
+
 #define RETURN_VALUE_COUNT 1
 
 uint32_t reset_query_protocol_attributes(void)
@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_RESET_TEST_NUM_BASE + 3)
 #define TEST_DESC "Reset msg attributes mandatory cmd check     "
 
+VAL_REGISTER_TEST(PROTOCOL_RESET, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(701));
+
 uint32_t reset_query_mandatory_command_support(void)
 {
     int32_t  status;
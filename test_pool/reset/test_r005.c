@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_RESET_TEST_NUM_BASE + 5)
 #define TEST_DESC "Reset domain attributes check                "
 
+VAL_REGISTER_TEST(PROTOCOL_RESET, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(701));
+
 uint32_t reset_query_domain_attributes(void)
 {
     int32_t  status;
@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_RESET_TEST_NUM_BASE + 6)
 #define TEST_DESC "Domain attributes invalid domain id check    "
 
+VAL_REGISTER_TEST(PROTOCOL_RESET, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(701));
+
 uint32_t reset_query_domain_attributes_invalid_id(void)
 {
     int32_t  status;
@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_RESET_TEST_NUM_BASE + 7)
 #define TEST_DESC "Reset command invalid domain id check        "
 
+VAL_REGISTER_TEST(PROTOCOL_RESET, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(701));
+
 #define PARAMETER_SIZE 3
 
 uint32_t reset_query_reset_command_invalid_id(void)
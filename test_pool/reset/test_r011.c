@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_RESET_TEST_NUM_BASE + 11)
 #define TEST_DESC "Reset notify invalid notify_enable           "
 
+VAL_REGISTER_TEST(PROTOCOL_RESET, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(701));
+
 #define PARAMETER_SIZE 2
 
 uint32_t reset_query_invalid_notify_enable(void)
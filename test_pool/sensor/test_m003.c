@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_SENSOR_TEST_NUM_BASE + 3)
 #define TEST_DESC "Sensor msg attributes mandatory cmd check    "
 
+VAL_REGISTER_TEST(PROTOCOL_SENSOR, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(601));
+
 uint32_t sensor_query_mandatory_command_support(void)
 {
     int32_t  status;
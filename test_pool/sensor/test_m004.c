@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_SENSOR_TEST_NUM_BASE + 4)
 #define TEST_DESC "Sensor msg attributes invalid msg id check   "
 
+VAL_REGISTER_TEST(PROTOCOL_SENSOR, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(601));
+
 uint32_t sensor_invalid_messageid_call(void)
 {
     int32_t  status;
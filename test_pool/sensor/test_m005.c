@@ -21,7 +21,7 @@
 #define TEST_NUM  (SCMI_SENSOR_TEST_NUM_BASE + 5)
 #define TEST_DESC "Sensor description get check                 "
 
-#define SENSOR_DESC_LEN 7
+VAL_REGISTER_TEST(PROTOCOL_SENSOR, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(601));
 
 uint32_t sensor_query_description_get(void)
 {
@@ -30,7 +30,7 @@ uint32_t sensor_query_description_get(void)
     uint32_t cmd_msg_hdr;
     size_t   param_count;
     size_t   return_value_count;
-    uint32_t return_values[MAX_RETURNS_SIZE];
+    uint32_t *return_values;
     uint32_t num_remaining_desc, num_desc_retured = 0;
     uint32_t i, desc_index = 0, sensor_id;
     uint32_t async_support, num_trip_points;
@@ -39,6 +39,11 @@ uint32_t sensor_query_description_get(void)
     if (val_test_initialize(TEST_NUM, TEST_DESC) != VAL_STATUS_PASS)
         return VAL_STATUS_SKIP;
 
+    /* Pages hold as many entries as the channel allows */
+    return_values = val_buffer_get();
+    if (return_values == NULL)
+        return VAL_STATUS_FAIL;
+
     val_print(VAL_PRINT_TEST, "\n     [Check 1] Query sensor description ");
 
     /* Reading sensor description repeatedly until all sensor details received*/
@@ -70,6 +75,10 @@ uint32_t sensor_query_description_get(void)
         num_desc_retured = VAL_EXTRACT_BITS(num_sensor_flag, 0, 11);
         val_print(VAL_PRINT_DEBUG, "\n       NUM OF DESC RETURNED   : %d", num_desc_retured);
 
+        if (val_check_return_count(return_value_count,
+                DESC_OFFSET + (num_desc_retured * SENSOR_DESC_LEN)) != VAL_STATUS_PASS)
+            return VAL_STATUS_FAIL;
+
         /* Sensor desc start from return_values[1] */
         sensor_desc = &return_values[DESC_OFFSET];
         for (i = 0; i < num_desc_retured; i++)
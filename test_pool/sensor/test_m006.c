@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_SENSOR_TEST_NUM_BASE + 6)
 #define TEST_DESC "Sensor trip pnt notify invalid event_ctrl chk"
 
+VAL_REGISTER_TEST(PROTOCOL_SENSOR, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(601));
+
 #define MAX_PARAMETER_SIZE 2
 
 uint32_t sensor_trip_point_nfy_event_ctrl_check(void)
@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_SENSOR_TEST_NUM_BASE + 8)
 #define TEST_DESC "Sensor trip point config invalid param check "
 
+VAL_REGISTER_TEST(PROTOCOL_SENSOR, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(601));
+
 #define MAX_PARAMETER_SIZE 3
 
 uint32_t sensor_trip_point_config_invalid_param_check(void)
@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_SENSOR_TEST_NUM_BASE + 14)
 #define TEST_DESC "Sensor reading get - async mode access check "
 
+VAL_REGISTER_TEST(PROTOCOL_SENSOR, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(601));
+
 #define MAX_PARAMETER_SIZE 2
 
 uint32_t sensor_reading_get_async_mode(void)
@@ -77,9 +79,9 @@ uint32_t sensor_reading_get_async_mode(void)
         val_print(VAL_PRINT_TEST, "\n     [Check 2] Wait for delayed response");
 
         VAL_INIT_TEST_PARAM(param_count, rsp_msg_hdr, return_value_count, status);
-        val_receive_notification(&rsp_msg_hdr, &return_value_count, return_values);
+        val_receive_delayed_response(&rsp_msg_hdr, &status, &return_value_count, return_values);
 
-        val_print(VAL_PRINT_TEST, "\n       NOTIFY MSG HDR   : 0x%08x", rsp_msg_hdr);
+        val_print(VAL_PRINT_TEST, "\n       DELAYED RESP HDR : 0x%08x", rsp_msg_hdr);
         if (val_compare("PROTOCOL ID", VAL_EXTRACT_BITS(rsp_msg_hdr, 10, 17), PROTOCOL_SENSOR))
              return VAL_STATUS_FAIL;
         if (val_compare("MSG TYPE   ", VAL_EXTRACT_BITS(rsp_msg_hdr, 8, 9), DELAYED_RESPONSE_MSG))
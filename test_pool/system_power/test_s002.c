@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_SYSTEM_POWER_TEST_NUM_BASE + 2)
 #define TEST_DESC "System power protocol attributes check       "
 
+VAL_REGISTER_TEST(PROTOCOL_SYSTEM_POWER, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(301));
+
 uint32_t system_power_query_protocol_attributes(void)
 {
     int32_t  status;
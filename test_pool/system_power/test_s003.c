@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_SYSTEM_POWER_TEST_NUM_BASE + 3)
 #define TEST_DESC "Sys pwr msg attributes mandatory cmd check   "
 
+VAL_REGISTER_TEST(PROTOCOL_SYSTEM_POWER, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(301));
+
 uint32_t system_power_query_mandatory_command_support(void)
 {
     int32_t  status;
@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_SYSTEM_POWER_TEST_NUM_BASE + 4)
 #define TEST_DESC "Sys pwr msg attibutes invalid msg id check   "
 
+VAL_REGISTER_TEST(PROTOCOL_SYSTEM_POWER, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(301));
+
 uint32_t system_power_invalid_messageid_call(void)
 {
     int32_t  status;
@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_SYSTEM_POWER_TEST_NUM_BASE + 5)
 #define TEST_DESC "System Power state set invalid flag check    "
 
+VAL_REGISTER_TEST(PROTOCOL_SYSTEM_POWER, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(301));
+
 #define PARAMETER_SIZE 2
 
 uint32_t system_power_state_set_invalid_parameters(void)
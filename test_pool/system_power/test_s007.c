@@ -21,6 +21,8 @@
 #define TEST_NUM  (SCMI_SYSTEM_POWER_TEST_NUM_BASE + 7)
 #define TEST_DESC "Sys pwr state nfy invalid notify_enable check"
 
+VAL_REGISTER_TEST(PROTOCOL_SYSTEM_POWER, VAL_VERSION_ANY, VAL_VERSION_ANY, VAL_TEST_DEPS(301));
+
 uint32_t system_power_state_notify_invalid_parameters(void)
 {
     int32_t  status;
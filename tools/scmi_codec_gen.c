@@ -0,0 +1,657 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+/*
+ * Host tool generating the SCMI message codec from the protocol descriptions
+ * of tools/scmi_messages.spec. For each message it emits the word offset of
+ * every field, the bit range and an extractor for every bit field, the
+ * message length, and a struct with an encoder and a length checked decoder
+ * for the parameters and for the returns. The codec is a header only, so
+ * that VAL, the platform layers and the mocker models share it.
+ *
+ *   scmi_codec_gen tools/scmi_messages.spec val/include/scmi_codec.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define CODEC_MAX_NAME      48
+#define CODEC_MAX_PROTOCOLS 16
+#define CODEC_MAX_MESSAGES  256
+#define CODEC_MAX_FIELDS    16
+#define CODEC_MAX_BITS      8
+#define CODEC_NAME_WORDS    4  /* SCMI_CODEC_NAME_SIZE bytes */
+
+typedef enum {
+    CODEC_FIELD_WORD,
+    CODEC_FIELD_WORDS,
+    CODEC_FIELD_STRING,
+    CODEC_FIELD_TAIL
+} CODEC_FIELD_KIND;
+
+typedef enum {
+    CODEC_COMMAND,
+    CODEC_DELAYED,
+    CODEC_NOTIFICATION
+} CODEC_MESSAGE_TYPE;
+
+typedef struct {
+    char name[CODEC_MAX_NAME];
+    uint32_t low;
+    uint32_t high;
+} CODEC_BITS_s;
+
+typedef struct {
+    char name[CODEC_MAX_NAME];
+    uint32_t kind;
+    uint32_t words;   /* 0 for a tail */
+    uint32_t offset;
+    CODEC_BITS_s bits[CODEC_MAX_BITS];
+    uint32_t num_bits;
+} CODEC_FIELD_s;
+
+typedef struct {
+    CODEC_FIELD_s fields[CODEC_MAX_FIELDS];
+    uint32_t num_fields;
+    uint32_t words;   /* Fixed words, excluding a tail */
+    bool tail;
+} CODEC_PART_s;
+
+typedef struct {
+    uint32_t protocol;
+    uint32_t type;
+    uint32_t id;
+    char name[CODEC_MAX_NAME];
+    CODEC_PART_s params;
+    CODEC_PART_s returns;
+} CODEC_MESSAGE_s;
+
+typedef struct {
+    char name[CODEC_MAX_NAME];
+    uint32_t id;
+} CODEC_PROTOCOL_s;
+
+static CODEC_PROTOCOL_s g_protocols[CODEC_MAX_PROTOCOLS];
+static uint32_t g_num_protocols;
+static CODEC_MESSAGE_s g_messages[CODEC_MAX_MESSAGES];
+static uint32_t g_num_messages;
+/* Field the next bit fields belong to */
+static CODEC_FIELD_s *g_last_field;
+
+static const char *g_type_names[] = { "command", "delayed", "notification" };
+
+/**
+  @brief   Copies a name, upper or lower cased
+  @param   dst    destination, CODEC_MAX_NAME bytes
+  @param   src    name
+  @param   upper  true for upper case
+  @return  none
+**/
+static void codec_case(char *dst, const char *src, bool upper)
+{
+    size_t i;
+
+    for (i = 0; (src[i] != '\0') && (i < CODEC_MAX_NAME - 1); i++)
+        dst[i] = upper ? toupper((unsigned char)src[i]) : tolower((unsigned char)src[i]);
+    dst[i] = '\0';
+}
+
+/**
+  @brief   Checks that a token is a C identifier that fits a name
+  @param   token  token
+  @return  true when valid
+**/
+static bool codec_valid_name(const char *token)
+{
+    size_t i;
+
+    if ((token == NULL) || (strlen(token) >= CODEC_MAX_NAME) ||
+        !(isalpha((unsigned char)token[0]) || (token[0] == '_')))
+        return false;
+
+    for (i = 1; token[i] != '\0'; i++) {
+        if (!isalnum((unsigned char)token[i]) && (token[i] != '_'))
+            return false;
+    }
+
+    return true;
+}
+
+/**
+  @brief   Parses a number token
+  @param   token  token
+  @param   value  storage for the value
+  @return  true when valid
+**/
+static bool codec_number(const char *token, uint32_t *value)
+{
+    char *end;
+
+    if (token == NULL)
+        return false;
+
+    *value = strtoul(token, &end, 0);
+    return (end != token) && (*end == '\0');
+}
+
+/**
+  @brief   Parses one line of the spec
+  @param   tokens      tokens of the line
+  @param   num_tokens  number of tokens
+  @return  NULL on success, else the reason of the failure
+**/
+static const char *codec_parse_line(char **tokens, uint32_t num_tokens)
+{
+    static const char *message_keywords[] = { "command", "delayed", "notification" };
+    CODEC_MESSAGE_s *message = g_num_messages ? &g_messages[g_num_messages - 1] : NULL;
+    CODEC_PART_s *part;
+    CODEC_FIELD_s *field;
+    CODEC_BITS_s *bits;
+    uint32_t type, i;
+
+    if (strcmp(tokens[0], "protocol") == 0) {
+        if (num_tokens != 3)
+            return "expected 'protocol <name> <id>'";
+        if (g_num_protocols == CODEC_MAX_PROTOCOLS)
+            return "too many protocols";
+        if (!codec_valid_name(tokens[1]) ||
+            !codec_number(tokens[2], &g_protocols[g_num_protocols].id))
+            return "invalid protocol";
+        codec_case(g_protocols[g_num_protocols++].name, tokens[1], false);
+        return NULL;
+    }
+
+    for (type = 0; type < sizeof(message_keywords) / sizeof(message_keywords[0]); type++) {
+        if (strcmp(tokens[0], message_keywords[type]) != 0)
+            continue;
+
+        if (num_tokens != 3)
+            return "expected '<type> <NAME> <message id>'";
+        if (g_num_protocols == 0)
+            return "message outside of a protocol";
+        if (g_num_messages == CODEC_MAX_MESSAGES)
+            return "too many messages";
+
+        message = &g_messages[g_num_messages];
+        memset(message, 0, sizeof(*message));
+        if (!codec_valid_name(tokens[1]) || !codec_number(tokens[2], &message->id) ||
+            (message->id > 0xFF))
+            return "invalid message";
+        message->protocol = g_num_protocols - 1;
+        message->type = type;
+        codec_case(message->name, tokens[1], true);
+        g_last_field = NULL;
+
+        for (i = 0; i < g_num_messages; i++) {
+            if ((g_messages[i].protocol == message->protocol) &&
+                (strcmp(g_messages[i].name, message->name) == 0))
+                return "message defined twice";
+            if ((g_messages[i].protocol == message->protocol) &&
+                (g_messages[i].type == type) && (g_messages[i].id == message->id))
+                return "message id defined twice";
+        }
+
+        g_num_messages++;
+        return NULL;
+    }
+
+    if ((strcmp(tokens[0], "param") == 0) || (strcmp(tokens[0], "return") == 0)) {
+        if (message == NULL)
+            return "field outside of a message";
+        if ((num_tokens < 2) || !codec_valid_name(tokens[1]))
+            return "invalid field";
+
+        part = (tokens[0][0] == 'p') ? &message->params : &message->returns;
+        if ((part == &message->params) && (message->type != CODEC_COMMAND))
+            return "only commands have parameters";
+        if (part->tail)
+            return "field after a tail";
+        if (part->num_fields == CODEC_MAX_FIELDS)
+            return "too many fields";
+
+        field = &part->fields[part->num_fields];
+        memset(field, 0, sizeof(*field));
+        codec_case(field->name, tokens[1], false);
+        for (i = 0; i < part->num_fields; i++) {
+            if (strcmp(part->fields[i].name, field->name) == 0)
+                return "field defined twice";
+        }
+
+        field->offset = part->words;
+        if (num_tokens == 2) {
+            field->kind = CODEC_FIELD_WORD;
+            field->words = 1;
+        } else if ((num_tokens == 4) && (strcmp(tokens[2], "words") == 0)) {
+            field->kind = CODEC_FIELD_WORDS;
+            if (!codec_number(tokens[3], &field->words) || (field->words < 2))
+                return "invalid number of words";
+        } else if ((num_tokens == 3) && (strcmp(tokens[2], "string") == 0)) {
+            field->kind = CODEC_FIELD_STRING;
+            field->words = CODEC_NAME_WORDS;
+        } else if ((num_tokens == 3) && (strcmp(tokens[2], "tail") == 0)) {
+            field->kind = CODEC_FIELD_TAIL;
+            part->tail = true;
+        } else {
+            return "expected 'words <n>', 'string' or 'tail'";
+        }
+
+        part->words += field->words;
+        part->num_fields++;
+        g_last_field = field;
+        return NULL;
+    }
+
+    if (strcmp(tokens[0], "bits") == 0) {
+        field = g_last_field;
+        if (field == NULL)
+            return "bit field outside of a field";
+        if (field->kind != CODEC_FIELD_WORD)
+            return "bit fields need a one word field";
+        if ((num_tokens < 3) || (num_tokens > 4))
+            return "expected 'bits <NAME> <low> [<high>]'";
+        if (field->num_bits == CODEC_MAX_BITS)
+            return "too many bit fields";
+
+        bits = &field->bits[field->num_bits];
+        if (!codec_valid_name(tokens[1]) || !codec_number(tokens[2], &bits->low))
+            return "invalid bit field";
+        bits->high = bits->low;
+        if ((num_tokens == 4) && !codec_number(tokens[3], &bits->high))
+            return "invalid bit field";
+        if ((bits->high < bits->low) || (bits->high > 31))
+            return "invalid bit range";
+        codec_case(bits->name, tokens[1], true);
+        for (i = 0; i < field->num_bits; i++) {
+            if (strcmp(field->bits[i].name, bits->name) == 0)
+                return "bit field defined twice";
+        }
+
+        field->num_bits++;
+        return NULL;
+    }
+
+    return "unknown keyword";
+}
+
+/**
+  @brief   Reads the spec
+  @param   path  spec file
+  @return  0 on success
+**/
+static int codec_read(const char *path)
+{
+    char line[256], *tokens[8], *comment, *token;
+    uint32_t line_number = 0, num_tokens;
+    const char *error;
+    FILE *file;
+
+    file = fopen(path, "r");
+    if (file == NULL) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return 1;
+    }
+
+    while (fgets(line, sizeof(line), file) != NULL) {
+        line_number++;
+        comment = strchr(line, '#');
+        if (comment != NULL)
+            *comment = '\0';
+
+        num_tokens = 0;
+        for (token = strtok(line, " \t\r\n"); token != NULL; token = strtok(NULL, " \t\r\n")) {
+            if (num_tokens == sizeof(tokens) / sizeof(tokens[0]))
+                break;
+            tokens[num_tokens++] = token;
+        }
+        if (num_tokens == 0)
+            continue;
+
+        error = codec_parse_line(tokens, num_tokens);
+        if (error != NULL) {
+            fprintf(stderr, "%s:%u: %s\n", path, line_number, error);
+            fclose(file);
+            return 1;
+        }
+    }
+
+    fclose(file);
+    return 0;
+}
+
+/**
+  @brief   Writes a #define, aligned like the hand written headers
+  @param   out    output
+  @param   value  value
+  @param   hex    true to write the value in hexadecimal
+  @param   fmt    name format
+  @return  none
+**/
+static void codec_define(FILE *out, uint32_t value, bool hex, const char *fmt, ...)
+    __attribute__((format(printf, 4, 5)));
+
+static void codec_define(FILE *out, uint32_t value, bool hex, const char *fmt, ...)
+{
+    char name[4 * CODEC_MAX_NAME];
+    va_list args;
+
+    va_start(args, fmt);
+    vsnprintf(name, sizeof(name), fmt, args);
+    va_end(args);
+
+    fprintf(out, hex ? "#define %-63s 0x%X\n" : "#define %-63s %u\n", name, value);
+}
+
+/**
+  @brief   Writes the struct, encoder, decoder and bit field extractors of
+           the parameters or of the returns of a message
+  @param   out     output
+  @param   prefix  lower case name of the message
+  @param   part    parameters or returns
+  @param   what    "params" or "returns"
+  @return  none
+**/
+static void codec_write_part(FILE *out, const char *prefix, const CODEC_PART_s *part,
+                             const char *what)
+{
+    const CODEC_FIELD_s *field;
+    const CODEC_BITS_s *bits;
+    char lower[CODEC_MAX_NAME];
+    uint32_t i, j;
+
+    if (part->num_fields == 0)
+        return;
+
+    fprintf(out, "\nstruct scmi_%s_%s {\n", prefix, what);
+    for (i = 0; i < part->num_fields; i++) {
+        field = &part->fields[i];
+        switch (field->kind) {
+        case CODEC_FIELD_WORD:
+            fprintf(out, "    uint32_t %s;\n", field->name);
+            break;
+        case CODEC_FIELD_WORDS:
+            fprintf(out, "    uint32_t %s[%u];\n", field->name, field->words);
+            break;
+        case CODEC_FIELD_STRING:
+            fprintf(out, "    uint8_t %s[SCMI_CODEC_NAME_SIZE];\n", field->name);
+            break;
+        case CODEC_FIELD_TAIL:
+            fprintf(out, "    const uint32_t *%s;\n    size_t %s_count;\n", field->name,
+                    field->name);
+            break;
+        }
+    }
+    fprintf(out, "};\n");
+
+    /* Encoder */
+    fprintf(out, "\nstatic inline size_t scmi_%s_%s_encode(uint32_t *words,\n"
+                 "        const struct scmi_%s_%s *%s)\n{\n", prefix, what, prefix, what, what);
+    for (i = 0; i < part->num_fields; i++) {
+        field = &part->fields[i];
+        switch (field->kind) {
+        case CODEC_FIELD_WORD:
+            fprintf(out, "    words[%u] = %s->%s;\n", field->offset, what, field->name);
+            break;
+        case CODEC_FIELD_WORDS:
+            for (j = 0; j < field->words; j++)
+                fprintf(out, "    words[%u] = %s->%s[%u];\n", field->offset + j, what,
+                        field->name, j);
+            break;
+        case CODEC_FIELD_STRING:
+            fprintf(out, "    scmi_codec_copy_bytes(&words[%u], %s->%s, SCMI_CODEC_NAME_SIZE);\n",
+                    field->offset, what, field->name);
+            break;
+        case CODEC_FIELD_TAIL:
+            fprintf(out, "    scmi_codec_copy_bytes(&words[%u], %s->%s,\n"
+                         "                          %s->%s_count * sizeof(uint32_t));\n"
+                         "    return %u + %s->%s_count;\n}\n", field->offset, what, field->name,
+                    what, field->name, field->offset, what, field->name);
+            break;
+        }
+    }
+    if (!part->tail)
+        fprintf(out, "    return %u;\n}\n", part->words);
+
+    /* Decoder, checks the length first */
+    fprintf(out, "\nstatic inline bool scmi_%s_%s_decode(const uint32_t *words,\n"
+                 "        size_t count, struct scmi_%s_%s *%s)\n{\n",
+            prefix, what, prefix, what, what);
+    fprintf(out, "    if (count %s %u)\n        return false;\n\n", part->tail ? "<" : "!=",
+            part->words);
+    for (i = 0; i < part->num_fields; i++) {
+        field = &part->fields[i];
+        switch (field->kind) {
+        case CODEC_FIELD_WORD:
+            fprintf(out, "    %s->%s = words[%u];\n", what, field->name, field->offset);
+            break;
+        case CODEC_FIELD_WORDS:
+            for (j = 0; j < field->words; j++)
+                fprintf(out, "    %s->%s[%u] = words[%u];\n", what, field->name, j,
+                        field->offset + j);
+            break;
+        case CODEC_FIELD_STRING:
+            fprintf(out, "    scmi_codec_copy_bytes(%s->%s, &words[%u], SCMI_CODEC_NAME_SIZE);\n",
+                    what, field->name, field->offset);
+            break;
+        case CODEC_FIELD_TAIL:
+            fprintf(out, "    %s->%s = &words[%u];\n    %s->%s_count = count - %u;\n", what,
+                    field->name, field->offset, what, field->name, field->offset);
+            break;
+        }
+    }
+    fprintf(out, "    return true;\n}\n");
+
+    /* Bit field extractors */
+    for (i = 0; i < part->num_fields; i++) {
+        field = &part->fields[i];
+        for (j = 0; j < field->num_bits; j++) {
+            bits = &field->bits[j];
+            codec_case(lower, bits->name, false);
+            fprintf(out, "\nstatic inline uint32_t scmi_%s_%s_%s(uint32_t %s)\n{\n"
+                         "    return SCMI_CODEC_BITS(%s, %u, %u);\n}\n", prefix, field->name,
+                    lower, field->name, field->name, bits->low, bits->high);
+        }
+    }
+}
+
+/**
+  @brief   Writes the offsets and bit ranges of the parameters or of the
+           returns of a message
+  @param   out     output
+  @param   prefix  upper case name of the message
+  @param   part    parameters or returns
+  @param   what    "PARAM" or "RET"
+  @return  none
+**/
+static void codec_write_offsets(FILE *out, const char *prefix, const CODEC_PART_s *part,
+                                const char *what)
+{
+    const CODEC_FIELD_s *field;
+    char upper[CODEC_MAX_NAME];
+    uint32_t i, j;
+
+    for (i = 0; i < part->num_fields; i++) {
+        field = &part->fields[i];
+        codec_case(upper, field->name, true);
+        codec_define(out, field->offset, false, "SCMI_%s_%s_%s", prefix, what, upper);
+        for (j = 0; j < field->num_bits; j++) {
+            codec_define(out, field->bits[j].low, false, "SCMI_%s_%s_%s_LOW", prefix, upper,
+                         field->bits[j].name);
+            codec_define(out, field->bits[j].high, false, "SCMI_%s_%s_%s_HIGH", prefix, upper,
+                         field->bits[j].name);
+        }
+    }
+    codec_define(out, part->words, false, "SCMI_%s_%s_COUNT", prefix, what);
+}
+
+/**
+  @brief   Writes the codec header
+  @param   out   output
+  @param   spec  path of the spec, for the banner
+  @return  none
+**/
+static void codec_write(FILE *out, const char *spec)
+{
+    char upper[2 * CODEC_MAX_NAME], lower[2 * CODEC_MAX_NAME], name[CODEC_MAX_NAME];
+    const CODEC_PROTOCOL_s *protocol;
+    const CODEC_MESSAGE_s *message;
+    uint32_t i, p;
+
+    fprintf(out,
+        "/** @file\n"
+        " * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.\n"
+        " * SPDX-License-Identifier : Apache-2.0\n"
+        " *\n"
+        " * Licensed under the Apache License, Version 2.0 (the \"License\");\n"
+        " * you may not use this file except in compliance with the License.\n"
+        " * You may obtain a copy of the License at\n"
+        " *\n"
+        " *  http://www.apache.org/licenses/LICENSE-2.0\n"
+        " *\n"
+        " * Unless required by applicable law or agreed to in writing, software\n"
+        " * distributed under the License is distributed on an \"AS IS\" BASIS,\n"
+        " * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.\n"
+        " * See the License for the specific language governing permissions and\n"
+        " * limitations under the License.\n"
+        "**/\n\n"
+        "/* Generated by scmi_codec_gen from %s, do not edit. Run make codec. */\n\n"
+        "#ifndef __SCMI_CODEC_H__\n"
+        "#define __SCMI_CODEC_H__\n\n"
+        "#include <stdint.h>\n"
+        "#include <stddef.h>\n"
+        "#include <stdbool.h>\n\n"
+        "#define SCMI_CODEC_NAME_SIZE 16\n\n"
+        "#define SCMI_CODEC_BITS(word, low, high) \\\n"
+        "    (((word) >> (low)) & (uint32_t)(((1ull << ((high) - (low) + 1)) - 1)))\n\n"
+        "/* Message header */\n"
+        "#define SCMI_CODEC_MESSAGE_ID_LOW   0\n"
+        "#define SCMI_CODEC_MESSAGE_ID_HIGH  7\n"
+        "#define SCMI_CODEC_TYPE_LOW         8\n"
+        "#define SCMI_CODEC_TYPE_HIGH        9\n"
+        "#define SCMI_CODEC_PROTOCOL_LOW     10\n"
+        "#define SCMI_CODEC_PROTOCOL_HIGH    17\n"
+        "#define SCMI_CODEC_TOKEN_LOW        18\n"
+        "#define SCMI_CODEC_TOKEN_HIGH       27\n\n"
+        "#define SCMI_CODEC_COMMAND          0\n"
+        "#define SCMI_CODEC_DELAYED_RESPONSE 2\n"
+        "#define SCMI_CODEC_NOTIFICATION     3\n\n"
+        "static inline uint32_t scmi_codec_header(uint32_t protocol_id, uint32_t message_id,\n"
+        "        uint32_t type, uint32_t token)\n"
+        "{\n"
+        "    return ((message_id & 0xFF) << SCMI_CODEC_MESSAGE_ID_LOW) |\n"
+        "           ((type & 0x3) << SCMI_CODEC_TYPE_LOW) |\n"
+        "           ((protocol_id & 0xFF) << SCMI_CODEC_PROTOCOL_LOW) |\n"
+        "           ((token & 0x3FF) << SCMI_CODEC_TOKEN_LOW);\n"
+        "}\n\n"
+        "static inline uint32_t scmi_codec_message_id(uint32_t header)\n"
+        "{\n"
+        "    return SCMI_CODEC_BITS(header, SCMI_CODEC_MESSAGE_ID_LOW,\n"
+        "                           SCMI_CODEC_MESSAGE_ID_HIGH);\n"
+        "}\n\n"
+        "static inline uint32_t scmi_codec_type(uint32_t header)\n"
+        "{\n"
+        "    return SCMI_CODEC_BITS(header, SCMI_CODEC_TYPE_LOW, SCMI_CODEC_TYPE_HIGH);\n"
+        "}\n\n"
+        "static inline uint32_t scmi_codec_protocol_id(uint32_t header)\n"
+        "{\n"
+        "    return SCMI_CODEC_BITS(header, SCMI_CODEC_PROTOCOL_LOW, SCMI_CODEC_PROTOCOL_HIGH);\n"
+        "}\n\n"
+        "static inline uint32_t scmi_codec_token(uint32_t header)\n"
+        "{\n"
+        "    return SCMI_CODEC_BITS(header, SCMI_CODEC_TOKEN_LOW, SCMI_CODEC_TOKEN_HIGH);\n"
+        "}\n\n"
+        "/* Byte copy, so that the codec does not need the C library */\n"
+        "static inline void scmi_codec_copy_bytes(void *dst, const void *src, size_t size)\n"
+        "{\n"
+        "    uint8_t *to = dst;\n"
+        "    const uint8_t *from = src;\n\n"
+        "    while (size--)\n"
+        "        *to++ = *from++;\n"
+        "}\n", spec);
+
+    for (p = 0; p < g_num_protocols; p++) {
+        protocol = &g_protocols[p];
+        codec_case(name, protocol->name, true);
+        fprintf(out, "\n/* %s protocol */\n\n", protocol->name);
+        codec_define(out, protocol->id, true, "SCMI_%s_PROTOCOL_ID", name);
+
+        for (i = 0; i < g_num_messages; i++) {
+            message = &g_messages[i];
+            if (message->protocol != p)
+                continue;
+
+            snprintf(upper, sizeof(upper), "%s_%s", name, message->name);
+            codec_case(lower, upper, false);
+            fprintf(out, "\n/* %s %s, %s 0x%X */\n\n", protocol->name, message->name,
+                    g_type_names[message->type], message->id);
+            codec_define(out, message->id, true, "SCMI_%s_MSG_ID", upper);
+            if (message->type == CODEC_COMMAND)
+                codec_write_offsets(out, upper, &message->params, "PARAM");
+            codec_write_offsets(out, upper, &message->returns, "RET");
+            codec_write_part(out, lower, &message->params, "params");
+            codec_write_part(out, lower, &message->returns, "returns");
+        }
+    }
+
+    /* Length of the parameters of each command, for the receiving side */
+    fprintf(out, "\n/* Words of parameters of a command, -1 for a command not described */\n"
+                 "static inline int32_t scmi_codec_param_count(uint32_t protocol_id, "
+                 "uint32_t message_id)\n{\n"
+                 "    switch ((protocol_id << 8) | message_id) {\n");
+    for (i = 0; i < g_num_messages; i++) {
+        message = &g_messages[i];
+        if (message->type != CODEC_COMMAND)
+            continue;
+        codec_case(name, g_protocols[message->protocol].name, true);
+        snprintf(upper, sizeof(upper), "%s_%s", name, message->name);
+        fprintf(out, "    case (SCMI_%s_PROTOCOL_ID << 8) | SCMI_%s_MSG_ID:\n"
+                     "        return SCMI_%s_PARAM_COUNT;\n", name, upper, upper);
+    }
+    fprintf(out, "    default:\n        return -1;\n    }\n}\n\n"
+                 "#endif /* __SCMI_CODEC_H__ */\n");
+}
+
+int main(int argc, char *argv[])
+{
+    FILE *out;
+
+    if (argc != 3) {
+        fprintf(stderr, "Usage: %s <spec> <header>\n", argv[0]);
+        return 1;
+    }
+
+    if (codec_read(argv[1]) != 0)
+        return 1;
+
+    out = fopen(argv[2], "w");
+    if (out == NULL) {
+        fprintf(stderr, "cannot create %s\n", argv[2]);
+        return 1;
+    }
+
+    codec_write(out, argv[1]);
+    if (fclose(out) != 0) {
+        fprintf(stderr, "cannot write %s\n", argv[2]);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,416 @@
+# Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+# SPDX-License-Identifier : Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Messages of the SCMI 2.0 protocols, compiled into val/include/scmi_codec.h
+# by scmi_codec_gen (make codec).
+#
+#   protocol <name> <id>
+#   command|delayed|notification <NAME> <message id>
+#       param|return <field> [words <n> | string | tail]
+#           bits <NAME> <low> [<high>]
+#
+# A param is sent by the agent, a return by the platform. The status of a
+# response or delayed response is not part of the returns. Fields are one
+# word unless given a size. A string is SCMI_CODEC_NAME_SIZE bytes. A tail is
+# a variable number of words and ends the message. bits describes a bit
+# field of the field above it.
+
+protocol base 0x10
+
+command PROTOCOL_VERSION 0x0
+    return version
+
+command PROTOCOL_ATTRIBUTES 0x1
+    return attributes
+        bits NUM_PROTOCOLS 0 7
+        bits NUM_AGENTS 8 15
+
+command PROTOCOL_MESSAGE_ATTRIBUTES 0x2
+    param message_id
+    return attributes
+
+command DISCOVER_VENDOR 0x3
+    return vendor_identifier string
+
+command DISCOVER_SUB_VENDOR 0x4
+    return vendor_identifier string
+
+command DISCOVER_IMPLEMENTATION_VERSION 0x5
+    return implementation_version
+
+command DISCOVER_LIST_PROTOCOLS 0x6
+    param skip
+    return num_protocols
+    return protocols tail
+
+command DISCOVER_AGENT 0x7
+    param agent_id
+    return agent_id
+    return name string
+
+command NOTIFY_ERRORS 0x8
+    param notify_enable
+        bits ENABLE 0
+
+command SET_DEVICE_PERMISSIONS 0x9
+    param agent_id
+    param device_id
+    param flags
+        bits ACCESS_TYPE 0
+
+command SET_PROTOCOL_PERMISSIONS 0xA
+    param agent_id
+    param device_id
+    param command_id
+        bits PROTOCOL_ID 0 7
+    param flags
+        bits ACCESS_TYPE 0
+
+command RESET_AGENT_CONFIGURATION 0xB
+    param agent_id
+    param flags
+        bits PERMISSIONS_RESET 0
+
+notification ERROR_EVENT 0x0
+    return agent_id
+    return error_status
+    return msg_reports tail
+
+protocol power_domain 0x11
+
+command PROTOCOL_VERSION 0x0
+    return version
+
+command PROTOCOL_ATTRIBUTES 0x1
+    return attributes
+        bits NUM_DOMAINS 0 15
+    return statistics_address_low
+    return statistics_address_high
+    return statistics_len
+
+command PROTOCOL_MESSAGE_ATTRIBUTES 0x2
+    param message_id
+    return attributes
+
+command DOMAIN_ATTRIBUTES 0x3
+    param domain_id
+    return attributes
+        bits SYNC 29
+        bits ASYNC 30
+        bits STATE_NOTIFICATIONS 31
+    return name string
+
+command STATE_SET 0x4
+    param flags
+        bits ASYNC 0
+    param domain_id
+    param power_state
+
+command STATE_GET 0x5
+    param domain_id
+    return power_state
+
+command STATE_NOTIFY 0x6
+    param domain_id
+    param notify_enable
+        bits ENABLE 0
+
+command STATE_CHANGE_REQUESTED_NOTIFY 0x7
+    param domain_id
+    param notify_enable
+        bits ENABLE 0
+
+notification STATE_CHANGED 0x0
+    return agent_id
+    return domain_id
+    return power_state
+
+notification STATE_CHANGE_REQUESTED 0x1
+    return agent_id
+    return domain_id
+    return power_state
+
+protocol system_power 0x12
+
+command PROTOCOL_VERSION 0x0
+    return version
+
+command PROTOCOL_ATTRIBUTES 0x1
+    return attributes
+
+command PROTOCOL_MESSAGE_ATTRIBUTES 0x2
+    param message_id
+    return attributes
+        bits SUSPEND 30
+        bits WARM_RESET 31
+
+command STATE_SET 0x3
+    param flags
+        bits GRACEFUL 0
+    param system_state
+
+command STATE_GET 0x4
+    return system_state
+
+command STATE_NOTIFY 0x5
+    param notify_enable
+        bits ENABLE 0
+
+notification STATE_NOTIFIER 0x0
+    return agent_id
+    return flags
+    return system_state
+
+protocol performance 0x13
+
+command PROTOCOL_VERSION 0x0
+    return version
+
+command PROTOCOL_ATTRIBUTES 0x1
+    return attributes
+        bits NUM_DOMAINS 0 15
+        bits POWER_MW 16
+    return statistics_address_low
+    return statistics_address_high
+    return statistics_len
+
+command PROTOCOL_MESSAGE_ATTRIBUTES 0x2
+    param message_id
+    return attributes
+        bits FAST_CHANNEL 0
+
+command DOMAIN_ATTRIBUTES 0x3
+    param domain_id
+    return attributes
+        bits FAST_CHANNEL 27
+        bits LEVEL_NOTIFY 28
+        bits LIMIT_NOTIFY 29
+        bits LEVEL_SET 30
+        bits LIMIT_SET 31
+    return rate_limit
+        bits RATE_LIMIT 0 19
+    return sustained_freq
+    return sustained_perf_level
+    return name string
+
+command DESCRIBE_LEVELS 0x4
+    param domain_id
+    param level_index
+    return num_levels
+        bits NUM_LEVELS 0 11
+        bits NUM_REMAINING 16 31
+    return perf_levels tail
+
+command LIMITS_SET 0x5
+    param domain_id
+    param range_max
+    param range_min
+
+command LIMITS_GET 0x6
+    param domain_id
+    return range_max
+    return range_min
+
+command LEVEL_SET 0x7
+    param domain_id
+    param performance_level
+
+command LEVEL_GET 0x8
+    param domain_id
+    return performance_level
+
+command NOTIFY_LIMITS 0x9
+    param domain_id
+    param notify_enable
+        bits ENABLE 0
+
+command NOTIFY_LEVEL 0xA
+    param domain_id
+    param notify_enable
+        bits ENABLE 0
+
+command DESCRIBE_FASTCHANNEL 0xB
+    param domain_id
+    param message_id
+    return attributes
+        bits DOORBELL 0
+        bits DOORBELL_WIDTH 1 2
+    return rate_limit
+    return chan_addr_low
+    return chan_addr_high
+    return chan_size
+    return doorbell_addr_low
+    return doorbell_addr_high
+    return doorbell_set_mask_low
+    return doorbell_set_mask_high
+    return doorbell_preserve_mask_low
+    return doorbell_preserve_mask_high
+
+notification LIMITS_CHANGED 0x0
+    return agent_id
+    return domain_id
+    return range_max
+    return range_min
+
+notification LEVEL_CHANGED 0x1
+    return agent_id
+    return domain_id
+    return performance_level
+
+protocol clock 0x14
+
+command PROTOCOL_VERSION 0x0
+    return version
+
+command PROTOCOL_ATTRIBUTES 0x1
+    return attributes
+        bits NUM_CLOCKS 0 15
+        bits MAX_ASYNC 16 23
+
+command PROTOCOL_MESSAGE_ATTRIBUTES 0x2
+    param message_id
+    return attributes
+
+command ATTRIBUTES 0x3
+    param clock_id
+    return attributes
+        bits ENABLED 0
+    return clock_name string
+
+command DESCRIBE_RATES 0x4
+    param clock_id
+    param rate_index
+    return num_rates_flags
+        bits NUM_RATES 0 11
+        bits FORMAT 12
+        bits NUM_REMAINING 16 31
+    return rates tail
+
+command RATE_SET 0x5
+    param flags
+        bits ASYNC 0
+        bits IGNORE_DELAYED_RESPONSE 1
+        bits ROUND_UP 2
+    param clock_id
+    param rate words 2
+
+command RATE_GET 0x6
+    param clock_id
+    return rate words 2
+
+command CONFIG_SET 0x7
+    param clock_id
+    param attributes
+        bits ENABLE 0
+
+delayed RATE_SET_COMPLETE 0x5
+    return clock_id
+    return rate words 2
+
+protocol sensor 0x15
+
+command PROTOCOL_VERSION 0x0
+    return version
+
+command PROTOCOL_ATTRIBUTES 0x1
+    return attributes
+        bits NUM_SENSORS 0 15
+        bits MAX_ASYNC 16 23
+    return sensor_reg_address_low
+    return sensor_reg_address_high
+    return sensor_reg_len
+
+command PROTOCOL_MESSAGE_ATTRIBUTES 0x2
+    param message_id
+    return attributes
+
+command DESCRIPTION_GET 0x3
+    param desc_index
+    return num_sensor_flags
+        bits NUM_DESCRIPTORS 0 11
+        bits NUM_REMAINING 16 31
+    return sensor_descriptors tail
+
+command TRIP_POINT_NOTIFY 0x4
+    param sensor_id
+    param event_control
+        bits ENABLE 0
+
+command TRIP_POINT_CONFIG 0x5
+    param sensor_id
+    param trip_point_ev_ctrl
+        bits DIRECTION 0 1
+        bits TRIP_POINT_ID 4 11
+    param trip_point_val_low
+    param trip_point_val_high
+
+command READING_GET 0x6
+    param sensor_id
+    param flags
+        bits ASYNC 0
+    return sensor_value_low
+    return sensor_value_high
+
+delayed READING_COMPLETE 0x6
+    return sensor_id
+    return sensor_value_low
+    return sensor_value_high
+
+notification TRIP_POINT_EVENT 0x0
+    return agent_id
+    return sensor_id
+    return trip_point_desc
+
+protocol reset 0x16
+
+command PROTOCOL_VERSION 0x0
+    return version
+
+command PROTOCOL_ATTRIBUTES 0x1
+    return attributes
+        bits NUM_DOMAINS 0 15
+
+command PROTOCOL_MESSAGE_ATTRIBUTES 0x2
+    param message_id
+    return attributes
+
+command DOMAIN_ATTRIBUTES 0x3
+    param domain_id
+    return attributes
+        bits NOTIFY 30
+        bits ASYNC 31
+    return latency
+    return name string
+
+command RESET 0x4
+    param domain_id
+    param flags
+        bits AUTONOMOUS 0
+        bits EXPLICIT 1
+        bits ASYNC 2
+    param reset_state
+
+command NOTIFY 0x5
+    param domain_id
+    param notify_enable
+        bits ENABLE 0
+
+delayed COMPLETE 0x4
+    return domain_id
+
+notification ISSUED 0x0
+    return agent_id
+    return domain_id
+    return reset_state
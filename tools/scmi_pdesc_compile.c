@@ -0,0 +1,293 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+/*
+ * Host tool compiling a text platform description into the blob loaded by
+ * the agent when SCMI_PLATFORM_DESCRIPTION is set. Each line gives the
+ * values of a key, or of one row of a key for tables indexed by domain:
+ *
+ *   perf.num_domains = 4
+ *   perf.name = "Domain_0" "Domain_1" "Domain_2" "Domain_3"
+ *   perf.level[1] = 1313000000 1531000000 1750000000 2100000000
+ *
+ * '#' starts a comment. Keys not given keep their compiled-in values.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "pal_description.h"
+
+#define PDESC_MAX_ROWS 256
+
+typedef struct {
+    uint32_t *values;
+    uint32_t num_values;
+    bool defined;
+} PDESC_ROW_s;
+
+typedef struct {
+    PDESC_ROW_s rows[PDESC_MAX_ROWS];
+    uint32_t num_rows;
+} PDESC_KEY_s;
+
+#define PDESC_KEY_INFO(name, id, text, type) [id] = { text, type },
+static const struct {
+    const char *name;
+    uint32_t type;
+} g_key_info[PDESC_NUM_KEYS] = {
+    PAL_DESCRIPTION_KEYS(PDESC_KEY_INFO)
+};
+#undef PDESC_KEY_INFO
+
+static PDESC_KEY_s g_keys[PDESC_NUM_KEYS];
+static char *g_strings;
+static uint32_t g_strings_size;
+
+/**
+  @brief   Adds a string to the string table
+  @param   string  NUL terminated string
+  @return  offset of the string in the table
+**/
+static uint32_t pdesc_add_string(const char *string)
+{
+    uint32_t offset = g_strings_size;
+    size_t length = strlen(string) + 1;
+
+    g_strings = realloc(g_strings, g_strings_size + length);
+    if (g_strings == NULL) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+
+    memcpy(g_strings + offset, string, length);
+    g_strings_size += length;
+    return offset;
+}
+
+/**
+  @brief   Parses the values of a line into a row
+  @param   text  values, separated by blanks
+  @param   type  PAL_DESCRIPTION_NUMBER or PAL_DESCRIPTION_STRING
+  @param   row   row to fill
+  @return  NULL on success, else the reason of the failure
+**/
+static const char *pdesc_parse_values(char *text, uint32_t type, PDESC_ROW_s *row)
+{
+    char *end;
+
+    while (1) {
+        text += strspn(text, " \t\r\n");
+        if (*text == '\0')
+            return NULL;
+
+        row->values = realloc(row->values, (row->num_values + 1) * sizeof(uint32_t));
+        if (row->values == NULL)
+            return "out of memory";
+
+        if (*text == '"') {
+            if (type != PAL_DESCRIPTION_STRING)
+                return "string given for a number key";
+            end = strchr(text + 1, '"');
+            if (end == NULL)
+                return "unterminated string";
+            *end = '\0';
+            row->values[row->num_values++] = pdesc_add_string(text + 1);
+            text = end + 1;
+        } else {
+            if (type != PAL_DESCRIPTION_NUMBER)
+                return "number given for a string key";
+            row->values[row->num_values++] = strtoul(text, &end, 0);
+            if ((end == text) || ((*end != '\0') && !strchr(" \t\r\n", *end)))
+                return "invalid number";
+            text = end;
+        }
+    }
+}
+
+/**
+  @brief   Parses one line of the description
+  @param   line  line, without comment
+  @return  NULL on success, else the reason of the failure
+**/
+static const char *pdesc_parse_line(char *line)
+{
+    char *name, *values, *bracket, *end;
+    uint32_t key, row = 0;
+    PDESC_KEY_s *entry;
+
+    values = strchr(line, '=');
+    if (values == NULL)
+        return "missing '='";
+    *values++ = '\0';
+
+    name = line + strspn(line, " \t");
+    name[strcspn(name, " \t")] = '\0';
+
+    bracket = strchr(name, '[');
+    if (bracket != NULL) {
+        *bracket = '\0';
+        row = strtoul(bracket + 1, &end, 0);
+        if ((end == bracket + 1) || (*end != ']') || (end[1] != '\0'))
+            return "invalid row";
+        if (row >= PDESC_MAX_ROWS)
+            return "row out of range";
+    }
+
+    for (key = 0; key < PDESC_NUM_KEYS; key++) {
+        if ((g_key_info[key].name != NULL) && (strcmp(g_key_info[key].name, name) == 0))
+            break;
+    }
+    if (key == PDESC_NUM_KEYS)
+        return "unknown key";
+
+    if ((bracket != NULL) && (g_key_info[key].type == PAL_DESCRIPTION_STRING))
+        return "string keys have no rows";
+
+    entry = &g_keys[key];
+    if (entry->rows[row].defined)
+        return "defined twice";
+
+    entry->rows[row].defined = true;
+    if (row >= entry->num_rows)
+        entry->num_rows = row + 1;
+
+    return pdesc_parse_values(values, g_key_info[key].type, &entry->rows[row]);
+}
+
+/**
+  @brief   Writes a little-endian word
+  @param   file   output
+  @param   value  word
+  @return  none
+**/
+static void pdesc_write_word(FILE *file, uint32_t value)
+{
+    uint8_t bytes[4] = { value, value >> 8, value >> 16, value >> 24 };
+
+    fwrite(bytes, 1, sizeof(bytes), file);
+}
+
+/**
+  @brief   Writes the blob, see pal_description.h for the layout
+  @param   file  output
+  @return  none
+**/
+static void pdesc_write(FILE *file)
+{
+    uint32_t num_keys = 0, num_rows = 0, num_values = 0;
+    uint32_t key, row, value;
+
+    for (key = 0; key < PDESC_NUM_KEYS; key++) {
+        if (g_keys[key].num_rows == 0)
+            continue;
+        num_keys++;
+        num_rows += g_keys[key].num_rows;
+        for (row = 0; row < g_keys[key].num_rows; row++)
+            num_values += g_keys[key].rows[row].num_values;
+    }
+
+    pdesc_write_word(file, PAL_DESCRIPTION_MAGIC);
+    pdesc_write_word(file, PAL_DESCRIPTION_VERSION);
+    pdesc_write_word(file, num_keys);
+    pdesc_write_word(file, num_rows);
+    pdesc_write_word(file, num_values);
+    pdesc_write_word(file, g_strings_size);
+
+    for (key = 0, num_rows = 0; key < PDESC_NUM_KEYS; key++) {
+        if (g_keys[key].num_rows == 0)
+            continue;
+        pdesc_write_word(file, key);
+        pdesc_write_word(file, num_rows);
+        pdesc_write_word(file, g_keys[key].num_rows);
+        num_rows += g_keys[key].num_rows;
+    }
+
+    for (key = 0, num_values = 0; key < PDESC_NUM_KEYS; key++) {
+        for (row = 0; row < g_keys[key].num_rows; row++) {
+            pdesc_write_word(file, num_values);
+            pdesc_write_word(file, g_keys[key].rows[row].num_values);
+            num_values += g_keys[key].rows[row].num_values;
+        }
+    }
+
+    for (key = 0; key < PDESC_NUM_KEYS; key++) {
+        for (row = 0; row < g_keys[key].num_rows; row++) {
+            for (value = 0; value < g_keys[key].rows[row].num_values; value++)
+                pdesc_write_word(file, g_keys[key].rows[row].values[value]);
+        }
+    }
+
+    if (g_strings_size != 0)
+        fwrite(g_strings, 1, g_strings_size, file);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *error;
+    char line[4096];
+    uint32_t line_number = 0;
+    FILE *input, *output;
+    int status = 0;
+    char *comment;
+
+    if (argc != 3) {
+        fprintf(stderr, "Usage: %s <description text> <description blob>\n", argv[0]);
+        return 1;
+    }
+
+    input = fopen(argv[1], "r");
+    if (input == NULL) {
+        fprintf(stderr, "%s: cannot open\n", argv[1]);
+        return 1;
+    }
+
+    while (fgets(line, sizeof(line), input) != NULL) {
+        line_number++;
+        comment = strchr(line, '#');
+        if (comment != NULL)
+            *comment = '\0';
+        if (line[strspn(line, " \t\r\n")] == '\0')
+            continue;
+
+        error = pdesc_parse_line(line);
+        if (error != NULL) {
+            fprintf(stderr, "%s:%d: %s\n", argv[1], line_number, error);
+            status = 1;
+        }
+    }
+    fclose(input);
+
+    if (status != 0)
+        return status;
+
+    output = fopen(argv[2], "wb");
+    if (output == NULL) {
+        fprintf(stderr, "%s: cannot create\n", argv[2]);
+        return 1;
+    }
+
+    pdesc_write(output);
+    if (fclose(output) != 0) {
+        fprintf(stderr, "%s: write failed\n", argv[2]);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,118 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+/*
+ * Host tool printing a recording of SCMI traffic, one line per record. With
+ * -n the timing columns are left out, so that the recordings of two firmware
+ * releases can be compared with diff.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "val_record.h"
+
+static const char *g_kind_names[] = { "CMD", "DLY", "NTF" };
+
+/**
+  @brief   Prints a record
+  @param   record     record
+  @param   origin_ns  timestamp of the first record
+  @param   timing     false to leave the timing columns out
+  @return  none
+**/
+static void record_print(const VAL_RECORD_s *record, uint64_t origin_ns, int timing)
+{
+    uint32_t i;
+
+    if (timing)
+        printf("%12.3f %10.3f ", (record->timestamp_ns - origin_ns) / 1000.0,
+               record->latency_ns / 1000.0);
+
+    printf("ch%u %s ", record->channel,
+           (record->kind < 3) ? g_kind_names[record->kind] : "???");
+    if (record->kind == VAL_RECORD_COMMAND)
+        printf("0x%08x -> ", record->command_header);
+    printf("0x%08x status %d", record->header, record->status);
+
+    if (record->num_parameters != 0) {
+        printf(" param");
+        for (i = 0; (i < record->num_parameters) && (i < VAL_RECORD_MAX_PARAMETERS); i++)
+            printf(" 0x%08x", record->parameters[i]);
+    }
+
+    if (record->num_returns != 0) {
+        printf(" return");
+        for (i = 0; (i < record->num_returns) && (i < VAL_RECORD_MAX_RETURNS); i++)
+            printf(" 0x%08x", record->returns[i]);
+    }
+
+    printf("\n");
+}
+
+int main(int argc, char *argv[])
+{
+    VAL_RECORD_FILE_s header;
+    VAL_RECORD_s record;
+    uint64_t origin_ns = 0;
+    const char *path;
+    int timing = 1;
+    uint32_t i;
+    FILE *file;
+
+    if ((argc == 3) && (strcmp(argv[1], "-n") == 0)) {
+        timing = 0;
+        path = argv[2];
+    } else if (argc == 2) {
+        path = argv[1];
+    } else {
+        fprintf(stderr, "Usage: %s [-n] <recording>\n", argv[0]);
+        return 1;
+    }
+
+    file = fopen(path, "rb");
+    if (file == NULL) {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return 1;
+    }
+
+    if ((fread(&header, sizeof(header), 1, file) != 1) || (header.magic != VAL_RECORD_MAGIC) ||
+        (header.version != VAL_RECORD_VERSION) || (header.record_size != sizeof(record))) {
+        fprintf(stderr, "%s: not a recording of this version\n", path);
+        fclose(file);
+        return 1;
+    }
+
+    if (timing)
+        printf("%12s %10s\n", "time(us)", "took(us)");
+
+    for (i = 0; i < header.num_records; i++) {
+        if (fread(&record, sizeof(record), 1, file) != 1) {
+            fprintf(stderr, "%s: truncated after %u records\n", path, i);
+            fclose(file);
+            return 1;
+        }
+
+        if (i == 0)
+            origin_ns = record.timestamp_ns;
+        record_print(&record, origin_ns, timing);
+    }
+
+    fclose(file);
+    return 0;
+}
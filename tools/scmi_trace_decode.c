@@ -0,0 +1,302 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+/*
+ * Host tool printing the binary trace of an agent built with TRACE=1 as the
+ * text log the agent would have printed. The format strings are read from
+ * the VAL_TRACE_SECTION section of the agent ELF image, which must be the
+ * image that recorded the trace.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "val_trace.h"
+
+#define DECODE_SPEC_SIZE 32
+
+typedef struct {
+    const char *data;  /* Format string section */
+    uint32_t size;
+} DECODE_FORMATS_s;
+
+/**
+  @brief   Reads a whole file into memory
+  @param   path  file name, "-" for stdin
+  @param   size  storage for the file size
+  @return  file contents, NULL on failure
+**/
+static uint8_t *decode_read_file(const char *path, size_t *size)
+{
+    FILE *file = (strcmp(path, "-") == 0) ? stdin : fopen(path, "rb");
+    uint8_t *data = NULL;
+    size_t capacity = 0;
+    size_t length;
+
+    if (file == NULL)
+        return NULL;
+
+    *size = 0;
+    do {
+        if (*size == capacity) {
+            capacity = capacity ? capacity * 2 : 65536;
+            data = realloc(data, capacity);
+            if (data == NULL)
+                break;
+        }
+        length = fread(data + *size, 1, capacity - *size, file);
+        *size += length;
+    } while (length != 0);
+
+    if (file != stdin)
+        fclose(file);
+    return data;
+}
+
+/**
+  @brief   Reads a little-endian field of an ELF header
+  @param   data   field address
+  @param   bytes  field size, 2, 4 or 8
+  @return  field value
+**/
+static uint64_t decode_field(const uint8_t *data, uint32_t bytes)
+{
+    uint64_t value = 0;
+
+    while (bytes--)
+        value = (value << 8) | data[bytes];
+
+    return value;
+}
+
+/**
+  @brief   Finds the format string section of an agent ELF image
+  @param   image    ELF image
+  @param   size     image size
+  @param   formats  storage for the section
+  @return  true if the section was found
+**/
+static bool decode_find_formats(const uint8_t *image, size_t size, DECODE_FORMATS_s *formats)
+{
+    bool elf64;
+    uint64_t sh_offset, name_offset, offset;
+    uint32_t sh_size, sh_count, sh_names, word, i;
+    const uint8_t *section;
+
+    if ((size < 0x40) || (memcmp(image, "\177ELF", 4) != 0) || (image[5] != 1 /* LSB */))
+        return false;
+
+    elf64 = (image[4] == 2);
+    word = elf64 ? 8 : 4;
+    sh_offset = decode_field(image + (elf64 ? 0x28 : 0x20), word);
+    sh_size = decode_field(image + (elf64 ? 0x3a : 0x2e), 2);
+    sh_count = decode_field(image + (elf64 ? 0x3c : 0x30), 2);
+    sh_names = decode_field(image + (elf64 ? 0x3e : 0x32), 2);
+    if ((sh_names >= sh_count) || (sh_offset + ((uint64_t)sh_count * sh_size) > size))
+        return false;
+
+    /* sh_offset and sh_size follow sh_name, type, flags and addr */
+    section = image + sh_offset + (sh_names * sh_size);
+    name_offset = decode_field(section + (elf64 ? 0x18 : 0x10), word);
+
+    for (i = 0; i < sh_count; i++) {
+        section = image + sh_offset + (i * sh_size);
+        offset = name_offset + decode_field(section, 4);
+        if ((offset >= size) ||
+            (strncmp((const char *)image + offset, VAL_TRACE_SECTION,
+                     size - offset) != 0))
+            continue;
+
+        offset = decode_field(section + (elf64 ? 0x18 : 0x10), word);
+        formats->size = decode_field(section + (elf64 ? 0x20 : 0x14), word);
+        if (offset + formats->size > size)
+            return false;
+
+        formats->data = (const char *)image + offset;
+        return true;
+    }
+
+    return false;
+}
+
+/**
+  @brief   Prints the literal text of a format string, "%%" stands for '%'
+  @param   text  literal text
+  @param   end   end of the literal text
+  @return  none
+**/
+static void decode_print_literal(const char *text, const char *end)
+{
+    for (; text < end; text++) {
+        if ((text[0] == '%') && (text + 1 < end) && (text[1] == '%'))
+            text++;
+        putchar(*text);
+    }
+}
+
+/**
+  @brief   Prints one record with its format string
+  @param   format   format string
+  @param   payload  record payload
+  @param   length   payload size in bytes
+  @return  none
+**/
+static void decode_print_record(const char *format, const uint8_t *payload, uint32_t length)
+{
+    char spec[DECODE_SPEC_SIZE];
+    const char *start;
+    const char *next;
+    uint32_t used = 0;
+    uint32_t count;
+    uint64_t value;
+    size_t spec_length;
+    int wide;
+    char type;
+
+    while ((next = val_trace_next_conversion(format, &start, &wide, &type)) != NULL) {
+        decode_print_literal(format, start);
+        format = next;
+
+        /* Flags, width and precision of the original conversion, no length modifier */
+        spec_length = strspn(start + 1, "-+ #.0123456789") + 1;
+        if (spec_length + 4 > sizeof(spec)) {
+            printf("<?>");
+            continue;
+        }
+        memcpy(spec, start, spec_length);
+
+        if (type == 's') {
+            if (used + 4 > length) {
+                printf("<?>");
+                continue;
+            }
+            count = decode_field(payload + used, 4);
+            used += 4;
+            if (used + count > length) {
+                printf("<?>");
+                continue;
+            }
+            snprintf(spec + spec_length, sizeof(spec) - spec_length, ".*s");
+            printf(spec, (int)count, (const char *)payload + used);
+            used += (count + 3) & ~3u;
+            continue;
+        }
+
+        if (used + (wide ? 8 : 4) > length) {
+            printf("<?>");
+            continue;
+        }
+        value = decode_field(payload + used, wide ? 8 : 4);
+        used += wide ? 8 : 4;
+
+        if (type == 'p') {
+            printf("0x%llx", (unsigned long long)value);
+        } else if (wide) {
+            snprintf(spec + spec_length, sizeof(spec) - spec_length, "ll%c", type);
+            printf(spec, (unsigned long long)value);
+        } else {
+            spec[spec_length] = type;
+            spec[spec_length + 1] = '\0';
+            if ((type == 'd') || (type == 'i'))
+                printf(spec, (int32_t)value);
+            else
+                printf(spec, (uint32_t)value);
+        }
+    }
+
+    decode_print_literal(format, format + strlen(format));
+}
+
+/**
+  @brief   Prints every record of a trace, records that do not decode are
+           skipped up to the next sync byte
+  @param   formats  format string section
+  @param   trace    trace
+  @param   size     trace size
+  @param   level    highest print level to be printed
+  @return  number of bytes skipped
+**/
+static size_t decode_trace(const DECODE_FORMATS_s *formats, const uint8_t *trace, size_t size,
+                           uint32_t level)
+{
+    VAL_TRACE_RECORD_s header;
+    size_t offset = 0;
+    size_t skipped = 0;
+
+    while (offset + sizeof(header) <= size) {
+        memcpy(&header, trace + offset, sizeof(header));
+        if ((header.sync != VAL_TRACE_SYNC) || (header.format_id >= formats->size) ||
+            (sizeof(header) + header.length > VAL_TRACE_RECORD_SIZE) ||
+            (offset + sizeof(header) + header.length > size)) {
+            offset++;
+            skipped++;
+            continue;
+        }
+
+        if (header.level <= level)
+            decode_print_record(formats->data + header.format_id,
+                                trace + offset + sizeof(header), header.length);
+        offset += sizeof(header) + header.length;
+    }
+
+    return skipped + (size - offset);
+}
+
+int main(int argc, char *argv[])
+{
+    DECODE_FORMATS_s formats;
+    uint32_t level = UINT32_MAX;
+    const char *trace_path;
+    uint8_t *image, *trace;
+    size_t image_size, trace_size, skipped;
+    int arg = 1;
+
+    if ((argc > 1) && (strncmp(argv[1], "--level=", 8) == 0)) {
+        level = strtoul(argv[1] + 8, NULL, 0);
+        arg++;
+    }
+
+    if ((argc - arg < 1) || (argc - arg > 2)) {
+        fprintf(stderr, "Usage: %s [--level=N] <agent ELF image> [trace file, default stdin]\n",
+                argv[0]);
+        return 1;
+    }
+
+    image = decode_read_file(argv[arg], &image_size);
+    if ((image == NULL) || !decode_find_formats(image, image_size, &formats)) {
+        fprintf(stderr, "%s: no %s section, was the agent built with TRACE=1?\n",
+                argv[arg], VAL_TRACE_SECTION);
+        return 1;
+    }
+
+    trace_path = (argc - arg == 2) ? argv[arg + 1] : "-";
+    trace = decode_read_file(trace_path, &trace_size);
+    if (trace == NULL) {
+        fprintf(stderr, "%s: cannot read trace\n", trace_path);
+        return 1;
+    }
+
+    skipped = decode_trace(&formats, trace, trace_size, level);
+    if (skipped)
+        fprintf(stderr, "\n%zu trace bytes could not be decoded\n", skipped);
+
+    free(trace);
+    free(image);
+    return 0;
+}
@@ -36,22 +36,57 @@
 #define PAL_PRINT_INFO  5      /* Print all statements. Do not use unless really needed */
 
 #define PAL_STATUS_FAIL 0x90000000
+#define PAL_STATUS_TIMEOUT 0xA0000000
 #define PAL_STATUS_SKIP 0X10000000
 #define PAL_STATUS_PASS 0x0
 #define PAL_STATUS_NO_TESTS 0x1
 
+/* How a command completed, see pal_get_completion_mode() */
+#define PAL_COMPLETION_NONE      0 /* the transport has a single mode */
+#define PAL_COMPLETION_INTERRUPT 1
+#define PAL_COMPLETION_POLL      2
+
+/* Shared memory of a channel, see pal_get_channel_size(). The payload of a
+   response starts with its status, the return values follow */
+#define PAL_CHANNEL_SIZE_DEFAULT 128
+#define PAL_CHANNEL_SIZE_MIN     64   /* room for a page of a single entry */
+#define PAL_CHANNEL_SIZE_MAX     4096
+#define PAL_CHANNEL_HEADER_SIZE  0x1c /* bytes ahead of the payload */
+#define PAL_CHANNEL_MAX_RETURNS(size) ((((size) - PAL_CHANNEL_HEADER_SIZE) / 4) - 1)
+
 #define SCMI_NAME_STR_SIZE 16
 #define NUM_ELEMS(x) (sizeof(x) / sizeof((x)[0]))
-#define MAX_RETURNS_SIZE 32
+#define MAX_RETURNS_SIZE 32 /* return values of a command that is not paginated */
 
 /************  PAL API'S  ****************/
 
 uint32_t pal_initialize_system(void *info);
+uint32_t pal_set_transport(const char *name);
+const char *pal_get_transport(void);
 void pal_send_message(uint32_t message_header_send, size_t parameter_count,
         const uint32_t *parameters, uint32_t *message_header_rcv, int32_t *status,
         size_t *return_values_count, uint32_t *return_values);
 void pal_print(uint32_t level, const char *string, va_list args);
+void pal_trace(const void *record, size_t size);
+void pal_record(const void *record, size_t size);
+void pal_result(const void *result);
 void *pal_memcpy(void *dest, const void *src, size_t size);
+uint32_t pal_get_num_channels(void);
+uint32_t pal_select_channel(uint32_t channel_id);
+uint32_t pal_get_completion_mode(void);
+uint32_t pal_get_channel_size(void);
+uint64_t pal_get_time_ns(void);
+void pal_watchdog_arm(uint32_t budget_ms);
+void pal_watchdog_disarm(void);
+uint32_t pal_discovery_cache_load(const void *key, void *table, uint32_t size);
+void pal_discovery_cache_store(const void *key, const void *table, uint32_t size);
+void *pal_fast_channel_map(uint64_t address, uint32_t size);
+void pal_fast_channel_unmap(void *channel, uint32_t size);
+void *pal_stats_map(uint64_t address, uint32_t size);
+void pal_stats_unmap(void *region, uint32_t size);
+uint32_t pal_stats_sampler_start(uint32_t rate_hz, void (*sample)(void));
+uint32_t pal_stats_sampler_stop(void);
+void pal_stats_write(const void *samples, uint32_t count);
 
 void pal_receive_delayed_response(uint32_t *message_header_rcv, int32_t *status,
         size_t *return_values_count, uint32_t *return_values);
@@ -0,0 +1,3437 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+/* Generated by scmi_codec_gen from tools/scmi_messages.spec, do not edit. Run make codec. */
+
+#ifndef __SCMI_CODEC_H__
+#define __SCMI_CODEC_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define SCMI_CODEC_NAME_SIZE 16
+
+#define SCMI_CODEC_BITS(word, low, high) \
+    (((word) >> (low)) & (uint32_t)(((1ull << ((high) - (low) + 1)) - 1)))
+
+/* Message header */
+#define SCMI_CODEC_MESSAGE_ID_LOW   0
+#define SCMI_CODEC_MESSAGE_ID_HIGH  7
+#define SCMI_CODEC_TYPE_LOW         8
+#define SCMI_CODEC_TYPE_HIGH        9
+#define SCMI_CODEC_PROTOCOL_LOW     10
+#define SCMI_CODEC_PROTOCOL_HIGH    17
+#define SCMI_CODEC_TOKEN_LOW        18
+#define SCMI_CODEC_TOKEN_HIGH       27
+
+#define SCMI_CODEC_COMMAND          0
+#define SCMI_CODEC_DELAYED_RESPONSE 2
+#define SCMI_CODEC_NOTIFICATION     3
+
+static inline uint32_t scmi_codec_header(uint32_t protocol_id, uint32_t message_id,
+        uint32_t type, uint32_t token)
+{
+    return ((message_id & 0xFF) << SCMI_CODEC_MESSAGE_ID_LOW) |
+           ((type & 0x3) << SCMI_CODEC_TYPE_LOW) |
+           ((protocol_id & 0xFF) << SCMI_CODEC_PROTOCOL_LOW) |
+           ((token & 0x3FF) << SCMI_CODEC_TOKEN_LOW);
+}
+
+static inline uint32_t scmi_codec_message_id(uint32_t header)
+{
+    return SCMI_CODEC_BITS(header, SCMI_CODEC_MESSAGE_ID_LOW,
+                           SCMI_CODEC_MESSAGE_ID_HIGH);
+}
+
+static inline uint32_t scmi_codec_type(uint32_t header)
+{
+    return SCMI_CODEC_BITS(header, SCMI_CODEC_TYPE_LOW, SCMI_CODEC_TYPE_HIGH);
+}
+
+static inline uint32_t scmi_codec_protocol_id(uint32_t header)
+{
+    return SCMI_CODEC_BITS(header, SCMI_CODEC_PROTOCOL_LOW, SCMI_CODEC_PROTOCOL_HIGH);
+}
+
+static inline uint32_t scmi_codec_token(uint32_t header)
+{
+    return SCMI_CODEC_BITS(header, SCMI_CODEC_TOKEN_LOW, SCMI_CODEC_TOKEN_HIGH);
+}
+
+/* Byte copy, so that the codec does not need the C library */
+static inline void scmi_codec_copy_bytes(void *dst, const void *src, size_t size)
+{
+    uint8_t *to = dst;
+    const uint8_t *from = src;
+
+    while (size--)
+        *to++ = *from++;
+}
+
+/* base protocol */
+
+#define SCMI_BASE_PROTOCOL_ID                                           0x10
+
+/* base PROTOCOL_VERSION, command 0x0 */
+
+#define SCMI_BASE_PROTOCOL_VERSION_MSG_ID                               0x0
+#define SCMI_BASE_PROTOCOL_VERSION_PARAM_COUNT                          0
+#define SCMI_BASE_PROTOCOL_VERSION_RET_VERSION                          0
+#define SCMI_BASE_PROTOCOL_VERSION_RET_COUNT                            1
+
+struct scmi_base_protocol_version_returns {
+    uint32_t version;
+};
+
+static inline size_t scmi_base_protocol_version_returns_encode(uint32_t *words,
+        const struct scmi_base_protocol_version_returns *returns)
+{
+    words[0] = returns->version;
+    return 1;
+}
+
+static inline bool scmi_base_protocol_version_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_base_protocol_version_returns *returns)
+{
+    if (count != 1)
+        return false;
+
+    returns->version = words[0];
+    return true;
+}
+
+/* base PROTOCOL_ATTRIBUTES, command 0x1 */
+
+#define SCMI_BASE_PROTOCOL_ATTRIBUTES_MSG_ID                            0x1
+#define SCMI_BASE_PROTOCOL_ATTRIBUTES_PARAM_COUNT                       0
+#define SCMI_BASE_PROTOCOL_ATTRIBUTES_RET_ATTRIBUTES                    0
+#define SCMI_BASE_PROTOCOL_ATTRIBUTES_ATTRIBUTES_NUM_PROTOCOLS_LOW      0
+#define SCMI_BASE_PROTOCOL_ATTRIBUTES_ATTRIBUTES_NUM_PROTOCOLS_HIGH     7
+#define SCMI_BASE_PROTOCOL_ATTRIBUTES_ATTRIBUTES_NUM_AGENTS_LOW         8
+#define SCMI_BASE_PROTOCOL_ATTRIBUTES_ATTRIBUTES_NUM_AGENTS_HIGH        15
+#define SCMI_BASE_PROTOCOL_ATTRIBUTES_RET_COUNT                         1
+
+struct scmi_base_protocol_attributes_returns {
+    uint32_t attributes;
+};
+
+static inline size_t scmi_base_protocol_attributes_returns_encode(uint32_t *words,
+        const struct scmi_base_protocol_attributes_returns *returns)
+{
+    words[0] = returns->attributes;
+    return 1;
+}
+
+static inline bool scmi_base_protocol_attributes_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_base_protocol_attributes_returns *returns)
+{
+    if (count != 1)
+        return false;
+
+    returns->attributes = words[0];
+    return true;
+}
+
+static inline uint32_t scmi_base_protocol_attributes_attributes_num_protocols(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 0, 7);
+}
+
+static inline uint32_t scmi_base_protocol_attributes_attributes_num_agents(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 8, 15);
+}
+
+/* base PROTOCOL_MESSAGE_ATTRIBUTES, command 0x2 */
+
+#define SCMI_BASE_PROTOCOL_MESSAGE_ATTRIBUTES_MSG_ID                    0x2
+#define SCMI_BASE_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_MESSAGE_ID          0
+#define SCMI_BASE_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_COUNT               1
+#define SCMI_BASE_PROTOCOL_MESSAGE_ATTRIBUTES_RET_ATTRIBUTES            0
+#define SCMI_BASE_PROTOCOL_MESSAGE_ATTRIBUTES_RET_COUNT                 1
+
+struct scmi_base_protocol_message_attributes_params {
+    uint32_t message_id;
+};
+
+static inline size_t scmi_base_protocol_message_attributes_params_encode(uint32_t *words,
+        const struct scmi_base_protocol_message_attributes_params *params)
+{
+    words[0] = params->message_id;
+    return 1;
+}
+
+static inline bool scmi_base_protocol_message_attributes_params_decode(const uint32_t *words,
+        size_t count, struct scmi_base_protocol_message_attributes_params *params)
+{
+    if (count != 1)
+        return false;
+
+    params->message_id = words[0];
+    return true;
+}
+
+struct scmi_base_protocol_message_attributes_returns {
+    uint32_t attributes;
+};
+
+static inline size_t scmi_base_protocol_message_attributes_returns_encode(uint32_t *words,
+        const struct scmi_base_protocol_message_attributes_returns *returns)
+{
+    words[0] = returns->attributes;
+    return 1;
+}
+
+static inline bool scmi_base_protocol_message_attributes_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_base_protocol_message_attributes_returns *returns)
+{
+    if (count != 1)
+        return false;
+
+    returns->attributes = words[0];
+    return true;
+}
+
+/* base DISCOVER_VENDOR, command 0x3 */
+
+#define SCMI_BASE_DISCOVER_VENDOR_MSG_ID                                0x3
+#define SCMI_BASE_DISCOVER_VENDOR_PARAM_COUNT                           0
+#define SCMI_BASE_DISCOVER_VENDOR_RET_VENDOR_IDENTIFIER                 0
+#define SCMI_BASE_DISCOVER_VENDOR_RET_COUNT                             4
+
+struct scmi_base_discover_vendor_returns {
+    uint8_t vendor_identifier[SCMI_CODEC_NAME_SIZE];
+};
+
+static inline size_t scmi_base_discover_vendor_returns_encode(uint32_t *words,
+        const struct scmi_base_discover_vendor_returns *returns)
+{
+    scmi_codec_copy_bytes(&words[0], returns->vendor_identifier, SCMI_CODEC_NAME_SIZE);
+    return 4;
+}
+
+static inline bool scmi_base_discover_vendor_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_base_discover_vendor_returns *returns)
+{
+    if (count != 4)
+        return false;
+
+    scmi_codec_copy_bytes(returns->vendor_identifier, &words[0], SCMI_CODEC_NAME_SIZE);
+    return true;
+}
+
+/* base DISCOVER_SUB_VENDOR, command 0x4 */
+
+#define SCMI_BASE_DISCOVER_SUB_VENDOR_MSG_ID                            0x4
+#define SCMI_BASE_DISCOVER_SUB_VENDOR_PARAM_COUNT                       0
+#define SCMI_BASE_DISCOVER_SUB_VENDOR_RET_VENDOR_IDENTIFIER             0
+#define SCMI_BASE_DISCOVER_SUB_VENDOR_RET_COUNT                         4
+
+struct scmi_base_discover_sub_vendor_returns {
+    uint8_t vendor_identifier[SCMI_CODEC_NAME_SIZE];
+};
+
+static inline size_t scmi_base_discover_sub_vendor_returns_encode(uint32_t *words,
+        const struct scmi_base_discover_sub_vendor_returns *returns)
+{
+    scmi_codec_copy_bytes(&words[0], returns->vendor_identifier, SCMI_CODEC_NAME_SIZE);
+    return 4;
+}
+
+static inline bool scmi_base_discover_sub_vendor_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_base_discover_sub_vendor_returns *returns)
+{
+    if (count != 4)
+        return false;
+
+    scmi_codec_copy_bytes(returns->vendor_identifier, &words[0], SCMI_CODEC_NAME_SIZE);
+    return true;
+}
+
+/* base DISCOVER_IMPLEMENTATION_VERSION, command 0x5 */
+
+#define SCMI_BASE_DISCOVER_IMPLEMENTATION_VERSION_MSG_ID                0x5
+#define SCMI_BASE_DISCOVER_IMPLEMENTATION_VERSION_PARAM_COUNT           0
+#define SCMI_BASE_DISCOVER_IMPLEMENTATION_VERSION_RET_IMPLEMENTATION_VERSION 0
+#define SCMI_BASE_DISCOVER_IMPLEMENTATION_VERSION_RET_COUNT             1
+
+struct scmi_base_discover_implementation_version_returns {
+    uint32_t implementation_version;
+};
+
+static inline size_t scmi_base_discover_implementation_version_returns_encode(uint32_t *words,
+        const struct scmi_base_discover_implementation_version_returns *returns)
+{
+    words[0] = returns->implementation_version;
+    return 1;
+}
+
+static inline bool scmi_base_discover_implementation_version_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_base_discover_implementation_version_returns *returns)
+{
+    if (count != 1)
+        return false;
+
+    returns->implementation_version = words[0];
+    return true;
+}
+
+/* base DISCOVER_LIST_PROTOCOLS, command 0x6 */
+
+#define SCMI_BASE_DISCOVER_LIST_PROTOCOLS_MSG_ID                        0x6
+#define SCMI_BASE_DISCOVER_LIST_PROTOCOLS_PARAM_SKIP                    0
+#define SCMI_BASE_DISCOVER_LIST_PROTOCOLS_PARAM_COUNT                   1
+#define SCMI_BASE_DISCOVER_LIST_PROTOCOLS_RET_NUM_PROTOCOLS             0
+#define SCMI_BASE_DISCOVER_LIST_PROTOCOLS_RET_PROTOCOLS                 1
+#define SCMI_BASE_DISCOVER_LIST_PROTOCOLS_RET_COUNT                     1
+
+struct scmi_base_discover_list_protocols_params {
+    uint32_t skip;
+};
+
+static inline size_t scmi_base_discover_list_protocols_params_encode(uint32_t *words,
+        const struct scmi_base_discover_list_protocols_params *params)
+{
+    words[0] = params->skip;
+    return 1;
+}
+
+static inline bool scmi_base_discover_list_protocols_params_decode(const uint32_t *words,
+        size_t count, struct scmi_base_discover_list_protocols_params *params)
+{
+    if (count != 1)
+        return false;
+
+    params->skip = words[0];
+    return true;
+}
+
+struct scmi_base_discover_list_protocols_returns {
+    uint32_t num_protocols;
+    const uint32_t *protocols;
+    size_t protocols_count;
+};
+
+static inline size_t scmi_base_discover_list_protocols_returns_encode(uint32_t *words,
+        const struct scmi_base_discover_list_protocols_returns *returns)
+{
+    words[0] = returns->num_protocols;
+    scmi_codec_copy_bytes(&words[1], returns->protocols,
+                          returns->protocols_count * sizeof(uint32_t));
+    return 1 + returns->protocols_count;
+}
+
+static inline bool scmi_base_discover_list_protocols_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_base_discover_list_protocols_returns *returns)
+{
+    if (count < 1)
+        return false;
+
+    returns->num_protocols = words[0];
+    returns->protocols = &words[1];
+    returns->protocols_count = count - 1;
+    return true;
+}
+
+/* base DISCOVER_AGENT, command 0x7 */
+
+#define SCMI_BASE_DISCOVER_AGENT_MSG_ID                                 0x7
+#define SCMI_BASE_DISCOVER_AGENT_PARAM_AGENT_ID                         0
+#define SCMI_BASE_DISCOVER_AGENT_PARAM_COUNT                            1
+#define SCMI_BASE_DISCOVER_AGENT_RET_AGENT_ID                           0
+#define SCMI_BASE_DISCOVER_AGENT_RET_NAME                               1
+#define SCMI_BASE_DISCOVER_AGENT_RET_COUNT                              5
+
+struct scmi_base_discover_agent_params {
+    uint32_t agent_id;
+};
+
+static inline size_t scmi_base_discover_agent_params_encode(uint32_t *words,
+        const struct scmi_base_discover_agent_params *params)
+{
+    words[0] = params->agent_id;
+    return 1;
+}
+
+static inline bool scmi_base_discover_agent_params_decode(const uint32_t *words,
+        size_t count, struct scmi_base_discover_agent_params *params)
+{
+    if (count != 1)
+        return false;
+
+    params->agent_id = words[0];
+    return true;
+}
+
+struct scmi_base_discover_agent_returns {
+    uint32_t agent_id;
+    uint8_t name[SCMI_CODEC_NAME_SIZE];
+};
+
+static inline size_t scmi_base_discover_agent_returns_encode(uint32_t *words,
+        const struct scmi_base_discover_agent_returns *returns)
+{
+    words[0] = returns->agent_id;
+    scmi_codec_copy_bytes(&words[1], returns->name, SCMI_CODEC_NAME_SIZE);
+    return 5;
+}
+
+static inline bool scmi_base_discover_agent_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_base_discover_agent_returns *returns)
+{
+    if (count != 5)
+        return false;
+
+    returns->agent_id = words[0];
+    scmi_codec_copy_bytes(returns->name, &words[1], SCMI_CODEC_NAME_SIZE);
+    return true;
+}
+
+/* base NOTIFY_ERRORS, command 0x8 */
+
+#define SCMI_BASE_NOTIFY_ERRORS_MSG_ID                                  0x8
+#define SCMI_BASE_NOTIFY_ERRORS_PARAM_NOTIFY_ENABLE                     0
+#define SCMI_BASE_NOTIFY_ERRORS_NOTIFY_ENABLE_ENABLE_LOW                0
+#define SCMI_BASE_NOTIFY_ERRORS_NOTIFY_ENABLE_ENABLE_HIGH               0
+#define SCMI_BASE_NOTIFY_ERRORS_PARAM_COUNT                             1
+#define SCMI_BASE_NOTIFY_ERRORS_RET_COUNT                               0
+
+struct scmi_base_notify_errors_params {
+    uint32_t notify_enable;
+};
+
+static inline size_t scmi_base_notify_errors_params_encode(uint32_t *words,
+        const struct scmi_base_notify_errors_params *params)
+{
+    words[0] = params->notify_enable;
+    return 1;
+}
+
+static inline bool scmi_base_notify_errors_params_decode(const uint32_t *words,
+        size_t count, struct scmi_base_notify_errors_params *params)
+{
+    if (count != 1)
+        return false;
+
+    params->notify_enable = words[0];
+    return true;
+}
+
+static inline uint32_t scmi_base_notify_errors_notify_enable_enable(uint32_t notify_enable)
+{
+    return SCMI_CODEC_BITS(notify_enable, 0, 0);
+}
+
+/* base SET_DEVICE_PERMISSIONS, command 0x9 */
+
+#define SCMI_BASE_SET_DEVICE_PERMISSIONS_MSG_ID                         0x9
+#define SCMI_BASE_SET_DEVICE_PERMISSIONS_PARAM_AGENT_ID                 0
+#define SCMI_BASE_SET_DEVICE_PERMISSIONS_PARAM_DEVICE_ID                1
+#define SCMI_BASE_SET_DEVICE_PERMISSIONS_PARAM_FLAGS                    2
+#define SCMI_BASE_SET_DEVICE_PERMISSIONS_FLAGS_ACCESS_TYPE_LOW          0
+#define SCMI_BASE_SET_DEVICE_PERMISSIONS_FLAGS_ACCESS_TYPE_HIGH         0
+#define SCMI_BASE_SET_DEVICE_PERMISSIONS_PARAM_COUNT                    3
+#define SCMI_BASE_SET_DEVICE_PERMISSIONS_RET_COUNT                      0
+
+struct scmi_base_set_device_permissions_params {
+    uint32_t agent_id;
+    uint32_t device_id;
+    uint32_t flags;
+};
+
+static inline size_t scmi_base_set_device_permissions_params_encode(uint32_t *words,
+        const struct scmi_base_set_device_permissions_params *params)
+{
+    words[0] = params->agent_id;
+    words[1] = params->device_id;
+    words[2] = params->flags;
+    return 3;
+}
+
+static inline bool scmi_base_set_device_permissions_params_decode(const uint32_t *words,
+        size_t count, struct scmi_base_set_device_permissions_params *params)
+{
+    if (count != 3)
+        return false;
+
+    params->agent_id = words[0];
+    params->device_id = words[1];
+    params->flags = words[2];
+    return true;
+}
+
+static inline uint32_t scmi_base_set_device_permissions_flags_access_type(uint32_t flags)
+{
+    return SCMI_CODEC_BITS(flags, 0, 0);
+}
+
+/* base SET_PROTOCOL_PERMISSIONS, command 0xA */
+
+#define SCMI_BASE_SET_PROTOCOL_PERMISSIONS_MSG_ID                       0xA
+#define SCMI_BASE_SET_PROTOCOL_PERMISSIONS_PARAM_AGENT_ID               0
+#define SCMI_BASE_SET_PROTOCOL_PERMISSIONS_PARAM_DEVICE_ID              1
+#define SCMI_BASE_SET_PROTOCOL_PERMISSIONS_PARAM_COMMAND_ID             2
+#define SCMI_BASE_SET_PROTOCOL_PERMISSIONS_COMMAND_ID_PROTOCOL_ID_LOW   0
+#define SCMI_BASE_SET_PROTOCOL_PERMISSIONS_COMMAND_ID_PROTOCOL_ID_HIGH  7
+#define SCMI_BASE_SET_PROTOCOL_PERMISSIONS_PARAM_FLAGS                  3
+#define SCMI_BASE_SET_PROTOCOL_PERMISSIONS_FLAGS_ACCESS_TYPE_LOW        0
+#define SCMI_BASE_SET_PROTOCOL_PERMISSIONS_FLAGS_ACCESS_TYPE_HIGH       0
+#define SCMI_BASE_SET_PROTOCOL_PERMISSIONS_PARAM_COUNT                  4
+#define SCMI_BASE_SET_PROTOCOL_PERMISSIONS_RET_COUNT                    0
+
+struct scmi_base_set_protocol_permissions_params {
+    uint32_t agent_id;
+    uint32_t device_id;
+    uint32_t command_id;
+    uint32_t flags;
+};
+
+static inline size_t scmi_base_set_protocol_permissions_params_encode(uint32_t *words,
+        const struct scmi_base_set_protocol_permissions_params *params)
+{
+    words[0] = params->agent_id;
+    words[1] = params->device_id;
+    words[2] = params->command_id;
+    words[3] = params->flags;
+    return 4;
+}
+
+static inline bool scmi_base_set_protocol_permissions_params_decode(const uint32_t *words,
+        size_t count, struct scmi_base_set_protocol_permissions_params *params)
+{
+    if (count != 4)
+        return false;
+
+    params->agent_id = words[0];
+    params->device_id = words[1];
+    params->command_id = words[2];
+    params->flags = words[3];
+    return true;
+}
+
+static inline uint32_t scmi_base_set_protocol_permissions_command_id_protocol_id(uint32_t command_id)
+{
+    return SCMI_CODEC_BITS(command_id, 0, 7);
+}
+
+static inline uint32_t scmi_base_set_protocol_permissions_flags_access_type(uint32_t flags)
+{
+    return SCMI_CODEC_BITS(flags, 0, 0);
+}
+
+/* base RESET_AGENT_CONFIGURATION, command 0xB */
+
+#define SCMI_BASE_RESET_AGENT_CONFIGURATION_MSG_ID                      0xB
+#define SCMI_BASE_RESET_AGENT_CONFIGURATION_PARAM_AGENT_ID              0
+#define SCMI_BASE_RESET_AGENT_CONFIGURATION_PARAM_FLAGS                 1
+#define SCMI_BASE_RESET_AGENT_CONFIGURATION_FLAGS_PERMISSIONS_RESET_LOW 0
+#define SCMI_BASE_RESET_AGENT_CONFIGURATION_FLAGS_PERMISSIONS_RESET_HIGH 0
+#define SCMI_BASE_RESET_AGENT_CONFIGURATION_PARAM_COUNT                 2
+#define SCMI_BASE_RESET_AGENT_CONFIGURATION_RET_COUNT                   0
+
+struct scmi_base_reset_agent_configuration_params {
+    uint32_t agent_id;
+    uint32_t flags;
+};
+
+static inline size_t scmi_base_reset_agent_configuration_params_encode(uint32_t *words,
+        const struct scmi_base_reset_agent_configuration_params *params)
+{
+    words[0] = params->agent_id;
+    words[1] = params->flags;
+    return 2;
+}
+
+static inline bool scmi_base_reset_agent_configuration_params_decode(const uint32_t *words,
+        size_t count, struct scmi_base_reset_agent_configuration_params *params)
+{
+    if (count != 2)
+        return false;
+
+    params->agent_id = words[0];
+    params->flags = words[1];
+    return true;
+}
+
+static inline uint32_t scmi_base_reset_agent_configuration_flags_permissions_reset(uint32_t flags)
+{
+    return SCMI_CODEC_BITS(flags, 0, 0);
+}
+
+/* base ERROR_EVENT, notification 0x0 */
+
+#define SCMI_BASE_ERROR_EVENT_MSG_ID                                    0x0
+#define SCMI_BASE_ERROR_EVENT_RET_AGENT_ID                              0
+#define SCMI_BASE_ERROR_EVENT_RET_ERROR_STATUS                          1
+#define SCMI_BASE_ERROR_EVENT_RET_MSG_REPORTS                           2
+#define SCMI_BASE_ERROR_EVENT_RET_COUNT                                 2
+
+struct scmi_base_error_event_returns {
+    uint32_t agent_id;
+    uint32_t error_status;
+    const uint32_t *msg_reports;
+    size_t msg_reports_count;
+};
+
+static inline size_t scmi_base_error_event_returns_encode(uint32_t *words,
+        const struct scmi_base_error_event_returns *returns)
+{
+    words[0] = returns->agent_id;
+    words[1] = returns->error_status;
+    scmi_codec_copy_bytes(&words[2], returns->msg_reports,
+                          returns->msg_reports_count * sizeof(uint32_t));
+    return 2 + returns->msg_reports_count;
+}
+
+static inline bool scmi_base_error_event_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_base_error_event_returns *returns)
+{
+    if (count < 2)
+        return false;
+
+    returns->agent_id = words[0];
+    returns->error_status = words[1];
+    returns->msg_reports = &words[2];
+    returns->msg_reports_count = count - 2;
+    return true;
+}
+
+/* power_domain protocol */
+
+#define SCMI_POWER_DOMAIN_PROTOCOL_ID                                   0x11
+
+/* power_domain PROTOCOL_VERSION, command 0x0 */
+
+#define SCMI_POWER_DOMAIN_PROTOCOL_VERSION_MSG_ID                       0x0
+#define SCMI_POWER_DOMAIN_PROTOCOL_VERSION_PARAM_COUNT                  0
+#define SCMI_POWER_DOMAIN_PROTOCOL_VERSION_RET_VERSION                  0
+#define SCMI_POWER_DOMAIN_PROTOCOL_VERSION_RET_COUNT                    1
+
+struct scmi_power_domain_protocol_version_returns {
+    uint32_t version;
+};
+
+static inline size_t scmi_power_domain_protocol_version_returns_encode(uint32_t *words,
+        const struct scmi_power_domain_protocol_version_returns *returns)
+{
+    words[0] = returns->version;
+    return 1;
+}
+
+static inline bool scmi_power_domain_protocol_version_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_power_domain_protocol_version_returns *returns)
+{
+    if (count != 1)
+        return false;
+
+    returns->version = words[0];
+    return true;
+}
+
+/* power_domain PROTOCOL_ATTRIBUTES, command 0x1 */
+
+#define SCMI_POWER_DOMAIN_PROTOCOL_ATTRIBUTES_MSG_ID                    0x1
+#define SCMI_POWER_DOMAIN_PROTOCOL_ATTRIBUTES_PARAM_COUNT               0
+#define SCMI_POWER_DOMAIN_PROTOCOL_ATTRIBUTES_RET_ATTRIBUTES            0
+#define SCMI_POWER_DOMAIN_PROTOCOL_ATTRIBUTES_ATTRIBUTES_NUM_DOMAINS_LOW 0
+#define SCMI_POWER_DOMAIN_PROTOCOL_ATTRIBUTES_ATTRIBUTES_NUM_DOMAINS_HIGH 15
+#define SCMI_POWER_DOMAIN_PROTOCOL_ATTRIBUTES_RET_STATISTICS_ADDRESS_LOW 1
+#define SCMI_POWER_DOMAIN_PROTOCOL_ATTRIBUTES_RET_STATISTICS_ADDRESS_HIGH 2
+#define SCMI_POWER_DOMAIN_PROTOCOL_ATTRIBUTES_RET_STATISTICS_LEN        3
+#define SCMI_POWER_DOMAIN_PROTOCOL_ATTRIBUTES_RET_COUNT                 4
+
+struct scmi_power_domain_protocol_attributes_returns {
+    uint32_t attributes;
+    uint32_t statistics_address_low;
+    uint32_t statistics_address_high;
+    uint32_t statistics_len;
+};
+
+static inline size_t scmi_power_domain_protocol_attributes_returns_encode(uint32_t *words,
+        const struct scmi_power_domain_protocol_attributes_returns *returns)
+{
+    words[0] = returns->attributes;
+    words[1] = returns->statistics_address_low;
+    words[2] = returns->statistics_address_high;
+    words[3] = returns->statistics_len;
+    return 4;
+}
+
+static inline bool scmi_power_domain_protocol_attributes_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_power_domain_protocol_attributes_returns *returns)
+{
+    if (count != 4)
+        return false;
+
+    returns->attributes = words[0];
+    returns->statistics_address_low = words[1];
+    returns->statistics_address_high = words[2];
+    returns->statistics_len = words[3];
+    return true;
+}
+
+static inline uint32_t scmi_power_domain_protocol_attributes_attributes_num_domains(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 0, 15);
+}
+
+/* power_domain PROTOCOL_MESSAGE_ATTRIBUTES, command 0x2 */
+
+#define SCMI_POWER_DOMAIN_PROTOCOL_MESSAGE_ATTRIBUTES_MSG_ID            0x2
+#define SCMI_POWER_DOMAIN_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_MESSAGE_ID  0
+#define SCMI_POWER_DOMAIN_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_COUNT       1
+#define SCMI_POWER_DOMAIN_PROTOCOL_MESSAGE_ATTRIBUTES_RET_ATTRIBUTES    0
+#define SCMI_POWER_DOMAIN_PROTOCOL_MESSAGE_ATTRIBUTES_RET_COUNT         1
+
+struct scmi_power_domain_protocol_message_attributes_params {
+    uint32_t message_id;
+};
+
+static inline size_t scmi_power_domain_protocol_message_attributes_params_encode(uint32_t *words,
+        const struct scmi_power_domain_protocol_message_attributes_params *params)
+{
+    words[0] = params->message_id;
+    return 1;
+}
+
+static inline bool scmi_power_domain_protocol_message_attributes_params_decode(const uint32_t *words,
+        size_t count, struct scmi_power_domain_protocol_message_attributes_params *params)
+{
+    if (count != 1)
+        return false;
+
+    params->message_id = words[0];
+    return true;
+}
+
+struct scmi_power_domain_protocol_message_attributes_returns {
+    uint32_t attributes;
+};
+
+static inline size_t scmi_power_domain_protocol_message_attributes_returns_encode(uint32_t *words,
+        const struct scmi_power_domain_protocol_message_attributes_returns *returns)
+{
+    words[0] = returns->attributes;
+    return 1;
+}
+
+static inline bool scmi_power_domain_protocol_message_attributes_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_power_domain_protocol_message_attributes_returns *returns)
+{
+    if (count != 1)
+        return false;
+
+    returns->attributes = words[0];
+    return true;
+}
+
+/* power_domain DOMAIN_ATTRIBUTES, command 0x3 */
+
+#define SCMI_POWER_DOMAIN_DOMAIN_ATTRIBUTES_MSG_ID                      0x3
+#define SCMI_POWER_DOMAIN_DOMAIN_ATTRIBUTES_PARAM_DOMAIN_ID             0
+#define SCMI_POWER_DOMAIN_DOMAIN_ATTRIBUTES_PARAM_COUNT                 1
+#define SCMI_POWER_DOMAIN_DOMAIN_ATTRIBUTES_RET_ATTRIBUTES              0
+#define SCMI_POWER_DOMAIN_DOMAIN_ATTRIBUTES_ATTRIBUTES_SYNC_LOW         29
+#define SCMI_POWER_DOMAIN_DOMAIN_ATTRIBUTES_ATTRIBUTES_SYNC_HIGH        29
+#define SCMI_POWER_DOMAIN_DOMAIN_ATTRIBUTES_ATTRIBUTES_ASYNC_LOW        30
+#define SCMI_POWER_DOMAIN_DOMAIN_ATTRIBUTES_ATTRIBUTES_ASYNC_HIGH       30
+#define SCMI_POWER_DOMAIN_DOMAIN_ATTRIBUTES_ATTRIBUTES_STATE_NOTIFICATIONS_LOW 31
+#define SCMI_POWER_DOMAIN_DOMAIN_ATTRIBUTES_ATTRIBUTES_STATE_NOTIFICATIONS_HIGH 31
+#define SCMI_POWER_DOMAIN_DOMAIN_ATTRIBUTES_RET_NAME                    1
+#define SCMI_POWER_DOMAIN_DOMAIN_ATTRIBUTES_RET_COUNT                   5
+
+struct scmi_power_domain_domain_attributes_params {
+    uint32_t domain_id;
+};
+
+static inline size_t scmi_power_domain_domain_attributes_params_encode(uint32_t *words,
+        const struct scmi_power_domain_domain_attributes_params *params)
+{
+    words[0] = params->domain_id;
+    return 1;
+}
+
+static inline bool scmi_power_domain_domain_attributes_params_decode(const uint32_t *words,
+        size_t count, struct scmi_power_domain_domain_attributes_params *params)
+{
+    if (count != 1)
+        return false;
+
+    params->domain_id = words[0];
+    return true;
+}
+
+struct scmi_power_domain_domain_attributes_returns {
+    uint32_t attributes;
+    uint8_t name[SCMI_CODEC_NAME_SIZE];
+};
+
+static inline size_t scmi_power_domain_domain_attributes_returns_encode(uint32_t *words,
+        const struct scmi_power_domain_domain_attributes_returns *returns)
+{
+    words[0] = returns->attributes;
+    scmi_codec_copy_bytes(&words[1], returns->name, SCMI_CODEC_NAME_SIZE);
+    return 5;
+}
+
+static inline bool scmi_power_domain_domain_attributes_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_power_domain_domain_attributes_returns *returns)
+{
+    if (count != 5)
+        return false;
+
+    returns->attributes = words[0];
+    scmi_codec_copy_bytes(returns->name, &words[1], SCMI_CODEC_NAME_SIZE);
+    return true;
+}
+
+static inline uint32_t scmi_power_domain_domain_attributes_attributes_sync(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 29, 29);
+}
+
+static inline uint32_t scmi_power_domain_domain_attributes_attributes_async(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 30, 30);
+}
+
+static inline uint32_t scmi_power_domain_domain_attributes_attributes_state_notifications(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 31, 31);
+}
+
+/* power_domain STATE_SET, command 0x4 */
+
+#define SCMI_POWER_DOMAIN_STATE_SET_MSG_ID                              0x4
+#define SCMI_POWER_DOMAIN_STATE_SET_PARAM_FLAGS                         0
+#define SCMI_POWER_DOMAIN_STATE_SET_FLAGS_ASYNC_LOW                     0
+#define SCMI_POWER_DOMAIN_STATE_SET_FLAGS_ASYNC_HIGH                    0
+#define SCMI_POWER_DOMAIN_STATE_SET_PARAM_DOMAIN_ID                     1
+#define SCMI_POWER_DOMAIN_STATE_SET_PARAM_POWER_STATE                   2
+#define SCMI_POWER_DOMAIN_STATE_SET_PARAM_COUNT                         3
+#define SCMI_POWER_DOMAIN_STATE_SET_RET_COUNT                           0
+
+struct scmi_power_domain_state_set_params {
+    uint32_t flags;
+    uint32_t domain_id;
+    uint32_t power_state;
+};
+
+static inline size_t scmi_power_domain_state_set_params_encode(uint32_t *words,
+        const struct scmi_power_domain_state_set_params *params)
+{
+    words[0] = params->flags;
+    words[1] = params->domain_id;
+    words[2] = params->power_state;
+    return 3;
+}
+
+static inline bool scmi_power_domain_state_set_params_decode(const uint32_t *words,
+        size_t count, struct scmi_power_domain_state_set_params *params)
+{
+    if (count != 3)
+        return false;
+
+    params->flags = words[0];
+    params->domain_id = words[1];
+    params->power_state = words[2];
+    return true;
+}
+
+static inline uint32_t scmi_power_domain_state_set_flags_async(uint32_t flags)
+{
+    return SCMI_CODEC_BITS(flags, 0, 0);
+}
+
+/* power_domain STATE_GET, command 0x5 */
+
+#define SCMI_POWER_DOMAIN_STATE_GET_MSG_ID                              0x5
+#define SCMI_POWER_DOMAIN_STATE_GET_PARAM_DOMAIN_ID                     0
+#define SCMI_POWER_DOMAIN_STATE_GET_PARAM_COUNT                         1
+#define SCMI_POWER_DOMAIN_STATE_GET_RET_POWER_STATE                     0
+#define SCMI_POWER_DOMAIN_STATE_GET_RET_COUNT                           1
+
+struct scmi_power_domain_state_get_params {
+    uint32_t domain_id;
+};
+
+static inline size_t scmi_power_domain_state_get_params_encode(uint32_t *words,
+        const struct scmi_power_domain_state_get_params *params)
+{
+    words[0] = params->domain_id;
+    return 1;
+}
+
+static inline bool scmi_power_domain_state_get_params_decode(const uint32_t *words,
+        size_t count, struct scmi_power_domain_state_get_params *params)
+{
+    if (count != 1)
+        return false;
+
+    params->domain_id = words[0];
+    return true;
+}
+
+struct scmi_power_domain_state_get_returns {
+    uint32_t power_state;
+};
+
+static inline size_t scmi_power_domain_state_get_returns_encode(uint32_t *words,
+        const struct scmi_power_domain_state_get_returns *returns)
+{
+    words[0] = returns->power_state;
+    return 1;
+}
+
+static inline bool scmi_power_domain_state_get_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_power_domain_state_get_returns *returns)
+{
+    if (count != 1)
+        return false;
+
+    returns->power_state = words[0];
+    return true;
+}
+
+/* power_domain STATE_NOTIFY, command 0x6 */
+
+#define SCMI_POWER_DOMAIN_STATE_NOTIFY_MSG_ID                           0x6
+#define SCMI_POWER_DOMAIN_STATE_NOTIFY_PARAM_DOMAIN_ID                  0
+#define SCMI_POWER_DOMAIN_STATE_NOTIFY_PARAM_NOTIFY_ENABLE              1
+#define SCMI_POWER_DOMAIN_STATE_NOTIFY_NOTIFY_ENABLE_ENABLE_LOW         0
+#define SCMI_POWER_DOMAIN_STATE_NOTIFY_NOTIFY_ENABLE_ENABLE_HIGH        0
+#define SCMI_POWER_DOMAIN_STATE_NOTIFY_PARAM_COUNT                      2
+#define SCMI_POWER_DOMAIN_STATE_NOTIFY_RET_COUNT                        0
+
+struct scmi_power_domain_state_notify_params {
+    uint32_t domain_id;
+    uint32_t notify_enable;
+};
+
+static inline size_t scmi_power_domain_state_notify_params_encode(uint32_t *words,
+        const struct scmi_power_domain_state_notify_params *params)
+{
+    words[0] = params->domain_id;
+    words[1] = params->notify_enable;
+    return 2;
+}
+
+static inline bool scmi_power_domain_state_notify_params_decode(const uint32_t *words,
+        size_t count, struct scmi_power_domain_state_notify_params *params)
+{
+    if (count != 2)
+        return false;
+
+    params->domain_id = words[0];
+    params->notify_enable = words[1];
+    return true;
+}
+
+static inline uint32_t scmi_power_domain_state_notify_notify_enable_enable(uint32_t notify_enable)
+{
+    return SCMI_CODEC_BITS(notify_enable, 0, 0);
+}
+
+/* power_domain STATE_CHANGE_REQUESTED_NOTIFY, command 0x7 */
+
+#define SCMI_POWER_DOMAIN_STATE_CHANGE_REQUESTED_NOTIFY_MSG_ID          0x7
+#define SCMI_POWER_DOMAIN_STATE_CHANGE_REQUESTED_NOTIFY_PARAM_DOMAIN_ID 0
+#define SCMI_POWER_DOMAIN_STATE_CHANGE_REQUESTED_NOTIFY_PARAM_NOTIFY_ENABLE 1
+#define SCMI_POWER_DOMAIN_STATE_CHANGE_REQUESTED_NOTIFY_NOTIFY_ENABLE_ENABLE_LOW 0
+#define SCMI_POWER_DOMAIN_STATE_CHANGE_REQUESTED_NOTIFY_NOTIFY_ENABLE_ENABLE_HIGH 0
+#define SCMI_POWER_DOMAIN_STATE_CHANGE_REQUESTED_NOTIFY_PARAM_COUNT     2
+#define SCMI_POWER_DOMAIN_STATE_CHANGE_REQUESTED_NOTIFY_RET_COUNT       0
+
+struct scmi_power_domain_state_change_requested_notify_params {
+    uint32_t domain_id;
+    uint32_t notify_enable;
+};
+
+static inline size_t scmi_power_domain_state_change_requested_notify_params_encode(uint32_t *words,
+        const struct scmi_power_domain_state_change_requested_notify_params *params)
+{
+    words[0] = params->domain_id;
+    words[1] = params->notify_enable;
+    return 2;
+}
+
+static inline bool scmi_power_domain_state_change_requested_notify_params_decode(const uint32_t *words,
+        size_t count, struct scmi_power_domain_state_change_requested_notify_params *params)
+{
+    if (count != 2)
+        return false;
+
+    params->domain_id = words[0];
+    params->notify_enable = words[1];
+    return true;
+}
+
+static inline uint32_t scmi_power_domain_state_change_requested_notify_notify_enable_enable(uint32_t notify_enable)
+{
+    return SCMI_CODEC_BITS(notify_enable, 0, 0);
+}
+
+/* power_domain STATE_CHANGED, notification 0x0 */
+
+#define SCMI_POWER_DOMAIN_STATE_CHANGED_MSG_ID                          0x0
+#define SCMI_POWER_DOMAIN_STATE_CHANGED_RET_AGENT_ID                    0
+#define SCMI_POWER_DOMAIN_STATE_CHANGED_RET_DOMAIN_ID                   1
+#define SCMI_POWER_DOMAIN_STATE_CHANGED_RET_POWER_STATE                 2
+#define SCMI_POWER_DOMAIN_STATE_CHANGED_RET_COUNT                       3
+
+struct scmi_power_domain_state_changed_returns {
+    uint32_t agent_id;
+    uint32_t domain_id;
+    uint32_t power_state;
+};
+
+static inline size_t scmi_power_domain_state_changed_returns_encode(uint32_t *words,
+        const struct scmi_power_domain_state_changed_returns *returns)
+{
+    words[0] = returns->agent_id;
+    words[1] = returns->domain_id;
+    words[2] = returns->power_state;
+    return 3;
+}
+
+static inline bool scmi_power_domain_state_changed_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_power_domain_state_changed_returns *returns)
+{
+    if (count != 3)
+        return false;
+
+    returns->agent_id = words[0];
+    returns->domain_id = words[1];
+    returns->power_state = words[2];
+    return true;
+}
+
+/* power_domain STATE_CHANGE_REQUESTED, notification 0x1 */
+
+#define SCMI_POWER_DOMAIN_STATE_CHANGE_REQUESTED_MSG_ID                 0x1
+#define SCMI_POWER_DOMAIN_STATE_CHANGE_REQUESTED_RET_AGENT_ID           0
+#define SCMI_POWER_DOMAIN_STATE_CHANGE_REQUESTED_RET_DOMAIN_ID          1
+#define SCMI_POWER_DOMAIN_STATE_CHANGE_REQUESTED_RET_POWER_STATE        2
+#define SCMI_POWER_DOMAIN_STATE_CHANGE_REQUESTED_RET_COUNT              3
+
+struct scmi_power_domain_state_change_requested_returns {
+    uint32_t agent_id;
+    uint32_t domain_id;
+    uint32_t power_state;
+};
+
+static inline size_t scmi_power_domain_state_change_requested_returns_encode(uint32_t *words,
+        const struct scmi_power_domain_state_change_requested_returns *returns)
+{
+    words[0] = returns->agent_id;
+    words[1] = returns->domain_id;
+    words[2] = returns->power_state;
+    return 3;
+}
+
+static inline bool scmi_power_domain_state_change_requested_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_power_domain_state_change_requested_returns *returns)
+{
+    if (count != 3)
+        return false;
+
+    returns->agent_id = words[0];
+    returns->domain_id = words[1];
+    returns->power_state = words[2];
+    return true;
+}
+
+/* system_power protocol */
+
+#define SCMI_SYSTEM_POWER_PROTOCOL_ID                                   0x12
+
+/* system_power PROTOCOL_VERSION, command 0x0 */
+
+#define SCMI_SYSTEM_POWER_PROTOCOL_VERSION_MSG_ID                       0x0
+#define SCMI_SYSTEM_POWER_PROTOCOL_VERSION_PARAM_COUNT                  0
+#define SCMI_SYSTEM_POWER_PROTOCOL_VERSION_RET_VERSION                  0
+#define SCMI_SYSTEM_POWER_PROTOCOL_VERSION_RET_COUNT                    1
+
+struct scmi_system_power_protocol_version_returns {
+    uint32_t version;
+};
+
+static inline size_t scmi_system_power_protocol_version_returns_encode(uint32_t *words,
+        const struct scmi_system_power_protocol_version_returns *returns)
+{
+    words[0] = returns->version;
+    return 1;
+}
+
+static inline bool scmi_system_power_protocol_version_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_system_power_protocol_version_returns *returns)
+{
+    if (count != 1)
+        return false;
+
+    returns->version = words[0];
+    return true;
+}
+
+/* system_power PROTOCOL_ATTRIBUTES, command 0x1 */
+
+#define SCMI_SYSTEM_POWER_PROTOCOL_ATTRIBUTES_MSG_ID                    0x1
+#define SCMI_SYSTEM_POWER_PROTOCOL_ATTRIBUTES_PARAM_COUNT               0
+#define SCMI_SYSTEM_POWER_PROTOCOL_ATTRIBUTES_RET_ATTRIBUTES            0
+#define SCMI_SYSTEM_POWER_PROTOCOL_ATTRIBUTES_RET_COUNT                 1
+
+struct scmi_system_power_protocol_attributes_returns {
+    uint32_t attributes;
+};
+
+static inline size_t scmi_system_power_protocol_attributes_returns_encode(uint32_t *words,
+        const struct scmi_system_power_protocol_attributes_returns *returns)
+{
+    words[0] = returns->attributes;
+    return 1;
+}
+
+static inline bool scmi_system_power_protocol_attributes_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_system_power_protocol_attributes_returns *returns)
+{
+    if (count != 1)
+        return false;
+
+    returns->attributes = words[0];
+    return true;
+}
+
+/* system_power PROTOCOL_MESSAGE_ATTRIBUTES, command 0x2 */
+
+#define SCMI_SYSTEM_POWER_PROTOCOL_MESSAGE_ATTRIBUTES_MSG_ID            0x2
+#define SCMI_SYSTEM_POWER_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_MESSAGE_ID  0
+#define SCMI_SYSTEM_POWER_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_COUNT       1
+#define SCMI_SYSTEM_POWER_PROTOCOL_MESSAGE_ATTRIBUTES_RET_ATTRIBUTES    0
+#define SCMI_SYSTEM_POWER_PROTOCOL_MESSAGE_ATTRIBUTES_ATTRIBUTES_SUSPEND_LOW 30
+#define SCMI_SYSTEM_POWER_PROTOCOL_MESSAGE_ATTRIBUTES_ATTRIBUTES_SUSPEND_HIGH 30
+#define SCMI_SYSTEM_POWER_PROTOCOL_MESSAGE_ATTRIBUTES_ATTRIBUTES_WARM_RESET_LOW 31
+#define SCMI_SYSTEM_POWER_PROTOCOL_MESSAGE_ATTRIBUTES_ATTRIBUTES_WARM_RESET_HIGH 31
+#define SCMI_SYSTEM_POWER_PROTOCOL_MESSAGE_ATTRIBUTES_RET_COUNT         1
+
+struct scmi_system_power_protocol_message_attributes_params {
+    uint32_t message_id;
+};
+
+static inline size_t scmi_system_power_protocol_message_attributes_params_encode(uint32_t *words,
+        const struct scmi_system_power_protocol_message_attributes_params *params)
+{
+    words[0] = params->message_id;
+    return 1;
+}
+
+static inline bool scmi_system_power_protocol_message_attributes_params_decode(const uint32_t *words,
+        size_t count, struct scmi_system_power_protocol_message_attributes_params *params)
+{
+    if (count != 1)
+        return false;
+
+    params->message_id = words[0];
+    return true;
+}
+
+struct scmi_system_power_protocol_message_attributes_returns {
+    uint32_t attributes;
+};
+
+static inline size_t scmi_system_power_protocol_message_attributes_returns_encode(uint32_t *words,
+        const struct scmi_system_power_protocol_message_attributes_returns *returns)
+{
+    words[0] = returns->attributes;
+    return 1;
+}
+
+static inline bool scmi_system_power_protocol_message_attributes_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_system_power_protocol_message_attributes_returns *returns)
+{
+    if (count != 1)
+        return false;
+
+    returns->attributes = words[0];
+    return true;
+}
+
+static inline uint32_t scmi_system_power_protocol_message_attributes_attributes_suspend(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 30, 30);
+}
+
+static inline uint32_t scmi_system_power_protocol_message_attributes_attributes_warm_reset(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 31, 31);
+}
+
+/* system_power STATE_SET, command 0x3 */
+
+#define SCMI_SYSTEM_POWER_STATE_SET_MSG_ID                              0x3
+#define SCMI_SYSTEM_POWER_STATE_SET_PARAM_FLAGS                         0
+#define SCMI_SYSTEM_POWER_STATE_SET_FLAGS_GRACEFUL_LOW                  0
+#define SCMI_SYSTEM_POWER_STATE_SET_FLAGS_GRACEFUL_HIGH                 0
+#define SCMI_SYSTEM_POWER_STATE_SET_PARAM_SYSTEM_STATE                  1
+#define SCMI_SYSTEM_POWER_STATE_SET_PARAM_COUNT                         2
+#define SCMI_SYSTEM_POWER_STATE_SET_RET_COUNT                           0
+
+struct scmi_system_power_state_set_params {
+    uint32_t flags;
+    uint32_t system_state;
+};
+
+static inline size_t scmi_system_power_state_set_params_encode(uint32_t *words,
+        const struct scmi_system_power_state_set_params *params)
+{
+    words[0] = params->flags;
+    words[1] = params->system_state;
+    return 2;
+}
+
+static inline bool scmi_system_power_state_set_params_decode(const uint32_t *words,
+        size_t count, struct scmi_system_power_state_set_params *params)
+{
+    if (count != 2)
+        return false;
+
+    params->flags = words[0];
+    params->system_state = words[1];
+    return true;
+}
+
+static inline uint32_t scmi_system_power_state_set_flags_graceful(uint32_t flags)
+{
+    return SCMI_CODEC_BITS(flags, 0, 0);
+}
+
+/* system_power STATE_GET, command 0x4 */
+
+#define SCMI_SYSTEM_POWER_STATE_GET_MSG_ID                              0x4
+#define SCMI_SYSTEM_POWER_STATE_GET_PARAM_COUNT                         0
+#define SCMI_SYSTEM_POWER_STATE_GET_RET_SYSTEM_STATE                    0
+#define SCMI_SYSTEM_POWER_STATE_GET_RET_COUNT                           1
+
+struct scmi_system_power_state_get_returns {
+    uint32_t system_state;
+};
+
+static inline size_t scmi_system_power_state_get_returns_encode(uint32_t *words,
+        const struct scmi_system_power_state_get_returns *returns)
+{
+    words[0] = returns->system_state;
+    return 1;
+}
+
+static inline bool scmi_system_power_state_get_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_system_power_state_get_returns *returns)
+{
+    if (count != 1)
+        return false;
+
+    returns->system_state = words[0];
+    return true;
+}
+
+/* system_power STATE_NOTIFY, command 0x5 */
+
+#define SCMI_SYSTEM_POWER_STATE_NOTIFY_MSG_ID                           0x5
+#define SCMI_SYSTEM_POWER_STATE_NOTIFY_PARAM_NOTIFY_ENABLE              0
+#define SCMI_SYSTEM_POWER_STATE_NOTIFY_NOTIFY_ENABLE_ENABLE_LOW         0
+#define SCMI_SYSTEM_POWER_STATE_NOTIFY_NOTIFY_ENABLE_ENABLE_HIGH        0
+#define SCMI_SYSTEM_POWER_STATE_NOTIFY_PARAM_COUNT                      1
+#define SCMI_SYSTEM_POWER_STATE_NOTIFY_RET_COUNT                        0
+
+struct scmi_system_power_state_notify_params {
+    uint32_t notify_enable;
+};
+
+static inline size_t scmi_system_power_state_notify_params_encode(uint32_t *words,
+        const struct scmi_system_power_state_notify_params *params)
+{
+    words[0] = params->notify_enable;
+    return 1;
+}
+
+static inline bool scmi_system_power_state_notify_params_decode(const uint32_t *words,
+        size_t count, struct scmi_system_power_state_notify_params *params)
+{
+    if (count != 1)
+        return false;
+
+    params->notify_enable = words[0];
+    return true;
+}
+
+static inline uint32_t scmi_system_power_state_notify_notify_enable_enable(uint32_t notify_enable)
+{
+    return SCMI_CODEC_BITS(notify_enable, 0, 0);
+}
+
+/* system_power STATE_NOTIFIER, notification 0x0 */
+
+#define SCMI_SYSTEM_POWER_STATE_NOTIFIER_MSG_ID                         0x0
+#define SCMI_SYSTEM_POWER_STATE_NOTIFIER_RET_AGENT_ID                   0
+#define SCMI_SYSTEM_POWER_STATE_NOTIFIER_RET_FLAGS                      1
+#define SCMI_SYSTEM_POWER_STATE_NOTIFIER_RET_SYSTEM_STATE               2
+#define SCMI_SYSTEM_POWER_STATE_NOTIFIER_RET_COUNT                      3
+
+struct scmi_system_power_state_notifier_returns {
+    uint32_t agent_id;
+    uint32_t flags;
+    uint32_t system_state;
+};
+
+static inline size_t scmi_system_power_state_notifier_returns_encode(uint32_t *words,
+        const struct scmi_system_power_state_notifier_returns *returns)
+{
+    words[0] = returns->agent_id;
+    words[1] = returns->flags;
+    words[2] = returns->system_state;
+    return 3;
+}
+
+static inline bool scmi_system_power_state_notifier_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_system_power_state_notifier_returns *returns)
+{
+    if (count != 3)
+        return false;
+
+    returns->agent_id = words[0];
+    returns->flags = words[1];
+    returns->system_state = words[2];
+    return true;
+}
+
+/* performance protocol */
+
+#define SCMI_PERFORMANCE_PROTOCOL_ID                                    0x13
+
+/* performance PROTOCOL_VERSION, command 0x0 */
+
+#define SCMI_PERFORMANCE_PROTOCOL_VERSION_MSG_ID                        0x0
+#define SCMI_PERFORMANCE_PROTOCOL_VERSION_PARAM_COUNT                   0
+#define SCMI_PERFORMANCE_PROTOCOL_VERSION_RET_VERSION                   0
+#define SCMI_PERFORMANCE_PROTOCOL_VERSION_RET_COUNT                     1
+
+struct scmi_performance_protocol_version_returns {
+    uint32_t version;
+};
+
+static inline size_t scmi_performance_protocol_version_returns_encode(uint32_t *words,
+        const struct scmi_performance_protocol_version_returns *returns)
+{
+    words[0] = returns->version;
+    return 1;
+}
+
+static inline bool scmi_performance_protocol_version_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_performance_protocol_version_returns *returns)
+{
+    if (count != 1)
+        return false;
+
+    returns->version = words[0];
+    return true;
+}
+
+/* performance PROTOCOL_ATTRIBUTES, command 0x1 */
+
+#define SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_MSG_ID                     0x1
+#define SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_PARAM_COUNT                0
+#define SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_RET_ATTRIBUTES             0
+#define SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_ATTRIBUTES_NUM_DOMAINS_LOW 0
+#define SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_ATTRIBUTES_NUM_DOMAINS_HIGH 15
+#define SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_ATTRIBUTES_POWER_MW_LOW    16
+#define SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_ATTRIBUTES_POWER_MW_HIGH   16
+#define SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_RET_STATISTICS_ADDRESS_LOW 1
+#define SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_RET_STATISTICS_ADDRESS_HIGH 2
+#define SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_RET_STATISTICS_LEN         3
+#define SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_RET_COUNT                  4
+
+struct scmi_performance_protocol_attributes_returns {
+    uint32_t attributes;
+    uint32_t statistics_address_low;
+    uint32_t statistics_address_high;
+    uint32_t statistics_len;
+};
+
+static inline size_t scmi_performance_protocol_attributes_returns_encode(uint32_t *words,
+        const struct scmi_performance_protocol_attributes_returns *returns)
+{
+    words[0] = returns->attributes;
+    words[1] = returns->statistics_address_low;
+    words[2] = returns->statistics_address_high;
+    words[3] = returns->statistics_len;
+    return 4;
+}
+
+static inline bool scmi_performance_protocol_attributes_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_performance_protocol_attributes_returns *returns)
+{
+    if (count != 4)
+        return false;
+
+    returns->attributes = words[0];
+    returns->statistics_address_low = words[1];
+    returns->statistics_address_high = words[2];
+    returns->statistics_len = words[3];
+    return true;
+}
+
+static inline uint32_t scmi_performance_protocol_attributes_attributes_num_domains(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 0, 15);
+}
+
+static inline uint32_t scmi_performance_protocol_attributes_attributes_power_mw(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 16, 16);
+}
+
+/* performance PROTOCOL_MESSAGE_ATTRIBUTES, command 0x2 */
+
+#define SCMI_PERFORMANCE_PROTOCOL_MESSAGE_ATTRIBUTES_MSG_ID             0x2
+#define SCMI_PERFORMANCE_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_MESSAGE_ID   0
+#define SCMI_PERFORMANCE_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_COUNT        1
+#define SCMI_PERFORMANCE_PROTOCOL_MESSAGE_ATTRIBUTES_RET_ATTRIBUTES     0
+#define SCMI_PERFORMANCE_PROTOCOL_MESSAGE_ATTRIBUTES_ATTRIBUTES_FAST_CHANNEL_LOW 0
+#define SCMI_PERFORMANCE_PROTOCOL_MESSAGE_ATTRIBUTES_ATTRIBUTES_FAST_CHANNEL_HIGH 0
+#define SCMI_PERFORMANCE_PROTOCOL_MESSAGE_ATTRIBUTES_RET_COUNT          1
+
+struct scmi_performance_protocol_message_attributes_params {
+    uint32_t message_id;
+};
+
+static inline size_t scmi_performance_protocol_message_attributes_params_encode(uint32_t *words,
+        const struct scmi_performance_protocol_message_attributes_params *params)
+{
+    words[0] = params->message_id;
+    return 1;
+}
+
+static inline bool scmi_performance_protocol_message_attributes_params_decode(const uint32_t *words,
+        size_t count, struct scmi_performance_protocol_message_attributes_params *params)
+{
+    if (count != 1)
+        return false;
+
+    params->message_id = words[0];
+    return true;
+}
+
+struct scmi_performance_protocol_message_attributes_returns {
+    uint32_t attributes;
+};
+
+static inline size_t scmi_performance_protocol_message_attributes_returns_encode(uint32_t *words,
+        const struct scmi_performance_protocol_message_attributes_returns *returns)
+{
+    words[0] = returns->attributes;
+    return 1;
+}
+
+static inline bool scmi_performance_protocol_message_attributes_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_performance_protocol_message_attributes_returns *returns)
+{
+    if (count != 1)
+        return false;
+
+    returns->attributes = words[0];
+    return true;
+}
+
+static inline uint32_t scmi_performance_protocol_message_attributes_attributes_fast_channel(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 0, 0);
+}
+
+/* performance DOMAIN_ATTRIBUTES, command 0x3 */
+
+#define SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_MSG_ID                       0x3
+#define SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_PARAM_DOMAIN_ID              0
+#define SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_PARAM_COUNT                  1
+#define SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_RET_ATTRIBUTES               0
+#define SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_ATTRIBUTES_FAST_CHANNEL_LOW  27
+#define SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_ATTRIBUTES_FAST_CHANNEL_HIGH 27
+#define SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_ATTRIBUTES_LEVEL_NOTIFY_LOW  28
+#define SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_ATTRIBUTES_LEVEL_NOTIFY_HIGH 28
+#define SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_ATTRIBUTES_LIMIT_NOTIFY_LOW  29
+#define SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_ATTRIBUTES_LIMIT_NOTIFY_HIGH 29
+#define SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_ATTRIBUTES_LEVEL_SET_LOW     30
+#define SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_ATTRIBUTES_LEVEL_SET_HIGH    30
+#define SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_ATTRIBUTES_LIMIT_SET_LOW     31
+#define SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_ATTRIBUTES_LIMIT_SET_HIGH    31
+#define SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_RET_RATE_LIMIT               1
+#define SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_RATE_LIMIT_RATE_LIMIT_LOW    0
+#define SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_RATE_LIMIT_RATE_LIMIT_HIGH   19
+#define SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_RET_SUSTAINED_FREQ           2
+#define SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_RET_SUSTAINED_PERF_LEVEL     3
+#define SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_RET_NAME                     4
+#define SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_RET_COUNT                    8
+
+struct scmi_performance_domain_attributes_params {
+    uint32_t domain_id;
+};
+
+static inline size_t scmi_performance_domain_attributes_params_encode(uint32_t *words,
+        const struct scmi_performance_domain_attributes_params *params)
+{
+    words[0] = params->domain_id;
+    return 1;
+}
+
+static inline bool scmi_performance_domain_attributes_params_decode(const uint32_t *words,
+        size_t count, struct scmi_performance_domain_attributes_params *params)
+{
+    if (count != 1)
+        return false;
+
+    params->domain_id = words[0];
+    return true;
+}
+
+struct scmi_performance_domain_attributes_returns {
+    uint32_t attributes;
+    uint32_t rate_limit;
+    uint32_t sustained_freq;
+    uint32_t sustained_perf_level;
+    uint8_t name[SCMI_CODEC_NAME_SIZE];
+};
+
+static inline size_t scmi_performance_domain_attributes_returns_encode(uint32_t *words,
+        const struct scmi_performance_domain_attributes_returns *returns)
+{
+    words[0] = returns->attributes;
+    words[1] = returns->rate_limit;
+    words[2] = returns->sustained_freq;
+    words[3] = returns->sustained_perf_level;
+    scmi_codec_copy_bytes(&words[4], returns->name, SCMI_CODEC_NAME_SIZE);
+    return 8;
+}
+
+static inline bool scmi_performance_domain_attributes_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_performance_domain_attributes_returns *returns)
+{
+    if (count != 8)
+        return false;
+
+    returns->attributes = words[0];
+    returns->rate_limit = words[1];
+    returns->sustained_freq = words[2];
+    returns->sustained_perf_level = words[3];
+    scmi_codec_copy_bytes(returns->name, &words[4], SCMI_CODEC_NAME_SIZE);
+    return true;
+}
+
+static inline uint32_t scmi_performance_domain_attributes_attributes_fast_channel(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 27, 27);
+}
+
+static inline uint32_t scmi_performance_domain_attributes_attributes_level_notify(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 28, 28);
+}
+
+static inline uint32_t scmi_performance_domain_attributes_attributes_limit_notify(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 29, 29);
+}
+
+static inline uint32_t scmi_performance_domain_attributes_attributes_level_set(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 30, 30);
+}
+
+static inline uint32_t scmi_performance_domain_attributes_attributes_limit_set(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 31, 31);
+}
+
+static inline uint32_t scmi_performance_domain_attributes_rate_limit_rate_limit(uint32_t rate_limit)
+{
+    return SCMI_CODEC_BITS(rate_limit, 0, 19);
+}
+
+/* performance DESCRIBE_LEVELS, command 0x4 */
+
+#define SCMI_PERFORMANCE_DESCRIBE_LEVELS_MSG_ID                         0x4
+#define SCMI_PERFORMANCE_DESCRIBE_LEVELS_PARAM_DOMAIN_ID                0
+#define SCMI_PERFORMANCE_DESCRIBE_LEVELS_PARAM_LEVEL_INDEX              1
+#define SCMI_PERFORMANCE_DESCRIBE_LEVELS_PARAM_COUNT                    2
+#define SCMI_PERFORMANCE_DESCRIBE_LEVELS_RET_NUM_LEVELS                 0
+#define SCMI_PERFORMANCE_DESCRIBE_LEVELS_NUM_LEVELS_NUM_LEVELS_LOW      0
+#define SCMI_PERFORMANCE_DESCRIBE_LEVELS_NUM_LEVELS_NUM_LEVELS_HIGH     11
+#define SCMI_PERFORMANCE_DESCRIBE_LEVELS_NUM_LEVELS_NUM_REMAINING_LOW   16
+#define SCMI_PERFORMANCE_DESCRIBE_LEVELS_NUM_LEVELS_NUM_REMAINING_HIGH  31
+#define SCMI_PERFORMANCE_DESCRIBE_LEVELS_RET_PERF_LEVELS                1
+#define SCMI_PERFORMANCE_DESCRIBE_LEVELS_RET_COUNT                      1
+
+struct scmi_performance_describe_levels_params {
+    uint32_t domain_id;
+    uint32_t level_index;
+};
+
+static inline size_t scmi_performance_describe_levels_params_encode(uint32_t *words,
+        const struct scmi_performance_describe_levels_params *params)
+{
+    words[0] = params->domain_id;
+    words[1] = params->level_index;
+    return 2;
+}
+
+static inline bool scmi_performance_describe_levels_params_decode(const uint32_t *words,
+        size_t count, struct scmi_performance_describe_levels_params *params)
+{
+    if (count != 2)
+        return false;
+
+    params->domain_id = words[0];
+    params->level_index = words[1];
+    return true;
+}
+
+struct scmi_performance_describe_levels_returns {
+    uint32_t num_levels;
+    const uint32_t *perf_levels;
+    size_t perf_levels_count;
+};
+
+static inline size_t scmi_performance_describe_levels_returns_encode(uint32_t *words,
+        const struct scmi_performance_describe_levels_returns *returns)
+{
+    words[0] = returns->num_levels;
+    scmi_codec_copy_bytes(&words[1], returns->perf_levels,
+                          returns->perf_levels_count * sizeof(uint32_t));
+    return 1 + returns->perf_levels_count;
+}
+
+static inline bool scmi_performance_describe_levels_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_performance_describe_levels_returns *returns)
+{
+    if (count < 1)
+        return false;
+
+    returns->num_levels = words[0];
+    returns->perf_levels = &words[1];
+    returns->perf_levels_count = count - 1;
+    return true;
+}
+
+static inline uint32_t scmi_performance_describe_levels_num_levels_num_levels(uint32_t num_levels)
+{
+    return SCMI_CODEC_BITS(num_levels, 0, 11);
+}
+
+static inline uint32_t scmi_performance_describe_levels_num_levels_num_remaining(uint32_t num_levels)
+{
+    return SCMI_CODEC_BITS(num_levels, 16, 31);
+}
+
+/* performance LIMITS_SET, command 0x5 */
+
+#define SCMI_PERFORMANCE_LIMITS_SET_MSG_ID                              0x5
+#define SCMI_PERFORMANCE_LIMITS_SET_PARAM_DOMAIN_ID                     0
+#define SCMI_PERFORMANCE_LIMITS_SET_PARAM_RANGE_MAX                     1
+#define SCMI_PERFORMANCE_LIMITS_SET_PARAM_RANGE_MIN                     2
+#define SCMI_PERFORMANCE_LIMITS_SET_PARAM_COUNT                         3
+#define SCMI_PERFORMANCE_LIMITS_SET_RET_COUNT                           0
+
+struct scmi_performance_limits_set_params {
+    uint32_t domain_id;
+    uint32_t range_max;
+    uint32_t range_min;
+};
+
+static inline size_t scmi_performance_limits_set_params_encode(uint32_t *words,
+        const struct scmi_performance_limits_set_params *params)
+{
+    words[0] = params->domain_id;
+    words[1] = params->range_max;
+    words[2] = params->range_min;
+    return 3;
+}
+
+static inline bool scmi_performance_limits_set_params_decode(const uint32_t *words,
+        size_t count, struct scmi_performance_limits_set_params *params)
+{
+    if (count != 3)
+        return false;
+
+    params->domain_id = words[0];
+    params->range_max = words[1];
+    params->range_min = words[2];
+    return true;
+}
+
+/* performance LIMITS_GET, command 0x6 */
+
+#define SCMI_PERFORMANCE_LIMITS_GET_MSG_ID                              0x6
+#define SCMI_PERFORMANCE_LIMITS_GET_PARAM_DOMAIN_ID                     0
+#define SCMI_PERFORMANCE_LIMITS_GET_PARAM_COUNT                         1
+#define SCMI_PERFORMANCE_LIMITS_GET_RET_RANGE_MAX                       0
+#define SCMI_PERFORMANCE_LIMITS_GET_RET_RANGE_MIN                       1
+#define SCMI_PERFORMANCE_LIMITS_GET_RET_COUNT                           2
+
+struct scmi_performance_limits_get_params {
+    uint32_t domain_id;
+};
+
+static inline size_t scmi_performance_limits_get_params_encode(uint32_t *words,
+        const struct scmi_performance_limits_get_params *params)
+{
+    words[0] = params->domain_id;
+    return 1;
+}
+
+static inline bool scmi_performance_limits_get_params_decode(const uint32_t *words,
+        size_t count, struct scmi_performance_limits_get_params *params)
+{
+    if (count != 1)
+        return false;
+
+    params->domain_id = words[0];
+    return true;
+}
+
+struct scmi_performance_limits_get_returns {
+    uint32_t range_max;
+    uint32_t range_min;
+};
+
+static inline size_t scmi_performance_limits_get_returns_encode(uint32_t *words,
+        const struct scmi_performance_limits_get_returns *returns)
+{
+    words[0] = returns->range_max;
+    words[1] = returns->range_min;
+    return 2;
+}
+
+static inline bool scmi_performance_limits_get_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_performance_limits_get_returns *returns)
+{
+    if (count != 2)
+        return false;
+
+    returns->range_max = words[0];
+    returns->range_min = words[1];
+    return true;
+}
+
+/* performance LEVEL_SET, command 0x7 */
+
+#define SCMI_PERFORMANCE_LEVEL_SET_MSG_ID                               0x7
+#define SCMI_PERFORMANCE_LEVEL_SET_PARAM_DOMAIN_ID                      0
+#define SCMI_PERFORMANCE_LEVEL_SET_PARAM_PERFORMANCE_LEVEL              1
+#define SCMI_PERFORMANCE_LEVEL_SET_PARAM_COUNT                          2
+#define SCMI_PERFORMANCE_LEVEL_SET_RET_COUNT                            0
+
+struct scmi_performance_level_set_params {
+    uint32_t domain_id;
+    uint32_t performance_level;
+};
+
+static inline size_t scmi_performance_level_set_params_encode(uint32_t *words,
+        const struct scmi_performance_level_set_params *params)
+{
+    words[0] = params->domain_id;
+    words[1] = params->performance_level;
+    return 2;
+}
+
+static inline bool scmi_performance_level_set_params_decode(const uint32_t *words,
+        size_t count, struct scmi_performance_level_set_params *params)
+{
+    if (count != 2)
+        return false;
+
+    params->domain_id = words[0];
+    params->performance_level = words[1];
+    return true;
+}
+
+/* performance LEVEL_GET, command 0x8 */
+
+#define SCMI_PERFORMANCE_LEVEL_GET_MSG_ID                               0x8
+#define SCMI_PERFORMANCE_LEVEL_GET_PARAM_DOMAIN_ID                      0
+#define SCMI_PERFORMANCE_LEVEL_GET_PARAM_COUNT                          1
+#define SCMI_PERFORMANCE_LEVEL_GET_RET_PERFORMANCE_LEVEL                0
+#define SCMI_PERFORMANCE_LEVEL_GET_RET_COUNT                            1
+
+struct scmi_performance_level_get_params {
+    uint32_t domain_id;
+};
+
+static inline size_t scmi_performance_level_get_params_encode(uint32_t *words,
+        const struct scmi_performance_level_get_params *params)
+{
+    words[0] = params->domain_id;
+    return 1;
+}
+
+static inline bool scmi_performance_level_get_params_decode(const uint32_t *words,
+        size_t count, struct scmi_performance_level_get_params *params)
+{
+    if (count != 1)
+        return false;
+
+    params->domain_id = words[0];
+    return true;
+}
+
+struct scmi_performance_level_get_returns {
+    uint32_t performance_level;
+};
+
+static inline size_t scmi_performance_level_get_returns_encode(uint32_t *words,
+        const struct scmi_performance_level_get_returns *returns)
+{
+    words[0] = returns->performance_level;
+    return 1;
+}
+
+static inline bool scmi_performance_level_get_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_performance_level_get_returns *returns)
+{
+    if (count != 1)
+        return false;
+
+    returns->performance_level = words[0];
+    return true;
+}
+
+/* performance NOTIFY_LIMITS, command 0x9 */
+
+#define SCMI_PERFORMANCE_NOTIFY_LIMITS_MSG_ID                           0x9
+#define SCMI_PERFORMANCE_NOTIFY_LIMITS_PARAM_DOMAIN_ID                  0
+#define SCMI_PERFORMANCE_NOTIFY_LIMITS_PARAM_NOTIFY_ENABLE              1
+#define SCMI_PERFORMANCE_NOTIFY_LIMITS_NOTIFY_ENABLE_ENABLE_LOW         0
+#define SCMI_PERFORMANCE_NOTIFY_LIMITS_NOTIFY_ENABLE_ENABLE_HIGH        0
+#define SCMI_PERFORMANCE_NOTIFY_LIMITS_PARAM_COUNT                      2
+#define SCMI_PERFORMANCE_NOTIFY_LIMITS_RET_COUNT                        0
+
+struct scmi_performance_notify_limits_params {
+    uint32_t domain_id;
+    uint32_t notify_enable;
+};
+
+static inline size_t scmi_performance_notify_limits_params_encode(uint32_t *words,
+        const struct scmi_performance_notify_limits_params *params)
+{
+    words[0] = params->domain_id;
+    words[1] = params->notify_enable;
+    return 2;
+}
+
+static inline bool scmi_performance_notify_limits_params_decode(const uint32_t *words,
+        size_t count, struct scmi_performance_notify_limits_params *params)
+{
+    if (count != 2)
+        return false;
+
+    params->domain_id = words[0];
+    params->notify_enable = words[1];
+    return true;
+}
+
+static inline uint32_t scmi_performance_notify_limits_notify_enable_enable(uint32_t notify_enable)
+{
+    return SCMI_CODEC_BITS(notify_enable, 0, 0);
+}
+
+/* performance NOTIFY_LEVEL, command 0xA */
+
+#define SCMI_PERFORMANCE_NOTIFY_LEVEL_MSG_ID                            0xA
+#define SCMI_PERFORMANCE_NOTIFY_LEVEL_PARAM_DOMAIN_ID                   0
+#define SCMI_PERFORMANCE_NOTIFY_LEVEL_PARAM_NOTIFY_ENABLE               1
+#define SCMI_PERFORMANCE_NOTIFY_LEVEL_NOTIFY_ENABLE_ENABLE_LOW          0
+#define SCMI_PERFORMANCE_NOTIFY_LEVEL_NOTIFY_ENABLE_ENABLE_HIGH         0
+#define SCMI_PERFORMANCE_NOTIFY_LEVEL_PARAM_COUNT                       2
+#define SCMI_PERFORMANCE_NOTIFY_LEVEL_RET_COUNT                         0
+
+struct scmi_performance_notify_level_params {
+    uint32_t domain_id;
+    uint32_t notify_enable;
+};
+
+static inline size_t scmi_performance_notify_level_params_encode(uint32_t *words,
+        const struct scmi_performance_notify_level_params *params)
+{
+    words[0] = params->domain_id;
+    words[1] = params->notify_enable;
+    return 2;
+}
+
+static inline bool scmi_performance_notify_level_params_decode(const uint32_t *words,
+        size_t count, struct scmi_performance_notify_level_params *params)
+{
+    if (count != 2)
+        return false;
+
+    params->domain_id = words[0];
+    params->notify_enable = words[1];
+    return true;
+}
+
+static inline uint32_t scmi_performance_notify_level_notify_enable_enable(uint32_t notify_enable)
+{
+    return SCMI_CODEC_BITS(notify_enable, 0, 0);
+}
+
+/* performance DESCRIBE_FASTCHANNEL, command 0xB */
+
+#define SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_MSG_ID                    0xB
+#define SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_PARAM_DOMAIN_ID           0
+#define SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_PARAM_MESSAGE_ID          1
+#define SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_PARAM_COUNT               2
+#define SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_ATTRIBUTES            0
+#define SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_ATTRIBUTES_DOORBELL_LOW   0
+#define SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_ATTRIBUTES_DOORBELL_HIGH  0
+#define SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_ATTRIBUTES_DOORBELL_WIDTH_LOW 1
+#define SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_ATTRIBUTES_DOORBELL_WIDTH_HIGH 2
+#define SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_RATE_LIMIT            1
+#define SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_CHAN_ADDR_LOW         2
+#define SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_CHAN_ADDR_HIGH        3
+#define SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_CHAN_SIZE             4
+#define SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_DOORBELL_ADDR_LOW     5
+#define SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_DOORBELL_ADDR_HIGH    6
+#define SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_DOORBELL_SET_MASK_LOW 7
+#define SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_DOORBELL_SET_MASK_HIGH 8
+#define SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_DOORBELL_PRESERVE_MASK_LOW 9
+#define SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_DOORBELL_PRESERVE_MASK_HIGH 10
+#define SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_COUNT                 11
+
+struct scmi_performance_describe_fastchannel_params {
+    uint32_t domain_id;
+    uint32_t message_id;
+};
+
+static inline size_t scmi_performance_describe_fastchannel_params_encode(uint32_t *words,
+        const struct scmi_performance_describe_fastchannel_params *params)
+{
+    words[0] = params->domain_id;
+    words[1] = params->message_id;
+    return 2;
+}
+
+static inline bool scmi_performance_describe_fastchannel_params_decode(const uint32_t *words,
+        size_t count, struct scmi_performance_describe_fastchannel_params *params)
+{
+    if (count != 2)
+        return false;
+
+    params->domain_id = words[0];
+    params->message_id = words[1];
+    return true;
+}
+
+struct scmi_performance_describe_fastchannel_returns {
+    uint32_t attributes;
+    uint32_t rate_limit;
+    uint32_t chan_addr_low;
+    uint32_t chan_addr_high;
+    uint32_t chan_size;
+    uint32_t doorbell_addr_low;
+    uint32_t doorbell_addr_high;
+    uint32_t doorbell_set_mask_low;
+    uint32_t doorbell_set_mask_high;
+    uint32_t doorbell_preserve_mask_low;
+    uint32_t doorbell_preserve_mask_high;
+};
+
+static inline size_t scmi_performance_describe_fastchannel_returns_encode(uint32_t *words,
+        const struct scmi_performance_describe_fastchannel_returns *returns)
+{
+    words[0] = returns->attributes;
+    words[1] = returns->rate_limit;
+    words[2] = returns->chan_addr_low;
+    words[3] = returns->chan_addr_high;
+    words[4] = returns->chan_size;
+    words[5] = returns->doorbell_addr_low;
+    words[6] = returns->doorbell_addr_high;
+    words[7] = returns->doorbell_set_mask_low;
+    words[8] = returns->doorbell_set_mask_high;
+    words[9] = returns->doorbell_preserve_mask_low;
+    words[10] = returns->doorbell_preserve_mask_high;
+    return 11;
+}
+
+static inline bool scmi_performance_describe_fastchannel_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_performance_describe_fastchannel_returns *returns)
+{
+    if (count != 11)
+        return false;
+
+    returns->attributes = words[0];
+    returns->rate_limit = words[1];
+    returns->chan_addr_low = words[2];
+    returns->chan_addr_high = words[3];
+    returns->chan_size = words[4];
+    returns->doorbell_addr_low = words[5];
+    returns->doorbell_addr_high = words[6];
+    returns->doorbell_set_mask_low = words[7];
+    returns->doorbell_set_mask_high = words[8];
+    returns->doorbell_preserve_mask_low = words[9];
+    returns->doorbell_preserve_mask_high = words[10];
+    return true;
+}
+
+static inline uint32_t scmi_performance_describe_fastchannel_attributes_doorbell(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 0, 0);
+}
+
+static inline uint32_t scmi_performance_describe_fastchannel_attributes_doorbell_width(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 1, 2);
+}
+
+/* performance LIMITS_CHANGED, notification 0x0 */
+
+#define SCMI_PERFORMANCE_LIMITS_CHANGED_MSG_ID                          0x0
+#define SCMI_PERFORMANCE_LIMITS_CHANGED_RET_AGENT_ID                    0
+#define SCMI_PERFORMANCE_LIMITS_CHANGED_RET_DOMAIN_ID                   1
+#define SCMI_PERFORMANCE_LIMITS_CHANGED_RET_RANGE_MAX                   2
+#define SCMI_PERFORMANCE_LIMITS_CHANGED_RET_RANGE_MIN                   3
+#define SCMI_PERFORMANCE_LIMITS_CHANGED_RET_COUNT                       4
+
+struct scmi_performance_limits_changed_returns {
+    uint32_t agent_id;
+    uint32_t domain_id;
+    uint32_t range_max;
+    uint32_t range_min;
+};
+
+static inline size_t scmi_performance_limits_changed_returns_encode(uint32_t *words,
+        const struct scmi_performance_limits_changed_returns *returns)
+{
+    words[0] = returns->agent_id;
+    words[1] = returns->domain_id;
+    words[2] = returns->range_max;
+    words[3] = returns->range_min;
+    return 4;
+}
+
+static inline bool scmi_performance_limits_changed_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_performance_limits_changed_returns *returns)
+{
+    if (count != 4)
+        return false;
+
+    returns->agent_id = words[0];
+    returns->domain_id = words[1];
+    returns->range_max = words[2];
+    returns->range_min = words[3];
+    return true;
+}
+
+/* performance LEVEL_CHANGED, notification 0x1 */
+
+#define SCMI_PERFORMANCE_LEVEL_CHANGED_MSG_ID                           0x1
+#define SCMI_PERFORMANCE_LEVEL_CHANGED_RET_AGENT_ID                     0
+#define SCMI_PERFORMANCE_LEVEL_CHANGED_RET_DOMAIN_ID                    1
+#define SCMI_PERFORMANCE_LEVEL_CHANGED_RET_PERFORMANCE_LEVEL            2
+#define SCMI_PERFORMANCE_LEVEL_CHANGED_RET_COUNT                        3
+
+struct scmi_performance_level_changed_returns {
+    uint32_t agent_id;
+    uint32_t domain_id;
+    uint32_t performance_level;
+};
+
+static inline size_t scmi_performance_level_changed_returns_encode(uint32_t *words,
+        const struct scmi_performance_level_changed_returns *returns)
+{
+    words[0] = returns->agent_id;
+    words[1] = returns->domain_id;
+    words[2] = returns->performance_level;
+    return 3;
+}
+
+static inline bool scmi_performance_level_changed_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_performance_level_changed_returns *returns)
+{
+    if (count != 3)
+        return false;
+
+    returns->agent_id = words[0];
+    returns->domain_id = words[1];
+    returns->performance_level = words[2];
+    return true;
+}
+
+/* clock protocol */
+
+#define SCMI_CLOCK_PROTOCOL_ID                                          0x14
+
+/* clock PROTOCOL_VERSION, command 0x0 */
+
+#define SCMI_CLOCK_PROTOCOL_VERSION_MSG_ID                              0x0
+#define SCMI_CLOCK_PROTOCOL_VERSION_PARAM_COUNT                         0
+#define SCMI_CLOCK_PROTOCOL_VERSION_RET_VERSION                         0
+#define SCMI_CLOCK_PROTOCOL_VERSION_RET_COUNT                           1
+
+struct scmi_clock_protocol_version_returns {
+    uint32_t version;
+};
+
+static inline size_t scmi_clock_protocol_version_returns_encode(uint32_t *words,
+        const struct scmi_clock_protocol_version_returns *returns)
+{
+    words[0] = returns->version;
+    return 1;
+}
+
+static inline bool scmi_clock_protocol_version_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_clock_protocol_version_returns *returns)
+{
+    if (count != 1)
+        return false;
+
+    returns->version = words[0];
+    return true;
+}
+
+/* clock PROTOCOL_ATTRIBUTES, command 0x1 */
+
+#define SCMI_CLOCK_PROTOCOL_ATTRIBUTES_MSG_ID                           0x1
+#define SCMI_CLOCK_PROTOCOL_ATTRIBUTES_PARAM_COUNT                      0
+#define SCMI_CLOCK_PROTOCOL_ATTRIBUTES_RET_ATTRIBUTES                   0
+#define SCMI_CLOCK_PROTOCOL_ATTRIBUTES_ATTRIBUTES_NUM_CLOCKS_LOW        0
+#define SCMI_CLOCK_PROTOCOL_ATTRIBUTES_ATTRIBUTES_NUM_CLOCKS_HIGH       15
+#define SCMI_CLOCK_PROTOCOL_ATTRIBUTES_ATTRIBUTES_MAX_ASYNC_LOW         16
+#define SCMI_CLOCK_PROTOCOL_ATTRIBUTES_ATTRIBUTES_MAX_ASYNC_HIGH        23
+#define SCMI_CLOCK_PROTOCOL_ATTRIBUTES_RET_COUNT                        1
+
+struct scmi_clock_protocol_attributes_returns {
+    uint32_t attributes;
+};
+
+static inline size_t scmi_clock_protocol_attributes_returns_encode(uint32_t *words,
+        const struct scmi_clock_protocol_attributes_returns *returns)
+{
+    words[0] = returns->attributes;
+    return 1;
+}
+
+static inline bool scmi_clock_protocol_attributes_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_clock_protocol_attributes_returns *returns)
+{
+    if (count != 1)
+        return false;
+
+    returns->attributes = words[0];
+    return true;
+}
+
+static inline uint32_t scmi_clock_protocol_attributes_attributes_num_clocks(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 0, 15);
+}
+
+static inline uint32_t scmi_clock_protocol_attributes_attributes_max_async(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 16, 23);
+}
+
+/* clock PROTOCOL_MESSAGE_ATTRIBUTES, command 0x2 */
+
+#define SCMI_CLOCK_PROTOCOL_MESSAGE_ATTRIBUTES_MSG_ID                   0x2
+#define SCMI_CLOCK_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_MESSAGE_ID         0
+#define SCMI_CLOCK_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_COUNT              1
+#define SCMI_CLOCK_PROTOCOL_MESSAGE_ATTRIBUTES_RET_ATTRIBUTES           0
+#define SCMI_CLOCK_PROTOCOL_MESSAGE_ATTRIBUTES_RET_COUNT                1
+
+struct scmi_clock_protocol_message_attributes_params {
+    uint32_t message_id;
+};
+
+static inline size_t scmi_clock_protocol_message_attributes_params_encode(uint32_t *words,
+        const struct scmi_clock_protocol_message_attributes_params *params)
+{
+    words[0] = params->message_id;
+    return 1;
+}
+
+static inline bool scmi_clock_protocol_message_attributes_params_decode(const uint32_t *words,
+        size_t count, struct scmi_clock_protocol_message_attributes_params *params)
+{
+    if (count != 1)
+        return false;
+
+    params->message_id = words[0];
+    return true;
+}
+
+struct scmi_clock_protocol_message_attributes_returns {
+    uint32_t attributes;
+};
+
+static inline size_t scmi_clock_protocol_message_attributes_returns_encode(uint32_t *words,
+        const struct scmi_clock_protocol_message_attributes_returns *returns)
+{
+    words[0] = returns->attributes;
+    return 1;
+}
+
+static inline bool scmi_clock_protocol_message_attributes_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_clock_protocol_message_attributes_returns *returns)
+{
+    if (count != 1)
+        return false;
+
+    returns->attributes = words[0];
+    return true;
+}
+
+/* clock ATTRIBUTES, command 0x3 */
+
+#define SCMI_CLOCK_ATTRIBUTES_MSG_ID                                    0x3
+#define SCMI_CLOCK_ATTRIBUTES_PARAM_CLOCK_ID                            0
+#define SCMI_CLOCK_ATTRIBUTES_PARAM_COUNT                               1
+#define SCMI_CLOCK_ATTRIBUTES_RET_ATTRIBUTES                            0
+#define SCMI_CLOCK_ATTRIBUTES_ATTRIBUTES_ENABLED_LOW                    0
+#define SCMI_CLOCK_ATTRIBUTES_ATTRIBUTES_ENABLED_HIGH                   0
+#define SCMI_CLOCK_ATTRIBUTES_RET_CLOCK_NAME                            1
+#define SCMI_CLOCK_ATTRIBUTES_RET_COUNT                                 5
+
+struct scmi_clock_attributes_params {
+    uint32_t clock_id;
+};
+
+static inline size_t scmi_clock_attributes_params_encode(uint32_t *words,
+        const struct scmi_clock_attributes_params *params)
+{
+    words[0] = params->clock_id;
+    return 1;
+}
+
+static inline bool scmi_clock_attributes_params_decode(const uint32_t *words,
+        size_t count, struct scmi_clock_attributes_params *params)
+{
+    if (count != 1)
+        return false;
+
+    params->clock_id = words[0];
+    return true;
+}
+
+struct scmi_clock_attributes_returns {
+    uint32_t attributes;
+    uint8_t clock_name[SCMI_CODEC_NAME_SIZE];
+};
+
+static inline size_t scmi_clock_attributes_returns_encode(uint32_t *words,
+        const struct scmi_clock_attributes_returns *returns)
+{
+    words[0] = returns->attributes;
+    scmi_codec_copy_bytes(&words[1], returns->clock_name, SCMI_CODEC_NAME_SIZE);
+    return 5;
+}
+
+static inline bool scmi_clock_attributes_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_clock_attributes_returns *returns)
+{
+    if (count != 5)
+        return false;
+
+    returns->attributes = words[0];
+    scmi_codec_copy_bytes(returns->clock_name, &words[1], SCMI_CODEC_NAME_SIZE);
+    return true;
+}
+
+static inline uint32_t scmi_clock_attributes_attributes_enabled(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 0, 0);
+}
+
+/* clock DESCRIBE_RATES, command 0x4 */
+
+#define SCMI_CLOCK_DESCRIBE_RATES_MSG_ID                                0x4
+#define SCMI_CLOCK_DESCRIBE_RATES_PARAM_CLOCK_ID                        0
+#define SCMI_CLOCK_DESCRIBE_RATES_PARAM_RATE_INDEX                      1
+#define SCMI_CLOCK_DESCRIBE_RATES_PARAM_COUNT                           2
+#define SCMI_CLOCK_DESCRIBE_RATES_RET_NUM_RATES_FLAGS                   0
+#define SCMI_CLOCK_DESCRIBE_RATES_NUM_RATES_FLAGS_NUM_RATES_LOW         0
+#define SCMI_CLOCK_DESCRIBE_RATES_NUM_RATES_FLAGS_NUM_RATES_HIGH        11
+#define SCMI_CLOCK_DESCRIBE_RATES_NUM_RATES_FLAGS_FORMAT_LOW            12
+#define SCMI_CLOCK_DESCRIBE_RATES_NUM_RATES_FLAGS_FORMAT_HIGH           12
+#define SCMI_CLOCK_DESCRIBE_RATES_NUM_RATES_FLAGS_NUM_REMAINING_LOW     16
+#define SCMI_CLOCK_DESCRIBE_RATES_NUM_RATES_FLAGS_NUM_REMAINING_HIGH    31
+#define SCMI_CLOCK_DESCRIBE_RATES_RET_RATES                             1
+#define SCMI_CLOCK_DESCRIBE_RATES_RET_COUNT                             1
+
+struct scmi_clock_describe_rates_params {
+    uint32_t clock_id;
+    uint32_t rate_index;
+};
+
+static inline size_t scmi_clock_describe_rates_params_encode(uint32_t *words,
+        const struct scmi_clock_describe_rates_params *params)
+{
+    words[0] = params->clock_id;
+    words[1] = params->rate_index;
+    return 2;
+}
+
+static inline bool scmi_clock_describe_rates_params_decode(const uint32_t *words,
+        size_t count, struct scmi_clock_describe_rates_params *params)
+{
+    if (count != 2)
+        return false;
+
+    params->clock_id = words[0];
+    params->rate_index = words[1];
+    return true;
+}
+
+struct scmi_clock_describe_rates_returns {
+    uint32_t num_rates_flags;
+    const uint32_t *rates;
+    size_t rates_count;
+};
+
+static inline size_t scmi_clock_describe_rates_returns_encode(uint32_t *words,
+        const struct scmi_clock_describe_rates_returns *returns)
+{
+    words[0] = returns->num_rates_flags;
+    scmi_codec_copy_bytes(&words[1], returns->rates,
+                          returns->rates_count * sizeof(uint32_t));
+    return 1 + returns->rates_count;
+}
+
+static inline bool scmi_clock_describe_rates_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_clock_describe_rates_returns *returns)
+{
+    if (count < 1)
+        return false;
+
+    returns->num_rates_flags = words[0];
+    returns->rates = &words[1];
+    returns->rates_count = count - 1;
+    return true;
+}
+
+static inline uint32_t scmi_clock_describe_rates_num_rates_flags_num_rates(uint32_t num_rates_flags)
+{
+    return SCMI_CODEC_BITS(num_rates_flags, 0, 11);
+}
+
+static inline uint32_t scmi_clock_describe_rates_num_rates_flags_format(uint32_t num_rates_flags)
+{
+    return SCMI_CODEC_BITS(num_rates_flags, 12, 12);
+}
+
+static inline uint32_t scmi_clock_describe_rates_num_rates_flags_num_remaining(uint32_t num_rates_flags)
+{
+    return SCMI_CODEC_BITS(num_rates_flags, 16, 31);
+}
+
+/* clock RATE_SET, command 0x5 */
+
+#define SCMI_CLOCK_RATE_SET_MSG_ID                                      0x5
+#define SCMI_CLOCK_RATE_SET_PARAM_FLAGS                                 0
+#define SCMI_CLOCK_RATE_SET_FLAGS_ASYNC_LOW                             0
+#define SCMI_CLOCK_RATE_SET_FLAGS_ASYNC_HIGH                            0
+#define SCMI_CLOCK_RATE_SET_FLAGS_IGNORE_DELAYED_RESPONSE_LOW           1
+#define SCMI_CLOCK_RATE_SET_FLAGS_IGNORE_DELAYED_RESPONSE_HIGH          1
+#define SCMI_CLOCK_RATE_SET_FLAGS_ROUND_UP_LOW                          2
+#define SCMI_CLOCK_RATE_SET_FLAGS_ROUND_UP_HIGH                         2
+#define SCMI_CLOCK_RATE_SET_PARAM_CLOCK_ID                              1
+#define SCMI_CLOCK_RATE_SET_PARAM_RATE                                  2
+#define SCMI_CLOCK_RATE_SET_PARAM_COUNT                                 4
+#define SCMI_CLOCK_RATE_SET_RET_COUNT                                   0
+
+struct scmi_clock_rate_set_params {
+    uint32_t flags;
+    uint32_t clock_id;
+    uint32_t rate[2];
+};
+
+static inline size_t scmi_clock_rate_set_params_encode(uint32_t *words,
+        const struct scmi_clock_rate_set_params *params)
+{
+    words[0] = params->flags;
+    words[1] = params->clock_id;
+    words[2] = params->rate[0];
+    words[3] = params->rate[1];
+    return 4;
+}
+
+static inline bool scmi_clock_rate_set_params_decode(const uint32_t *words,
+        size_t count, struct scmi_clock_rate_set_params *params)
+{
+    if (count != 4)
+        return false;
+
+    params->flags = words[0];
+    params->clock_id = words[1];
+    params->rate[0] = words[2];
+    params->rate[1] = words[3];
+    return true;
+}
+
+static inline uint32_t scmi_clock_rate_set_flags_async(uint32_t flags)
+{
+    return SCMI_CODEC_BITS(flags, 0, 0);
+}
+
+static inline uint32_t scmi_clock_rate_set_flags_ignore_delayed_response(uint32_t flags)
+{
+    return SCMI_CODEC_BITS(flags, 1, 1);
+}
+
+static inline uint32_t scmi_clock_rate_set_flags_round_up(uint32_t flags)
+{
+    return SCMI_CODEC_BITS(flags, 2, 2);
+}
+
+/* clock RATE_GET, command 0x6 */
+
+#define SCMI_CLOCK_RATE_GET_MSG_ID                                      0x6
+#define SCMI_CLOCK_RATE_GET_PARAM_CLOCK_ID                              0
+#define SCMI_CLOCK_RATE_GET_PARAM_COUNT                                 1
+#define SCMI_CLOCK_RATE_GET_RET_RATE                                    0
+#define SCMI_CLOCK_RATE_GET_RET_COUNT                                   2
+
+struct scmi_clock_rate_get_params {
+    uint32_t clock_id;
+};
+
+static inline size_t scmi_clock_rate_get_params_encode(uint32_t *words,
+        const struct scmi_clock_rate_get_params *params)
+{
+    words[0] = params->clock_id;
+    return 1;
+}
+
+static inline bool scmi_clock_rate_get_params_decode(const uint32_t *words,
+        size_t count, struct scmi_clock_rate_get_params *params)
+{
+    if (count != 1)
+        return false;
+
+    params->clock_id = words[0];
+    return true;
+}
+
+struct scmi_clock_rate_get_returns {
+    uint32_t rate[2];
+};
+
+static inline size_t scmi_clock_rate_get_returns_encode(uint32_t *words,
+        const struct scmi_clock_rate_get_returns *returns)
+{
+    words[0] = returns->rate[0];
+    words[1] = returns->rate[1];
+    return 2;
+}
+
+static inline bool scmi_clock_rate_get_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_clock_rate_get_returns *returns)
+{
+    if (count != 2)
+        return false;
+
+    returns->rate[0] = words[0];
+    returns->rate[1] = words[1];
+    return true;
+}
+
+/* clock CONFIG_SET, command 0x7 */
+
+#define SCMI_CLOCK_CONFIG_SET_MSG_ID                                    0x7
+#define SCMI_CLOCK_CONFIG_SET_PARAM_CLOCK_ID                            0
+#define SCMI_CLOCK_CONFIG_SET_PARAM_ATTRIBUTES                          1
+#define SCMI_CLOCK_CONFIG_SET_ATTRIBUTES_ENABLE_LOW                     0
+#define SCMI_CLOCK_CONFIG_SET_ATTRIBUTES_ENABLE_HIGH                    0
+#define SCMI_CLOCK_CONFIG_SET_PARAM_COUNT                               2
+#define SCMI_CLOCK_CONFIG_SET_RET_COUNT                                 0
+
+struct scmi_clock_config_set_params {
+    uint32_t clock_id;
+    uint32_t attributes;
+};
+
+static inline size_t scmi_clock_config_set_params_encode(uint32_t *words,
+        const struct scmi_clock_config_set_params *params)
+{
+    words[0] = params->clock_id;
+    words[1] = params->attributes;
+    return 2;
+}
+
+static inline bool scmi_clock_config_set_params_decode(const uint32_t *words,
+        size_t count, struct scmi_clock_config_set_params *params)
+{
+    if (count != 2)
+        return false;
+
+    params->clock_id = words[0];
+    params->attributes = words[1];
+    return true;
+}
+
+static inline uint32_t scmi_clock_config_set_attributes_enable(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 0, 0);
+}
+
+/* clock RATE_SET_COMPLETE, delayed 0x5 */
+
+#define SCMI_CLOCK_RATE_SET_COMPLETE_MSG_ID                             0x5
+#define SCMI_CLOCK_RATE_SET_COMPLETE_RET_CLOCK_ID                       0
+#define SCMI_CLOCK_RATE_SET_COMPLETE_RET_RATE                           1
+#define SCMI_CLOCK_RATE_SET_COMPLETE_RET_COUNT                          3
+
+struct scmi_clock_rate_set_complete_returns {
+    uint32_t clock_id;
+    uint32_t rate[2];
+};
+
+static inline size_t scmi_clock_rate_set_complete_returns_encode(uint32_t *words,
+        const struct scmi_clock_rate_set_complete_returns *returns)
+{
+    words[0] = returns->clock_id;
+    words[1] = returns->rate[0];
+    words[2] = returns->rate[1];
+    return 3;
+}
+
+static inline bool scmi_clock_rate_set_complete_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_clock_rate_set_complete_returns *returns)
+{
+    if (count != 3)
+        return false;
+
+    returns->clock_id = words[0];
+    returns->rate[0] = words[1];
+    returns->rate[1] = words[2];
+    return true;
+}
+
+/* sensor protocol */
+
+#define SCMI_SENSOR_PROTOCOL_ID                                         0x15
+
+/* sensor PROTOCOL_VERSION, command 0x0 */
+
+#define SCMI_SENSOR_PROTOCOL_VERSION_MSG_ID                             0x0
+#define SCMI_SENSOR_PROTOCOL_VERSION_PARAM_COUNT                        0
+#define SCMI_SENSOR_PROTOCOL_VERSION_RET_VERSION                        0
+#define SCMI_SENSOR_PROTOCOL_VERSION_RET_COUNT                          1
+
+struct scmi_sensor_protocol_version_returns {
+    uint32_t version;
+};
+
+static inline size_t scmi_sensor_protocol_version_returns_encode(uint32_t *words,
+        const struct scmi_sensor_protocol_version_returns *returns)
+{
+    words[0] = returns->version;
+    return 1;
+}
+
+static inline bool scmi_sensor_protocol_version_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_sensor_protocol_version_returns *returns)
+{
+    if (count != 1)
+        return false;
+
+    returns->version = words[0];
+    return true;
+}
+
+/* sensor PROTOCOL_ATTRIBUTES, command 0x1 */
+
+#define SCMI_SENSOR_PROTOCOL_ATTRIBUTES_MSG_ID                          0x1
+#define SCMI_SENSOR_PROTOCOL_ATTRIBUTES_PARAM_COUNT                     0
+#define SCMI_SENSOR_PROTOCOL_ATTRIBUTES_RET_ATTRIBUTES                  0
+#define SCMI_SENSOR_PROTOCOL_ATTRIBUTES_ATTRIBUTES_NUM_SENSORS_LOW      0
+#define SCMI_SENSOR_PROTOCOL_ATTRIBUTES_ATTRIBUTES_NUM_SENSORS_HIGH     15
+#define SCMI_SENSOR_PROTOCOL_ATTRIBUTES_ATTRIBUTES_MAX_ASYNC_LOW        16
+#define SCMI_SENSOR_PROTOCOL_ATTRIBUTES_ATTRIBUTES_MAX_ASYNC_HIGH       23
+#define SCMI_SENSOR_PROTOCOL_ATTRIBUTES_RET_SENSOR_REG_ADDRESS_LOW      1
+#define SCMI_SENSOR_PROTOCOL_ATTRIBUTES_RET_SENSOR_REG_ADDRESS_HIGH     2
+#define SCMI_SENSOR_PROTOCOL_ATTRIBUTES_RET_SENSOR_REG_LEN              3
+#define SCMI_SENSOR_PROTOCOL_ATTRIBUTES_RET_COUNT                       4
+
+struct scmi_sensor_protocol_attributes_returns {
+    uint32_t attributes;
+    uint32_t sensor_reg_address_low;
+    uint32_t sensor_reg_address_high;
+    uint32_t sensor_reg_len;
+};
+
+static inline size_t scmi_sensor_protocol_attributes_returns_encode(uint32_t *words,
+        const struct scmi_sensor_protocol_attributes_returns *returns)
+{
+    words[0] = returns->attributes;
+    words[1] = returns->sensor_reg_address_low;
+    words[2] = returns->sensor_reg_address_high;
+    words[3] = returns->sensor_reg_len;
+    return 4;
+}
+
+static inline bool scmi_sensor_protocol_attributes_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_sensor_protocol_attributes_returns *returns)
+{
+    if (count != 4)
+        return false;
+
+    returns->attributes = words[0];
+    returns->sensor_reg_address_low = words[1];
+    returns->sensor_reg_address_high = words[2];
+    returns->sensor_reg_len = words[3];
+    return true;
+}
+
+static inline uint32_t scmi_sensor_protocol_attributes_attributes_num_sensors(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 0, 15);
+}
+
+static inline uint32_t scmi_sensor_protocol_attributes_attributes_max_async(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 16, 23);
+}
+
+/* sensor PROTOCOL_MESSAGE_ATTRIBUTES, command 0x2 */
+
+#define SCMI_SENSOR_PROTOCOL_MESSAGE_ATTRIBUTES_MSG_ID                  0x2
+#define SCMI_SENSOR_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_MESSAGE_ID        0
+#define SCMI_SENSOR_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_COUNT             1
+#define SCMI_SENSOR_PROTOCOL_MESSAGE_ATTRIBUTES_RET_ATTRIBUTES          0
+#define SCMI_SENSOR_PROTOCOL_MESSAGE_ATTRIBUTES_RET_COUNT               1
+
+struct scmi_sensor_protocol_message_attributes_params {
+    uint32_t message_id;
+};
+
+static inline size_t scmi_sensor_protocol_message_attributes_params_encode(uint32_t *words,
+        const struct scmi_sensor_protocol_message_attributes_params *params)
+{
+    words[0] = params->message_id;
+    return 1;
+}
+
+static inline bool scmi_sensor_protocol_message_attributes_params_decode(const uint32_t *words,
+        size_t count, struct scmi_sensor_protocol_message_attributes_params *params)
+{
+    if (count != 1)
+        return false;
+
+    params->message_id = words[0];
+    return true;
+}
+
+struct scmi_sensor_protocol_message_attributes_returns {
+    uint32_t attributes;
+};
+
+static inline size_t scmi_sensor_protocol_message_attributes_returns_encode(uint32_t *words,
+        const struct scmi_sensor_protocol_message_attributes_returns *returns)
+{
+    words[0] = returns->attributes;
+    return 1;
+}
+
+static inline bool scmi_sensor_protocol_message_attributes_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_sensor_protocol_message_attributes_returns *returns)
+{
+    if (count != 1)
+        return false;
+
+    returns->attributes = words[0];
+    return true;
+}
+
+/* sensor DESCRIPTION_GET, command 0x3 */
+
+#define SCMI_SENSOR_DESCRIPTION_GET_MSG_ID                              0x3
+#define SCMI_SENSOR_DESCRIPTION_GET_PARAM_DESC_INDEX                    0
+#define SCMI_SENSOR_DESCRIPTION_GET_PARAM_COUNT                         1
+#define SCMI_SENSOR_DESCRIPTION_GET_RET_NUM_SENSOR_FLAGS                0
+#define SCMI_SENSOR_DESCRIPTION_GET_NUM_SENSOR_FLAGS_NUM_DESCRIPTORS_LOW 0
+#define SCMI_SENSOR_DESCRIPTION_GET_NUM_SENSOR_FLAGS_NUM_DESCRIPTORS_HIGH 11
+#define SCMI_SENSOR_DESCRIPTION_GET_NUM_SENSOR_FLAGS_NUM_REMAINING_LOW  16
+#define SCMI_SENSOR_DESCRIPTION_GET_NUM_SENSOR_FLAGS_NUM_REMAINING_HIGH 31
+#define SCMI_SENSOR_DESCRIPTION_GET_RET_SENSOR_DESCRIPTORS              1
+#define SCMI_SENSOR_DESCRIPTION_GET_RET_COUNT                           1
+
+struct scmi_sensor_description_get_params {
+    uint32_t desc_index;
+};
+
+static inline size_t scmi_sensor_description_get_params_encode(uint32_t *words,
+        const struct scmi_sensor_description_get_params *params)
+{
+    words[0] = params->desc_index;
+    return 1;
+}
+
+static inline bool scmi_sensor_description_get_params_decode(const uint32_t *words,
+        size_t count, struct scmi_sensor_description_get_params *params)
+{
+    if (count != 1)
+        return false;
+
+    params->desc_index = words[0];
+    return true;
+}
+
+struct scmi_sensor_description_get_returns {
+    uint32_t num_sensor_flags;
+    const uint32_t *sensor_descriptors;
+    size_t sensor_descriptors_count;
+};
+
+static inline size_t scmi_sensor_description_get_returns_encode(uint32_t *words,
+        const struct scmi_sensor_description_get_returns *returns)
+{
+    words[0] = returns->num_sensor_flags;
+    scmi_codec_copy_bytes(&words[1], returns->sensor_descriptors,
+                          returns->sensor_descriptors_count * sizeof(uint32_t));
+    return 1 + returns->sensor_descriptors_count;
+}
+
+static inline bool scmi_sensor_description_get_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_sensor_description_get_returns *returns)
+{
+    if (count < 1)
+        return false;
+
+    returns->num_sensor_flags = words[0];
+    returns->sensor_descriptors = &words[1];
+    returns->sensor_descriptors_count = count - 1;
+    return true;
+}
+
+static inline uint32_t scmi_sensor_description_get_num_sensor_flags_num_descriptors(uint32_t num_sensor_flags)
+{
+    return SCMI_CODEC_BITS(num_sensor_flags, 0, 11);
+}
+
+static inline uint32_t scmi_sensor_description_get_num_sensor_flags_num_remaining(uint32_t num_sensor_flags)
+{
+    return SCMI_CODEC_BITS(num_sensor_flags, 16, 31);
+}
+
+/* sensor TRIP_POINT_NOTIFY, command 0x4 */
+
+#define SCMI_SENSOR_TRIP_POINT_NOTIFY_MSG_ID                            0x4
+#define SCMI_SENSOR_TRIP_POINT_NOTIFY_PARAM_SENSOR_ID                   0
+#define SCMI_SENSOR_TRIP_POINT_NOTIFY_PARAM_EVENT_CONTROL               1
+#define SCMI_SENSOR_TRIP_POINT_NOTIFY_EVENT_CONTROL_ENABLE_LOW          0
+#define SCMI_SENSOR_TRIP_POINT_NOTIFY_EVENT_CONTROL_ENABLE_HIGH         0
+#define SCMI_SENSOR_TRIP_POINT_NOTIFY_PARAM_COUNT                       2
+#define SCMI_SENSOR_TRIP_POINT_NOTIFY_RET_COUNT                         0
+
+struct scmi_sensor_trip_point_notify_params {
+    uint32_t sensor_id;
+    uint32_t event_control;
+};
+
+static inline size_t scmi_sensor_trip_point_notify_params_encode(uint32_t *words,
+        const struct scmi_sensor_trip_point_notify_params *params)
+{
+    words[0] = params->sensor_id;
+    words[1] = params->event_control;
+    return 2;
+}
+
+static inline bool scmi_sensor_trip_point_notify_params_decode(const uint32_t *words,
+        size_t count, struct scmi_sensor_trip_point_notify_params *params)
+{
+    if (count != 2)
+        return false;
+
+    params->sensor_id = words[0];
+    params->event_control = words[1];
+    return true;
+}
+
+static inline uint32_t scmi_sensor_trip_point_notify_event_control_enable(uint32_t event_control)
+{
+    return SCMI_CODEC_BITS(event_control, 0, 0);
+}
+
+/* sensor TRIP_POINT_CONFIG, command 0x5 */
+
+#define SCMI_SENSOR_TRIP_POINT_CONFIG_MSG_ID                            0x5
+#define SCMI_SENSOR_TRIP_POINT_CONFIG_PARAM_SENSOR_ID                   0
+#define SCMI_SENSOR_TRIP_POINT_CONFIG_PARAM_TRIP_POINT_EV_CTRL          1
+#define SCMI_SENSOR_TRIP_POINT_CONFIG_TRIP_POINT_EV_CTRL_DIRECTION_LOW  0
+#define SCMI_SENSOR_TRIP_POINT_CONFIG_TRIP_POINT_EV_CTRL_DIRECTION_HIGH 1
+#define SCMI_SENSOR_TRIP_POINT_CONFIG_TRIP_POINT_EV_CTRL_TRIP_POINT_ID_LOW 4
+#define SCMI_SENSOR_TRIP_POINT_CONFIG_TRIP_POINT_EV_CTRL_TRIP_POINT_ID_HIGH 11
+#define SCMI_SENSOR_TRIP_POINT_CONFIG_PARAM_TRIP_POINT_VAL_LOW          2
+#define SCMI_SENSOR_TRIP_POINT_CONFIG_PARAM_TRIP_POINT_VAL_HIGH         3
+#define SCMI_SENSOR_TRIP_POINT_CONFIG_PARAM_COUNT                       4
+#define SCMI_SENSOR_TRIP_POINT_CONFIG_RET_COUNT                         0
+
+struct scmi_sensor_trip_point_config_params {
+    uint32_t sensor_id;
+    uint32_t trip_point_ev_ctrl;
+    uint32_t trip_point_val_low;
+    uint32_t trip_point_val_high;
+};
+
+static inline size_t scmi_sensor_trip_point_config_params_encode(uint32_t *words,
+        const struct scmi_sensor_trip_point_config_params *params)
+{
+    words[0] = params->sensor_id;
+    words[1] = params->trip_point_ev_ctrl;
+    words[2] = params->trip_point_val_low;
+    words[3] = params->trip_point_val_high;
+    return 4;
+}
+
+static inline bool scmi_sensor_trip_point_config_params_decode(const uint32_t *words,
+        size_t count, struct scmi_sensor_trip_point_config_params *params)
+{
+    if (count != 4)
+        return false;
+
+    params->sensor_id = words[0];
+    params->trip_point_ev_ctrl = words[1];
+    params->trip_point_val_low = words[2];
+    params->trip_point_val_high = words[3];
+    return true;
+}
+
+static inline uint32_t scmi_sensor_trip_point_config_trip_point_ev_ctrl_direction(uint32_t trip_point_ev_ctrl)
+{
+    return SCMI_CODEC_BITS(trip_point_ev_ctrl, 0, 1);
+}
+
+static inline uint32_t scmi_sensor_trip_point_config_trip_point_ev_ctrl_trip_point_id(uint32_t trip_point_ev_ctrl)
+{
+    return SCMI_CODEC_BITS(trip_point_ev_ctrl, 4, 11);
+}
+
+/* sensor READING_GET, command 0x6 */
+
+#define SCMI_SENSOR_READING_GET_MSG_ID                                  0x6
+#define SCMI_SENSOR_READING_GET_PARAM_SENSOR_ID                         0
+#define SCMI_SENSOR_READING_GET_PARAM_FLAGS                             1
+#define SCMI_SENSOR_READING_GET_FLAGS_ASYNC_LOW                         0
+#define SCMI_SENSOR_READING_GET_FLAGS_ASYNC_HIGH                        0
+#define SCMI_SENSOR_READING_GET_PARAM_COUNT                             2
+#define SCMI_SENSOR_READING_GET_RET_SENSOR_VALUE_LOW                    0
+#define SCMI_SENSOR_READING_GET_RET_SENSOR_VALUE_HIGH                   1
+#define SCMI_SENSOR_READING_GET_RET_COUNT                               2
+
+struct scmi_sensor_reading_get_params {
+    uint32_t sensor_id;
+    uint32_t flags;
+};
+
+static inline size_t scmi_sensor_reading_get_params_encode(uint32_t *words,
+        const struct scmi_sensor_reading_get_params *params)
+{
+    words[0] = params->sensor_id;
+    words[1] = params->flags;
+    return 2;
+}
+
+static inline bool scmi_sensor_reading_get_params_decode(const uint32_t *words,
+        size_t count, struct scmi_sensor_reading_get_params *params)
+{
+    if (count != 2)
+        return false;
+
+    params->sensor_id = words[0];
+    params->flags = words[1];
+    return true;
+}
+
+static inline uint32_t scmi_sensor_reading_get_flags_async(uint32_t flags)
+{
+    return SCMI_CODEC_BITS(flags, 0, 0);
+}
+
+struct scmi_sensor_reading_get_returns {
+    uint32_t sensor_value_low;
+    uint32_t sensor_value_high;
+};
+
+static inline size_t scmi_sensor_reading_get_returns_encode(uint32_t *words,
+        const struct scmi_sensor_reading_get_returns *returns)
+{
+    words[0] = returns->sensor_value_low;
+    words[1] = returns->sensor_value_high;
+    return 2;
+}
+
+static inline bool scmi_sensor_reading_get_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_sensor_reading_get_returns *returns)
+{
+    if (count != 2)
+        return false;
+
+    returns->sensor_value_low = words[0];
+    returns->sensor_value_high = words[1];
+    return true;
+}
+
+/* sensor READING_COMPLETE, delayed 0x6 */
+
+#define SCMI_SENSOR_READING_COMPLETE_MSG_ID                             0x6
+#define SCMI_SENSOR_READING_COMPLETE_RET_SENSOR_ID                      0
+#define SCMI_SENSOR_READING_COMPLETE_RET_SENSOR_VALUE_LOW               1
+#define SCMI_SENSOR_READING_COMPLETE_RET_SENSOR_VALUE_HIGH              2
+#define SCMI_SENSOR_READING_COMPLETE_RET_COUNT                          3
+
+struct scmi_sensor_reading_complete_returns {
+    uint32_t sensor_id;
+    uint32_t sensor_value_low;
+    uint32_t sensor_value_high;
+};
+
+static inline size_t scmi_sensor_reading_complete_returns_encode(uint32_t *words,
+        const struct scmi_sensor_reading_complete_returns *returns)
+{
+    words[0] = returns->sensor_id;
+    words[1] = returns->sensor_value_low;
+    words[2] = returns->sensor_value_high;
+    return 3;
+}
+
+static inline bool scmi_sensor_reading_complete_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_sensor_reading_complete_returns *returns)
+{
+    if (count != 3)
+        return false;
+
+    returns->sensor_id = words[0];
+    returns->sensor_value_low = words[1];
+    returns->sensor_value_high = words[2];
+    return true;
+}
+
+/* sensor TRIP_POINT_EVENT, notification 0x0 */
+
+#define SCMI_SENSOR_TRIP_POINT_EVENT_MSG_ID                             0x0
+#define SCMI_SENSOR_TRIP_POINT_EVENT_RET_AGENT_ID                       0
+#define SCMI_SENSOR_TRIP_POINT_EVENT_RET_SENSOR_ID                      1
+#define SCMI_SENSOR_TRIP_POINT_EVENT_RET_TRIP_POINT_DESC                2
+#define SCMI_SENSOR_TRIP_POINT_EVENT_RET_COUNT                          3
+
+struct scmi_sensor_trip_point_event_returns {
+    uint32_t agent_id;
+    uint32_t sensor_id;
+    uint32_t trip_point_desc;
+};
+
+static inline size_t scmi_sensor_trip_point_event_returns_encode(uint32_t *words,
+        const struct scmi_sensor_trip_point_event_returns *returns)
+{
+    words[0] = returns->agent_id;
+    words[1] = returns->sensor_id;
+    words[2] = returns->trip_point_desc;
+    return 3;
+}
+
+static inline bool scmi_sensor_trip_point_event_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_sensor_trip_point_event_returns *returns)
+{
+    if (count != 3)
+        return false;
+
+    returns->agent_id = words[0];
+    returns->sensor_id = words[1];
+    returns->trip_point_desc = words[2];
+    return true;
+}
+
+/* reset protocol */
+
+#define SCMI_RESET_PROTOCOL_ID                                          0x16
+
+/* reset PROTOCOL_VERSION, command 0x0 */
+
+#define SCMI_RESET_PROTOCOL_VERSION_MSG_ID                              0x0
+#define SCMI_RESET_PROTOCOL_VERSION_PARAM_COUNT                         0
+#define SCMI_RESET_PROTOCOL_VERSION_RET_VERSION                         0
+#define SCMI_RESET_PROTOCOL_VERSION_RET_COUNT                           1
+
+struct scmi_reset_protocol_version_returns {
+    uint32_t version;
+};
+
+static inline size_t scmi_reset_protocol_version_returns_encode(uint32_t *words,
+        const struct scmi_reset_protocol_version_returns *returns)
+{
+    words[0] = returns->version;
+    return 1;
+}
+
+static inline bool scmi_reset_protocol_version_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_reset_protocol_version_returns *returns)
+{
+    if (count != 1)
+        return false;
+
+    returns->version = words[0];
+    return true;
+}
+
+/* reset PROTOCOL_ATTRIBUTES, command 0x1 */
+
+#define SCMI_RESET_PROTOCOL_ATTRIBUTES_MSG_ID                           0x1
+#define SCMI_RESET_PROTOCOL_ATTRIBUTES_PARAM_COUNT                      0
+#define SCMI_RESET_PROTOCOL_ATTRIBUTES_RET_ATTRIBUTES                   0
+#define SCMI_RESET_PROTOCOL_ATTRIBUTES_ATTRIBUTES_NUM_DOMAINS_LOW       0
+#define SCMI_RESET_PROTOCOL_ATTRIBUTES_ATTRIBUTES_NUM_DOMAINS_HIGH      15
+#define SCMI_RESET_PROTOCOL_ATTRIBUTES_RET_COUNT                        1
+
+struct scmi_reset_protocol_attributes_returns {
+    uint32_t attributes;
+};
+
+static inline size_t scmi_reset_protocol_attributes_returns_encode(uint32_t *words,
+        const struct scmi_reset_protocol_attributes_returns *returns)
+{
+    words[0] = returns->attributes;
+    return 1;
+}
+
+static inline bool scmi_reset_protocol_attributes_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_reset_protocol_attributes_returns *returns)
+{
+    if (count != 1)
+        return false;
+
+    returns->attributes = words[0];
+    return true;
+}
+
+static inline uint32_t scmi_reset_protocol_attributes_attributes_num_domains(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 0, 15);
+}
+
+/* reset PROTOCOL_MESSAGE_ATTRIBUTES, command 0x2 */
+
+#define SCMI_RESET_PROTOCOL_MESSAGE_ATTRIBUTES_MSG_ID                   0x2
+#define SCMI_RESET_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_MESSAGE_ID         0
+#define SCMI_RESET_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_COUNT              1
+#define SCMI_RESET_PROTOCOL_MESSAGE_ATTRIBUTES_RET_ATTRIBUTES           0
+#define SCMI_RESET_PROTOCOL_MESSAGE_ATTRIBUTES_RET_COUNT                1
+
+struct scmi_reset_protocol_message_attributes_params {
+    uint32_t message_id;
+};
+
+static inline size_t scmi_reset_protocol_message_attributes_params_encode(uint32_t *words,
+        const struct scmi_reset_protocol_message_attributes_params *params)
+{
+    words[0] = params->message_id;
+    return 1;
+}
+
+static inline bool scmi_reset_protocol_message_attributes_params_decode(const uint32_t *words,
+        size_t count, struct scmi_reset_protocol_message_attributes_params *params)
+{
+    if (count != 1)
+        return false;
+
+    params->message_id = words[0];
+    return true;
+}
+
+struct scmi_reset_protocol_message_attributes_returns {
+    uint32_t attributes;
+};
+
+static inline size_t scmi_reset_protocol_message_attributes_returns_encode(uint32_t *words,
+        const struct scmi_reset_protocol_message_attributes_returns *returns)
+{
+    words[0] = returns->attributes;
+    return 1;
+}
+
+static inline bool scmi_reset_protocol_message_attributes_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_reset_protocol_message_attributes_returns *returns)
+{
+    if (count != 1)
+        return false;
+
+    returns->attributes = words[0];
+    return true;
+}
+
+/* reset DOMAIN_ATTRIBUTES, command 0x3 */
+
+#define SCMI_RESET_DOMAIN_ATTRIBUTES_MSG_ID                             0x3
+#define SCMI_RESET_DOMAIN_ATTRIBUTES_PARAM_DOMAIN_ID                    0
+#define SCMI_RESET_DOMAIN_ATTRIBUTES_PARAM_COUNT                        1
+#define SCMI_RESET_DOMAIN_ATTRIBUTES_RET_ATTRIBUTES                     0
+#define SCMI_RESET_DOMAIN_ATTRIBUTES_ATTRIBUTES_NOTIFY_LOW              30
+#define SCMI_RESET_DOMAIN_ATTRIBUTES_ATTRIBUTES_NOTIFY_HIGH             30
+#define SCMI_RESET_DOMAIN_ATTRIBUTES_ATTRIBUTES_ASYNC_LOW               31
+#define SCMI_RESET_DOMAIN_ATTRIBUTES_ATTRIBUTES_ASYNC_HIGH              31
+#define SCMI_RESET_DOMAIN_ATTRIBUTES_RET_LATENCY                        1
+#define SCMI_RESET_DOMAIN_ATTRIBUTES_RET_NAME                           2
+#define SCMI_RESET_DOMAIN_ATTRIBUTES_RET_COUNT                          6
+
+struct scmi_reset_domain_attributes_params {
+    uint32_t domain_id;
+};
+
+static inline size_t scmi_reset_domain_attributes_params_encode(uint32_t *words,
+        const struct scmi_reset_domain_attributes_params *params)
+{
+    words[0] = params->domain_id;
+    return 1;
+}
+
+static inline bool scmi_reset_domain_attributes_params_decode(const uint32_t *words,
+        size_t count, struct scmi_reset_domain_attributes_params *params)
+{
+    if (count != 1)
+        return false;
+
+    params->domain_id = words[0];
+    return true;
+}
+
+struct scmi_reset_domain_attributes_returns {
+    uint32_t attributes;
+    uint32_t latency;
+    uint8_t name[SCMI_CODEC_NAME_SIZE];
+};
+
+static inline size_t scmi_reset_domain_attributes_returns_encode(uint32_t *words,
+        const struct scmi_reset_domain_attributes_returns *returns)
+{
+    words[0] = returns->attributes;
+    words[1] = returns->latency;
+    scmi_codec_copy_bytes(&words[2], returns->name, SCMI_CODEC_NAME_SIZE);
+    return 6;
+}
+
+static inline bool scmi_reset_domain_attributes_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_reset_domain_attributes_returns *returns)
+{
+    if (count != 6)
+        return false;
+
+    returns->attributes = words[0];
+    returns->latency = words[1];
+    scmi_codec_copy_bytes(returns->name, &words[2], SCMI_CODEC_NAME_SIZE);
+    return true;
+}
+
+static inline uint32_t scmi_reset_domain_attributes_attributes_notify(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 30, 30);
+}
+
+static inline uint32_t scmi_reset_domain_attributes_attributes_async(uint32_t attributes)
+{
+    return SCMI_CODEC_BITS(attributes, 31, 31);
+}
+
+/* reset RESET, command 0x4 */
+
+#define SCMI_RESET_RESET_MSG_ID                                         0x4
+#define SCMI_RESET_RESET_PARAM_DOMAIN_ID                                0
+#define SCMI_RESET_RESET_PARAM_FLAGS                                    1
+#define SCMI_RESET_RESET_FLAGS_AUTONOMOUS_LOW                           0
+#define SCMI_RESET_RESET_FLAGS_AUTONOMOUS_HIGH                          0
+#define SCMI_RESET_RESET_FLAGS_EXPLICIT_LOW                             1
+#define SCMI_RESET_RESET_FLAGS_EXPLICIT_HIGH                            1
+#define SCMI_RESET_RESET_FLAGS_ASYNC_LOW                                2
+#define SCMI_RESET_RESET_FLAGS_ASYNC_HIGH                               2
+#define SCMI_RESET_RESET_PARAM_RESET_STATE                              2
+#define SCMI_RESET_RESET_PARAM_COUNT                                    3
+#define SCMI_RESET_RESET_RET_COUNT                                      0
+
+struct scmi_reset_reset_params {
+    uint32_t domain_id;
+    uint32_t flags;
+    uint32_t reset_state;
+};
+
+static inline size_t scmi_reset_reset_params_encode(uint32_t *words,
+        const struct scmi_reset_reset_params *params)
+{
+    words[0] = params->domain_id;
+    words[1] = params->flags;
+    words[2] = params->reset_state;
+    return 3;
+}
+
+static inline bool scmi_reset_reset_params_decode(const uint32_t *words,
+        size_t count, struct scmi_reset_reset_params *params)
+{
+    if (count != 3)
+        return false;
+
+    params->domain_id = words[0];
+    params->flags = words[1];
+    params->reset_state = words[2];
+    return true;
+}
+
+static inline uint32_t scmi_reset_reset_flags_autonomous(uint32_t flags)
+{
+    return SCMI_CODEC_BITS(flags, 0, 0);
+}
+
+static inline uint32_t scmi_reset_reset_flags_explicit(uint32_t flags)
+{
+    return SCMI_CODEC_BITS(flags, 1, 1);
+}
+
+static inline uint32_t scmi_reset_reset_flags_async(uint32_t flags)
+{
+    return SCMI_CODEC_BITS(flags, 2, 2);
+}
+
+/* reset NOTIFY, command 0x5 */
+
+#define SCMI_RESET_NOTIFY_MSG_ID                                        0x5
+#define SCMI_RESET_NOTIFY_PARAM_DOMAIN_ID                               0
+#define SCMI_RESET_NOTIFY_PARAM_NOTIFY_ENABLE                           1
+#define SCMI_RESET_NOTIFY_NOTIFY_ENABLE_ENABLE_LOW                      0
+#define SCMI_RESET_NOTIFY_NOTIFY_ENABLE_ENABLE_HIGH                     0
+#define SCMI_RESET_NOTIFY_PARAM_COUNT                                   2
+#define SCMI_RESET_NOTIFY_RET_COUNT                                     0
+
+struct scmi_reset_notify_params {
+    uint32_t domain_id;
+    uint32_t notify_enable;
+};
+
+static inline size_t scmi_reset_notify_params_encode(uint32_t *words,
+        const struct scmi_reset_notify_params *params)
+{
+    words[0] = params->domain_id;
+    words[1] = params->notify_enable;
+    return 2;
+}
+
+static inline bool scmi_reset_notify_params_decode(const uint32_t *words,
+        size_t count, struct scmi_reset_notify_params *params)
+{
+    if (count != 2)
+        return false;
+
+    params->domain_id = words[0];
+    params->notify_enable = words[1];
+    return true;
+}
+
+static inline uint32_t scmi_reset_notify_notify_enable_enable(uint32_t notify_enable)
+{
+    return SCMI_CODEC_BITS(notify_enable, 0, 0);
+}
+
+/* reset COMPLETE, delayed 0x4 */
+
+#define SCMI_RESET_COMPLETE_MSG_ID                                      0x4
+#define SCMI_RESET_COMPLETE_RET_DOMAIN_ID                               0
+#define SCMI_RESET_COMPLETE_RET_COUNT                                   1
+
+struct scmi_reset_complete_returns {
+    uint32_t domain_id;
+};
+
+static inline size_t scmi_reset_complete_returns_encode(uint32_t *words,
+        const struct scmi_reset_complete_returns *returns)
+{
+    words[0] = returns->domain_id;
+    return 1;
+}
+
+static inline bool scmi_reset_complete_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_reset_complete_returns *returns)
+{
+    if (count != 1)
+        return false;
+
+    returns->domain_id = words[0];
+    return true;
+}
+
+/* reset ISSUED, notification 0x0 */
+
+#define SCMI_RESET_ISSUED_MSG_ID                                        0x0
+#define SCMI_RESET_ISSUED_RET_AGENT_ID                                  0
+#define SCMI_RESET_ISSUED_RET_DOMAIN_ID                                 1
+#define SCMI_RESET_ISSUED_RET_RESET_STATE                               2
+#define SCMI_RESET_ISSUED_RET_COUNT                                     3
+
+struct scmi_reset_issued_returns {
+    uint32_t agent_id;
+    uint32_t domain_id;
+    uint32_t reset_state;
+};
+
+static inline size_t scmi_reset_issued_returns_encode(uint32_t *words,
+        const struct scmi_reset_issued_returns *returns)
+{
+    words[0] = returns->agent_id;
+    words[1] = returns->domain_id;
+    words[2] = returns->reset_state;
+    return 3;
+}
+
+static inline bool scmi_reset_issued_returns_decode(const uint32_t *words,
+        size_t count, struct scmi_reset_issued_returns *returns)
+{
+    if (count != 3)
+        return false;
+
+    returns->agent_id = words[0];
+    returns->domain_id = words[1];
+    returns->reset_state = words[2];
+    return true;
+}
+
+/* Words of parameters of a command, -1 for a command not described */
+static inline int32_t scmi_codec_param_count(uint32_t protocol_id, uint32_t message_id)
+{
+    switch ((protocol_id << 8) | message_id) {
+    case (SCMI_BASE_PROTOCOL_ID << 8) | SCMI_BASE_PROTOCOL_VERSION_MSG_ID:
+        return SCMI_BASE_PROTOCOL_VERSION_PARAM_COUNT;
+    case (SCMI_BASE_PROTOCOL_ID << 8) | SCMI_BASE_PROTOCOL_ATTRIBUTES_MSG_ID:
+        return SCMI_BASE_PROTOCOL_ATTRIBUTES_PARAM_COUNT;
+    case (SCMI_BASE_PROTOCOL_ID << 8) | SCMI_BASE_PROTOCOL_MESSAGE_ATTRIBUTES_MSG_ID:
+        return SCMI_BASE_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_COUNT;
+    case (SCMI_BASE_PROTOCOL_ID << 8) | SCMI_BASE_DISCOVER_VENDOR_MSG_ID:
+        return SCMI_BASE_DISCOVER_VENDOR_PARAM_COUNT;
+    case (SCMI_BASE_PROTOCOL_ID << 8) | SCMI_BASE_DISCOVER_SUB_VENDOR_MSG_ID:
+        return SCMI_BASE_DISCOVER_SUB_VENDOR_PARAM_COUNT;
+    case (SCMI_BASE_PROTOCOL_ID << 8) | SCMI_BASE_DISCOVER_IMPLEMENTATION_VERSION_MSG_ID:
+        return SCMI_BASE_DISCOVER_IMPLEMENTATION_VERSION_PARAM_COUNT;
+    case (SCMI_BASE_PROTOCOL_ID << 8) | SCMI_BASE_DISCOVER_LIST_PROTOCOLS_MSG_ID:
+        return SCMI_BASE_DISCOVER_LIST_PROTOCOLS_PARAM_COUNT;
+    case (SCMI_BASE_PROTOCOL_ID << 8) | SCMI_BASE_DISCOVER_AGENT_MSG_ID:
+        return SCMI_BASE_DISCOVER_AGENT_PARAM_COUNT;
+    case (SCMI_BASE_PROTOCOL_ID << 8) | SCMI_BASE_NOTIFY_ERRORS_MSG_ID:
+        return SCMI_BASE_NOTIFY_ERRORS_PARAM_COUNT;
+    case (SCMI_BASE_PROTOCOL_ID << 8) | SCMI_BASE_SET_DEVICE_PERMISSIONS_MSG_ID:
+        return SCMI_BASE_SET_DEVICE_PERMISSIONS_PARAM_COUNT;
+    case (SCMI_BASE_PROTOCOL_ID << 8) | SCMI_BASE_SET_PROTOCOL_PERMISSIONS_MSG_ID:
+        return SCMI_BASE_SET_PROTOCOL_PERMISSIONS_PARAM_COUNT;
+    case (SCMI_BASE_PROTOCOL_ID << 8) | SCMI_BASE_RESET_AGENT_CONFIGURATION_MSG_ID:
+        return SCMI_BASE_RESET_AGENT_CONFIGURATION_PARAM_COUNT;
+    case (SCMI_POWER_DOMAIN_PROTOCOL_ID << 8) | SCMI_POWER_DOMAIN_PROTOCOL_VERSION_MSG_ID:
+        return SCMI_POWER_DOMAIN_PROTOCOL_VERSION_PARAM_COUNT;
+    case (SCMI_POWER_DOMAIN_PROTOCOL_ID << 8) | SCMI_POWER_DOMAIN_PROTOCOL_ATTRIBUTES_MSG_ID:
+        return SCMI_POWER_DOMAIN_PROTOCOL_ATTRIBUTES_PARAM_COUNT;
+    case (SCMI_POWER_DOMAIN_PROTOCOL_ID << 8) | SCMI_POWER_DOMAIN_PROTOCOL_MESSAGE_ATTRIBUTES_MSG_ID:
+        return SCMI_POWER_DOMAIN_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_COUNT;
+    case (SCMI_POWER_DOMAIN_PROTOCOL_ID << 8) | SCMI_POWER_DOMAIN_DOMAIN_ATTRIBUTES_MSG_ID:
+        return SCMI_POWER_DOMAIN_DOMAIN_ATTRIBUTES_PARAM_COUNT;
+    case (SCMI_POWER_DOMAIN_PROTOCOL_ID << 8) | SCMI_POWER_DOMAIN_STATE_SET_MSG_ID:
+        return SCMI_POWER_DOMAIN_STATE_SET_PARAM_COUNT;
+    case (SCMI_POWER_DOMAIN_PROTOCOL_ID << 8) | SCMI_POWER_DOMAIN_STATE_GET_MSG_ID:
+        return SCMI_POWER_DOMAIN_STATE_GET_PARAM_COUNT;
+    case (SCMI_POWER_DOMAIN_PROTOCOL_ID << 8) | SCMI_POWER_DOMAIN_STATE_NOTIFY_MSG_ID:
+        return SCMI_POWER_DOMAIN_STATE_NOTIFY_PARAM_COUNT;
+    case (SCMI_POWER_DOMAIN_PROTOCOL_ID << 8) | SCMI_POWER_DOMAIN_STATE_CHANGE_REQUESTED_NOTIFY_MSG_ID:
+        return SCMI_POWER_DOMAIN_STATE_CHANGE_REQUESTED_NOTIFY_PARAM_COUNT;
+    case (SCMI_SYSTEM_POWER_PROTOCOL_ID << 8) | SCMI_SYSTEM_POWER_PROTOCOL_VERSION_MSG_ID:
+        return SCMI_SYSTEM_POWER_PROTOCOL_VERSION_PARAM_COUNT;
+    case (SCMI_SYSTEM_POWER_PROTOCOL_ID << 8) | SCMI_SYSTEM_POWER_PROTOCOL_ATTRIBUTES_MSG_ID:
+        return SCMI_SYSTEM_POWER_PROTOCOL_ATTRIBUTES_PARAM_COUNT;
+    case (SCMI_SYSTEM_POWER_PROTOCOL_ID << 8) | SCMI_SYSTEM_POWER_PROTOCOL_MESSAGE_ATTRIBUTES_MSG_ID:
+        return SCMI_SYSTEM_POWER_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_COUNT;
+    case (SCMI_SYSTEM_POWER_PROTOCOL_ID << 8) | SCMI_SYSTEM_POWER_STATE_SET_MSG_ID:
+        return SCMI_SYSTEM_POWER_STATE_SET_PARAM_COUNT;
+    case (SCMI_SYSTEM_POWER_PROTOCOL_ID << 8) | SCMI_SYSTEM_POWER_STATE_GET_MSG_ID:
+        return SCMI_SYSTEM_POWER_STATE_GET_PARAM_COUNT;
+    case (SCMI_SYSTEM_POWER_PROTOCOL_ID << 8) | SCMI_SYSTEM_POWER_STATE_NOTIFY_MSG_ID:
+        return SCMI_SYSTEM_POWER_STATE_NOTIFY_PARAM_COUNT;
+    case (SCMI_PERFORMANCE_PROTOCOL_ID << 8) | SCMI_PERFORMANCE_PROTOCOL_VERSION_MSG_ID:
+        return SCMI_PERFORMANCE_PROTOCOL_VERSION_PARAM_COUNT;
+    case (SCMI_PERFORMANCE_PROTOCOL_ID << 8) | SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_MSG_ID:
+        return SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_PARAM_COUNT;
+    case (SCMI_PERFORMANCE_PROTOCOL_ID << 8) | SCMI_PERFORMANCE_PROTOCOL_MESSAGE_ATTRIBUTES_MSG_ID:
+        return SCMI_PERFORMANCE_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_COUNT;
+    case (SCMI_PERFORMANCE_PROTOCOL_ID << 8) | SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_MSG_ID:
+        return SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_PARAM_COUNT;
+    case (SCMI_PERFORMANCE_PROTOCOL_ID << 8) | SCMI_PERFORMANCE_DESCRIBE_LEVELS_MSG_ID:
+        return SCMI_PERFORMANCE_DESCRIBE_LEVELS_PARAM_COUNT;
+    case (SCMI_PERFORMANCE_PROTOCOL_ID << 8) | SCMI_PERFORMANCE_LIMITS_SET_MSG_ID:
+        return SCMI_PERFORMANCE_LIMITS_SET_PARAM_COUNT;
+    case (SCMI_PERFORMANCE_PROTOCOL_ID << 8) | SCMI_PERFORMANCE_LIMITS_GET_MSG_ID:
+        return SCMI_PERFORMANCE_LIMITS_GET_PARAM_COUNT;
+    case (SCMI_PERFORMANCE_PROTOCOL_ID << 8) | SCMI_PERFORMANCE_LEVEL_SET_MSG_ID:
+        return SCMI_PERFORMANCE_LEVEL_SET_PARAM_COUNT;
+    case (SCMI_PERFORMANCE_PROTOCOL_ID << 8) | SCMI_PERFORMANCE_LEVEL_GET_MSG_ID:
+        return SCMI_PERFORMANCE_LEVEL_GET_PARAM_COUNT;
+    case (SCMI_PERFORMANCE_PROTOCOL_ID << 8) | SCMI_PERFORMANCE_NOTIFY_LIMITS_MSG_ID:
+        return SCMI_PERFORMANCE_NOTIFY_LIMITS_PARAM_COUNT;
+    case (SCMI_PERFORMANCE_PROTOCOL_ID << 8) | SCMI_PERFORMANCE_NOTIFY_LEVEL_MSG_ID:
+        return SCMI_PERFORMANCE_NOTIFY_LEVEL_PARAM_COUNT;
+    case (SCMI_PERFORMANCE_PROTOCOL_ID << 8) | SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_MSG_ID:
+        return SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_PARAM_COUNT;
+    case (SCMI_CLOCK_PROTOCOL_ID << 8) | SCMI_CLOCK_PROTOCOL_VERSION_MSG_ID:
+        return SCMI_CLOCK_PROTOCOL_VERSION_PARAM_COUNT;
+    case (SCMI_CLOCK_PROTOCOL_ID << 8) | SCMI_CLOCK_PROTOCOL_ATTRIBUTES_MSG_ID:
+        return SCMI_CLOCK_PROTOCOL_ATTRIBUTES_PARAM_COUNT;
+    case (SCMI_CLOCK_PROTOCOL_ID << 8) | SCMI_CLOCK_PROTOCOL_MESSAGE_ATTRIBUTES_MSG_ID:
+        return SCMI_CLOCK_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_COUNT;
+    case (SCMI_CLOCK_PROTOCOL_ID << 8) | SCMI_CLOCK_ATTRIBUTES_MSG_ID:
+        return SCMI_CLOCK_ATTRIBUTES_PARAM_COUNT;
+    case (SCMI_CLOCK_PROTOCOL_ID << 8) | SCMI_CLOCK_DESCRIBE_RATES_MSG_ID:
+        return SCMI_CLOCK_DESCRIBE_RATES_PARAM_COUNT;
+    case (SCMI_CLOCK_PROTOCOL_ID << 8) | SCMI_CLOCK_RATE_SET_MSG_ID:
+        return SCMI_CLOCK_RATE_SET_PARAM_COUNT;
+    case (SCMI_CLOCK_PROTOCOL_ID << 8) | SCMI_CLOCK_RATE_GET_MSG_ID:
+        return SCMI_CLOCK_RATE_GET_PARAM_COUNT;
+    case (SCMI_CLOCK_PROTOCOL_ID << 8) | SCMI_CLOCK_CONFIG_SET_MSG_ID:
+        return SCMI_CLOCK_CONFIG_SET_PARAM_COUNT;
+    case (SCMI_SENSOR_PROTOCOL_ID << 8) | SCMI_SENSOR_PROTOCOL_VERSION_MSG_ID:
+        return SCMI_SENSOR_PROTOCOL_VERSION_PARAM_COUNT;
+    case (SCMI_SENSOR_PROTOCOL_ID << 8) | SCMI_SENSOR_PROTOCOL_ATTRIBUTES_MSG_ID:
+        return SCMI_SENSOR_PROTOCOL_ATTRIBUTES_PARAM_COUNT;
+    case (SCMI_SENSOR_PROTOCOL_ID << 8) | SCMI_SENSOR_PROTOCOL_MESSAGE_ATTRIBUTES_MSG_ID:
+        return SCMI_SENSOR_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_COUNT;
+    case (SCMI_SENSOR_PROTOCOL_ID << 8) | SCMI_SENSOR_DESCRIPTION_GET_MSG_ID:
+        return SCMI_SENSOR_DESCRIPTION_GET_PARAM_COUNT;
+    case (SCMI_SENSOR_PROTOCOL_ID << 8) | SCMI_SENSOR_TRIP_POINT_NOTIFY_MSG_ID:
+        return SCMI_SENSOR_TRIP_POINT_NOTIFY_PARAM_COUNT;
+    case (SCMI_SENSOR_PROTOCOL_ID << 8) | SCMI_SENSOR_TRIP_POINT_CONFIG_MSG_ID:
+        return SCMI_SENSOR_TRIP_POINT_CONFIG_PARAM_COUNT;
+    case (SCMI_SENSOR_PROTOCOL_ID << 8) | SCMI_SENSOR_READING_GET_MSG_ID:
+        return SCMI_SENSOR_READING_GET_PARAM_COUNT;
+    case (SCMI_RESET_PROTOCOL_ID << 8) | SCMI_RESET_PROTOCOL_VERSION_MSG_ID:
+        return SCMI_RESET_PROTOCOL_VERSION_PARAM_COUNT;
+    case (SCMI_RESET_PROTOCOL_ID << 8) | SCMI_RESET_PROTOCOL_ATTRIBUTES_MSG_ID:
+        return SCMI_RESET_PROTOCOL_ATTRIBUTES_PARAM_COUNT;
+    case (SCMI_RESET_PROTOCOL_ID << 8) | SCMI_RESET_PROTOCOL_MESSAGE_ATTRIBUTES_MSG_ID:
+        return SCMI_RESET_PROTOCOL_MESSAGE_ATTRIBUTES_PARAM_COUNT;
+    case (SCMI_RESET_PROTOCOL_ID << 8) | SCMI_RESET_DOMAIN_ATTRIBUTES_MSG_ID:
+        return SCMI_RESET_DOMAIN_ATTRIBUTES_PARAM_COUNT;
+    case (SCMI_RESET_PROTOCOL_ID << 8) | SCMI_RESET_RESET_MSG_ID:
+        return SCMI_RESET_RESET_PARAM_COUNT;
+    case (SCMI_RESET_PROTOCOL_ID << 8) | SCMI_RESET_NOTIFY_MSG_ID:
+        return SCMI_RESET_NOTIFY_PARAM_COUNT;
+    default:
+        return -1;
+    }
+}
+
+#endif /* __SCMI_CODEC_H__ */
@@ -18,15 +18,17 @@
 #ifndef __VAL_BASE_H__
 #define __VAL_BASE_H__
 
-#define VERSION_OFFSET                0
-#define ATTRIBUTE_OFFSET              0
-#define VENDOR_ID_OFFSET              0
-#define IMPLEMENTATION_VERSION_OFFSET 0
-#define NUM_OF_PROTOCOLS_OFFSET       0
-#define PROTOCOL_LIST_OFFSET          1
-#define AGENT_ID_OFFSET               0
-#define AGENT_NAME_OFFSET             1
+/* Offsets of the return values, see scmi_codec.h */
+#define VERSION_OFFSET                SCMI_BASE_PROTOCOL_VERSION_RET_VERSION
+#define ATTRIBUTE_OFFSET              SCMI_BASE_PROTOCOL_ATTRIBUTES_RET_ATTRIBUTES
+#define VENDOR_ID_OFFSET              SCMI_BASE_DISCOVER_VENDOR_RET_VENDOR_IDENTIFIER
+#define IMPLEMENTATION_VERSION_OFFSET SCMI_BASE_DISCOVER_IMPLEMENTATION_VERSION_RET_IMPLEMENTATION_VERSION
+#define NUM_OF_PROTOCOLS_OFFSET       SCMI_BASE_DISCOVER_LIST_PROTOCOLS_RET_NUM_PROTOCOLS
+#define PROTOCOL_LIST_OFFSET          SCMI_BASE_DISCOVER_LIST_PROTOCOLS_RET_PROTOCOLS
+#define AGENT_ID_OFFSET               SCMI_BASE_DISCOVER_AGENT_RET_AGENT_ID
+#define AGENT_NAME_OFFSET             SCMI_BASE_DISCOVER_AGENT_RET_NAME
 
+/* SCMI 1.0 DISCOVER_AGENT returns the name only */
 #define AGENT_NAME_v1_OFFSET          0
 
 #define INVALID_NOTIFY_ENABLE        0xF
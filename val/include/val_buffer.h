@@ -0,0 +1,37 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef __VAL_BUFFER_H__
+#define __VAL_BUFFER_H__
+
+#include <stdint.h>
+
+/*
+ * Response buffers. A paginated command returns as many entries as the
+ * channel holds, see pal_get_channel_size(), which may be far more than the
+ * MAX_RETURNS_SIZE array of an ordinary command. Each thread carves its pool
+ * into buffers that hold the return values of a full channel. Buffers are
+ * not given back one by one: the pool of a thread is emptied when a test or
+ * a discovery walk starts. val_send_message() tells the transport how many
+ * words the buffer it is handed holds, so that a response larger than its
+ * buffer is cut short rather than written past it.
+ */
+#define VAL_MAX_RETURN_VALUES   PAL_CHANNEL_MAX_RETURNS(PAL_CHANNEL_SIZE_MAX)
+#define VAL_BUFFER_MIN_COUNT    2  /* buffers of the pool with the largest channel */
+#define VAL_BUFFER_POOL_WORDS   (VAL_BUFFER_MIN_COUNT * VAL_MAX_RETURN_VALUES)
+
+#endif
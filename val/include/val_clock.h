@@ -18,17 +18,18 @@
 #ifndef __VAL_CLOCK_H__
 #define __VAL_CLOCK_H__
 
-#define VERSION_OFFSET                     0
-#define ATTRIBUTE_OFFSET                   0
-#define NAME_OFFSET                        1
-#define RATE_FLAG_OFFSET                   0
-#define RATES_OFFSET                       1
-#define RATE_LOWER_WORD_OFFSET             0
-#define RATE_UPPER_WORD_OFFSET             1
+/* Offsets of the return values, see scmi_codec.h */
+#define VERSION_OFFSET                     SCMI_CLOCK_PROTOCOL_VERSION_RET_VERSION
+#define ATTRIBUTE_OFFSET                   SCMI_CLOCK_PROTOCOL_ATTRIBUTES_RET_ATTRIBUTES
+#define NAME_OFFSET                        SCMI_CLOCK_ATTRIBUTES_RET_CLOCK_NAME
+#define RATE_FLAG_OFFSET                   SCMI_CLOCK_DESCRIBE_RATES_RET_NUM_RATES_FLAGS
+#define RATES_OFFSET                       SCMI_CLOCK_DESCRIBE_RATES_RET_RATES
+#define RATE_LOWER_WORD_OFFSET             SCMI_CLOCK_RATE_GET_RET_RATE
+#define RATE_UPPER_WORD_OFFSET             (SCMI_CLOCK_RATE_GET_RET_RATE + 1)
 
-#define DELAYED_RESP_CLOCK_ID_OFFSET       0
-#define DELAYED_RESP_RATE_LOWER_OFFSET     1
-#define DELAYED_RESP_RATE_UPPER_OFFSET     2
+#define DELAYED_RESP_CLOCK_ID_OFFSET       SCMI_CLOCK_RATE_SET_COMPLETE_RET_CLOCK_ID
+#define DELAYED_RESP_RATE_LOWER_OFFSET     SCMI_CLOCK_RATE_SET_COMPLETE_RET_RATE
+#define DELAYED_RESP_RATE_UPPER_OFFSET     (SCMI_CLOCK_RATE_SET_COMPLETE_RET_RATE + 1)
 
 
 #define INVALID_ATTRIBUTE                  0xF
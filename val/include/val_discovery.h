@@ -0,0 +1,48 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef __VAL_DISCOVERY_H__
+#define __VAL_DISCOVERY_H__
+
+#include <stdint.h>
+
+/*
+ * Discovery phase. Before its tests, each suite walks its protocol once and
+ * fills its info table, so that a test finds the table filled whether or not
+ * the tests that used to fill it have run. A table is handed to the PAL once
+ * walked, and a PAL with a cache hands it back on the next run of the same
+ * firmware, keyed by VAL_DISCOVERY_KEY_s, instead of the protocol being
+ * walked again.
+ */
+#define VAL_DISCOVERY_VENDOR_SIZE      16 /* SCMI_NAME_STR_SIZE */
+
+/* How the table of a protocol was filled, see val_discovery_report() */
+#define VAL_DISCOVERY_NONE             0 /* the suite did not run */
+#define VAL_DISCOVERY_WALKED           1
+#define VAL_DISCOVERY_CACHED           2
+#define VAL_DISCOVERY_FAILED           3 /* partly filled, the tests fill the rest */
+
+typedef struct {
+    uint8_t  vendor_name[VAL_DISCOVERY_VENDOR_SIZE];  /* from BASE_DISCOVER_VENDOR */
+    uint32_t implementation_version;   /* from BASE_DISCOVER_IMPLEMENTATION_VERSION */
+    uint32_t protocol_id;
+    uint32_t protocol_version;
+    uint32_t channel_id;               /* agents may see different resources */
+    uint32_t table_size;               /* size of the info table, changes with the build */
+} VAL_DISCOVERY_KEY_s;
+
+#endif
@@ -19,6 +19,14 @@
 #define __VAL_INTERFACE_H__
 
 #include "pal_interface.h"
+#include "val_trace.h"
+#include "val_record.h"
+#include "val_result.h"
+#include "val_registry.h"
+#include "val_discovery.h"
+#include "val_buffer.h"
+#include "val_stats.h"
+#include "scmi_codec.h"
 
 #define RUN_TEST(x) val_report_status(x)
 
@@ -41,10 +49,40 @@
 #define VAL_PRINT_DEBUG PAL_PRINT_DEBUG
 #define VAL_PRINT_INFO  PAL_PRINT_INFO
 
+/* Prints above VERBOSE_LEVEL are compiled out along with their arguments.
+   With VAL_BINARY_TRACE, each print is recorded as the offset of its format
+   string in VAL_TRACE_SECTION followed by its raw arguments, see val_trace.h */
+#ifdef VAL_BINARY_TRACE
+#define val_print(level, format, ...)                                                   \
+    do {                                                                               \
+        if ((level) <= VERBOSE_LEVEL) {                                                \
+            static const char val_trace_format[]                                       \
+                __attribute__((section(VAL_TRACE_SECTION), aligned(1))) = format;      \
+            val_trace(level, val_trace_format, ##__VA_ARGS__);                         \
+        }                                                                              \
+    } while (0)
+#else
+#define val_print(level, ...)                                                           \
+    do {                                                                               \
+        if ((level) <= VERBOSE_LEVEL)                                                  \
+            val_print_message(level, __VA_ARGS__);                                     \
+    } while (0)
+#endif
+
 #define VAL_STATUS_FAIL     PAL_STATUS_FAIL
 #define VAL_STATUS_SKIP     PAL_STATUS_SKIP
 #define VAL_STATUS_PASS     PAL_STATUS_PASS
 #define VAL_STATUS_NO_TESTS PAL_STATUS_NO_TESTS
+#define VAL_STATUS_TIMEOUT  PAL_STATUS_TIMEOUT
+
+/* Wall clock budget of a test, a test running past it is reported as TIMEOUT.
+   The PAL watchdog unblocks the transport once the budget has run out */
+#define VAL_TEST_BUDGET_MS  10000
+#define VAL_MAX_TEST_NUM    800 /* Test numbers are below this, see SCMI_*_TEST_NUM_BASE */
+#define VAL_SLOWEST_TESTS   5   /* Tests listed by val_test_timing_report() */
+
+/* Highest statistics read rate, val_stats_start() clamps faster rates */
+#define VAL_STATS_MAX_RATE_HZ  100000
 
 #define VAL_RESERVED_BYTE_ZERO 0x00
 #define VAL_EXTRACT_BITS(data, start, end) ((data >> start) & ((1ul << (end - start + 1)) - 1))
@@ -52,6 +90,19 @@
 #define VAL_INIT_TEST_PARAM(param_count, rsp_msg_hdr, ret_value_count, status) \
      {param_count = 0; rsp_msg_hdr = 0; ret_value_count = 0; status = SCMI_GENERIC_ERROR; }
 
+#define VAL_TOKEN_LOW              SCMI_CODEC_TOKEN_LOW
+#define VAL_TOKEN_HIGH             SCMI_CODEC_TOKEN_HIGH
+#define VAL_TOKEN_MASK             0x3FF
+#define VAL_MAX_OUTSTANDING_CMDS   32 /* Power of 2, at most VAL_TOKEN_MASK + 1 */
+#define VAL_GET_TOKEN(msg_hdr)     scmi_codec_token(msg_hdr)
+
+/* State owned by a single protocol suite is per thread when suites run concurrently */
+#ifdef VAL_MULTI_THREAD
+#define VAL_THREAD_LOCAL __thread
+#else
+#define VAL_THREAD_LOCAL
+#endif
+
 #define VAL_ERR_PRINT_ID_ENABLED  1
 #define VAL_ERR_PRINT_ID_DISABLED 0
 
@@ -79,6 +130,23 @@ typedef enum {
     NOTIFICATION_MSG =      3
 } MESSAGE_TYPE;
 
+typedef enum {
+    VAL_CMD_FREE = 0,
+    VAL_CMD_PENDING,    /* Sent, waiting for the response */
+    VAL_CMD_COMPLETED   /* Response received, a delayed response may follow */
+} VAL_CMD_STATE;
+
+typedef struct {
+    uint32_t msg_hdr;
+    uint32_t state;
+} VAL_OUTSTANDING_CMD_s;
+
+typedef struct {
+    char *data;   /* Capture memory, owned by the caller */
+    size_t size;  /* Size of data in bytes */
+    size_t used;  /* Bytes captured so far, excluding the terminator */
+} VAL_PRINT_BUFFER_s;
+
 typedef enum {
     PROTOCOL_BASE = 0x10,
     PROTOCOL_POWER_DOMAIN,
@@ -95,7 +163,9 @@ uint32_t val_strcmp(uint8_t *dst_ptr, uint8_t *src_ptr, uint32_t len);
 uint32_t val_compare_msg_hdr(uint32_t sent_msg_hdr, uint32_t rsp_msg_hdr);
 uint32_t val_protocol_version_check(uint32_t exp_version, uint32_t version);
 uint32_t val_reserved_bits_check_is_zero(uint32_t reserved_bits);
-void val_print(uint32_t level, const char *string, ...);
+uint32_t val_check_return_count(size_t rcvd_count, size_t exp_count);
+void val_print_message(uint32_t level, const char *string, ...);
+void val_trace(uint32_t level, const char *format, ...);
 void val_memset(void *ptr, int value, size_t length);
 uint32_t val_msg_hdr_create(uint32_t protoco_id, uint32_t msg_id, uint32_t msg_type);
 char *val_get_result_string(uint32_t test_status);
@@ -108,6 +178,7 @@ void val_receive_delayed_response(uint32_t *message_header_rcv, int32_t *status,
                               size_t *return_values_count, uint32_t *return_values);
 void val_receive_notification(uint32_t *message_header_rcv, size_t *return_values_count,
                               uint32_t *return_values);
+uint32_t val_get_outstanding_cmd(uint32_t token);
 uint32_t val_initialize_system(void *info);
 uint32_t val_test_initialize(uint32_t test_num, char *test_desc);
 void val_print_return_values(uint32_t count, uint32_t *values);
@@ -122,8 +193,45 @@ uint32_t val_report_status(uint32_t status);
 uint32_t val_get_test_passed(void);
 uint32_t val_get_test_failed(void);
 uint32_t val_get_test_skipped(void);
+uint32_t val_get_test_timeout(void);
+void val_set_test_budget(uint32_t budget_ms);
+void val_test_timing_report(void);
+uint32_t val_registry_select(const char *filter, uint32_t shard_index, uint32_t shard_count);
+uint32_t val_registry_test_state(uint32_t test_num);
+uint32_t val_registry_protocol_enabled(uint32_t protocol_id);
+void val_registry_set_version(uint32_t protocol_id, uint32_t version);
+uint32_t val_registry_version_supported(uint32_t test_num);
+void val_registry_list(void);
 uint32_t val_compare(char *parameter, uint32_t rcvd_val, uint32_t exp_val);
 uint32_t val_compare_str(char *parameter, char *rcvd_val, char *exp_val, uint32_t len);
+uint32_t val_set_transport(const char *name);
+const char *val_get_transport(void);
+uint32_t val_get_num_channels(void);
+uint32_t val_select_channel(uint32_t channel_id);
+uint32_t val_get_channel(void);
+uint32_t val_discovery_initialize(void);
+uint32_t val_discovery_run(uint32_t protocol_id, uint32_t version, void *table, uint32_t size,
+                           uint32_t (*walk)(uint32_t version));
+int32_t val_discovery_send(uint32_t protocol_id, uint32_t message_id, size_t param_count,
+                           uint32_t *parameters, size_t *return_value_count,
+                           uint32_t *return_values);
+void val_discovery_report(void);
+void val_buffer_initialize(void);
+uint32_t *val_buffer_get(void);
+void val_buffer_reset(void);
+size_t val_buffer_capacity(const uint32_t *buffer);
+uint32_t val_get_max_return_values(void);
+void val_latency_record(uint32_t msg_hdr, uint64_t latency_ns);
+void val_latency_report(void);
+uint32_t val_stats_open(uint32_t protocol_id);
+void val_stats_close(uint32_t protocol_id);
+uint32_t val_stats_read(uint32_t protocol_id, VAL_STATS_SAMPLE_s *samples, uint32_t max_samples);
+uint32_t val_stats_start(uint32_t rate_hz);
+void val_stats_stop(void);
+#ifdef VAL_MULTI_THREAD
+void val_print_buffer_set(VAL_PRINT_BUFFER_s *buffer);
+void val_print_buffer_flush(VAL_PRINT_BUFFER_s *buffer);
+#endif
 
 /* BASE VAL APIs */
 
@@ -160,7 +268,9 @@ typedef enum {
 void val_base_save_info(uint32_t param_identifier, uint32_t param_value);
 void val_base_save_name(uint32_t param_identifier, uint8_t *vendor_name);
 uint32_t val_base_get_info(uint32_t param_identifier);
+uint8_t *val_base_get_name(uint32_t param_identifier);
 uint32_t val_base_execute_tests(void);
+uint32_t val_base_discover(void);
 
 /* POWER DOMAIN VAL APIs */
 
@@ -259,6 +369,7 @@ typedef enum {
     PERF_STATS_ADDR_HIGH,
     PERF_STATS_ADDR_LEN,
     PERF_DOMAIN_NAME,
+    PERF_DESCRIBE_FAST_CH_SUPPORT,
     PERF_MESSAGE_FAST_CH_SUPPORT,
     PERF_DOMAIN_FAST_CH_SUPPORT,
     PERF_DOMAIN_LVL_CHANGE_NTFY_SUPPORT,
@@ -274,6 +385,25 @@ void val_performance_save_info(uint32_t param_identifier, uint32_t perf_id, uint
 uint32_t val_performance_get_info(uint32_t param_identifier, uint32_t perf_id);
 uint32_t val_performance_execute_tests(void);
 
+typedef struct {
+    volatile uint32_t *chan;     /* Mapped fast channel */
+    volatile void *doorbell;     /* Mapped doorbell, NULL when not supported */
+    uint32_t chan_size;          /* In bytes */
+    uint32_t rate_limit;         /* In us */
+    uint32_t doorbell_width;     /* In bytes */
+    uint64_t doorbell_set_mask;
+    uint64_t doorbell_preserve_mask;
+} VAL_FAST_CHANNEL_s;
+
+uint32_t val_fast_channel_init(const uint32_t *describe_values, VAL_FAST_CHANNEL_s *fast_channel);
+uint32_t val_fast_channel_open(uint32_t domain_id, uint32_t message_id,
+                               VAL_FAST_CHANNEL_s *fast_channel);
+void val_fast_channel_close(VAL_FAST_CHANNEL_s *fast_channel);
+uint32_t val_fast_channel_read(const VAL_FAST_CHANNEL_s *fast_channel, uint32_t *values,
+                               uint32_t count);
+uint32_t val_fast_channel_write(const VAL_FAST_CHANNEL_s *fast_channel, const uint32_t *values,
+                                uint32_t count);
+
 /* CLOCK VAL APIs */
 
 typedef enum {
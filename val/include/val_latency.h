@@ -0,0 +1,50 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef __VAL_LATENCY_H__
+#define __VAL_LATENCY_H__
+
+/*
+ * Log-linear histogram: values below 2^SUB_BITS get a bucket each, above that
+ * every power of two is split into 2^SUB_BITS linear sub-buckets, bounding the
+ * error of a reported value to 1/2^SUB_BITS.
+ */
+#define VAL_LATENCY_SUB_BITS        4
+#define VAL_LATENCY_SUB_BUCKETS     (1u << VAL_LATENCY_SUB_BITS)
+#define VAL_LATENCY_MAX_SHIFT       (32 - VAL_LATENCY_SUB_BITS - 1)
+#define VAL_LATENCY_NUM_BUCKETS     ((VAL_LATENCY_MAX_SHIFT + 2) * VAL_LATENCY_SUB_BUCKETS)
+
+/* Number of distinct (protocol, message id) pairs tracked, power of 2 */
+#ifndef VAL_LATENCY_MAX_ENTRIES
+#define VAL_LATENCY_MAX_ENTRIES     128
+#endif
+
+/* Samples of a command are kept apart by how they completed, see pal_get_completion_mode() */
+#define VAL_LATENCY_KEY(protocol_id, msg_id, mode) \
+    ((((protocol_id) << 16) | ((msg_id) << 8) | (mode)) + 1)
+
+typedef struct {
+    uint32_t key;       /* VAL_LATENCY_KEY of the command, 0 when the entry is free */
+    uint32_t count;
+    uint32_t max;       /* In ns */
+    uint32_t bucket[VAL_LATENCY_NUM_BUCKETS];
+} VAL_LATENCY_ENTRY_s;
+
+void val_latency_histogram_add(VAL_LATENCY_ENTRY_s *entry, uint64_t latency_ns);
+uint32_t val_latency_get_percentile(const VAL_LATENCY_ENTRY_s *entry, uint32_t permille);
+
+#endif
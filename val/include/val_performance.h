@@ -22,35 +22,37 @@
 #define MAX_PERFORMANCE_LEVELS                 16
 
 #define NOT_SUPPORTED                          0
-#define VERSION_OFFSET                         0
-#define ATTRIBUTE_OFFSET                       0
-#define STATS_ADDR_LOW_OFFSET                  1
-#define STATS_ADDR_HIGH_OFFSET                 2
-#define STATS_LENGTH_OFFSET                    3
-#define RATE_LIMIT_OFFSET                      1
-#define FREQUENCY_OFFSET                       2
-#define SUSTAINED_LEVEL_OFFSET                 3
-#define NAME_OFFSET                            4
-#define NUM_LEVEL_OFFSET                       0
-#define PERF_LEVEL_ARRAY_OFFSET                1
-#define RANGE_MAX_OFFSET                       0
-#define RANGE_MIN_OFFSET                       1
-#define PERFORMANCE_LEVEL_OFFSET               0
-#define FAST_CH_RATE_LIMIT_OFFSET              1
-#define CHAN_ADDR_LOW_OFFSET                   2
-#define CHAN_ADDR_HIGH_OFFSET                  3
-#define CHAN_SIZE_OFFSET                       4
-#define DOORBELL_ADDR_LOW_OFFSET               5
-#define DOORBELL_ADDR_HIGH_OFFSET              6
-#define DOORBELL_MASK_LOW_OFFSET               7
-#define DOORBELL_MASK_HIGH_OFFSET              8
-#define DOORBELL_PRESERVE_LOW_OFFSET           9
-#define DOORBELL_PRESERVE_HIGH_OFFSET          10
 
-#define NOTIFICATION_DOMAIN_ID_OFFSET          1
-#define NOTIFICATION_RANGE_MAX_OFFSET          2
-#define NOTIFICATION_RANGE_MIN_OFFSET          3
-#define NOTIFICATION_LEVEL_OFFSET              2
+/* Offsets of the return values, see scmi_codec.h */
+#define VERSION_OFFSET                         SCMI_PERFORMANCE_PROTOCOL_VERSION_RET_VERSION
+#define ATTRIBUTE_OFFSET                       SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_RET_ATTRIBUTES
+#define STATS_ADDR_LOW_OFFSET                  SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_RET_STATISTICS_ADDRESS_LOW
+#define STATS_ADDR_HIGH_OFFSET                 SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_RET_STATISTICS_ADDRESS_HIGH
+#define STATS_LENGTH_OFFSET                    SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_RET_STATISTICS_LEN
+#define RATE_LIMIT_OFFSET                      SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_RET_RATE_LIMIT
+#define FREQUENCY_OFFSET                       SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_RET_SUSTAINED_FREQ
+#define SUSTAINED_LEVEL_OFFSET                 SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_RET_SUSTAINED_PERF_LEVEL
+#define NAME_OFFSET                            SCMI_PERFORMANCE_DOMAIN_ATTRIBUTES_RET_NAME
+#define NUM_LEVEL_OFFSET                       SCMI_PERFORMANCE_DESCRIBE_LEVELS_RET_NUM_LEVELS
+#define PERF_LEVEL_ARRAY_OFFSET                SCMI_PERFORMANCE_DESCRIBE_LEVELS_RET_PERF_LEVELS
+#define RANGE_MAX_OFFSET                       SCMI_PERFORMANCE_LIMITS_GET_RET_RANGE_MAX
+#define RANGE_MIN_OFFSET                       SCMI_PERFORMANCE_LIMITS_GET_RET_RANGE_MIN
+#define PERFORMANCE_LEVEL_OFFSET               SCMI_PERFORMANCE_LEVEL_GET_RET_PERFORMANCE_LEVEL
+#define FAST_CH_RATE_LIMIT_OFFSET              SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_RATE_LIMIT
+#define CHAN_ADDR_LOW_OFFSET                   SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_CHAN_ADDR_LOW
+#define CHAN_ADDR_HIGH_OFFSET                  SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_CHAN_ADDR_HIGH
+#define CHAN_SIZE_OFFSET                       SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_CHAN_SIZE
+#define DOORBELL_ADDR_LOW_OFFSET               SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_DOORBELL_ADDR_LOW
+#define DOORBELL_ADDR_HIGH_OFFSET              SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_DOORBELL_ADDR_HIGH
+#define DOORBELL_MASK_LOW_OFFSET               SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_DOORBELL_SET_MASK_LOW
+#define DOORBELL_MASK_HIGH_OFFSET              SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_DOORBELL_SET_MASK_HIGH
+#define DOORBELL_PRESERVE_LOW_OFFSET           SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_DOORBELL_PRESERVE_MASK_LOW
+#define DOORBELL_PRESERVE_HIGH_OFFSET          SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_DOORBELL_PRESERVE_MASK_HIGH
+
+#define NOTIFICATION_DOMAIN_ID_OFFSET          SCMI_PERFORMANCE_LIMITS_CHANGED_RET_DOMAIN_ID
+#define NOTIFICATION_RANGE_MAX_OFFSET          SCMI_PERFORMANCE_LIMITS_CHANGED_RET_RANGE_MAX
+#define NOTIFICATION_RANGE_MIN_OFFSET          SCMI_PERFORMANCE_LIMITS_CHANGED_RET_RANGE_MIN
+#define NOTIFICATION_LEVEL_OFFSET              SCMI_PERFORMANCE_LEVEL_CHANGED_RET_PERFORMANCE_LEVEL
 
 #define INVALID_NOTIFY_EN_VAL                  0xFF
 #define NOTIFY_ENABLE                          1
@@ -80,6 +82,7 @@ typedef struct {
     uint32_t perf_stats_addr_low;
     uint8_t  perf_stats_addr_high;
     uint8_t  perf_stats_addr_len;
+    uint8_t  describe_fast_ch_support;
     PERFORMANCE_CMD_FAST_CH_SUPPORT_s perf_fast_cmd_ch_support;
     PERFORMANCE_DOMAIN_INFO_s perf_domain_info[MAX_PERFORMANCE_DOMAINS];
 } PERFORMANCE_INFO_s;
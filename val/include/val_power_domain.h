@@ -20,13 +20,14 @@
 
 #define MAX_POWER_DOMAINS 10
 
-#define VERSION_OFFSET                         0
-#define ATTRIBUTE_OFFSET                       0
-#define STATS_ADDR_LOW_OFFSET                  1
-#define STATS_ADDR_HIGH_OFFSET                 2
-#define STATS_LENGTH_OFFSET                    3
-#define DOMAIN_NAME_OFFSET                     1
-#define POWER_STATE_OFFSET                     0
+/* Offsets of the return values, see scmi_codec.h */
+#define VERSION_OFFSET                         SCMI_POWER_DOMAIN_PROTOCOL_VERSION_RET_VERSION
+#define ATTRIBUTE_OFFSET                       SCMI_POWER_DOMAIN_PROTOCOL_ATTRIBUTES_RET_ATTRIBUTES
+#define STATS_ADDR_LOW_OFFSET                  SCMI_POWER_DOMAIN_PROTOCOL_ATTRIBUTES_RET_STATISTICS_ADDRESS_LOW
+#define STATS_ADDR_HIGH_OFFSET                 SCMI_POWER_DOMAIN_PROTOCOL_ATTRIBUTES_RET_STATISTICS_ADDRESS_HIGH
+#define STATS_LENGTH_OFFSET                    SCMI_POWER_DOMAIN_PROTOCOL_ATTRIBUTES_RET_STATISTICS_LEN
+#define DOMAIN_NAME_OFFSET                     SCMI_POWER_DOMAIN_DOMAIN_ATTRIBUTES_RET_NAME
+#define POWER_STATE_OFFSET                     SCMI_POWER_DOMAIN_STATE_GET_RET_POWER_STATE
 
 #define INVALID_SYNC_FLAG                      0xF
 #define INVALID_ASYNC_FLAG                     0xE
@@ -0,0 +1,62 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef __VAL_RECORD_H__
+#define __VAL_RECORD_H__
+
+#include <stdint.h>
+
+/*
+ * Recording of the SCMI traffic of a run, shared by the agent, the replay
+ * backend of the hosted platforms and scmi_record_dump. A recording is a
+ * VAL_RECORD_FILE_s header followed by fixed size VAL_RECORD_s records, one
+ * per command and response, delayed response or notification, in the order
+ * they completed. Words are stored in the byte order of the agent,
+ * little-endian on every supported platform.
+ */
+#define VAL_RECORD_MAGIC               0x524D4353 /* "SCMR" */
+#define VAL_RECORD_VERSION             1
+#define VAL_RECORD_MAX_PARAMETERS      8  /* Longer commands are recorded truncated */
+#define VAL_RECORD_MAX_RETURNS         32 /* MAX_RETURNS_SIZE */
+
+#define VAL_RECORD_COMMAND             0
+#define VAL_RECORD_DELAYED_RESPONSE    1
+#define VAL_RECORD_NOTIFICATION        2
+
+typedef struct {
+    uint32_t magic;        /* VAL_RECORD_MAGIC */
+    uint32_t version;      /* VAL_RECORD_VERSION */
+    uint32_t record_size;  /* sizeof(VAL_RECORD_s) */
+    uint32_t num_records;  /* records written so far */
+} VAL_RECORD_FILE_s;
+
+typedef struct {
+    uint64_t timestamp_ns;     /* when the command was sent or the wait started */
+    uint64_t latency_ns;       /* until the response or message was received */
+    uint32_t kind;             /* VAL_RECORD_COMMAND, _DELAYED_RESPONSE or _NOTIFICATION */
+    uint32_t channel;          /* channel of the agent thread */
+    uint32_t command_header;   /* header sent, 0 for a delayed response or notification */
+    uint32_t header;           /* header received */
+    int32_t  status;           /* status received, 0 for a notification */
+    uint32_t num_parameters;   /* parameters sent */
+    uint32_t num_returns;      /* return values received */
+    uint32_t reserved;
+    uint32_t parameters[VAL_RECORD_MAX_PARAMETERS];
+    uint32_t returns[VAL_RECORD_MAX_RETURNS];
+} VAL_RECORD_s;
+
+#endif
@@ -0,0 +1,58 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef __VAL_REGISTRY_H__
+#define __VAL_REGISTRY_H__
+
+#include <stdint.h>
+
+/*
+ * Test registry. Each test registers a descriptor in VAL_REGISTRY_SECTION
+ * of the agent image, so the registry holds the tests that are linked in.
+ * Suites still run their tests in order. A test that is not selected
+ * returns from val_test_initialize() without sending anything, and a test
+ * that is only needed by a selected test runs without being reported, and
+ * a test whose version bounds exclude the protocol version is skipped.
+ */
+#define VAL_REGISTRY_SECTION     "val_test_registry"
+#define VAL_REGISTRY_MAX_DEPS    6 /* Direct dependencies of a test */
+#define VAL_VERSION_ANY          0 /* No version bound */
+
+typedef struct {
+    uint32_t test_num;
+    uint32_t protocol_id;        /* PROTOCOL_IDENTIFIER of the suite running the test */
+    const char *description;
+    uint32_t min_version;        /* lowest protocol version the test runs on, or VAL_VERSION_ANY */
+    uint32_t max_version;        /* highest protocol version the test runs on, or VAL_VERSION_ANY */
+    uint16_t deps[VAL_REGISTRY_MAX_DEPS]; /* tests whose discovery it relies on, 0 terminated */
+} VAL_TEST_s;
+
+/* Lists the tests a test relies on, a test without dependencies uses VAL_TEST_DEPS(0) */
+#define VAL_TEST_DEPS(...) { __VA_ARGS__ }
+
+/* Registers the test of the file, which defines TEST_NUM and TEST_DESC */
+#define VAL_REGISTER_TEST(protocol_id, min_version, max_version, deps)                    \
+    static const VAL_TEST_s val_test_descriptor                                         \
+        __attribute__((used, section(VAL_REGISTRY_SECTION), aligned(8))) =             \
+        { TEST_NUM, protocol_id, TEST_DESC, min_version, max_version, deps }
+
+/* What val_test_initialize() does with a test, see val_registry_select() */
+#define VAL_TEST_SKIPPED         0 /* not selected, nor needed by a selected test */
+#define VAL_TEST_QUIET           1 /* needed by a selected test, runs unreported */
+#define VAL_TEST_SELECTED        2
+
+#endif
@@ -20,10 +20,11 @@
 
 #define MAX_NUM_OF_DOMAINS                 5
 
-#define VERSION_OFFSET                           0
-#define ATTRIBUTE_OFFSET                         0
-#define LATANCY_OFFSET                           1
-#define NAME_OFFSET                              2
+/* Offsets of the return values, see scmi_codec.h */
+#define VERSION_OFFSET                           SCMI_RESET_PROTOCOL_VERSION_RET_VERSION
+#define ATTRIBUTE_OFFSET                         SCMI_RESET_PROTOCOL_ATTRIBUTES_RET_ATTRIBUTES
+#define LATANCY_OFFSET                           SCMI_RESET_DOMAIN_ATTRIBUTES_RET_LATENCY
+#define NAME_OFFSET                              SCMI_RESET_DOMAIN_ATTRIBUTES_RET_NAME
 
 #define ARCH_COLD_RESET                          0
 #define EXPLICIT_SYNC_DEASSERT_RESET             0
@@ -0,0 +1,51 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef __VAL_RESULT_H__
+#define __VAL_RESULT_H__
+
+#include <stdint.h>
+
+/*
+ * Results of a run, handed to the PAL as they happen: one result per check
+ * made by the val_compare helpers, then one per test when it is reported.
+ * The strings are only valid for the duration of pal_result().
+ */
+#define VAL_RESULT_CHECK         0
+#define VAL_RESULT_TEST          1
+
+#define VAL_RESULT_NUMBER        0 /* expected and received are numbers */
+#define VAL_RESULT_STRING        1 /* expected and received are strings */
+#define VAL_RESULT_NONE          2 /* the check has no expected value */
+
+typedef struct {
+    uint32_t kind;               /* VAL_RESULT_CHECK or VAL_RESULT_TEST */
+    uint32_t test_num;           /* number of the test, 0 outside of a test */
+    const char *suite;           /* protocol of the test */
+    const char *description;     /* description of the test */
+    const char *check;           /* name of the check, NULL for a test */
+    uint32_t status;             /* VAL_STATUS_PASS, _FAIL, _SKIP or _TIMEOUT */
+    uint64_t elapsed_ns;         /* since the test started */
+    uint64_t duration_ns;        /* since the previous check of the test, or its start */
+    uint32_t value_type;         /* VAL_RESULT_NUMBER, _STRING or _NONE */
+    uint32_t expected;
+    uint32_t received;
+    const char *expected_string;
+    const char *received_string;
+} VAL_RESULT_s;
+
+#endif
@@ -20,19 +20,21 @@
 
 #define MAX_NUM_OF_SENSORS                  32
 
-#define VERSION_OFFSET                      0
-#define ATTRIBUTE_OFFSET                    0
-#define REG_ADDR_LOW_OFFSET                 1
-#define REG_ADDR_HIGH_OFFSET                2
-#define REG_LENGTH_OFFSET                   3
-#define NUM_SENSOR_FLAG_OFFSET              0
-#define DESC_OFFSET                         1
-#define SENSOR_VAL_LOW_OFFSET               0
-#define SENSOR_VAL_HIGH_OFFSET              1
+/* Offsets of the return values, see scmi_codec.h */
+#define VERSION_OFFSET                      SCMI_SENSOR_PROTOCOL_VERSION_RET_VERSION
+#define ATTRIBUTE_OFFSET                    SCMI_SENSOR_PROTOCOL_ATTRIBUTES_RET_ATTRIBUTES
+#define REG_ADDR_LOW_OFFSET                 SCMI_SENSOR_PROTOCOL_ATTRIBUTES_RET_SENSOR_REG_ADDRESS_LOW
+#define REG_ADDR_HIGH_OFFSET                SCMI_SENSOR_PROTOCOL_ATTRIBUTES_RET_SENSOR_REG_ADDRESS_HIGH
+#define REG_LENGTH_OFFSET                   SCMI_SENSOR_PROTOCOL_ATTRIBUTES_RET_SENSOR_REG_LEN
+#define NUM_SENSOR_FLAG_OFFSET              SCMI_SENSOR_DESCRIPTION_GET_RET_NUM_SENSOR_FLAGS
+#define DESC_OFFSET                         SCMI_SENSOR_DESCRIPTION_GET_RET_SENSOR_DESCRIPTORS
+#define SENSOR_DESC_LEN                     7 /* words of a sensor descriptor */
+#define SENSOR_VAL_LOW_OFFSET               SCMI_SENSOR_READING_GET_RET_SENSOR_VALUE_LOW
+#define SENSOR_VAL_HIGH_OFFSET              SCMI_SENSOR_READING_GET_RET_SENSOR_VALUE_HIGH
 
-#define DELAYED_RESP_SENSOR_ID_OFFSET       0
-#define DELAYED_RESP_SENSOR_VAL_LOW_OFFSET  1
-#define DELAYED_RESP_SENSOR_VAL_HIGH_OFFSET 2
+#define DELAYED_RESP_SENSOR_ID_OFFSET       SCMI_SENSOR_READING_COMPLETE_RET_SENSOR_ID
+#define DELAYED_RESP_SENSOR_VAL_LOW_OFFSET  SCMI_SENSOR_READING_COMPLETE_RET_SENSOR_VALUE_LOW
+#define DELAYED_RESP_SENSOR_VAL_HIGH_OFFSET SCMI_SENSOR_READING_COMPLETE_RET_SENSOR_VALUE_HIGH
 
 #define INVALID_FLAG_VAL                    0xF
 #define SENSOR_READ_ASYNC_MODE              0x1
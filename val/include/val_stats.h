@@ -0,0 +1,92 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef __VAL_STATS_H__
+#define __VAL_STATS_H__
+
+#include <stdint.h>
+
+/*
+ * Statistics regions, the shared memory whose address and length the power
+ * domain, performance and sensor PROTOCOL_ATTRIBUTES return. The power
+ * domain and performance regions are laid out as the SCMI specification
+ * defines them: a VAL_STATS_HEADER_s followed by the byte offset of each
+ * domain from the start of the region, 0 for a domain without statistics.
+ * A domain is a VAL_STATS_DOMAIN_s followed by one VAL_STATS_ENTRY_s per
+ * power state or performance level, in the order of their index.
+ * The specification defines no layout for the sensor region, the suite
+ * uses the same one there with a signature of its own, one entry per
+ * sensor domain, and the last reading in place of the residency.
+ * The platform changes match around each update: it makes match odd
+ * before it updates the region and even again once it is done, a reader
+ * retries a copy that saw match change.
+ * Values are little-endian and naturally aligned.
+ */
+#define VAL_STATS_SIGNATURE_POWER      0x50444D53 /* defined by SCMI */
+#define VAL_STATS_SIGNATURE_PERF       0x50455246 /* defined by SCMI */
+#define VAL_STATS_SIGNATURE_SENSOR     0x52534E53 /* "SNSR", defined by the suite */
+#define VAL_STATS_SENSOR_REVISION      1
+
+typedef struct {
+    uint32_t signature;      /* VAL_STATS_SIGNATURE_* of the protocol */
+    uint16_t revision;
+    uint16_t attributes;     /* reserved, zero */
+    uint16_t num_domains;
+    uint16_t reserved0;
+    uint32_t match;          /* odd while the platform updates the region */
+    uint32_t reserved1;
+} VAL_STATS_HEADER_s;
+
+typedef struct {
+    uint16_t num_entries;    /* power states or performance levels */
+    uint16_t current;        /* index of the entry the domain is in */
+    uint32_t reserved;
+    uint64_t last_change_us; /* platform time of the last change of the domain */
+} VAL_STATS_DOMAIN_s;
+
+typedef struct {
+    uint64_t count;          /* transitions into a state or level, updates of a sensor */
+    uint64_t value;          /* residency in us of a state or level, reading of a sensor */
+} VAL_STATS_ENTRY_s;
+
+/*
+ * Samples of a run, as exported by the hosted platforms. A binary export is
+ * a VAL_STATS_FILE_s header followed by fixed size VAL_STATS_SAMPLE_s, one
+ * per entry of every domain each time the regions are read.
+ */
+#define VAL_STATS_MAGIC                0x534D4353 /* "SCMS" */
+#define VAL_STATS_VERSION              2
+
+typedef struct {
+    uint32_t magic;          /* VAL_STATS_MAGIC */
+    uint32_t version;        /* VAL_STATS_VERSION */
+    uint32_t sample_size;    /* sizeof(VAL_STATS_SAMPLE_s) */
+    uint32_t rate_hz;        /* sampling rate */
+} VAL_STATS_FILE_s;
+
+typedef struct {
+    uint64_t time_ns;        /* agent time the region was read */
+    uint64_t last_change_us; /* of the domain, see VAL_STATS_DOMAIN_s */
+    uint64_t count;
+    uint64_t value;
+    uint32_t index;          /* of the entry in its domain */
+    uint16_t domain_id;
+    uint8_t  protocol_id;
+    uint8_t  current;        /* 1 if the domain is in this entry */
+} VAL_STATS_SAMPLE_s;
+
+#endif
@@ -18,8 +18,9 @@
 #ifndef __VAL_SYSTEM_POWER_H__
 #define __VAL_SYSTEM_POWER_H__
 
-#define VERSION_OFFSET                0
-#define ATTRIBUTE_OFFSET              0
+/* Offsets of the return values, see scmi_codec.h */
+#define VERSION_OFFSET                SCMI_SYSTEM_POWER_PROTOCOL_VERSION_RET_VERSION
+#define ATTRIBUTE_OFFSET              SCMI_SYSTEM_POWER_PROTOCOL_ATTRIBUTES_RET_ATTRIBUTES
 
 #define INVALID_FLAG_VAL                    0xF
 #define INVALID_NOTIFY_EN_VAL               0xF
@@ -0,0 +1,91 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef __VAL_TRACE_H__
+#define __VAL_TRACE_H__
+
+#include <stdint.h>
+
+/*
+ * Binary trace format, shared by the agent and the host decoder. Format
+ * strings are kept in their own section of the agent image and a record
+ * names its format by offset into that section. The payload holds one
+ * entry per conversion of the format, in order:
+ *   integer, 'c'        one 32 bit word
+ *   'l', 'll', 'z', 'p' two 32 bit words, low word first
+ *   's'                 one 32 bit byte count, then the bytes padded to 4
+ * Words are stored in the byte order of the agent, little-endian on every
+ * supported platform.
+ */
+#define VAL_TRACE_SECTION        "val_trace_fmt"
+#define VAL_TRACE_SYNC           0xA5
+#define VAL_TRACE_RECORD_SIZE    256 /* Header and payload, longer records are truncated */
+#define VAL_TRACE_STRING_SIZE    128 /* Longest string argument recorded */
+
+typedef struct {
+    uint8_t  sync;       /* VAL_TRACE_SYNC */
+    uint8_t  level;      /* print level */
+    uint16_t length;     /* payload bytes following the header */
+    uint32_t format_id;  /* offset of the format string in VAL_TRACE_SECTION */
+} VAL_TRACE_RECORD_s;
+
+/**
+  @brief   Finds the next conversion of a format string. Field width and
+           precision must be literal, '*' is not supported.
+  @param   format  format string, or what is left of it
+  @param   start   storage for the position of the '%' starting the conversion
+  @param   wide    storage for true if the argument is recorded as 64 bits
+  @param   type    storage for the conversion character
+  @return  format string past the conversion, NULL if there is none left
+**/
+static inline const char *val_trace_next_conversion(const char *format, const char **start,
+                                                    int *wide, char *type)
+{
+    while (*format != '\0') {
+        if (*format++ != '%')
+            continue;
+
+        *start = format - 1;
+        if (*format == '%') {
+            format++;
+            continue;
+        }
+
+        while ((*format == '-') || (*format == '+') || (*format == ' ') || (*format == '#') ||
+               (*format == '.') || ((*format >= '0') && (*format <= '9')))
+            format++;
+
+        *wide = 0;
+        while ((*format == 'l') || (*format == 'h') || (*format == 'z') || (*format == 'j')) {
+            if (*format != 'h')
+                *wide = 1;
+            format++;
+        }
+
+        if (*format == '\0')
+            return NULL;
+
+        *type = *format++;
+        if (*type == 'p')
+            *wide = 1;
+        return format;
+    }
+
+    return NULL;
+}
+
+#endif
@@ -29,10 +29,10 @@ uint32_t val_base_execute_tests(void)
 {
     uint32_t version = 0;
 
-    val_memset((void *)&g_base_info_table, 0, sizeof(g_base_info_table));
-
+    /* The table was filled by val_base_discover() before the suites started */
     if (RUN_TEST(base_query_protocol_version(&version)))
         return VAL_STATUS_FAIL;
+    val_registry_set_version(PROTOCOL_BASE, version);
 
     RUN_TEST(base_query_protocol_attributes());
     RUN_TEST(base_query_mandatory_command_support());
@@ -83,6 +83,9 @@ void val_base_save_info(uint32_t param_identifier, uint32_t param_value)
     case BASE_TEST_AGENT_ID:
         g_base_info_table.test_agent_id = param_value;
         break;
+    case BASE_IMPLEMENTATION_VERSION:
+        g_base_info_table.implementation_version = param_value;
+        break;
     default:
         val_print(VAL_PRINT_ERR, "\nUnidentified base parameter %d", param_identifier);
     }
@@ -146,6 +149,102 @@ void val_base_save_name(uint32_t param_identifier, uint8_t *param_value)
     }
 }
 
+/**
+  @brief   This API is used to get base vendor name
+           1. Caller       -  VAL.
+           2. Prerequisite -  Base protocol info table.
+  @param   param_identifier  id of parameter which will be read
+  @return  name, NUL terminated
+**/
+uint8_t *val_base_get_name(uint32_t param_identifier)
+{
+    switch (param_identifier)
+    {
+    case BASE_VENDOR_NAME:
+        return &(g_base_info_table.vendor_name[0]);
+    case BASE_SUBVENDOR_NAME:
+        return &(g_base_info_table.subvendor_name[0]);
+    case BASE_TEST_AGENT_NAME:
+        return &(g_base_info_table.test_agent_name[0]);
+    default:
+        val_print(VAL_PRINT_ERR, "\nUnidentified parameter %d", param_identifier);
+    }
+
+    return NULL;
+}
+
+/**
+  @brief   This API walks the base protocol and fills its info table, along
+           with the list of protocols the agent may use
+           1. Caller       -  val_discovery_initialize().
+  @param   none
+  @return  VAL_STATUS_PASS, VAL_STATUS_FAIL if a command failed
+**/
+uint32_t val_base_discover(void)
+{
+    uint32_t return_values[MAX_RETURNS_SIZE];
+    uint32_t *protocols = val_buffer_get();
+    size_t   return_value_count;
+    uint32_t attributes, num_protocols, num_returned;
+    uint32_t protocol_list = 0;
+    uint32_t skip = 0;
+    uint32_t protocol;
+    uint32_t i;
+
+    val_memset((void *)&g_base_info_table, 0, sizeof(g_base_info_table));
+    val_agent_set_supported_protocol_list(0);
+
+    if (protocols == NULL)
+        return VAL_STATUS_FAIL;
+
+    if (val_discovery_send(PROTOCOL_BASE, BASE_PROTOCOL_ATTRIBUTES, 0, NULL, NULL, return_values))
+        return VAL_STATUS_FAIL;
+
+    attributes = return_values[ATTRIBUTE_OFFSET];
+    val_base_save_info(BASE_NUM_AGENTS, VAL_EXTRACT_BITS(attributes, 8, 15));
+    val_base_save_info(BASE_NUM_PROTOCOLS, VAL_EXTRACT_BITS(attributes, 0, 7));
+
+    /* A name may use all of its bytes, terminate it before saving it */
+    if (val_discovery_send(PROTOCOL_BASE, BASE_DISCOVER_VENDOR, 0, NULL, NULL, return_values))
+        return VAL_STATUS_FAIL;
+    return_values[VENDOR_ID_OFFSET + (SCMI_NAME_STR_SIZE / 4) - 1] &= 0x00FFFFFF;
+    val_base_save_name(BASE_VENDOR_NAME, (uint8_t *)&return_values[VENDOR_ID_OFFSET]);
+
+    if (val_discovery_send(PROTOCOL_BASE, BASE_DISCOVER_SUB_VENDOR, 0, NULL, NULL, return_values))
+        return VAL_STATUS_FAIL;
+    return_values[VENDOR_ID_OFFSET + (SCMI_NAME_STR_SIZE / 4) - 1] &= 0x00FFFFFF;
+    val_base_save_name(BASE_SUBVENDOR_NAME, (uint8_t *)&return_values[VENDOR_ID_OFFSET]);
+
+    if (val_discovery_send(PROTOCOL_BASE, BASE_DISCOVER_IMPLEMENTATION_VERSION, 0, NULL,
+                           NULL, return_values))
+        return VAL_STATUS_FAIL;
+    val_base_save_info(BASE_IMPLEMENTATION_VERSION, return_values[IMPLEMENTATION_VERSION_OFFSET]);
+
+    /* The list comes in parts, each part starting after the protocols already returned */
+    num_protocols = val_base_get_info(BASE_NUM_PROTOCOLS);
+    while (skip < num_protocols) {
+        if (val_discovery_send(PROTOCOL_BASE, BASE_DISCOVER_LIST_PROTOCOLS, 1, &skip,
+                               &return_value_count, protocols))
+            return VAL_STATUS_FAIL;
+
+        /* Four protocols to a word, the protocols announced must all have been received */
+        num_returned = protocols[NUM_OF_PROTOCOLS_OFFSET];
+        if ((num_returned == 0) ||
+            (return_value_count < PROTOCOL_LIST_OFFSET + ((num_returned + 3) / 4)))
+            return VAL_STATUS_FAIL;
+
+        for (i = 0; i < num_returned; i++) {
+            protocol = (uint8_t)(protocols[PROTOCOL_LIST_OFFSET + (i / 4)] >> ((i % 4) * 8));
+            if (protocol < 32)
+                protocol_list |= (1u << protocol);
+        }
+        skip += num_returned;
+    }
+
+    val_agent_set_supported_protocol_list(protocol_list);
+    return VAL_STATUS_PASS;
+}
+
 /**
   @brief   This API is used for checking vendor name
   @param   none
@@ -0,0 +1,97 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interface.h"
+
+/* Return values a buffer of the pool holds, set once the transport is open */
+static uint32_t g_buffer_capacity = MAX_RETURNS_SIZE;
+
+/* Pool of the calling thread and the number of its buffers handed out */
+static VAL_THREAD_LOCAL uint32_t g_buffer_pool[VAL_BUFFER_POOL_WORDS];
+static VAL_THREAD_LOCAL uint32_t g_buffer_used;
+
+/**
+  @brief   This API sizes the buffers of the pools for the channel size of
+           the transport, before the suites start
+           1. Caller       -  VAL.
+  @param   none
+  @return  none
+**/
+void val_buffer_initialize(void)
+{
+    g_buffer_capacity = PAL_CHANNEL_MAX_RETURNS(pal_get_channel_size());
+    if (g_buffer_capacity > VAL_MAX_RETURN_VALUES)
+        g_buffer_capacity = VAL_MAX_RETURN_VALUES;
+    g_buffer_used = 0;
+}
+
+/**
+  @brief   This API hands out a buffer of the pool of the calling thread,
+           for the response of a paginated command
+           1. Caller       -  Test Suite, VAL.
+  @param   none
+  @return  buffer of val_get_max_return_values() words, NULL if the pool is
+           empty
+**/
+uint32_t *val_buffer_get(void)
+{
+    if ((g_buffer_used + 1) * g_buffer_capacity > VAL_BUFFER_POOL_WORDS) {
+        val_print(VAL_PRINT_ERR, "\n       Response buffer pool empty");
+        return NULL;
+    }
+
+    return &g_buffer_pool[g_buffer_capacity * g_buffer_used++];
+}
+
+/**
+  @brief   This API gives back every buffer of the pool of the calling thread
+           1. Caller       -  VAL, when a test or a discovery walk starts.
+  @param   none
+  @return  none
+**/
+void val_buffer_reset(void)
+{
+    g_buffer_used = 0;
+}
+
+/**
+  @brief   This API returns how many return values fit in a buffer: up to
+           the end of its slot for a buffer of the pool, MAX_RETURNS_SIZE
+           for any other
+           1. Caller       -  VAL.
+  @param   buffer  storage for return values
+  @return  number of return values
+**/
+size_t val_buffer_capacity(const uint32_t *buffer)
+{
+    if ((buffer < g_buffer_pool) || (buffer >= &g_buffer_pool[VAL_BUFFER_POOL_WORDS]))
+        return MAX_RETURNS_SIZE;
+
+    return g_buffer_capacity - ((buffer - g_buffer_pool) % g_buffer_capacity);
+}
+
+/**
+  @brief   This API returns how many return values a response carries at
+           most, which bounds the entries of a page
+           1. Caller       -  Test Suite, VAL.
+  @param   none
+  @return  number of return values
+**/
+uint32_t val_get_max_return_values(void)
+{
+    return g_buffer_capacity;
+}
@@ -19,7 +19,105 @@
 #include "val_interface.h"
 #include "val_clock.h"
 
-static CLOCK_INFO_s g_clock_info_table;
+static VAL_THREAD_LOCAL CLOCK_INFO_s g_clock_info_table;
+
+/**
+  @brief   This function walks the rates of a clock, which come in parts as
+           large as the channel allows, and saves the lowest and highest rate
+           1. Caller       -  val_clock_discover().
+  @param   clock_id       clock identifier
+  @param   return_values  buffer from val_buffer_get()
+  @return  VAL_STATUS_PASS, VAL_STATUS_FAIL if a command failed
+**/
+static uint32_t val_clock_discover_rates(uint32_t clock_id, uint32_t *return_values)
+{
+    size_t   return_value_count;
+    uint32_t parameters[2];
+    uint32_t num_returned, num_remaining, num_rate_flag;
+    uint32_t rate_index = 0;
+    uint32_t *rate_array = &return_values[RATES_OFFSET];
+
+    do {
+        parameters[0] = clock_id;
+        parameters[1] = rate_index;
+        if (val_discovery_send(PROTOCOL_CLOCK, CLOCK_DESCRIBE_RATES, 2, parameters,
+                               &return_value_count, return_values))
+            return VAL_STATUS_FAIL;
+
+        num_rate_flag = return_values[RATE_FLAG_OFFSET];
+        num_remaining = VAL_EXTRACT_BITS(num_rate_flag, 16, 31);
+        num_returned = VAL_EXTRACT_BITS(num_rate_flag, 0, 11);
+
+        /* A range is a single triplet of lowest, highest and step */
+        if (VAL_EXTRACT_BITS(num_rate_flag, 12, 12) == CLOCK_RATE_FMT_STEP_SIZE) {
+            if ((num_returned != 1) || (return_value_count < RATES_OFFSET + 6))
+                return VAL_STATUS_FAIL;
+
+            val_clock_save_rate(CLOCK_LOWEST_RATE, clock_id,
+                                VAL_GET_64BIT_DATA(rate_array[1], rate_array[0]));
+            val_clock_save_rate(CLOCK_HIGHEST_RATE, clock_id,
+                                VAL_GET_64BIT_DATA(rate_array[3], rate_array[2]));
+            return VAL_STATUS_PASS;
+        }
+
+        /* The rates announced must all have been received */
+        if ((num_returned == 0) || (return_value_count < RATES_OFFSET + (num_returned * 2)))
+            return VAL_STATUS_FAIL;
+
+        /* Rates are listed in ascending order */
+        if (rate_index == 0)
+            val_clock_save_rate(CLOCK_LOWEST_RATE, clock_id,
+                                VAL_GET_64BIT_DATA(rate_array[1], rate_array[0]));
+        val_clock_save_rate(CLOCK_HIGHEST_RATE, clock_id,
+                            VAL_GET_64BIT_DATA(rate_array[1 + ((num_returned - 1) * 2)],
+                                               rate_array[(num_returned - 1) * 2]));
+        rate_index += num_returned;
+    } while (num_remaining > 0);
+
+    return VAL_STATUS_PASS;
+}
+
+/**
+  @brief   This function walks the clock protocol and fills its info table,
+           see val_discovery_run()
+           1. Caller       -  VAL.
+  @param   version  protocol version
+  @return  VAL_STATUS_PASS, VAL_STATUS_FAIL if a command failed
+**/
+static uint32_t val_clock_discover(uint32_t version)
+{
+    uint32_t return_values[MAX_RETURNS_SIZE];
+    uint32_t *rates = val_buffer_get();
+    uint32_t clock_id, num_clocks;
+
+    (void)version;
+
+    if (rates == NULL)
+        return VAL_STATUS_FAIL;
+
+    if (val_discovery_send(PROTOCOL_CLOCK, CLOCK_PROTOCOL_ATTRIBUTES, 0, NULL, NULL, return_values))
+        return VAL_STATUS_FAIL;
+
+    num_clocks = VAL_EXTRACT_BITS(return_values[ATTRIBUTE_OFFSET], 0, 15);
+    if (num_clocks > MAX_NUM_OF_CLOCKS)
+        return VAL_STATUS_FAIL;
+
+    val_clock_save_info(NUM_CLOCKS, 0, num_clocks);
+    val_clock_save_info(CLOCK_MAX_PENDING_ASYNC_CMD, 0,
+                        VAL_EXTRACT_BITS(return_values[ATTRIBUTE_OFFSET], 16, 23));
+
+    for (clock_id = 0; clock_id < num_clocks; clock_id++) {
+        if (val_discovery_send(PROTOCOL_CLOCK, CLOCK_ATTRIBUTES, 1, &clock_id, NULL, return_values))
+            return VAL_STATUS_FAIL;
+
+        val_clock_save_info(CLOCK_ATTRIBUTE, clock_id, return_values[ATTRIBUTE_OFFSET]);
+
+        if (val_clock_discover_rates(clock_id, rates) != VAL_STATUS_PASS)
+            return VAL_STATUS_FAIL;
+    }
+
+    return VAL_STATUS_PASS;
+}
 
 /**
   @brief   This API is called from app layer to execute clock tests
@@ -35,6 +133,10 @@ uint32_t val_clock_execute_tests(void)
     if (val_agent_check_protocol_support(PROTOCOL_CLOCK)) {
         if (RUN_TEST(clock_query_protocol_version(&version)))
             return VAL_STATUS_FAIL;
+        val_registry_set_version(PROTOCOL_CLOCK, version);
+
+        val_discovery_run(PROTOCOL_CLOCK, version, &g_clock_info_table,
+                          sizeof(g_clock_info_table), val_clock_discover);
 
         RUN_TEST(clock_query_protocol_attributes());
         RUN_TEST(clock_query_mandatory_command_support());
@@ -0,0 +1,211 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interface.h"
+
+#define VAL_DISCOVERY_NUM_PROTOCOLS (PROTOCOL_MAX - PROTOCOL_BASE)
+
+typedef struct {
+    uint32_t source;       /* VAL_DISCOVERY_NONE, _WALKED, _CACHED or _FAILED */
+    uint32_t messages;     /* commands sent by the walk */
+    uint64_t elapsed_ns;
+} VAL_DISCOVERY_PHASE_s;
+
+/* Set by the base walk before the suites start, read by every suite */
+static VAL_DISCOVERY_KEY_s g_discovery_key;
+static uint32_t g_discovery_keyed;
+
+/* Indexed by protocol, each entry is written by the single thread running the suite */
+static VAL_DISCOVERY_PHASE_s g_discovery_phase[VAL_DISCOVERY_NUM_PROTOCOLS];
+
+/* Commands sent by the walk of the calling thread */
+static VAL_THREAD_LOCAL uint32_t g_discovery_messages;
+
+/**
+  @brief   This API sends a discovery command. Unlike a test, a walk checks
+           nothing and reports nothing, a command that fails ends the walk.
+           1. Caller       -  VAL.
+  @param   protocol_id    protocol identifier
+  @param   message_id     message identifier
+  @param   param_count    number of parameters
+  @param   parameters          parameters
+  @param   return_value_count  storage for the number of return values, NULL
+                               if the walk does not need it
+  @param   return_values       storage for MAX_RETURNS_SIZE return values, or a
+                               buffer from val_buffer_get()
+  @return  SCMI status of the command, SCMI_GENERIC_ERROR if the response
+           does not match it
+**/
+int32_t val_discovery_send(uint32_t protocol_id, uint32_t message_id, size_t param_count,
+                           uint32_t *parameters, size_t *return_value_count,
+                           uint32_t *return_values)
+{
+    uint32_t cmd_msg_hdr;
+    uint32_t rsp_msg_hdr = 0;
+    size_t   count = 0;
+    int32_t  status = SCMI_GENERIC_ERROR;
+
+    g_discovery_messages++;
+    cmd_msg_hdr = val_msg_hdr_create(protocol_id, message_id, COMMAND_MSG);
+    val_send_message(cmd_msg_hdr, param_count, parameters, &rsp_msg_hdr, &status, &count,
+                     return_values);
+    if (return_value_count != NULL)
+        *return_value_count = count;
+
+    if ((status == SCMI_SUCCESS) &&
+        ((scmi_codec_protocol_id(rsp_msg_hdr) != protocol_id) ||
+         (scmi_codec_message_id(rsp_msg_hdr) != message_id)))
+        return SCMI_GENERIC_ERROR;
+
+    return status;
+}
+
+/**
+  @brief   This function notes how the table of a protocol was filled
+           1. Caller       -  VAL.
+  @param   protocol_id  protocol identifier
+  @param   source       VAL_DISCOVERY_WALKED, _CACHED or _FAILED
+  @param   messages     commands sent
+  @param   start        time the phase started, in ns
+  @return  none
+**/
+static void val_discovery_phase_done(uint32_t protocol_id, uint32_t source, uint32_t messages,
+                                     uint64_t start)
+{
+    VAL_DISCOVERY_PHASE_s *phase;
+
+    if ((protocol_id < PROTOCOL_BASE) || (protocol_id >= PROTOCOL_MAX))
+        return;
+
+    phase = &g_discovery_phase[protocol_id - PROTOCOL_BASE];
+    phase->source = source;
+    phase->messages = messages;
+    phase->elapsed_ns = pal_get_time_ns() - start;
+}
+
+/**
+  @brief   This API walks the base protocol, before any suite runs. Base is
+           always walked, its vendor name and implementation version key the
+           tables of the other protocols.
+           1. Caller       -  App layer.
+  @param   none
+  @return  VAL_STATUS_PASS, VAL_STATUS_FAIL if the base walk failed, the
+           other tables are then walked but not cached
+**/
+uint32_t val_discovery_initialize(void)
+{
+    uint64_t start = pal_get_time_ns();
+    uint32_t status;
+
+    val_memset(g_discovery_phase, 0, sizeof(g_discovery_phase));
+    val_memset(&g_discovery_key, 0, sizeof(g_discovery_key));
+    g_discovery_keyed = 0;
+    g_discovery_messages = 0;
+
+    val_buffer_reset();
+    status = val_base_discover();
+    val_discovery_phase_done(PROTOCOL_BASE,
+                             (status == VAL_STATUS_PASS) ? VAL_DISCOVERY_WALKED :
+                             VAL_DISCOVERY_FAILED, g_discovery_messages, start);
+    if (status != VAL_STATUS_PASS)
+        return VAL_STATUS_FAIL;
+
+    val_strcpy(g_discovery_key.vendor_name, val_base_get_name(BASE_VENDOR_NAME));
+    g_discovery_key.implementation_version = val_base_get_info(BASE_IMPLEMENTATION_VERSION);
+    g_discovery_keyed = 1;
+    return VAL_STATUS_PASS;
+}
+
+/**
+  @brief   This API fills the info table of a protocol, from the PAL cache if
+           it holds the table of this firmware, else by walking the protocol.
+           A walked table is handed to the PAL cache.
+           1. Caller       -  Protocol suites, once the version is known.
+  @param   protocol_id  protocol identifier
+  @param   version      protocol version, walks depend on it
+  @param   table        info table of the calling thread
+  @param   size         size of the table
+  @param   walk         walk of the protocol, fills the table with save_info
+  @return  VAL_STATUS_PASS, VAL_STATUS_FAIL if the walk failed
+**/
+uint32_t val_discovery_run(uint32_t protocol_id, uint32_t version, void *table, uint32_t size,
+                           uint32_t (*walk)(uint32_t version))
+{
+    VAL_DISCOVERY_KEY_s key = g_discovery_key;
+    uint64_t start = pal_get_time_ns();
+
+    key.protocol_id = protocol_id;
+    key.protocol_version = version;
+    key.channel_id = val_get_channel();
+    key.table_size = size;
+
+    if (g_discovery_keyed && (pal_discovery_cache_load(&key, table, size) == PAL_STATUS_PASS)) {
+        val_discovery_phase_done(protocol_id, VAL_DISCOVERY_CACHED, 0, start);
+        return VAL_STATUS_PASS;
+    }
+
+    g_discovery_messages = 0;
+    val_buffer_reset();
+    if (walk(version) != VAL_STATUS_PASS) {
+        val_print(VAL_PRINT_WARN, "\n       Discovery of protocol 0x%x failed", protocol_id);
+        val_discovery_phase_done(protocol_id, VAL_DISCOVERY_FAILED, g_discovery_messages, start);
+        return VAL_STATUS_FAIL;
+    }
+
+    if (g_discovery_keyed)
+        pal_discovery_cache_store(&key, table, size);
+
+    val_discovery_phase_done(protocol_id, VAL_DISCOVERY_WALKED, g_discovery_messages, start);
+    return VAL_STATUS_PASS;
+}
+
+/**
+  @brief   This API prints how long the discovery of each protocol took, and
+           whether its table came from the cache
+           1. Caller       -  App layer.
+  @param   none
+  @return  none
+**/
+void val_discovery_report(void)
+{
+    static const char * const sources[] = { "", "walked", "cached", "failed" };
+    const VAL_DISCOVERY_PHASE_s *phase;
+    uint64_t total_ns = 0;
+    uint32_t total_messages = 0;
+    uint32_t i;
+
+    for (i = 0; i < VAL_DISCOVERY_NUM_PROTOCOLS; i++) {
+        total_ns += g_discovery_phase[i].elapsed_ns;
+        total_messages += g_discovery_phase[i].messages;
+    }
+
+    /* Nothing timed, as on platforms without a time source */
+    if (total_ns == 0)
+        return;
+
+    val_print(VAL_PRINT_ERR, "\n  DISCOVERY (us)");
+    val_print(VAL_PRINT_ERR, "\n  PROTOCOL   COMMANDS       TIME  TABLE");
+    for (i = 0; i < VAL_DISCOVERY_NUM_PROTOCOLS; i++) {
+        phase = &g_discovery_phase[i];
+        if (phase->source == VAL_DISCOVERY_NONE)
+            continue;
+
+        val_print(VAL_PRINT_ERR, "\n      0x%02x %10u %10u  %s", PROTOCOL_BASE + i,
+                  phase->messages, (uint32_t)(phase->elapsed_ns / 1000), sources[phase->source]);
+    }
+    val_print(VAL_PRINT_ERR, "\n     TOTAL %10u %10u", total_messages, (uint32_t)(total_ns / 1000));
+}
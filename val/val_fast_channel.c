@@ -0,0 +1,207 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interface.h"
+#include "val_performance.h"
+
+/**
+  @brief   This function rings the doorbell of a fast channel, bits outside
+           the preserve mask are cleared and the set mask is applied
+           1. Caller       -  VAL.
+  @param   fast_channel  fast channel
+  @return  none
+**/
+static void val_fast_channel_ring(const VAL_FAST_CHANNEL_s *fast_channel)
+{
+    uint64_t preserve = fast_channel->doorbell_preserve_mask;
+    uint64_t set = fast_channel->doorbell_set_mask;
+
+    /* Payload must be visible to the platform before the doorbell is */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    switch (fast_channel->doorbell_width)
+    {
+    case 1:
+        *(volatile uint8_t *)fast_channel->doorbell =
+            (*(volatile uint8_t *)fast_channel->doorbell & preserve) | set;
+        break;
+    case 2:
+        *(volatile uint16_t *)fast_channel->doorbell =
+            (*(volatile uint16_t *)fast_channel->doorbell & preserve) | set;
+        break;
+    case 4:
+        *(volatile uint32_t *)fast_channel->doorbell =
+            (*(volatile uint32_t *)fast_channel->doorbell & preserve) | set;
+        break;
+    default:
+        *(volatile uint64_t *)fast_channel->doorbell =
+            (*(volatile uint64_t *)fast_channel->doorbell & preserve) | set;
+        break;
+    }
+}
+
+/**
+  @brief   This API maps a fast channel from the return values of
+           PERFORMANCE_DESCRIBE_FASTCHANNEL
+           1. Caller       -  Test Suite.
+  @param   describe_values  return values of PERFORMANCE_DESCRIBE_FASTCHANNEL
+  @param   fast_channel     fast channel to be filled
+  @return  status, skip when the platform cannot map the fast channel memory
+           into the agent, as with a remote or replayed platform
+**/
+uint32_t val_fast_channel_init(const uint32_t *describe_values, VAL_FAST_CHANNEL_s *fast_channel)
+{
+    uint32_t attributes = describe_values[ATTRIBUTE_OFFSET];
+    uint64_t address;
+
+    val_memset(fast_channel, 0, sizeof(*fast_channel));
+    fast_channel->rate_limit = describe_values[FAST_CH_RATE_LIMIT_OFFSET];
+    fast_channel->chan_size = describe_values[CHAN_SIZE_OFFSET];
+
+    address = VAL_GET_64BIT_DATA(describe_values[CHAN_ADDR_HIGH_OFFSET],
+                                 describe_values[CHAN_ADDR_LOW_OFFSET]);
+    fast_channel->chan = pal_fast_channel_map(address, fast_channel->chan_size);
+    if (fast_channel->chan == NULL) {
+        val_print(VAL_PRINT_ERR, "\n       FAST CH NOT MAPPED : 0x%08x%08x",
+                  describe_values[CHAN_ADDR_HIGH_OFFSET], describe_values[CHAN_ADDR_LOW_OFFSET]);
+        return VAL_STATUS_SKIP;
+    }
+
+    if (scmi_performance_describe_fastchannel_attributes_doorbell(attributes) == NOT_SUPPORTED)
+        return VAL_STATUS_PASS;
+
+    /* Doorbell data width encodes 8, 16, 32 or 64 bits */
+    fast_channel->doorbell_width =
+        1 << scmi_performance_describe_fastchannel_attributes_doorbell_width(attributes);
+    fast_channel->doorbell_set_mask =
+        VAL_GET_64BIT_DATA(describe_values[DOORBELL_MASK_HIGH_OFFSET],
+                           describe_values[DOORBELL_MASK_LOW_OFFSET]);
+    fast_channel->doorbell_preserve_mask =
+        VAL_GET_64BIT_DATA(describe_values[DOORBELL_PRESERVE_HIGH_OFFSET],
+                           describe_values[DOORBELL_PRESERVE_LOW_OFFSET]);
+
+    address = VAL_GET_64BIT_DATA(describe_values[DOORBELL_ADDR_HIGH_OFFSET],
+                                 describe_values[DOORBELL_ADDR_LOW_OFFSET]);
+    fast_channel->doorbell = pal_fast_channel_map(address, fast_channel->doorbell_width);
+    if (fast_channel->doorbell == NULL) {
+        val_print(VAL_PRINT_ERR, "\n       DOORBELL NOT MAPPED: 0x%08x%08x",
+                  describe_values[DOORBELL_ADDR_HIGH_OFFSET],
+                  describe_values[DOORBELL_ADDR_LOW_OFFSET]);
+        val_fast_channel_close(fast_channel);
+        return VAL_STATUS_SKIP;
+    }
+
+    return VAL_STATUS_PASS;
+}
+
+/**
+  @brief   This API describes and maps the fast channel of a performance
+           domain command
+           1. Caller       -  Test Suite, benchmark.
+  @param   domain_id     performance domain identifier
+  @param   message_id    PERFORMANCE_LIMITS_SET/GET or PERFORMANCE_LEVEL_SET/GET
+  @param   fast_channel  fast channel to be filled
+  @return  status, skip when the platform has no such fast channel
+**/
+uint32_t val_fast_channel_open(uint32_t domain_id, uint32_t message_id,
+                               VAL_FAST_CHANNEL_s *fast_channel)
+{
+    uint32_t return_values[MAX_RETURNS_SIZE];
+    uint32_t parameters[2];
+    uint32_t rsp_msg_hdr;
+    size_t return_value_count;
+    int32_t status;
+
+    parameters[0] = domain_id;
+    parameters[1] = message_id;
+    val_send_message(val_msg_hdr_create(PROTOCOL_PERFORMANCE, PERFORMANCE_DESCRIBE_FASTCHANNEL,
+                                        COMMAND_MSG),
+                     2, parameters, &rsp_msg_hdr, &status, &return_value_count, return_values);
+
+    if ((status == SCMI_NOT_SUPPORTED) || (status == SCMI_NOT_FOUND))
+        return VAL_STATUS_SKIP;
+
+    if ((status != SCMI_SUCCESS) || (return_value_count < SCMI_PERFORMANCE_DESCRIBE_FASTCHANNEL_RET_COUNT))
+        return VAL_STATUS_FAIL;
+
+    return val_fast_channel_init(return_values, fast_channel);
+}
+
+/**
+  @brief   This API releases the mappings of a fast channel
+           1. Caller       -  Test Suite, benchmark.
+  @param   fast_channel  fast channel
+  @return  none
+**/
+void val_fast_channel_close(VAL_FAST_CHANNEL_s *fast_channel)
+{
+    if (fast_channel->doorbell != NULL)
+        pal_fast_channel_unmap((void *)fast_channel->doorbell, fast_channel->doorbell_width);
+    if (fast_channel->chan != NULL)
+        pal_fast_channel_unmap((void *)fast_channel->chan, fast_channel->chan_size);
+
+    fast_channel->doorbell = NULL;
+    fast_channel->chan = NULL;
+}
+
+/**
+  @brief   This API reads 32 bit words from a fast channel
+           1. Caller       -  Test Suite, benchmark.
+  @param   fast_channel  fast channel
+  @param   values        storage for the words read
+  @param   count         number of words
+  @return  status
+**/
+uint32_t val_fast_channel_read(const VAL_FAST_CHANNEL_s *fast_channel, uint32_t *values,
+                               uint32_t count)
+{
+    uint32_t i;
+
+    if ((fast_channel->chan == NULL) || (count * sizeof(uint32_t) > fast_channel->chan_size))
+        return VAL_STATUS_FAIL;
+
+    for (i = 0; i < count; i++)
+        values[i] = fast_channel->chan[i];
+
+    return VAL_STATUS_PASS;
+}
+
+/**
+  @brief   This API writes 32 bit words to a fast channel and rings its
+           doorbell, if it has one
+           1. Caller       -  Test Suite, benchmark.
+  @param   fast_channel  fast channel
+  @param   values        words to be written
+  @param   count         number of words
+  @return  status
+**/
+uint32_t val_fast_channel_write(const VAL_FAST_CHANNEL_s *fast_channel, const uint32_t *values,
+                                uint32_t count)
+{
+    uint32_t i;
+
+    if ((fast_channel->chan == NULL) || (count * sizeof(uint32_t) > fast_channel->chan_size))
+        return VAL_STATUS_FAIL;
+
+    for (i = 0; i < count; i++)
+        fast_channel->chan[i] = values[i];
+
+    if (fast_channel->doorbell != NULL)
+        val_fast_channel_ring(fast_channel);
+
+    return VAL_STATUS_PASS;
+}
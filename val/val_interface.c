@@ -19,14 +19,152 @@
 
 #define MAX_STRCPY_SIZE 100
 
-static uint64_t g_test_pass;
-static uint64_t g_test_fail;
-static uint64_t g_test_skip;
+/* Result counters, updated atomically as suites may report from several threads */
+static uint32_t g_test_pass;
+static uint32_t g_test_fail;
+static uint32_t g_test_skip;
+static uint32_t g_test_timeout;
+
+/* Budget of each test in ms, 0 when tests run unbounded */
+static uint32_t g_test_budget_ms = VAL_TEST_BUDGET_MS;
+
+/* Time taken by each test, indexed by test number. Each test is run by a
+   single thread, which is the only one to write its entry */
+static uint64_t g_test_elapsed_ns[VAL_MAX_TEST_NUM];
 
 static uint32_t g_protocol_list;
 
+/* Commands in flight of the calling thread, keyed by the token of their
+   message header. Each suite thread sends on its own channel and receives
+   its own delayed responses, so it only ever looks up its own commands. */
+static VAL_THREAD_LOCAL VAL_OUTSTANDING_CMD_s g_outstanding_cmd_table[VAL_MAX_OUTSTANDING_CMDS];
+static uint32_t g_token_ring_head;
+
+#ifdef VAL_MULTI_THREAD
+/* Log capture of the calling thread, NULL when printing straight through the PAL */
+static VAL_THREAD_LOCAL VAL_PRINT_BUFFER_s *g_print_buffer;
+#endif
+
+/* Test run by the calling thread, the results of its checks refer to it */
+static VAL_THREAD_LOCAL uint32_t g_test_num;
+static VAL_THREAD_LOCAL const char *g_test_desc;
+static VAL_THREAD_LOCAL uint64_t g_test_start;
+static VAL_THREAD_LOCAL uint64_t g_check_start;
+
+/* Registry state of the running test, a VAL_TEST_QUIET test prints and reports nothing */
+static VAL_THREAD_LOCAL uint32_t g_test_state = VAL_TEST_SELECTED;
+
+/* Channel of the calling thread, stamped on the records of its traffic and
+   part of the key of its discovered tables */
+static VAL_THREAD_LOCAL uint32_t g_channel_id;
+
 /**
-  @brief   This function forms the command message header
+  @brief   This function allocates the token for a new command. Tokens are
+           handed out from a lock-free ring, skipping tokens whose command is
+           still waiting for its response or for a delayed response. A
+           command waiting for a delayed response gives up its token only
+           once every other token is taken.
+           1. Caller       -  VAL.
+  @param   none
+  @return  10 bit token
+**/
+static uint32_t val_token_alloc(void)
+{
+    uint32_t token = 0;
+    uint32_t state;
+    uint32_t i;
+
+    for (i = 0; i < 2 * VAL_MAX_OUTSTANDING_CMDS; i++) {
+        token = __atomic_fetch_add(&g_token_ring_head, 1, __ATOMIC_RELAXED) & VAL_TOKEN_MASK;
+        state = g_outstanding_cmd_table[token & (VAL_MAX_OUTSTANDING_CMDS - 1)].state;
+        if ((state == VAL_CMD_FREE) ||
+            ((i >= VAL_MAX_OUTSTANDING_CMDS) && (state == VAL_CMD_COMPLETED)))
+            break;
+    }
+
+    return token;
+}
+
+/**
+  @brief   This function returns the outstanding command table entry of a token
+           1. Caller       -  VAL.
+  @param   token  message header token
+  @return  table entry
+**/
+static VAL_OUTSTANDING_CMD_s *val_outstanding_cmd_entry(uint32_t token)
+{
+    return &g_outstanding_cmd_table[token & (VAL_MAX_OUTSTANDING_CMDS - 1)];
+}
+
+/**
+  @brief   This function matches a response with the command that issued it
+           1. Caller       -  VAL.
+  @param   rcvd_msg_hdr  message header received from platform
+  @param   state         state the issuing command is expected to be in
+  @return  entry of the issuing command, NULL if there is none
+**/
+static VAL_OUTSTANDING_CMD_s *val_outstanding_cmd_match(uint32_t rcvd_msg_hdr, uint32_t state)
+{
+    VAL_OUTSTANDING_CMD_s *entry = val_outstanding_cmd_entry(VAL_GET_TOKEN(rcvd_msg_hdr));
+
+    if ((entry->state != state) ||
+        (VAL_GET_TOKEN(entry->msg_hdr) != VAL_GET_TOKEN(rcvd_msg_hdr)) ||
+        (scmi_codec_protocol_id(entry->msg_hdr) != scmi_codec_protocol_id(rcvd_msg_hdr)))
+        return NULL;
+
+    return entry;
+}
+
+/**
+  @brief   This function tells whether a delayed response follows the
+           response of a command, for the asynchronous variants of the
+           commands that have one
+           1. Caller       -  VAL.
+  @param   msg_hdr        command message header
+  @param   num_parameter  number of parameters
+  @param   parameters     parameters of the command
+  @return  1 if a delayed response follows a successful response, else 0
+**/
+static uint32_t val_cmd_has_delayed_response(uint32_t msg_hdr, size_t num_parameter,
+                                             const uint32_t *parameters)
+{
+    uint32_t flags;
+
+    switch ((scmi_codec_protocol_id(msg_hdr) << 8) | scmi_codec_message_id(msg_hdr)) {
+    case (SCMI_POWER_DOMAIN_PROTOCOL_ID << 8) | SCMI_POWER_DOMAIN_STATE_SET_MSG_ID:
+        if (num_parameter <= SCMI_POWER_DOMAIN_STATE_SET_PARAM_FLAGS)
+            return 0;
+        flags = parameters[SCMI_POWER_DOMAIN_STATE_SET_PARAM_FLAGS];
+        return VAL_EXTRACT_BITS(flags, SCMI_POWER_DOMAIN_STATE_SET_FLAGS_ASYNC_LOW,
+                                SCMI_POWER_DOMAIN_STATE_SET_FLAGS_ASYNC_HIGH);
+    case (SCMI_CLOCK_PROTOCOL_ID << 8) | SCMI_CLOCK_RATE_SET_MSG_ID:
+        if (num_parameter <= SCMI_CLOCK_RATE_SET_PARAM_FLAGS)
+            return 0;
+        flags = parameters[SCMI_CLOCK_RATE_SET_PARAM_FLAGS];
+        return VAL_EXTRACT_BITS(flags, SCMI_CLOCK_RATE_SET_FLAGS_ASYNC_LOW,
+                                SCMI_CLOCK_RATE_SET_FLAGS_ASYNC_HIGH) &&
+               !VAL_EXTRACT_BITS(flags, SCMI_CLOCK_RATE_SET_FLAGS_IGNORE_DELAYED_RESPONSE_LOW,
+                                 SCMI_CLOCK_RATE_SET_FLAGS_IGNORE_DELAYED_RESPONSE_HIGH);
+    case (SCMI_SENSOR_PROTOCOL_ID << 8) | SCMI_SENSOR_READING_GET_MSG_ID:
+        if (num_parameter <= SCMI_SENSOR_READING_GET_PARAM_FLAGS)
+            return 0;
+        flags = parameters[SCMI_SENSOR_READING_GET_PARAM_FLAGS];
+        return VAL_EXTRACT_BITS(flags, SCMI_SENSOR_READING_GET_FLAGS_ASYNC_LOW,
+                                SCMI_SENSOR_READING_GET_FLAGS_ASYNC_HIGH);
+    case (SCMI_RESET_PROTOCOL_ID << 8) | SCMI_RESET_RESET_MSG_ID:
+        if (num_parameter <= SCMI_RESET_RESET_PARAM_FLAGS)
+            return 0;
+        flags = parameters[SCMI_RESET_RESET_PARAM_FLAGS];
+        return VAL_EXTRACT_BITS(flags, SCMI_RESET_RESET_FLAGS_ASYNC_LOW,
+                                SCMI_RESET_RESET_FLAGS_ASYNC_HIGH);
+    default:
+        return 0;
+    }
+}
+
+/**
+  @brief   This function forms the command message header, commands are
+           tagged with a token so that their responses can be matched
            1. Caller       -  ACK.
   @param   protocol_id protocol identifier
   @param   msg_id      command idenitifer
@@ -35,13 +173,12 @@ static uint32_t g_protocol_list;
 **/
 uint32_t val_msg_hdr_create(uint32_t protocol_id, uint32_t msg_id, uint32_t msg_type)
 {
-    uint32_t msg_hdr = 0;
+    uint32_t token = 0;
 
-    msg_hdr = msg_hdr | (protocol_id << 10);
-    msg_hdr = msg_hdr | (msg_type << 8);
-    msg_hdr = msg_hdr | msg_id;
+    if (msg_type == COMMAND_MSG)
+        token = val_token_alloc();
 
-    return msg_hdr;
+    return scmi_codec_header(protocol_id, msg_id, msg_type, token);
 }
 
 /**
@@ -52,10 +189,18 @@ uint32_t val_msg_hdr_create(uint32_t protocol_id, uint32_t msg_id, uint32_t msg_
 **/
 uint32_t val_initialize_system(void *info)
 {
-    g_test_pass = 0;
-    g_test_fail = 0;
-    g_test_skip = 0;
-    return pal_initialize_system(info);
+    __atomic_store_n(&g_test_pass, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&g_test_fail, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&g_test_skip, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&g_test_timeout, 0, __ATOMIC_RELAXED);
+    val_memset(g_test_elapsed_ns, 0, sizeof(g_test_elapsed_ns));
+    val_memset(g_outstanding_cmd_table, 0, sizeof(g_outstanding_cmd_table));
+    if (pal_initialize_system(info) != PAL_STATUS_PASS)
+        return VAL_STATUS_FAIL;
+
+    /* Paginated responses fill the channel of the transport */
+    val_buffer_initialize();
+    return VAL_STATUS_PASS;
 }
 
 /**
@@ -63,32 +208,336 @@ uint32_t val_initialize_system(void *info)
            1. Caller       -  ACK.
   @param   test_num  test number
   @param   test_desc test description
-  @return  test status
+  @return  test status, VAL_STATUS_SKIP if the test is not to run
 **/
 uint32_t val_test_initialize(uint32_t test_num, char *test_desc)
 {
+    g_test_state = val_registry_test_state(test_num);
+    if (g_test_state == VAL_TEST_SKIPPED)
+        return VAL_STATUS_SKIP;
+
+    g_test_num = test_num;
+    g_test_desc = test_desc;
+    g_test_start = pal_get_time_ns();
+    val_buffer_reset();
+    g_check_start = g_test_start;
+
     val_print(VAL_PRINT_ERR, "\n%3d: %s ", test_num, test_desc);
+
+    /* Reported as skipped, the suite runs a test its bounds exclude */
+    if (!val_registry_version_supported(test_num)) {
+        val_print(VAL_PRINT_ERR, "\n     Protocol version outside the test version bounds");
+        return VAL_STATUS_SKIP;
+    }
+
+    if (g_test_budget_ms != 0)
+        pal_watchdog_arm(g_test_budget_ms);
     return VAL_STATUS_PASS;
 }
 
 /**
-  @brief   This is val print function
+  @brief   This function returns the protocol of a test, from its number
+           1. Caller       -  VAL.
+  @param   test_num  test number
+  @return  protocol name
+**/
+static const char *val_result_suite(uint32_t test_num)
+{
+    static const char * const suites[] = {
+        "", "base", "power_domain", "system_power", "performance", "clock", "sensor", "reset"
+    };
+
+    if ((test_num / 100) >= NUM_ELEMS(suites))
+        return "";
+
+    return suites[test_num / 100];
+}
+
+/**
+  @brief   This function hands the result of a check of the running test to
+           the PAL results sink
+           1. Caller       -  VAL.
+  @param   check            name of the check
+  @param   status           VAL_STATUS_PASS or VAL_STATUS_FAIL
+  @param   value_type       VAL_RESULT_NUMBER, _STRING or _NONE
+  @param   expected         expected number
+  @param   received         received number
+  @param   expected_string  expected string
+  @param   received_string  received string
+  @return  none
+**/
+static void val_result_check(const char *check, uint32_t status, uint32_t value_type,
+                             uint32_t expected, uint32_t received,
+                             const char *expected_string, const char *received_string)
+{
+    VAL_RESULT_s result;
+    uint64_t now = pal_get_time_ns();
+
+    if (g_test_state == VAL_TEST_QUIET)
+        return;
+
+    result.kind = VAL_RESULT_CHECK;
+    result.test_num = g_test_num;
+    result.suite = val_result_suite(g_test_num);
+    result.description = (g_test_desc != NULL) ? g_test_desc : "";
+    result.check = check;
+    result.status = status;
+    result.elapsed_ns = now - g_test_start;
+    result.duration_ns = now - g_check_start;
+    result.value_type = value_type;
+    result.expected = expected;
+    result.received = received;
+    result.expected_string = expected_string;
+    result.received_string = received_string;
+    pal_result(&result);
+
+    g_check_start = now;
+}
+
+#ifdef VAL_MULTI_THREAD
+#ifndef VAL_BINARY_TRACE
+/**
+  @brief   This function prints through the PAL, bypassing the log capture
+           1. Caller       -  VAL.
+  @param   print_level  filter for print statements
+  @param   format       print data and format
+  @return  none
+**/
+static void val_print_direct(uint32_t print_level, const char *format, ...)
+{
+    va_list args;
+
+    va_start(args, format);
+    pal_print(print_level, format, args);
+    va_end(args);
+}
+#endif
+
+/**
+  @brief   This function appends a print to the log capture of the calling
+           thread, the capture is flushed when it runs out of space
+           1. Caller       -  VAL.
+  @param   buffer       log capture
+  @param   print_level  filter for print statements
+  @param   format       print data and format
+  @param   args         print arguments
+  @return  none
+**/
+static void val_print_buffer_append(VAL_PRINT_BUFFER_s *buffer, uint32_t print_level,
+                                    const char *format, va_list args)
+{
+    va_list args_copy;
+    int length;
+
+    va_copy(args_copy, args);
+    length = vsnprintf(buffer->data + buffer->used, buffer->size - buffer->used,
+                       format, args_copy);
+    va_end(args_copy);
+
+    if (length < 0)
+        return;
+
+    if ((size_t)length < buffer->size - buffer->used) {
+        buffer->used += length;
+        return;
+    }
+
+    /* Out of space, drop the truncated print and make room */
+    buffer->data[buffer->used] = '\0';
+    val_print_buffer_flush(buffer);
+
+    if ((size_t)length < buffer->size) {
+        buffer->used = vsnprintf(buffer->data, buffer->size, format, args);
+        return;
+    }
+
+    pal_print(print_level, format, args);
+}
+
+#ifdef VAL_BINARY_TRACE
+/**
+  @brief   This function appends a trace record to the log capture of the
+           calling thread, the capture is flushed when it runs out of space
+           1. Caller       -  VAL.
+  @param   buffer  log capture
+  @param   record  trace record
+  @param   size    size of the record in bytes
+  @return  none
+**/
+static void val_print_buffer_append_record(VAL_PRINT_BUFFER_s *buffer, const void *record,
+                                           size_t size)
+{
+    if (size > buffer->size - buffer->used)
+        val_print_buffer_flush(buffer);
+
+    if (size > buffer->size) {
+        pal_trace(record, size);
+        return;
+    }
+
+    memcpy(buffer->data + buffer->used, record, size);
+    buffer->used += size;
+}
+#endif
+
+/**
+  @brief   This API captures the prints of the calling thread in a buffer so
+           that concurrently running suites do not interleave their logs
+           1. Caller       -  App layer.
+  @param   buffer  log capture, NULL to print straight through the PAL
+  @return  none
+**/
+void val_print_buffer_set(VAL_PRINT_BUFFER_s *buffer)
+{
+    if ((buffer != NULL) && (buffer->size != 0)) {
+        buffer->used = 0;
+        buffer->data[0] = '\0';
+    }
+
+    g_print_buffer = buffer;
+}
+
+/**
+  @brief   This API prints and empties a log capture
+           1. Caller       -  App layer.
+  @param   buffer  log capture
+  @return  none
+**/
+void val_print_buffer_flush(VAL_PRINT_BUFFER_s *buffer)
+{
+    if ((buffer == NULL) || (buffer->used == 0))
+        return;
+
+#ifdef VAL_BINARY_TRACE
+    pal_trace(buffer->data, buffer->used);
+#else
+    val_print_direct(VAL_PRINT_ERR, "%s", buffer->data);
+#endif
+    buffer->used = 0;
+    buffer->data[0] = '\0';
+}
+#endif
+
+/**
+  @brief   This is val print function, called through the val_print() macro
+           so that prints above VERBOSE_LEVEL are compiled out
            1. Caller       -  ACK.
   @param   print_level  filter for print statements
   @param   format       print data and format
   @return  none
 **/
-void val_print(uint32_t print_level, const char *format, ...)
+void val_print_message(uint32_t print_level, const char *format, ...)
 {
     va_list args;
 
-    if (print_level <= VERBOSE_LEVEL) {
+    if ((print_level <= VERBOSE_LEVEL) && (g_test_state != VAL_TEST_QUIET)) {
         va_start(args, format);
-        pal_print(print_level, format, args);
+#ifdef VAL_MULTI_THREAD
+        if (g_print_buffer != NULL)
+            val_print_buffer_append(g_print_buffer, print_level, format, args);
+        else
+#endif
+            pal_print(print_level, format, args);
         va_end(args);
     }
 }
 
+#ifdef VAL_BINARY_TRACE
+/* Start of the format string section, provided by the linker */
+extern const char __start_val_trace_fmt[];
+
+/**
+  @brief   This function appends words to a trace record, as much as fits
+           1. Caller       -  VAL.
+  @param   record  trace record
+  @param   used    bytes of the record used so far
+  @param   words   words to be appended
+  @param   count   number of words
+  @return  bytes of the record used
+**/
+static uint32_t val_trace_put(uint8_t *record, uint32_t used, const uint32_t *words,
+                              uint32_t count)
+{
+    if (used + (count * sizeof(uint32_t)) > VAL_TRACE_RECORD_SIZE)
+        return used;
+
+    memcpy(record + used, words, count * sizeof(uint32_t));
+    return used + (count * sizeof(uint32_t));
+}
+
+/**
+  @brief   This is the binary trace version of the val print function,
+           called through the val_print() macro. The record carries the
+           format string offset and the raw arguments, and is decoded
+           offline by scmi_trace_decode.
+           1. Caller       -  ACK.
+  @param   print_level  filter for print statements
+  @param   format       format string, placed in VAL_TRACE_SECTION
+  @param   ...          arguments of the format
+  @return  none
+**/
+void val_trace(uint32_t print_level, const char *format, ...)
+{
+    uint32_t record[VAL_TRACE_RECORD_SIZE / sizeof(uint32_t)];
+    VAL_TRACE_RECORD_s *header = (VAL_TRACE_RECORD_s *)record;
+    uint32_t used = sizeof(*header);
+    const char *conversion = format;
+    const char *start;
+    const char *string;
+    uint64_t value;
+    uint32_t words[2];
+    uint32_t length;
+    va_list args;
+    int wide;
+    char type;
+
+    if (g_test_state == VAL_TEST_QUIET)
+        return;
+
+    header->sync = VAL_TRACE_SYNC;
+    header->level = print_level;
+    header->format_id = format - __start_val_trace_fmt;
+
+    va_start(args, format);
+    while ((conversion = val_trace_next_conversion(conversion, &start, &wide, &type)) != NULL) {
+        if (type == 's') {
+            string = va_arg(args, const char *);
+            for (length = 0; (length < VAL_TRACE_STRING_SIZE) && (string[length] != '\0'); length++)
+                ;
+            if (used + sizeof(uint32_t) + length > VAL_TRACE_RECORD_SIZE)
+                break;
+
+            used = val_trace_put((uint8_t *)record, used, &length, 1);
+            memcpy((uint8_t *)record + used, string, length);
+            used += (length + 3) & ~3u;
+            continue;
+        }
+
+        if (type == 'p')
+            value = (uintptr_t)va_arg(args, void *);
+        else if (wide)
+            value = va_arg(args, unsigned long long);
+        else
+            value = va_arg(args, unsigned int);
+
+        words[0] = (uint32_t)value;
+        words[1] = (uint32_t)(value >> 32);
+        used = val_trace_put((uint8_t *)record, used, words, wide ? 2 : 1);
+    }
+    va_end(args);
+
+    header->length = used - sizeof(*header);
+
+#ifdef VAL_MULTI_THREAD
+    if (g_print_buffer != NULL) {
+        val_print_buffer_append_record(g_print_buffer, record, used);
+        return;
+    }
+#endif
+    pal_trace(record, used);
+}
+#endif
+
 /**
   @brief   This is val memset function
            1. Caller       -  ACK.
@@ -165,6 +614,9 @@ uint32_t val_strcmp(uint8_t *dst_ptr, uint8_t *src_ptr, uint32_t len)
 **/
 uint32_t val_compare_msg_hdr(uint32_t sent_msg_hdr, uint32_t rcvd_msg_hdr)
 {
+    val_result_check("HEADER", (rcvd_msg_hdr != sent_msg_hdr) ? VAL_STATUS_FAIL : VAL_STATUS_PASS,
+                     VAL_RESULT_NUMBER, sent_msg_hdr, rcvd_msg_hdr, NULL, NULL);
+
     if (rcvd_msg_hdr != sent_msg_hdr) {
         val_print(VAL_PRINT_ERR, "\n       CHECK HEADER   : FAILED");
         val_print(VAL_PRINT_ERR, "\n         SENT       : 0x%08x                ", sent_msg_hdr);
@@ -187,6 +639,9 @@ uint32_t val_compare_msg_hdr(uint32_t sent_msg_hdr, uint32_t rcvd_msg_hdr)
 **/
 uint32_t val_compare(char *parameter, uint32_t rcvd_val, uint32_t exp_val)
 {
+    val_result_check(parameter, (rcvd_val != exp_val) ? VAL_STATUS_FAIL : VAL_STATUS_PASS,
+                     VAL_RESULT_NUMBER, exp_val, rcvd_val, NULL, NULL);
+
     if (rcvd_val != exp_val) {
         val_print(VAL_PRINT_ERR, "\n       CHECK %s: FAILED", parameter);
         val_print(VAL_PRINT_ERR, "\n         EXPECTED   : 0x%08x                ", exp_val);
@@ -209,7 +664,12 @@ uint32_t val_compare(char *parameter, uint32_t rcvd_val, uint32_t exp_val)
 **/
 uint32_t val_compare_str(char *parameter, char *rcvd_val, char *exp_val, uint32_t len)
 {
-    if (val_strcmp((uint8_t *)rcvd_val, (uint8_t *)exp_val, len)) {
+    uint32_t status = val_strcmp((uint8_t *)rcvd_val, (uint8_t *)exp_val, len) ?
+                      VAL_STATUS_FAIL : VAL_STATUS_PASS;
+
+    val_result_check(parameter, status, VAL_RESULT_STRING, 0, 0, exp_val, rcvd_val);
+
+    if (status != VAL_STATUS_PASS) {
         val_print(VAL_PRINT_ERR, "\n       CHECK %s: FAILED", parameter);
         val_print(VAL_PRINT_ERR, "\n         EXPECTED   : %s                ", exp_val);
         val_print(VAL_PRINT_ERR, "\n         RECEIVED   : %s                ", rcvd_val);
@@ -246,6 +706,10 @@ void val_print_return_values(uint32_t count, uint32_t *values)
 **/
 uint32_t val_reserved_bits_check_is_zero(uint32_t reserved_bits)
 {
+    val_result_check("RSVD BITS",
+                     (reserved_bits != VAL_RESERVED_BYTE_ZERO) ? VAL_STATUS_FAIL : VAL_STATUS_PASS,
+                     VAL_RESULT_NUMBER, VAL_RESERVED_BYTE_ZERO, reserved_bits, NULL, NULL);
+
     if (reserved_bits != VAL_RESERVED_BYTE_ZERO) {
         val_print(VAL_PRINT_ERR, "\n       CHECK RSVD BITS: FAILED [0x%08x]", reserved_bits);
         return VAL_STATUS_FAIL;
@@ -256,26 +720,98 @@ uint32_t val_reserved_bits_check_is_zero(uint32_t reserved_bits)
 }
 
 /**
-  @brief   This API is used to convert test result to string
+  @brief   This function checks that a response carries every return value
+           of the entries it announces, before the entries are decoded
+           1. Caller       - Test Suite.
+  @param   rcvd_count  number of return values received
+  @param   exp_count   number of return values the announced entries take
+  @return  status
+**/
+uint32_t val_check_return_count(size_t rcvd_count, size_t exp_count)
+{
+    val_result_check("RETURN COUNT", (rcvd_count < exp_count) ? VAL_STATUS_FAIL : VAL_STATUS_PASS,
+                     VAL_RESULT_NUMBER, exp_count, rcvd_count, NULL, NULL);
+
+    if (rcvd_count < exp_count) {
+        val_print(VAL_PRINT_ERR, "\n       CHECK RETURN COUNT: FAILED [%d of %d]",
+                  (uint32_t)rcvd_count, (uint32_t)exp_count);
+        return VAL_STATUS_FAIL;
+    } else
+        val_print(VAL_PRINT_DEBUG, "\n       CHECK RETURN COUNT: PASSED [%d]", (uint32_t)rcvd_count);
+
+    return VAL_STATUS_PASS;
+}
+
+/**
+  @brief   This API is used to convert test result to string. A test that
+           ran past its budget is reported as TIMEOUT whatever its status.
+           Tests that were not selected, or only ran for a selected test
+           that needs them, are not reported.
   @param   test_status  test status value
   @return  string       test status string
 **/
 uint32_t val_report_status(uint32_t status)
 {
+    VAL_RESULT_s result;
+    uint64_t elapsed_ns;
+    uint32_t state = g_test_state;
+
+    g_test_state = VAL_TEST_SELECTED;
+    if (state == VAL_TEST_SKIPPED)
+        return status;
+
+    if (g_test_budget_ms != 0)
+        pal_watchdog_disarm();
+
+    if (state == VAL_TEST_QUIET) {
+        g_test_num = 0;
+        g_test_desc = NULL;
+        return status;
+    }
+
+    elapsed_ns = pal_get_time_ns() - g_test_start;
+    if ((g_test_budget_ms != 0) && (elapsed_ns >= (uint64_t)g_test_budget_ms * 1000000))
+        status = VAL_STATUS_TIMEOUT;
+
+    if (g_test_num < VAL_MAX_TEST_NUM)
+        g_test_elapsed_ns[g_test_num] = elapsed_ns;
+
+    result.kind = VAL_RESULT_TEST;
+    result.test_num = g_test_num;
+    result.suite = val_result_suite(g_test_num);
+    result.description = (g_test_desc != NULL) ? g_test_desc : "";
+    result.check = NULL;
+    result.status = status;
+    result.elapsed_ns = elapsed_ns;
+    result.duration_ns = elapsed_ns;
+    result.value_type = VAL_RESULT_NONE;
+    result.expected = 0;
+    result.received = 0;
+    result.expected_string = NULL;
+    result.received_string = NULL;
+    pal_result(&result);
+
+    g_test_num = 0;
+    g_test_desc = NULL;
+
     switch (status)
     {
         case VAL_STATUS_PASS:
-              g_test_pass++;
+              __atomic_fetch_add(&g_test_pass, 1, __ATOMIC_RELAXED);
               val_print(VAL_PRINT_ERR, "          : CONFORMANT");
               break;
         case VAL_STATUS_FAIL:
-              g_test_fail++;
+              __atomic_fetch_add(&g_test_fail, 1, __ATOMIC_RELAXED);
               val_print(VAL_PRINT_ERR, "          : NON CONFORMANT");
               break;
         case VAL_STATUS_SKIP:
-              g_test_skip++;
+              __atomic_fetch_add(&g_test_skip, 1, __ATOMIC_RELAXED);
               val_print(VAL_PRINT_ERR, "          : SKIPPED");
               break;
+        case VAL_STATUS_TIMEOUT:
+              __atomic_fetch_add(&g_test_timeout, 1, __ATOMIC_RELAXED);
+              val_print(VAL_PRINT_ERR, "          : TIMEOUT");
+              break;
     }
     return status;
 }
@@ -297,6 +833,8 @@ char *val_get_result_string(uint32_t test_status)
         return "FAILED";
     case VAL_STATUS_SKIP:
         return "SKIPPED";
+    case VAL_STATUS_TIMEOUT:
+        return "TIMEOUT";
     default:
         val_print(VAL_PRINT_ERR, "\nInvalid test status %d", test_status);
         return "UNKNOWN";
@@ -355,16 +893,19 @@ char *val_get_status_string(int32_t status)
 **/
 uint32_t val_compare_status(int32_t status, int32_t expected_status)
 {
+    char *expected_string = val_get_status_string(expected_status);
+    char *received_string = val_get_status_string(status);
+
+    val_result_check("STATUS", (status != expected_status) ? VAL_STATUS_FAIL : VAL_STATUS_PASS,
+                     VAL_RESULT_STRING, 0, 0, expected_string, received_string);
+
     if (status != expected_status) {
         val_print(VAL_PRINT_ERR, "\n       CHECK STATUS   : FAILED");
-        val_print(VAL_PRINT_ERR, "\n           EXPECTED   : %s   ",
-                val_get_status_string(expected_status));
-        val_print(VAL_PRINT_ERR, "\n           RECEIVED   : %s         ",
-                val_get_status_string(status));
+        val_print(VAL_PRINT_ERR, "\n           EXPECTED   : %s   ", expected_string);
+        val_print(VAL_PRINT_ERR, "\n           RECEIVED   : %s         ", received_string);
         return VAL_STATUS_FAIL;
     } else {
-        val_print(VAL_PRINT_TEST, "\n       CHECK STATUS   : PASSED [%s] ",
-                    val_get_status_string(status));
+        val_print(VAL_PRINT_TEST, "\n       CHECK STATUS   : PASSED [%s] ", received_string);
         return VAL_STATUS_PASS;
     }
 }
@@ -378,6 +919,9 @@ uint32_t val_compare_status(int32_t status, int32_t expected_status)
 **/
 uint32_t val_compare_return_count(uint32_t received, uint32_t expected)
 {
+    val_result_check("COUNT", (received != expected) ? VAL_STATUS_FAIL : VAL_STATUS_PASS,
+                     VAL_RESULT_NUMBER, expected, received, NULL, NULL);
+
     if (received != expected) {
         val_print(VAL_PRINT_ERR, "\n       CHECK COUNT    : FAILED");
         val_print(VAL_PRINT_ERR, "\n         EXPECTED   : %d                ", expected);
@@ -389,6 +933,49 @@ uint32_t val_compare_return_count(uint32_t received, uint32_t expected)
     return VAL_STATUS_PASS;
 }
 
+#ifdef VAL_RECORD
+/**
+  @brief   This function hands the record of an exchange with the platform to
+           the PAL, which appends it to the recording of the run
+           1. Caller       -  VAL.
+  @param   kind            VAL_RECORD_COMMAND, _DELAYED_RESPONSE or _NOTIFICATION
+  @param   command_header  header sent, 0 if nothing was sent
+  @param   num_parameter   number of parameters sent
+  @param   parameters      parameters sent
+  @param   header          header received
+  @param   status          status received
+  @param   num_returns     number of return values received
+  @param   returns         return values received
+  @param   start           time the exchange started, in ns
+  @return  none
+**/
+static void val_record(uint32_t kind, uint32_t command_header, size_t num_parameter,
+                       const uint32_t *parameters, uint32_t header, int32_t status,
+                       size_t num_returns, const uint32_t *returns, uint64_t start)
+{
+    VAL_RECORD_s record;
+    size_t i;
+
+    val_memset(&record, 0, sizeof(record));
+    record.timestamp_ns = start;
+    record.latency_ns = pal_get_time_ns() - start;
+    record.kind = kind;
+    record.channel = g_channel_id;
+    record.command_header = command_header;
+    record.header = header;
+    record.status = status;
+    record.num_parameters = num_parameter;
+    record.num_returns = num_returns;
+
+    for (i = 0; (i < num_parameter) && (i < VAL_RECORD_MAX_PARAMETERS); i++)
+        record.parameters[i] = parameters[i];
+    for (i = 0; (i < num_returns) && (i < VAL_RECORD_MAX_RETURNS); i++)
+        record.returns[i] = returns[i];
+
+    pal_record(&record, sizeof(record));
+}
+#endif
+
 /**
   @brief   This function is used to send command data to platform and receive response
            1. Caller       - Test Suite.
@@ -397,15 +984,20 @@ uint32_t val_compare_return_count(uint32_t received, uint32_t expected)
   @param   parameter_buffer Buffer of sent parameters
   @param   rcvd_msg_hdr     message header received from platform
   @param   status           Status of command processed
-  @param   rcvd_buffer_size Size of return buffer
-  @param   rcvd_buffer      return values buffer
+  @param   rcvd_buffer_size Number of return values received
+  @param   rcvd_buffer      return values buffer, of MAX_RETURNS_SIZE words or
+                            from val_buffer_get()
   @return  none
 **/
 void val_send_message(uint32_t msg_hdr, size_t num_parameter, uint32_t *parameter_buffer,
                       uint32_t *rcvd_msg_hdr, int32_t *status, size_t *rcvd_buffer_size,
                       uint32_t *rcvd_buffer)
 {
+    VAL_OUTSTANDING_CMD_s *entry;
     uint32_t i;
+#if defined(VAL_LATENCY_STATS) || defined(VAL_RECORD)
+    uint64_t start;
+#endif
 
     val_print(VAL_PRINT_DEBUG, "\n       MSG HDR        : 0x%08x", msg_hdr);
     val_print(VAL_PRINT_DEBUG, "\n       NUM PARAM      : %d", num_parameter);
@@ -415,8 +1007,37 @@ void val_send_message(uint32_t msg_hdr, size_t num_parameter, uint32_t *paramete
         val_print(VAL_PRINT_DEBUG, "\n       PARAMETER[%02d]  : 0x%08x", i, parameter_buffer[i]);
     }
 
+    entry = val_outstanding_cmd_entry(VAL_GET_TOKEN(msg_hdr));
+    entry->msg_hdr = msg_hdr;
+    entry->state = VAL_CMD_PENDING;
+
+    /* The transport writes no more return values than the buffer holds */
+    *rcvd_buffer_size = val_buffer_capacity(rcvd_buffer);
+
+#if defined(VAL_LATENCY_STATS) || defined(VAL_RECORD)
+    start = pal_get_time_ns();
+#endif
     pal_send_message(msg_hdr, num_parameter, parameter_buffer, rcvd_msg_hdr, status,
                      rcvd_buffer_size, rcvd_buffer);
+#ifdef VAL_LATENCY_STATS
+    val_latency_record(msg_hdr, pal_get_time_ns() - start);
+#endif
+#ifdef VAL_RECORD
+    val_record(VAL_RECORD_COMMAND, msg_hdr, num_parameter, parameter_buffer, *rcvd_msg_hdr,
+               *status, *rcvd_buffer_size, rcvd_buffer, start);
+#endif
+
+    /* Keep the command around only while a delayed response may still refer
+       to its token. A command whose response failed or did not match frees its
+       token, any later response to it is then reported as having no command. */
+    if (val_outstanding_cmd_match(*rcvd_msg_hdr, VAL_CMD_PENDING) != entry) {
+        val_print(VAL_PRINT_DEBUG, "\n       NO COMMAND FOR : 0x%08x", *rcvd_msg_hdr);
+        entry->state = VAL_CMD_FREE;
+    } else if ((*status == SCMI_SUCCESS) &&
+               val_cmd_has_delayed_response(msg_hdr, num_parameter, parameter_buffer))
+        entry->state = VAL_CMD_COMPLETED;
+    else
+        entry->state = VAL_CMD_FREE;
 }
 
 /**
@@ -429,7 +1050,16 @@ void val_send_message(uint32_t msg_hdr, size_t num_parameter, uint32_t *paramete
 void val_receive_notification(uint32_t *message_header_rcv, size_t *return_values_count,
                               uint32_t *return_values)
 {
+#ifdef VAL_RECORD
+    uint64_t start = pal_get_time_ns();
+#endif
+
+    *return_values_count = val_buffer_capacity(return_values);
     pal_receive_notification(message_header_rcv, return_values_count, return_values);
+#ifdef VAL_RECORD
+    val_record(VAL_RECORD_NOTIFICATION, 0, 0, NULL, *message_header_rcv, 0,
+               *return_values_count, return_values, start);
+#endif
 }
 
 /**
@@ -443,7 +1073,40 @@ void val_receive_notification(uint32_t *message_header_rcv, size_t *return_value
 void val_receive_delayed_response(uint32_t *message_header_rcv, int32_t *status,
         size_t *return_values_count, uint32_t *return_values)
 {
+    VAL_OUTSTANDING_CMD_s *entry;
+#ifdef VAL_RECORD
+    uint64_t start = pal_get_time_ns();
+#endif
+
+    *return_values_count = val_buffer_capacity(return_values);
     pal_receive_delayed_response(message_header_rcv, status, return_values_count, return_values);
+#ifdef VAL_RECORD
+    val_record(VAL_RECORD_DELAYED_RESPONSE, 0, 0, NULL, *message_header_rcv, *status,
+               *return_values_count, return_values, start);
+#endif
+
+    entry = val_outstanding_cmd_match(*message_header_rcv, VAL_CMD_COMPLETED);
+    if (entry != NULL) {
+        val_print(VAL_PRINT_DEBUG, "\n       ISSUED BY      : 0x%08x", entry->msg_hdr);
+        entry->state = VAL_CMD_FREE;
+    } else
+        val_print(VAL_PRINT_DEBUG, "\n       NO COMMAND FOR : 0x%08x", *message_header_rcv);
+}
+
+/**
+  @brief   This API returns the header of the command which is using a token
+           1. Caller       -  Test Suite.
+  @param   token  message header token
+  @return  command message header, 0 if no command is outstanding for the token
+**/
+uint32_t val_get_outstanding_cmd(uint32_t token)
+{
+    VAL_OUTSTANDING_CMD_s *entry = val_outstanding_cmd_entry(token);
+
+    if ((entry->state == VAL_CMD_FREE) || (VAL_GET_TOKEN(entry->msg_hdr) != token))
+        return 0;
+
+    return entry->msg_hdr;
 }
 
 /**
@@ -517,7 +1180,7 @@ uint32_t val_check_trusted_agent(uint32_t agent_id)
 **/
 uint32_t val_get_test_passed(void)
 {
-    return g_test_pass;
+    return __atomic_load_n(&g_test_pass, __ATOMIC_RELAXED);
 }
 
 /**
@@ -526,7 +1189,7 @@ uint32_t val_get_test_passed(void)
 **/
 uint32_t val_get_test_failed(void)
 {
-    return g_test_fail;
+    return __atomic_load_n(&g_test_fail, __ATOMIC_RELAXED);
 }
 
 /**
@@ -535,5 +1198,122 @@ uint32_t val_get_test_failed(void)
 **/
 uint32_t val_get_test_skipped(void)
 {
-    return g_test_skip;
+    return __atomic_load_n(&g_test_skip, __ATOMIC_RELAXED);
+}
+
+/**
+  @brief   This API returns num of test that ran past their budget
+  @return num of test timed out
+**/
+uint32_t val_get_test_timeout(void)
+{
+    return __atomic_load_n(&g_test_timeout, __ATOMIC_RELAXED);
+}
+
+/**
+  @brief   This API sets the wall clock budget of each test
+           1. Caller       -  App layer.
+  @param   budget_ms  budget in ms, 0 to run tests unbounded
+  @return  none
+**/
+void val_set_test_budget(uint32_t budget_ms)
+{
+    g_test_budget_ms = budget_ms;
+}
+
+/**
+  @brief   This API prints the tests that took the longest to run
+           1. Caller       -  App layer.
+  @param   none
+  @return  none
+**/
+void val_test_timing_report(void)
+{
+    uint32_t slowest[VAL_SLOWEST_TESTS];
+    uint32_t num_slowest = 0;
+    uint32_t test_num;
+    uint32_t i;
+
+    for (test_num = 0; test_num < VAL_MAX_TEST_NUM; test_num++) {
+        if (g_test_elapsed_ns[test_num] == 0)
+            continue;
+
+        for (i = num_slowest; (i > 0) &&
+             (g_test_elapsed_ns[slowest[i - 1]] < g_test_elapsed_ns[test_num]); i--) {
+            if (i < VAL_SLOWEST_TESTS)
+                slowest[i] = slowest[i - 1];
+        }
+
+        if (i < VAL_SLOWEST_TESTS) {
+            slowest[i] = test_num;
+            if (num_slowest < VAL_SLOWEST_TESTS)
+                num_slowest++;
+        }
+    }
+
+    /* Nothing timed, as on platforms without a time source */
+    if (num_slowest == 0)
+        return;
+
+    val_print(VAL_PRINT_ERR, "\n  SLOWEST TESTS (us)");
+    for (i = 0; i < num_slowest; i++)
+        val_print(VAL_PRINT_ERR, "\n      %3d %10u", slowest[i],
+                  (uint32_t)(g_test_elapsed_ns[slowest[i]] / 1000));
+}
+
+/**
+  @brief   This API picks the transport the agent talks to the platform
+           through, before the system is initialized
+           1. Caller       -  App layer.
+  @param   name  transport name, with an optional ':' separated argument such
+                 as a socket path, NULL for the platform default
+  @return  VAL_STATUS_PASS, VAL_STATUS_FAIL if the platform has no such transport
+**/
+uint32_t val_set_transport(const char *name)
+{
+    return pal_set_transport(name);
+}
+
+/**
+  @brief   This API returns the name of the transport in use
+           1. Caller       -  App layer.
+  @return  transport name
+**/
+const char *val_get_transport(void)
+{
+    return pal_get_transport();
+}
+
+/**
+  @brief   This API returns the number of transport channels, each channel
+           is an independent agent to platform link
+           1. Caller       -  App layer.
+  @return  number of channels
+**/
+uint32_t val_get_num_channels(void)
+{
+    return pal_get_num_channels();
+}
+
+/**
+  @brief   This API binds the calling thread to a transport channel, every
+           message the thread sends afterwards goes through that channel
+           1. Caller       -  App layer.
+  @param   channel_id  channel identifier
+  @return  status
+**/
+uint32_t val_select_channel(uint32_t channel_id)
+{
+    g_channel_id = channel_id;
+    return pal_select_channel(channel_id);
+}
+
+/**
+  @brief   This API returns the channel the calling thread is bound to
+           1. Caller       -  VAL.
+  @return  channel identifier
+**/
+uint32_t val_get_channel(void)
+{
+    return g_channel_id;
 }
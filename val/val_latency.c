@@ -0,0 +1,219 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interface.h"
+#include "val_latency.h"
+
+/**
+  @brief   This function returns the histogram bucket of a latency
+           1. Caller       -  VAL.
+  @param   value  latency in ns
+  @return  bucket index
+**/
+static uint32_t val_latency_bucket(uint32_t value)
+{
+    uint32_t shift;
+
+    if (value < VAL_LATENCY_SUB_BUCKETS)
+        return value;
+
+    shift = (31 - __builtin_clz(value)) - VAL_LATENCY_SUB_BITS;
+    return (shift * VAL_LATENCY_SUB_BUCKETS) + (value >> shift);
+}
+
+/**
+  @brief   This function returns the highest latency falling in a bucket
+           1. Caller       -  VAL.
+  @param   index  bucket index
+  @return  latency in ns
+**/
+static uint32_t val_latency_bucket_value(uint32_t index)
+{
+    uint32_t shift;
+    uint32_t mantissa;
+
+    if (index < VAL_LATENCY_SUB_BUCKETS)
+        return index;
+
+    shift = (index / VAL_LATENCY_SUB_BUCKETS) - 1;
+    mantissa = index - (shift * VAL_LATENCY_SUB_BUCKETS);
+    return (uint32_t)((((uint64_t)mantissa + 1) << shift) - 1);
+}
+
+/**
+  @brief   This API returns the latency below which a share of the samples
+           of a histogram fall
+           1. Caller       -  VAL, benchmark.
+  @param   entry     histogram
+  @param   permille  share of the samples, in 1/1000
+  @return  latency in ns
+**/
+uint32_t val_latency_get_percentile(const VAL_LATENCY_ENTRY_s *entry, uint32_t permille)
+{
+    uint64_t target = (((uint64_t)entry->count * permille) + 999) / 1000;
+    uint64_t seen = 0;
+    uint32_t i;
+
+    if (target == 0)
+        target = 1;
+
+    for (i = 0; i < VAL_LATENCY_NUM_BUCKETS; i++) {
+        seen += entry->bucket[i];
+        if (seen >= target)
+            break;
+    }
+
+    /* The bucket bound may exceed the largest sample actually seen */
+    if ((i == VAL_LATENCY_NUM_BUCKETS) || (val_latency_bucket_value(i) > entry->max))
+        return entry->max;
+
+    return val_latency_bucket_value(i);
+}
+
+/**
+  @brief   This API adds a sample to a histogram, it is lock free and does not
+           allocate
+           1. Caller       -  VAL, benchmark.
+  @param   entry       histogram
+  @param   latency_ns  sample, saturated to 32 bits
+  @return  none
+**/
+void val_latency_histogram_add(VAL_LATENCY_ENTRY_s *entry, uint64_t latency_ns)
+{
+    uint32_t value = (latency_ns > UINT32_MAX) ? UINT32_MAX : (uint32_t)latency_ns;
+    uint32_t max;
+
+    __atomic_fetch_add(&entry->bucket[val_latency_bucket(value)], 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&entry->count, 1, __ATOMIC_RELAXED);
+
+    max = __atomic_load_n(&entry->max, __ATOMIC_RELAXED);
+    while ((value > max) &&
+           !__atomic_compare_exchange_n(&entry->max, &max, value, true,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        ;
+}
+
+#ifdef VAL_LATENCY_STATS
+
+/* Preallocated so that recording a sample never allocates */
+static VAL_LATENCY_ENTRY_s g_latency_table[VAL_LATENCY_MAX_ENTRIES];
+static uint32_t g_latency_dropped;
+
+/**
+  @brief   This function finds, or claims, the table entry of a command
+           1. Caller       -  VAL.
+  @param   key  VAL_LATENCY_KEY of the command
+  @return  table entry, NULL if the table is full
+**/
+static VAL_LATENCY_ENTRY_s *val_latency_entry(uint32_t key)
+{
+    uint32_t index = (key * 2654435761u) & (VAL_LATENCY_MAX_ENTRIES - 1);
+    uint32_t free_key;
+    uint32_t i;
+
+    for (i = 0; i < VAL_LATENCY_MAX_ENTRIES; i++) {
+        VAL_LATENCY_ENTRY_s *entry = &g_latency_table[index];
+
+        free_key = 0;
+        if ((__atomic_load_n(&entry->key, __ATOMIC_ACQUIRE) == key) ||
+            __atomic_compare_exchange_n(&entry->key, &free_key, key, false,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) ||
+            (free_key == key))
+            return entry;
+
+        index = (index + 1) & (VAL_LATENCY_MAX_ENTRIES - 1);
+    }
+
+    return NULL;
+}
+#endif
+
+/**
+  @brief   This API records the latency of a command, it is lock free and does
+           not allocate so that it can sit on the send path
+           1. Caller       -  VAL.
+  @param   msg_hdr     command message header
+  @param   latency_ns  time from sending the command to receiving its response
+  @return  none
+**/
+void val_latency_record(uint32_t msg_hdr, uint64_t latency_ns)
+{
+#ifdef VAL_LATENCY_STATS
+    VAL_LATENCY_ENTRY_s *entry;
+
+    entry = val_latency_entry(VAL_LATENCY_KEY(scmi_codec_protocol_id(msg_hdr),
+                                              scmi_codec_message_id(msg_hdr),
+                                              pal_get_completion_mode()));
+    if (entry == NULL) {
+        __atomic_fetch_add(&g_latency_dropped, 1, __ATOMIC_RELAXED);
+        return;
+    }
+
+    val_latency_histogram_add(entry, latency_ns);
+#else
+    (void)msg_hdr;
+    (void)latency_ns;
+#endif
+}
+
+/**
+  @brief   This API prints p50/p99/p999/max latency of every command sent,
+           per completion mode of the transport
+           1. Caller       -  App layer.
+  @param   none
+  @return  none
+**/
+void val_latency_report(void)
+{
+#ifdef VAL_LATENCY_STATS
+    static const char * const modes[] = { "-", "irq", "poll" };
+    const VAL_LATENCY_ENTRY_s *order[VAL_LATENCY_MAX_ENTRIES];
+    const VAL_LATENCY_ENTRY_s *entry;
+    uint32_t num_entries = 0;
+    uint32_t i, j;
+
+    /* Report in (protocol, message id, mode) order rather than table order */
+    for (i = 0; i < VAL_LATENCY_MAX_ENTRIES; i++) {
+        entry = &g_latency_table[i];
+        if (entry->count == 0)
+            continue;
+
+        for (j = num_entries; (j > 0) && (order[j - 1]->key > entry->key); j--)
+            order[j] = order[j - 1];
+        order[j] = entry;
+        num_entries++;
+    }
+
+    val_print(VAL_PRINT_ERR, "\n  COMMAND LATENCY (ns)");
+    val_print(VAL_PRINT_ERR,
+              "\n  PROTOCOL  MSG MODE      COUNT        P50        P99       P999        MAX");
+
+    for (i = 0; i < num_entries; i++) {
+        entry = order[i];
+        val_print(VAL_PRINT_ERR, "\n      0x%02x 0x%02x %-4s %10u %10u %10u %10u %10u",
+                  (entry->key - 1) >> 16, ((entry->key - 1) >> 8) & 0xFF,
+                  modes[((entry->key - 1) & 0xFF) % NUM_ELEMS(modes)], entry->count,
+                  val_latency_get_percentile(entry, 500),
+                  val_latency_get_percentile(entry, 990),
+                  val_latency_get_percentile(entry, 999),
+                  entry->max);
+    }
+
+    if (g_latency_dropped)
+        val_print(VAL_PRINT_ERR, "\n  NOT RECORDED, TABLE FULL: %u", g_latency_dropped);
+#endif
+}
@@ -19,7 +19,135 @@
 #include "val_interface.h"
 #include "val_performance.h"
 
-static PERFORMANCE_INFO_s g_performance_info_table;
+static VAL_THREAD_LOCAL PERFORMANCE_INFO_s g_performance_info_table;
+
+/**
+  @brief   This function walks the levels of a performance domain, which come
+           in parts as large as the channel allows, and saves the lowest,
+           highest and second level
+           1. Caller       -  val_performance_discover().
+  @param   domain_id      performance domain identifier
+  @param   return_values  buffer from val_buffer_get()
+  @return  VAL_STATUS_PASS, VAL_STATUS_FAIL if a command failed
+**/
+static uint32_t val_performance_discover_levels(uint32_t domain_id, uint32_t *return_values)
+{
+    size_t   return_value_count;
+    uint32_t parameters[2];
+    uint32_t num_returned, num_remaining, level;
+    uint32_t min_level = 0xFFFFFFFF, max_level = 0;
+    uint32_t level_index = 0;
+    uint32_t i;
+
+    do {
+        parameters[0] = domain_id;
+        parameters[1] = level_index;
+        if (val_discovery_send(PROTOCOL_PERFORMANCE, PERFORMANCE_DESCRIBE_LEVELS, 2, parameters,
+                               &return_value_count, return_values))
+            return VAL_STATUS_FAIL;
+
+        /* The levels announced must all have been received */
+        num_remaining = VAL_EXTRACT_BITS(return_values[NUM_LEVEL_OFFSET], 16, 31);
+        num_returned = VAL_EXTRACT_BITS(return_values[NUM_LEVEL_OFFSET], 0, 11);
+        if ((num_returned == 0) ||
+            (return_value_count < PERF_LEVEL_ARRAY_OFFSET + (num_returned * 3)))
+            return VAL_STATUS_FAIL;
+
+        for (i = 0; i < num_returned; i++) {
+            level = return_values[PERF_LEVEL_ARRAY_OFFSET + (i * 3)];
+            if (min_level > level)
+                min_level = level;
+            if (max_level < level)
+                max_level = level;
+            if ((level_index + i) == 1)
+                val_performance_save_info(PERF_DOMAIN_INTERMEDIATE_LEVEL, domain_id, level);
+        }
+        level_index += num_returned;
+    } while (num_remaining > 0);
+
+    val_performance_save_info(PERF_DOMAIN_MAX_LEVEL, domain_id, max_level);
+    val_performance_save_info(PERF_DOMAIN_MIN_LEVEL, domain_id, min_level);
+    return VAL_STATUS_PASS;
+}
+
+/**
+  @brief   This function walks the performance protocol and fills its info
+           table, see val_discovery_run()
+           1. Caller       -  VAL.
+  @param   version  protocol version
+  @return  VAL_STATUS_PASS, VAL_STATUS_FAIL if a command failed
+**/
+static uint32_t val_performance_discover(uint32_t version)
+{
+    static const uint32_t fast_ch_messages[] = {
+        PERFORMANCE_LIMITS_SET, PERFORMANCE_LIMITS_GET, PERFORMANCE_LEVEL_SET, PERFORMANCE_LEVEL_GET
+    };
+    uint32_t return_values[MAX_RETURNS_SIZE];
+    uint32_t *levels = val_buffer_get();
+    uint32_t domain_id, num_domains, attribute, message_id;
+    int32_t  status;
+    uint32_t i;
+
+    if (levels == NULL)
+        return VAL_STATUS_FAIL;
+
+    if (val_discovery_send(PROTOCOL_PERFORMANCE, PERFORMANCE_PROTOCOL_ATTRIBUTES, 0, NULL,
+                           NULL, return_values))
+        return VAL_STATUS_FAIL;
+
+    num_domains = VAL_EXTRACT_BITS(return_values[ATTRIBUTE_OFFSET], 0, 15);
+    if (num_domains > MAX_PERFORMANCE_DOMAINS)
+        return VAL_STATUS_FAIL;
+
+    val_performance_save_info(NUM_PERF_DOMAINS, 0x00, num_domains);
+    val_performance_save_info(PERF_STATS_ADDR_LOW, 0x00, return_values[STATS_ADDR_LOW_OFFSET]);
+    val_performance_save_info(PERF_STATS_ADDR_HIGH, 0x00, return_values[STATS_ADDR_HIGH_OFFSET]);
+    val_performance_save_info(PERF_STATS_ADDR_LEN, 0x00, return_values[STATS_LENGTH_OFFSET]);
+
+    if (version == PROTOCOL_VERSION_2) {
+        /* Any answer other than NOT_FOUND means the command is implemented */
+        message_id = PERFORMANCE_DESCRIBE_FASTCHANNEL;
+        status = val_discovery_send(PROTOCOL_PERFORMANCE, PERFORMANCE_PROTOCOL_MESSAGE_ATTRIBUTES,
+                                    1, &message_id, NULL, return_values);
+        val_performance_save_info(PERF_DESCRIBE_FAST_CH_SUPPORT, 0x00,
+                                  (status != SCMI_NOT_FOUND));
+
+        for (i = 0; i < NUM_ELEMS(fast_ch_messages); i++) {
+            message_id = fast_ch_messages[i];
+            if (val_discovery_send(PROTOCOL_PERFORMANCE, PERFORMANCE_PROTOCOL_MESSAGE_ATTRIBUTES,
+                                   1, &message_id, NULL, return_values))
+                return VAL_STATUS_FAIL;
+
+            val_performance_save_info(PERF_MESSAGE_FAST_CH_SUPPORT, message_id,
+                                      VAL_EXTRACT_BITS(return_values[ATTRIBUTE_OFFSET], 0, 0));
+        }
+    }
+
+    for (domain_id = 0; domain_id < num_domains; domain_id++) {
+        if (val_discovery_send(PROTOCOL_PERFORMANCE, PERFORMANCE_DOMAIN_ATTRIBUTES, 1, &domain_id,
+                               NULL, return_values))
+            return VAL_STATUS_FAIL;
+
+        attribute = return_values[ATTRIBUTE_OFFSET];
+        val_performance_save_info(PERF_DOMAIN_SET_PERFORMANCE_LIMIT_SUPPORT, domain_id,
+                                  VAL_EXTRACT_BITS(attribute, 31, 31));
+        val_performance_save_info(PERF_DOMAIN_SET_PERFORMANCE_LEVEL_SUPPORT, domain_id,
+                                  VAL_EXTRACT_BITS(attribute, 30, 30));
+        val_performance_save_info(PERF_DOMAIN_LIMIT_CHANGE_NTFY_SUPPORT, domain_id,
+                                  VAL_EXTRACT_BITS(attribute, 29, 29));
+        val_performance_save_info(PERF_DOMAIN_LVL_CHANGE_NTFY_SUPPORT, domain_id,
+                                  VAL_EXTRACT_BITS(attribute, 28, 28));
+        /* Reserved in version 1 */
+        if (version == PROTOCOL_VERSION_2)
+            val_performance_save_info(PERF_DOMAIN_FAST_CH_SUPPORT, domain_id,
+                                      VAL_EXTRACT_BITS(attribute, 27, 27));
+
+        if (val_performance_discover_levels(domain_id, levels) != VAL_STATUS_PASS)
+            return VAL_STATUS_FAIL;
+    }
+
+    return VAL_STATUS_PASS;
+}
 
 /**
   @brief   This API is called from app layer to execute performance tests
@@ -35,6 +163,10 @@ uint32_t val_performance_execute_tests(void)
     if (val_agent_check_protocol_support(PROTOCOL_PERFORMANCE)) {
         if (RUN_TEST(performance_query_protocol_version(&version)))
             return VAL_STATUS_FAIL;
+        val_registry_set_version(PROTOCOL_PERFORMANCE, version);
+
+        val_discovery_run(PROTOCOL_PERFORMANCE, version, &g_performance_info_table,
+                          sizeof(g_performance_info_table), val_performance_discover);
 
         RUN_TEST(performance_query_protocol_attributes());
 
@@ -112,6 +244,9 @@ void val_performance_save_info(uint32_t param_identifier, uint32_t perf_id, uint
     case PERF_STATS_ADDR_LEN:
         g_performance_info_table.perf_stats_addr_len = param_value;
         break;
+    case PERF_DESCRIBE_FAST_CH_SUPPORT:
+        g_performance_info_table.describe_fast_ch_support = param_value;
+        break;
     case PERF_DOMAIN_FAST_CH_SUPPORT:
         g_performance_info_table.perf_domain_info[perf_id].fast_ch_support = param_value;
         break;
@@ -194,6 +329,9 @@ uint32_t val_performance_get_info(uint32_t param_identifier, uint32_t perf_id)
     case PERF_STATS_ADDR_LEN:
         param_value =  g_performance_info_table.perf_stats_addr_len;
         break;
+    case PERF_DESCRIBE_FAST_CH_SUPPORT:
+        param_value = g_performance_info_table.describe_fast_ch_support;
+        break;
     case PERF_DOMAIN_FAST_CH_SUPPORT:
         param_value = g_performance_info_table.perf_domain_info[perf_id].fast_ch_support;
         break;
@@ -19,7 +19,33 @@
 #include "val_interface.h"
 #include "val_power_domain.h"
 
-static POWER_DOMAIN_INFO_s g_power_domain_info_table;
+static VAL_THREAD_LOCAL POWER_DOMAIN_INFO_s g_power_domain_info_table;
+
+/**
+  @brief   This function walks the power domain protocol and fills its info
+           table, see val_discovery_run()
+           1. Caller       -  VAL.
+  @param   version  protocol version
+  @return  VAL_STATUS_PASS, VAL_STATUS_FAIL if a command failed
+**/
+static uint32_t val_power_domain_discover(uint32_t version)
+{
+    uint32_t return_values[MAX_RETURNS_SIZE];
+
+    (void)version;
+
+    if (val_discovery_send(PROTOCOL_POWER_DOMAIN, PD_PROTOCOL_ATTRIBUTES, 0, NULL, NULL,
+                           return_values))
+        return VAL_STATUS_FAIL;
+
+    val_power_domain_save_info(NUM_POWER_DOMAIN, 0x00,
+                               VAL_EXTRACT_BITS(return_values[ATTRIBUTE_OFFSET], 0, 15));
+    val_power_domain_save_info(PD_STATS_ADDR_LOW, 0x00, return_values[STATS_ADDR_LOW_OFFSET]);
+    val_power_domain_save_info(PD_STATS_ADDR_HIGH, 0x00, return_values[STATS_ADDR_HIGH_OFFSET]);
+    val_power_domain_save_info(PD_STATS_ADDR_LEN, 0x00, return_values[STATS_LENGTH_OFFSET]);
+
+    return VAL_STATUS_PASS;
+}
 
 /**
   @brief   This API is called from app layer to execute power domain tests
@@ -35,6 +61,10 @@ uint32_t val_power_domain_execute_tests(void)
     if (val_agent_check_protocol_support(PROTOCOL_POWER_DOMAIN)) {
         if (RUN_TEST(power_domain_query_protocol_version(&version)))
             return VAL_STATUS_FAIL;
+        val_registry_set_version(PROTOCOL_POWER_DOMAIN, version);
+
+        val_discovery_run(PROTOCOL_POWER_DOMAIN, version, &g_power_domain_info_table,
+                          sizeof(g_power_domain_info_table), val_power_domain_discover);
 
         RUN_TEST(power_domain_query_protocol_attributes());
         RUN_TEST(power_domain_query_mandatory_command_support());
@@ -0,0 +1,337 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interface.h"
+
+/* Bounds of VAL_REGISTRY_SECTION, weak as an agent may link no test at all */
+extern const VAL_TEST_s __start_val_test_registry[] __attribute__((weak));
+extern const VAL_TEST_s __stop_val_test_registry[] __attribute__((weak));
+
+/* What val_test_initialize() does with each test, set before the suites run */
+static uint8_t g_registry_state[VAL_MAX_TEST_NUM];
+static uint32_t g_registry_filtered;
+
+/* Version of each protocol, set by its suite once queried, 0 until then */
+static uint32_t g_registry_version[PROTOCOL_MAX - PROTOCOL_BASE];
+
+/**
+  @brief   This function matches a test number against a glob pattern, '*'
+           standing for any digits and '?' for a single digit
+           1. Caller       -  VAL.
+  @param   pattern  pattern, up to its end or a ','
+  @param   digits   decimal test number, NUL terminated
+  @return  1 if the number matches
+**/
+static uint32_t val_registry_glob(const char *pattern, const char *digits)
+{
+    if ((*pattern == '\0') || (*pattern == ','))
+        return (*digits == '\0');
+
+    if (*pattern == '*')
+        return val_registry_glob(pattern + 1, digits) ||
+               ((*digits != '\0') && val_registry_glob(pattern, digits + 1));
+
+    if ((*digits != '\0') && ((*pattern == '?') || (*pattern == *digits)))
+        return val_registry_glob(pattern + 1, digits + 1);
+
+    return 0;
+}
+
+/**
+  @brief   This function parses a decimal number
+           1. Caller       -  VAL.
+  @param   string  text, updated past the number
+  @param   value   storage for the number
+  @return  VAL_STATUS_PASS, VAL_STATUS_FAIL if there is no number
+**/
+static uint32_t val_registry_number(const char **string, uint32_t *value)
+{
+    const char *start = *string;
+
+    *value = 0;
+    while ((**string >= '0') && (**string <= '9'))
+        *value = (*value * 10) + (*(*string)++ - '0');
+
+    return (*string != start) ? VAL_STATUS_PASS : VAL_STATUS_FAIL;
+}
+
+/**
+  @brief   This function matches a test number against a filter
+           1. Caller       -  VAL.
+  @param   filter    comma separated numbers, ranges such as 501-510 and
+                     globs such as 6* or 40?
+  @param   test_num  test number
+  @param   match     storage for 1 if the number is matched
+  @return  VAL_STATUS_PASS, VAL_STATUS_FAIL if the filter is malformed
+**/
+static uint32_t val_registry_match(const char *filter, uint32_t test_num, uint32_t *match)
+{
+    char digits[12];
+    const char *item = filter;
+    const char *end;
+    const char *next;
+    uint32_t first, last;
+    uint32_t length = 0;
+    uint32_t value;
+    uint32_t glob;
+
+    for (value = test_num; (value != 0) || (length == 0); value /= 10)
+        length++;
+    digits[length] = '\0';
+    for (value = test_num; length > 0; value /= 10)
+        digits[--length] = '0' + (value % 10);
+
+    *match = 0;
+    while (1) {
+        glob = 0;
+        for (end = item; (*end != '\0') && (*end != ','); end++)
+            glob |= ((*end == '*') || (*end == '?'));
+
+        if (glob) {
+            *match |= val_registry_glob(item, digits);
+        } else {
+            next = item;
+            if (val_registry_number(&next, &first) != VAL_STATUS_PASS)
+                return VAL_STATUS_FAIL;
+
+            last = first;
+            if (*next == '-') {
+                next++;
+                if (val_registry_number(&next, &last) != VAL_STATUS_PASS)
+                    return VAL_STATUS_FAIL;
+            }
+
+            if (next != end)
+                return VAL_STATUS_FAIL;
+
+            *match |= ((test_num >= first) && (test_num <= last));
+        }
+
+        if (*end == '\0')
+            return VAL_STATUS_PASS;
+        item = end + 1;
+    }
+}
+
+/**
+  @brief   This API selects the tests to run, before the suites run. Tests
+           needed by a selected test, transitively, run without being
+           reported. Shards split the selected tests by their rank in test
+           number order, so every board of a rig gets a disjoint share.
+           1. Caller       -  App layer.
+  @param   filter       tests to run, see val_registry_match(), NULL for all
+  @param   shard_index  shard run by this agent, below shard_count
+  @param   shard_count  number of shards, 0 or 1 for no sharding
+  @return  VAL_STATUS_PASS, VAL_STATUS_FAIL if the filter or shard is malformed
+**/
+uint32_t val_registry_select(const char *filter, uint32_t shard_index, uint32_t shard_count)
+{
+    const VAL_TEST_s *test;
+    uint32_t rank = 0;
+    uint32_t changed;
+    uint32_t match;
+    uint32_t i;
+
+    if (shard_count == 0)
+        shard_count = 1;
+    if (shard_index >= shard_count)
+        return VAL_STATUS_FAIL;
+
+    val_memset(g_registry_state, VAL_TEST_SKIPPED, sizeof(g_registry_state));
+
+    for (test = __start_val_test_registry; test < __stop_val_test_registry; test++) {
+        if (test->test_num >= VAL_MAX_TEST_NUM)
+            continue;
+
+        match = 1;
+        if ((filter != NULL) &&
+            (val_registry_match(filter, test->test_num, &match) != VAL_STATUS_PASS))
+            return VAL_STATUS_FAIL;
+
+        if (match)
+            g_registry_state[test->test_num] = VAL_TEST_SELECTED;
+    }
+
+    /* Versions of a test share its number, rank the numbers rather than the descriptors */
+    for (i = 0; i < VAL_MAX_TEST_NUM; i++) {
+        if (g_registry_state[i] != VAL_TEST_SELECTED)
+            continue;
+
+        if ((rank++ % shard_count) != shard_index)
+            g_registry_state[i] = VAL_TEST_SKIPPED;
+    }
+
+    do {
+        changed = 0;
+        for (test = __start_val_test_registry; test < __stop_val_test_registry; test++) {
+            if ((test->test_num >= VAL_MAX_TEST_NUM) ||
+                (g_registry_state[test->test_num] == VAL_TEST_SKIPPED))
+                continue;
+
+            for (i = 0; (i < VAL_REGISTRY_MAX_DEPS) && (test->deps[i] != 0); i++) {
+                if ((test->deps[i] < VAL_MAX_TEST_NUM) &&
+                    (g_registry_state[test->deps[i]] == VAL_TEST_SKIPPED)) {
+                    g_registry_state[test->deps[i]] = VAL_TEST_QUIET;
+                    changed = 1;
+                }
+            }
+        }
+    } while (changed);
+
+    g_registry_filtered = 1;
+    return VAL_STATUS_PASS;
+}
+
+/**
+  @brief   This API returns what to do with a test
+           1. Caller       -  VAL.
+  @param   test_num  test number
+  @return  VAL_TEST_SELECTED, VAL_TEST_QUIET or VAL_TEST_SKIPPED
+**/
+uint32_t val_registry_test_state(uint32_t test_num)
+{
+    if (!g_registry_filtered || (test_num >= VAL_MAX_TEST_NUM))
+        return VAL_TEST_SELECTED;
+
+    return g_registry_state[test_num];
+}
+
+/**
+  @brief   This API tells whether any test of a protocol runs, suites with
+           none are not dispatched
+           1. Caller       -  App layer.
+  @param   protocol_id  protocol identifier
+  @return  1 if a test of the protocol runs
+**/
+uint32_t val_registry_protocol_enabled(uint32_t protocol_id)
+{
+    const VAL_TEST_s *test;
+
+    if (!g_registry_filtered)
+        return 1;
+
+    for (test = __start_val_test_registry; test < __stop_val_test_registry; test++) {
+        if ((test->protocol_id == protocol_id) &&
+            (val_registry_test_state(test->test_num) != VAL_TEST_SKIPPED))
+            return 1;
+    }
+
+    return 0;
+}
+
+/**
+  @brief   This API records the version of a protocol, the tests of the
+           protocol then only run when their version bounds admit it
+           1. Caller       -  Protocol suites, once the version is known.
+  @param   protocol_id  protocol identifier
+  @param   version      protocol version
+  @return  none
+**/
+void val_registry_set_version(uint32_t protocol_id, uint32_t version)
+{
+    if ((protocol_id < PROTOCOL_BASE) || (protocol_id >= PROTOCOL_MAX))
+        return;
+
+    g_registry_version[protocol_id - PROTOCOL_BASE] = version;
+}
+
+/**
+  @brief   This API tells whether a test runs on the version of its protocol.
+           Only the major versions are compared, and a test of a protocol
+           whose version is not known yet runs.
+           1. Caller       -  VAL.
+  @param   test_num  test number
+  @return  1 if a version of the test admits the protocol version
+**/
+uint32_t val_registry_version_supported(uint32_t test_num)
+{
+    const VAL_TEST_s *test;
+    uint32_t registered = 0;
+    uint32_t major;
+
+    for (test = __start_val_test_registry; test < __stop_val_test_registry; test++) {
+        if (test->test_num != test_num)
+            continue;
+
+        registered = 1;
+        if ((test->protocol_id < PROTOCOL_BASE) || (test->protocol_id >= PROTOCOL_MAX))
+            return 1;
+
+        major = g_registry_version[test->protocol_id - PROTOCOL_BASE] >> 16;
+        if ((major == 0) ||
+            (((test->min_version == VAL_VERSION_ANY) || (major >= (test->min_version >> 16))) &&
+             ((test->max_version == VAL_VERSION_ANY) || (major <= (test->max_version >> 16)))))
+            return 1;
+    }
+
+    return !registered;
+}
+
+/**
+  @brief   This function returns the protocol versions a test runs on
+           1. Caller       -  VAL.
+  @param   test  test descriptor
+  @return  versions, such as "any", "v2+" or "v1"
+**/
+static const char *val_registry_versions(const VAL_TEST_s *test)
+{
+    static const char * const names[] = { "any", "v1+", "v2+", "v1", "v2" };
+
+    if (test->max_version != VAL_VERSION_ANY)
+        return (test->max_version == PROTOCOL_VERSION_1) ? names[3] : names[4];
+    if (test->min_version == PROTOCOL_VERSION_2)
+        return names[2];
+    if (test->min_version == PROTOCOL_VERSION_1)
+        return names[1];
+
+    return names[0];
+}
+
+/**
+  @brief   This API prints the tests that run, in test number order, with
+           their version bounds and dependencies
+           1. Caller       -  App layer.
+  @param   none
+  @return  none
+**/
+void val_registry_list(void)
+{
+    const VAL_TEST_s *test;
+    uint32_t test_num;
+    uint32_t state;
+    uint32_t i;
+
+    val_print(VAL_PRINT_ERR, "\n  TEST  VERSIONS  RUN       DESCRIPTION                                   DEPS");
+
+    for (test_num = 0; test_num < VAL_MAX_TEST_NUM; test_num++) {
+        state = val_registry_test_state(test_num);
+        if (state == VAL_TEST_SKIPPED)
+            continue;
+
+        for (test = __start_val_test_registry; test < __stop_val_test_registry; test++) {
+            if (test->test_num != test_num)
+                continue;
+
+            val_print(VAL_PRINT_ERR, "\n  %4d  %-8s  %-8s  %s", test_num,
+                      val_registry_versions(test),
+                      (state == VAL_TEST_QUIET) ? "needed" : "selected", test->description);
+            for (i = 0; (i < VAL_REGISTRY_MAX_DEPS) && (test->deps[i] != 0); i++)
+                val_print(VAL_PRINT_ERR, " %d", test->deps[i]);
+        }
+    }
+    val_print(VAL_PRINT_ERR, "\n");
+}
@@ -19,7 +19,44 @@
 #include "val_interface.h"
 #include "val_reset.h"
 
-static RESET_INFO_s g_reset_info_table;
+static VAL_THREAD_LOCAL RESET_INFO_s g_reset_info_table;
+
+/**
+  @brief   This function walks the reset protocol and fills its info table,
+           see val_discovery_run()
+           1. Caller       -  VAL.
+  @param   version  protocol version
+  @return  VAL_STATUS_PASS, VAL_STATUS_FAIL if a command failed
+**/
+static uint32_t val_reset_discover(uint32_t version)
+{
+    uint32_t return_values[MAX_RETURNS_SIZE];
+    uint32_t domain_id, num_domains;
+
+    (void)version;
+
+    if (val_discovery_send(PROTOCOL_RESET, RESET_PROTOCOL_ATTRIBUTES, 0, NULL, NULL, return_values))
+        return VAL_STATUS_FAIL;
+
+    num_domains = VAL_EXTRACT_BITS(return_values[ATTRIBUTE_OFFSET], 0, 15);
+    if (num_domains > MAX_NUM_OF_DOMAINS)
+        return VAL_STATUS_FAIL;
+
+    val_reset_save_info(NUM_RESET_DOMAINS, 0x00, num_domains);
+
+    for (domain_id = 0; domain_id < num_domains; domain_id++) {
+        if (val_discovery_send(PROTOCOL_RESET, RESET_DOMAIN_ATTRIBUTES, 1, &domain_id,
+                               NULL, return_values))
+            return VAL_STATUS_FAIL;
+
+        val_reset_save_info(RESET_ASYNC_SUPPORT, domain_id,
+                            VAL_EXTRACT_BITS(return_values[ATTRIBUTE_OFFSET], 31, 31));
+        val_reset_save_info(RESET_NOTIFY_SUPPORT, domain_id,
+                            VAL_EXTRACT_BITS(return_values[ATTRIBUTE_OFFSET], 30, 30));
+    }
+
+    return VAL_STATUS_PASS;
+}
 
 /**
   @brief   This API is called from app layer to execute reset domain tests
@@ -35,6 +72,10 @@ uint32_t val_reset_execute_tests(void)
     if (val_agent_check_protocol_support(PROTOCOL_RESET)) {
         if (RUN_TEST(reset_query_protocol_version(&version)))
             return VAL_STATUS_FAIL;
+        val_registry_set_version(PROTOCOL_RESET, version);
+
+        val_discovery_run(PROTOCOL_RESET, version, &g_reset_info_table,
+                          sizeof(g_reset_info_table), val_reset_discover);
 
         RUN_TEST(reset_query_protocol_attributes());
         RUN_TEST(reset_query_mandatory_command_support());
@@ -19,7 +19,66 @@
 #include "val_interface.h"
 #include "val_sensor.h"
 
-static SENSOR_INFO_s g_sensor_info_table;
+static VAL_THREAD_LOCAL SENSOR_INFO_s g_sensor_info_table;
+
+/**
+  @brief   This function walks the sensor protocol and fills its info table,
+           see val_discovery_run()
+           1. Caller       -  VAL.
+  @param   version  protocol version
+  @return  VAL_STATUS_PASS, VAL_STATUS_FAIL if a command failed
+**/
+static uint32_t val_sensor_discover(uint32_t version)
+{
+    uint32_t return_values[MAX_RETURNS_SIZE];
+    uint32_t *descriptors = val_buffer_get();
+    size_t   return_value_count;
+    uint32_t num_returned, num_remaining, sensor_id, i;
+    uint32_t desc_index = 0;
+    uint32_t *sensor_desc;
+
+    (void)version;
+
+    if (descriptors == NULL)
+        return VAL_STATUS_FAIL;
+    sensor_desc = &descriptors[DESC_OFFSET];
+
+    if (val_discovery_send(PROTOCOL_SENSOR, SENSOR_PROTOCOL_ATTRIBUTES, 0, NULL, NULL,
+                           return_values))
+        return VAL_STATUS_FAIL;
+
+    val_sensor_save_info(NUM_SENSORS, VAL_EXTRACT_BITS(return_values[ATTRIBUTE_OFFSET], 0, 15));
+    val_sensor_save_info(SENSOR_STATS_ADDR_LOW, return_values[REG_ADDR_LOW_OFFSET]);
+    val_sensor_save_info(SENSOR_STATS_ADDR_HIGH, return_values[REG_ADDR_HIGH_OFFSET]);
+    val_sensor_save_info(SENSOR_STATS_ADDR_LEN, return_values[REG_LENGTH_OFFSET]);
+
+    do {
+        if (val_discovery_send(PROTOCOL_SENSOR, SENSOR_DESCRIPTION_GET, 1, &desc_index,
+                               &return_value_count, descriptors))
+            return VAL_STATUS_FAIL;
+
+        /* The descriptors announced must all have been received */
+        num_remaining = VAL_EXTRACT_BITS(descriptors[NUM_SENSOR_FLAG_OFFSET], 16, 31);
+        num_returned = VAL_EXTRACT_BITS(descriptors[NUM_SENSOR_FLAG_OFFSET], 0, 11);
+        if ((num_returned == 0) ||
+            (return_value_count < DESC_OFFSET + (num_returned * SENSOR_DESC_LEN)))
+            return VAL_STATUS_FAIL;
+
+        for (i = 0; i < num_returned; i++) {
+            sensor_id = sensor_desc[i * SENSOR_DESC_LEN];
+            if (sensor_id >= MAX_NUM_OF_SENSORS)
+                return VAL_STATUS_FAIL;
+
+            val_sensor_save_desc_info(SENSOR_NUM_OF_TRIP_POINTS, sensor_id,
+                VAL_EXTRACT_BITS(sensor_desc[1 + (i * SENSOR_DESC_LEN)], 0, 7));
+            val_sensor_save_desc_info(SENSOR_ASYNC_READ_SUPPORT, sensor_id,
+                VAL_EXTRACT_BITS(sensor_desc[1 + (i * SENSOR_DESC_LEN)], 31, 31));
+        }
+        desc_index += num_returned;
+    } while (num_remaining > 0);
+
+    return VAL_STATUS_PASS;
+}
 
 /**
   @brief   This API is called from app layer to execute sensor domain tests
@@ -35,6 +94,10 @@ uint32_t val_sensor_execute_tests(void)
     if (val_agent_check_protocol_support(PROTOCOL_SENSOR)) {
         if (RUN_TEST(sensor_query_protocol_version(&version)))
             return VAL_STATUS_FAIL;
+        val_registry_set_version(PROTOCOL_SENSOR, version);
+
+        val_discovery_run(PROTOCOL_SENSOR, version, &g_sensor_info_table,
+                          sizeof(g_sensor_info_table), val_sensor_discover);
 
         RUN_TEST(sensor_query_protocol_attributes());
         RUN_TEST(sensor_query_mandatory_command_support());
@@ -0,0 +1,426 @@
+/** @file
+ * Copyright (c) 2020, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interface.h"
+
+/* Samples kept until they are exported, power of 2 */
+#ifndef VAL_STATS_RING_SIZE
+#define VAL_STATS_RING_SIZE        8192
+#endif
+
+/* Larger regions are read up to this size */
+#define VAL_STATS_MAX_REGION_SIZE  4096
+#define VAL_STATS_MAX_SAMPLES      (VAL_STATS_MAX_REGION_SIZE / sizeof(VAL_STATS_ENTRY_s))
+#define VAL_STATS_READ_RETRIES     8
+
+/* Where PROTOCOL_ATTRIBUTES of a protocol returns its region */
+typedef struct {
+    uint32_t protocol_id;
+    uint32_t signature;
+    uint32_t message_id;
+    uint32_t address_low;
+    uint32_t address_high;
+    uint32_t length;
+} VAL_STATS_PROTOCOL_s;
+
+typedef struct {
+    const volatile uint32_t *base;  /* mapping of the region, NULL if it is not open */
+    uint32_t size;                  /* bytes read, a multiple of 4 */
+    uint64_t snapshot[VAL_STATS_MAX_REGION_SIZE / sizeof(uint64_t)];
+} VAL_STATS_REGION_s;
+
+static const VAL_STATS_PROTOCOL_s g_stats_protocols[] = {
+    {PROTOCOL_POWER_DOMAIN, VAL_STATS_SIGNATURE_POWER,
+     SCMI_POWER_DOMAIN_PROTOCOL_ATTRIBUTES_MSG_ID,
+     SCMI_POWER_DOMAIN_PROTOCOL_ATTRIBUTES_RET_STATISTICS_ADDRESS_LOW,
+     SCMI_POWER_DOMAIN_PROTOCOL_ATTRIBUTES_RET_STATISTICS_ADDRESS_HIGH,
+     SCMI_POWER_DOMAIN_PROTOCOL_ATTRIBUTES_RET_STATISTICS_LEN},
+    {PROTOCOL_PERFORMANCE, VAL_STATS_SIGNATURE_PERF,
+     SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_MSG_ID,
+     SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_RET_STATISTICS_ADDRESS_LOW,
+     SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_RET_STATISTICS_ADDRESS_HIGH,
+     SCMI_PERFORMANCE_PROTOCOL_ATTRIBUTES_RET_STATISTICS_LEN},
+    {PROTOCOL_SENSOR, VAL_STATS_SIGNATURE_SENSOR,
+     SCMI_SENSOR_PROTOCOL_ATTRIBUTES_MSG_ID,
+     SCMI_SENSOR_PROTOCOL_ATTRIBUTES_RET_SENSOR_REG_ADDRESS_LOW,
+     SCMI_SENSOR_PROTOCOL_ATTRIBUTES_RET_SENSOR_REG_ADDRESS_HIGH,
+     SCMI_SENSOR_PROTOCOL_ATTRIBUTES_RET_SENSOR_REG_LEN},
+};
+
+static VAL_STATS_REGION_s g_stats_regions[NUM_ELEMS(g_stats_protocols)];
+
+/* Samples of the sampler, written at head and exported from tail */
+static VAL_STATS_SAMPLE_s g_stats_ring[VAL_STATS_RING_SIZE];
+static uint32_t g_stats_head;
+static uint32_t g_stats_tail;
+
+/* Samples parsed from one region, by the sampler or by val_stats_read() */
+static VAL_STATS_SAMPLE_s g_stats_scratch[VAL_STATS_MAX_SAMPLES];
+
+static uint32_t g_stats_rate_hz;
+static uint64_t g_stats_num_samples;
+static uint32_t g_stats_num_torn;   /* copies the platform kept updating */
+
+/**
+  @brief   This function returns the index of a protocol with a statistics
+           region
+           1. Caller       -  VAL.
+  @param   protocol_id  protocol identifier
+  @return  index into g_stats_protocols, NUM_ELEMS(g_stats_protocols) if none
+**/
+static uint32_t val_stats_index(uint32_t protocol_id)
+{
+    uint32_t i;
+
+    for (i = 0; i < NUM_ELEMS(g_stats_protocols); i++) {
+        if (g_stats_protocols[i].protocol_id == protocol_id)
+            break;
+    }
+
+    return i;
+}
+
+/**
+  @brief   This function copies a region into its snapshot. The copy is
+           retried while the platform updates the region, see match.
+           1. Caller       -  VAL.
+  @param   region  open region
+  @return  VAL_STATUS_PASS, VAL_STATUS_FAIL if no consistent copy was made
+**/
+static uint32_t val_stats_snapshot(VAL_STATS_REGION_s *region)
+{
+    const volatile uint32_t *match = &region->base[offsetof(VAL_STATS_HEADER_s, match) / 4];
+    uint32_t *snapshot = (uint32_t *)region->snapshot;
+    uint32_t before, retry, i;
+
+    for (retry = 0; retry < VAL_STATS_READ_RETRIES; retry++) {
+        before = __atomic_load_n(match, __ATOMIC_ACQUIRE);
+        if (before & 1)
+            continue;
+
+        for (i = 0; i < region->size / 4; i++)
+            snapshot[i] = region->base[i];
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE); /* The copy is read before match again */
+        if (*match == before)
+            return VAL_STATUS_PASS;
+    }
+
+    g_stats_num_torn++;
+    return VAL_STATUS_FAIL;
+}
+
+/**
+  @brief   This function turns the snapshot of a region into one sample per
+           entry of each domain. Offsets and counts are checked against the
+           size of the region.
+           1. Caller       -  VAL.
+  @param   protocol  protocol of the region
+  @param   region    region with a snapshot
+  @param   time_ns   time the snapshot was taken
+  @param   samples      storage for the samples
+  @param   max_samples  number of samples the storage holds
+  @param   num_samples  storage for the number of samples
+  @return  status, fail if the region is not laid out as expected
+**/
+static uint32_t val_stats_parse(const VAL_STATS_PROTOCOL_s *protocol,
+                                const VAL_STATS_REGION_s *region, uint64_t time_ns,
+                                VAL_STATS_SAMPLE_s *samples, uint32_t max_samples,
+                                uint32_t *num_samples)
+{
+    const uint8_t *base = (const uint8_t *)region->snapshot;
+    const VAL_STATS_HEADER_s *header = (const VAL_STATS_HEADER_s *)base;
+    const uint32_t *domain_offset = (const uint32_t *)(header + 1);
+    const VAL_STATS_DOMAIN_s *domain;
+    const VAL_STATS_ENTRY_s *entry;
+    uint32_t domain_id, i;
+
+    *num_samples = 0;
+
+    if ((region->size < sizeof(*header)) || (header->signature != protocol->signature) ||
+        (sizeof(*header) + (header->num_domains * sizeof(uint32_t)) > region->size))
+        return VAL_STATUS_FAIL;
+
+    /* Only the suite defined layout has a revision to check */
+    if ((protocol->signature == VAL_STATS_SIGNATURE_SENSOR) &&
+        (header->revision != VAL_STATS_SENSOR_REVISION))
+        return VAL_STATUS_FAIL;
+
+    for (domain_id = 0; domain_id < header->num_domains; domain_id++) {
+        /* A domain without statistics */
+        if (domain_offset[domain_id] == 0)
+            continue;
+
+        if ((domain_offset[domain_id] % sizeof(uint64_t)) ||
+            (domain_offset[domain_id] + sizeof(*domain) > region->size))
+            return VAL_STATUS_FAIL;
+
+        domain = (const VAL_STATS_DOMAIN_s *)(base + domain_offset[domain_id]);
+        if (domain_offset[domain_id] + sizeof(*domain) + (domain->num_entries * sizeof(*entry)) >
+            region->size)
+            return VAL_STATUS_FAIL;
+
+        entry = (const VAL_STATS_ENTRY_s *)(domain + 1);
+        for (i = 0; (i < domain->num_entries) && (*num_samples < max_samples); i++) {
+            samples->time_ns = time_ns;
+            samples->last_change_us = domain->last_change_us;
+            samples->count = entry[i].count;
+            samples->value = entry[i].value;
+            samples->index = i;
+            samples->domain_id = domain_id;
+            samples->protocol_id = protocol->protocol_id;
+            samples->current = (domain->current == i);
+            samples++;
+            (*num_samples)++;
+        }
+    }
+
+    return VAL_STATUS_PASS;
+}
+
+/**
+  @brief   This API maps the statistics region of a protocol, at the address
+           its PROTOCOL_ATTRIBUTES returns, and checks its header
+           1. Caller       -  App layer, Test Suite.
+  @param   protocol_id  PROTOCOL_POWER_DOMAIN, _PERFORMANCE or _SENSOR
+  @return  status, skip when the platform has no region for the protocol
+**/
+uint32_t val_stats_open(uint32_t protocol_id)
+{
+    uint32_t index = val_stats_index(protocol_id);
+    const VAL_STATS_PROTOCOL_s *protocol;
+    VAL_STATS_REGION_s *region;
+    uint32_t return_values[MAX_RETURNS_SIZE];
+    size_t return_value_count;
+    uint32_t num_samples;
+    uint64_t address;
+    uint32_t length;
+
+    if (index == NUM_ELEMS(g_stats_protocols))
+        return VAL_STATUS_SKIP;
+
+    protocol = &g_stats_protocols[index];
+    region = &g_stats_regions[index];
+    if (region->base != NULL)
+        return VAL_STATUS_PASS;
+
+    if ((val_discovery_send(protocol_id, protocol->message_id, 0, NULL, &return_value_count,
+                            return_values) != SCMI_SUCCESS) ||
+        (return_value_count <= protocol->length))
+        return VAL_STATUS_SKIP;
+
+    address = VAL_GET_64BIT_DATA(return_values[protocol->address_high],
+                                 return_values[protocol->address_low]);
+    length = return_values[protocol->length];
+    if ((address == 0) || (length < sizeof(VAL_STATS_HEADER_s)))
+        return VAL_STATUS_SKIP;
+
+    if (length > VAL_STATS_MAX_REGION_SIZE)
+        length = VAL_STATS_MAX_REGION_SIZE;
+
+    region->base = pal_stats_map(address, length);
+    if (region->base == NULL) {
+        val_print(VAL_PRINT_ERR, "\n       STATS MAP FAILED   : 0x%08x%08x",
+                  return_values[protocol->address_high], return_values[protocol->address_low]);
+        return VAL_STATUS_FAIL;
+    }
+
+    region->size = length & ~3u;
+    if ((val_stats_snapshot(region) != VAL_STATUS_PASS) ||
+        (val_stats_parse(protocol, region, 0, NULL, 0, &num_samples) != VAL_STATUS_PASS)) {
+        val_print(VAL_PRINT_ERR, "\n       STATS REGION INVALID: protocol 0x%x", protocol_id);
+        val_stats_close(protocol_id);
+        return VAL_STATUS_FAIL;
+    }
+
+    return VAL_STATUS_PASS;
+}
+
+/**
+  @brief   This API unmaps the statistics region of a protocol
+           1. Caller       -  App layer, Test Suite.
+  @param   protocol_id  protocol identifier
+  @return  none
+**/
+void val_stats_close(uint32_t protocol_id)
+{
+    uint32_t index = val_stats_index(protocol_id);
+
+    if ((index == NUM_ELEMS(g_stats_protocols)) || (g_stats_regions[index].base == NULL))
+        return;
+
+    pal_stats_unmap((void *)g_stats_regions[index].base, g_stats_regions[index].size);
+    g_stats_regions[index].base = NULL;
+}
+
+/**
+  @brief   This API reads the counters of an open region, without sending any
+           command. Not to be called while the sampler runs.
+           1. Caller       -  App layer, Test Suite.
+  @param   protocol_id  protocol identifier
+  @param   samples      storage for one sample per entry of each domain
+  @param   max_samples  number of samples the storage holds
+  @return  number of samples, 0 if the region is not open, is invalid or
+           kept changing while it was read
+**/
+uint32_t val_stats_read(uint32_t protocol_id, VAL_STATS_SAMPLE_s *samples, uint32_t max_samples)
+{
+    uint32_t index = val_stats_index(protocol_id);
+    VAL_STATS_REGION_s *region;
+    uint32_t num_samples;
+
+    if (index == NUM_ELEMS(g_stats_protocols))
+        return 0;
+
+    region = &g_stats_regions[index];
+    if ((region->base == NULL) || (val_stats_snapshot(region) != VAL_STATUS_PASS))
+        return 0;
+
+    if (val_stats_parse(&g_stats_protocols[index], region, pal_get_time_ns(), samples,
+                        max_samples, &num_samples) != VAL_STATUS_PASS)
+        return 0;
+
+    return num_samples;
+}
+
+/**
+  @brief   This function hands the samples of the ring to the PAL export
+           1. Caller       -  VAL.
+  @param   none
+  @return  none
+**/
+static void val_stats_flush(void)
+{
+    uint32_t start, count;
+
+    while (g_stats_tail != g_stats_head) {
+        start = g_stats_tail % VAL_STATS_RING_SIZE;
+        count = g_stats_head - g_stats_tail;
+        if (count > VAL_STATS_RING_SIZE - start)
+            count = VAL_STATS_RING_SIZE - start;
+
+        pal_stats_write(&g_stats_ring[start], count);
+        g_stats_tail += count;
+    }
+}
+
+/**
+  @brief   This function reads every open region into the ring, called on
+           each tick of the sampler. The ring is exported once half full,
+           so the sampler never waits for the export in the middle of a
+           region.
+           1. Caller       -  PAL sampler.
+  @param   none
+  @return  none
+**/
+static void val_stats_sample(void)
+{
+    uint32_t num_samples, index, i;
+
+    for (index = 0; index < NUM_ELEMS(g_stats_regions); index++) {
+        num_samples = val_stats_read(g_stats_protocols[index].protocol_id, g_stats_scratch,
+                                     VAL_STATS_MAX_SAMPLES);
+        for (i = 0; i < num_samples; i++) {
+            if (g_stats_head - g_stats_tail == VAL_STATS_RING_SIZE)
+                val_stats_flush();
+            g_stats_ring[g_stats_head++ % VAL_STATS_RING_SIZE] = g_stats_scratch[i];
+        }
+        g_stats_num_samples += num_samples;
+    }
+
+    if (g_stats_head - g_stats_tail >= VAL_STATS_RING_SIZE / 2)
+        val_stats_flush();
+}
+
+/**
+  @brief   This API opens the statistics regions of the platform and starts
+           reading them at a fixed rate, on a thread of the platform
+           1. Caller       -  App layer.
+  @param   rate_hz  reads per second
+  @return  status, skip when the platform has no statistics region
+**/
+uint32_t val_stats_start(uint32_t rate_hz)
+{
+    uint32_t num_open = 0;
+    uint32_t index;
+
+    if ((rate_hz == 0) || (rate_hz > VAL_STATS_MAX_RATE_HZ))
+        rate_hz = (rate_hz == 0) ? 1 : VAL_STATS_MAX_RATE_HZ;
+
+    for (index = 0; index < NUM_ELEMS(g_stats_protocols); index++) {
+        if (val_stats_open(g_stats_protocols[index].protocol_id) == VAL_STATUS_PASS)
+            num_open++;
+    }
+
+    if (num_open == 0) {
+        val_print(VAL_PRINT_WARN, "\n       No statistics region to sample");
+        return VAL_STATUS_SKIP;
+    }
+
+    g_stats_rate_hz = rate_hz;
+    g_stats_head = 0;
+    g_stats_tail = 0;
+    g_stats_num_samples = 0;
+    g_stats_num_torn = 0;
+    if (pal_stats_sampler_start(rate_hz, val_stats_sample) != PAL_STATUS_PASS) {
+        val_print(VAL_PRINT_ERR, "\n       STATS SAMPLER NOT AVAILABLE");
+        for (index = 0; index < NUM_ELEMS(g_stats_protocols); index++)
+            val_stats_close(g_stats_protocols[index].protocol_id);
+        g_stats_rate_hz = 0;
+        return VAL_STATUS_FAIL;
+    }
+
+    return VAL_STATUS_PASS;
+}
+
+/**
+  @brief   This API stops the sampler, exports the samples left in the ring
+           with a last read of each region, prints the final counters and
+           unmaps the regions
+           1. Caller       -  App layer.
+  @param   none
+  @return  none
+**/
+void val_stats_stop(void)
+{
+    uint32_t num_missed, num_samples, index, i;
+
+    if (g_stats_rate_hz == 0)
+        return;
+
+    num_missed = pal_stats_sampler_stop();
+    val_stats_sample();
+    val_stats_flush();
+
+    val_print(VAL_PRINT_ERR, "\n  STATISTICS  RATE: %u/s  SAMPLES: %u  TORN: %u  MISSED: %u",
+              g_stats_rate_hz, (uint32_t)g_stats_num_samples, g_stats_num_torn, num_missed);
+    val_print(VAL_PRINT_ERR, "\n  PROTOCOL DOMAIN        ENTRY      COUNT      VALUE");
+    for (index = 0; index < NUM_ELEMS(g_stats_protocols); index++) {
+        num_samples = val_stats_read(g_stats_protocols[index].protocol_id, g_stats_scratch,
+                                     VAL_STATS_MAX_SAMPLES);
+        for (i = 0; i < num_samples; i++)
+            val_print(VAL_PRINT_ERR, "\n      0x%02x %6u %12u %10u %10u%s",
+                      g_stats_scratch[i].protocol_id, g_stats_scratch[i].domain_id,
+                      g_stats_scratch[i].index, (uint32_t)g_stats_scratch[i].count,
+                      (uint32_t)g_stats_scratch[i].value,
+                      g_stats_scratch[i].current ? " *" : "");
+
+        val_stats_close(g_stats_protocols[index].protocol_id);
+    }
+
+    g_stats_rate_hz = 0;
+}
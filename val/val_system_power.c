@@ -19,7 +19,7 @@
 #include "val_interface.h"
 #include "val_system_power.h"
 
-static SYSTEM_POWER_INFO_s g_system_power_info_table;
+static VAL_THREAD_LOCAL SYSTEM_POWER_INFO_s g_system_power_info_table;
 
 /**
   @brief   This API is called from app layer to execute system power tests
@@ -35,6 +35,7 @@ uint32_t val_system_power_execute_tests(void)
     if (val_agent_check_protocol_support(PROTOCOL_SYSTEM_POWER)) {
         if (RUN_TEST(system_power_query_protocol_version(&version)))
             return VAL_STATUS_FAIL;
+        val_registry_set_version(PROTOCOL_SYSTEM_POWER, version);
 
         RUN_TEST(system_power_query_protocol_attributes());
         RUN_TEST(system_power_query_mandatory_command_support());